@@ -5,7 +5,7 @@
 #define MINT_CPP_HLSL_STRUCTURED_BUFFER_H
 
 
-#include <MintRenderingBase/Include/CppHlsl/CppHlslTypes.h>
+#include <MintCppHlsl/Include/CppHlslTypes.h>
 
 
 namespace mint
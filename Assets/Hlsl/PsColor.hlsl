@@ -1,10 +0,0 @@
-#include <ShaderStructDefinitions>
-#include <ShaderConstantBuffers>
-#include <ShaderStructuredBufferDefinitions>
-
-StructuredBuffer<SB_Material> sbMaterials : register(t1);
-
-float4 main(VS_OUTPUT input) : SV_TARGET
-{
-    return sbMaterials[input._materialId]._diffuseColor;
-}
@@ -1,9 +0,0 @@
-#include <ShaderStructDefinitions>
-#include <ShaderConstantBuffers>
-#include <ShaderStructuredBufferDefinitions>
-
-
-float4 main(VS_OUTPUT input) : SV_TARGET
-{
-    return input._texCoord;
-}
@@ -0,0 +1,102 @@
+﻿#include <MintContainer/Include/StringUtil.h>
+
+#include <MintPlatform/Include/AssetPack.h>
+
+#include <filesystem>
+#include <cstdio>
+
+
+// 파일과 폴더들을 AssetPack 으로 묶거나, AssetPack 의 Entry 목록을 출력한다.
+// 사용법: MintAssetPackTool pack <output.mpak> [--lz4] <input file | input directory>...
+//         MintAssetPackTool list <input.mpak>
+
+
+const char* getCompressionString(const mint::AssetPackCompression compression)
+{
+    switch (compression)
+    {
+    case mint::AssetPackCompression::None:
+        return "None";
+    case mint::AssetPackCompression::Lz4:
+        return "Lz4";
+    default:
+        break;
+    }
+    return "Unknown";
+}
+
+// 폴더는 그 폴더 기준 상대 경로로, 파일은 파일 이름으로 추가한다.
+int pack(const int argc, const char* const argv[])
+{
+    const char* const packFileName = argv[2];
+    mint::AssetPackCompression compression = mint::AssetPackCompression::None;
+    mint::AssetPackWriter assetPackWriter;
+    for (int32 argIndex = 3; argIndex < argc; ++argIndex)
+    {
+        const char* const input = argv[argIndex];
+        if (mint::StringUtil::strcmp(input, "--lz4") == true)
+        {
+            compression = mint::AssetPackCompression::Lz4;
+            continue;
+        }
+
+        std::error_code errorCode;
+        if (std::filesystem::is_directory(input, errorCode) == true)
+        {
+            assetPackWriter.addDirectory(input, compression);
+        }
+        else if (std::filesystem::is_regular_file(input, errorCode) == true)
+        {
+            const std::string path = std::filesystem::path(input).filename().generic_string();
+            assetPackWriter.addFile(path.c_str(), input, compression);
+        }
+        else
+        {
+            printf("[%s] 는 파일도 폴더도 아닙니다.\n", input);
+            return 1;
+        }
+    }
+
+    if (assetPackWriter.save(packFileName) == false)
+    {
+        printf("[%s] 파일을 저장하지 못했습니다.\n", packFileName);
+        return 1;
+    }
+    printf("[%s] 에 %u 개의 Entry 를 저장했습니다.\n", packFileName, assetPackWriter.getEntryCount());
+    return 0;
+}
+
+int list(const char* const packFileName)
+{
+    mint::AssetPackReader assetPackReader;
+    if (assetPackReader.open(packFileName) == false)
+    {
+        printf("[%s] 파일을 열지 못했습니다.\n", packFileName);
+        return 1;
+    }
+
+    const uint32 entryCount = assetPackReader.getEntryCount();
+    for (uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+    {
+        const mint::AssetPackEntry& entry = assetPackReader.getEntry(entryIndex);
+        const char* const path = assetPackReader.getEntryPath(entryIndex);
+        printf("%s %llu -> %llu (%s)\n", (path == nullptr) ? "<invalid path>" : path, entry._originalSize, entry._storedSize, getCompressionString(entry._compression));
+    }
+    return 0;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    if (4 <= argc && mint::StringUtil::strcmp(argv[1], "pack") == true)
+    {
+        return pack(argc, argv);
+    }
+    else if (argc == 3 && mint::StringUtil::strcmp(argv[1], "list") == true)
+    {
+        return list(argv[2]);
+    }
+
+    printf("Usage: MintAssetPackTool pack <output.mpak> [--lz4] <input file | input directory>...\n");
+    printf("       MintAssetPackTool list <input.mpak>\n");
+    return 1;
+}
@@ -5,7 +5,18 @@
 #define MINT_COMMON_DEFINITIONS_H
 
 
-#define MINT_INLINE __forceinline
+#if defined _MSC_VER
+    #define MINT_INLINE __forceinline
+#else
+    // always_inline 은 가변 인자 함수 (formatString 등) 에 쓸 수 없으므로 inline 만 붙인다.
+    #define MINT_INLINE inline
+
+    // MSVC 전용 keyword 를 다른 Compiler 에서도 쓸 수 있게 한다.
+    // class 에 붙는 abstract 는 의미만 나타내므로 비워 두고, 순수 가상 함수는 = 0 으로 선언한다.
+    #define __noop ((void)0)
+    #define __debugbreak() __builtin_trap()
+    #define abstract
+#endif
 
 
 #if defined(DEBUG) | defined(_DEBUG)
@@ -25,10 +25,10 @@ namespace mint
         #define _MINT_LOG_ERROR_ACTION exit(kErrorExitCode)
     #endif
 
-    #define MINT_LOG_UNTAGGED(author, format, ...)              mint::Logger::getInstance().log(nullptr, author, nullptr, nullptr, 0, format, __VA_ARGS__)
-    #define MINT_LOG(author, format, ...)                       mint::Logger::getInstance().log(" _LOG_ ", author, __func__, __FILE__, __LINE__, format, __VA_ARGS__)
-    #define MINT_LOG_ALERT(author, format, ...)                 mint::Logger::getInstance().logAlert(" ALERT ", author, __func__, __FILE__, __LINE__, format, __VA_ARGS__)
-    #define MINT_LOG_ERROR(author, format, ...)                 mint::Logger::getInstance().logError(" ERROR ", author, __func__, __FILE__, __LINE__, format, __VA_ARGS__); _MINT_LOG_ERROR_ACTION
+    #define MINT_LOG_UNTAGGED(author, format, ...)              mint::Logger::getInstance().log(nullptr, author, nullptr, nullptr, 0, format, ##__VA_ARGS__)
+    #define MINT_LOG(author, format, ...)                       mint::Logger::getInstance().log(" _LOG_ ", author, __func__, __FILE__, __LINE__, format, ##__VA_ARGS__)
+    #define MINT_LOG_ALERT(author, format, ...)                 mint::Logger::getInstance().logAlert(" ALERT ", author, __func__, __FILE__, __LINE__, format, ##__VA_ARGS__)
+    #define MINT_LOG_ERROR(author, format, ...)                 mint::Logger::getInstance().logError(" ERROR ", author, __func__, __FILE__, __LINE__, format, ##__VA_ARGS__); _MINT_LOG_ERROR_ACTION
 #pragma endregion
 
 
@@ -45,7 +45,7 @@ namespace mint
 #endif
 
     #if defined MINT_DEBUG
-        #define MINT_ASSERT(author, expression, format, ...)    if (!(expression)) { mint::Logger::getInstance().logError(" ASSRT ", author, __func__, __FILE__, __LINE__, format, __VA_ARGS__); _MINT_LOG_ERROR_ACTION; }
+        #define MINT_ASSERT(author, expression, format, ...)    if (!(expression)) { mint::Logger::getInstance().logError(" ASSRT ", author, __func__, __FILE__, __LINE__, format, ##__VA_ARGS__); _MINT_LOG_ERROR_ACTION; }
     #else
         #define MINT_ASSERT(author, expression, format, ...)
     #endif
@@ -0,0 +1,58 @@
+﻿#pragma once
+
+
+#ifndef MINT_PARALLEL_FOR_H
+#define MINT_PARALLEL_FOR_H
+
+
+#include <thread>
+#include <vector>
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+namespace mint
+{
+    // [0, count) 구간을 최대 hardware_concurrency 개의 연속된 구간으로 나눠 function(begin, end) 를 병렬로 호출한다.
+    // 구간 하나의 크기는 minBatchSize 보다 작아지지 않으며, 구간이 하나뿐이면 호출한 thread 에서 바로 실행한다.
+    // 구간 경계는 batchAlignment 의 배수가 된다. (SIMD kernel 의 tail 처리를 마지막 구간으로 몰기 위함)
+    template<typename Function>
+    void parallelFor(const uint32 count, const uint32 minBatchSize, Function&& function, const uint32 batchAlignment = 1)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const uint32 hardwareThreadCount = max(std::thread::hardware_concurrency(), 1u);
+        const uint32 maxBatchCount = max((count / max(minBatchSize, 1u)), 1u);
+        const uint32 batchCount = min(hardwareThreadCount, maxBatchCount);
+        if (batchCount <= 1)
+        {
+            function(0u, count);
+            return;
+        }
+
+        const uint32 alignment = max(batchAlignment, 1u);
+        const uint32 batchSize = (((count + batchCount - 1) / batchCount + alignment - 1) / alignment) * alignment;
+        std::vector<std::thread> threads;
+        threads.reserve(batchCount - 1);
+        uint32 batchBegin = batchSize;
+        while (batchBegin < count)
+        {
+            const uint32 batchEnd = min(batchBegin + batchSize, count);
+            threads.emplace_back([&function, batchBegin, batchEnd]() { function(batchBegin, batchEnd); });
+            batchBegin = batchEnd;
+        }
+
+        function(0u, min(batchSize, count));
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+}
+
+
+#endif // !MINT_PARALLEL_FOR_H
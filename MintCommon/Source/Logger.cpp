@@ -1,6 +1,10 @@
 ﻿#include <MintCommon/Include/Logger.h>
 
-#include <Windows.h>
+#if defined _WIN32
+    #include <Windows.h>
+#endif
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <filesystem>
@@ -56,13 +60,13 @@ namespace mint
         {
             va_list vl;
             va_start(vl, format);
-            vsprintf_s(content, kFinalBufferSize, format, vl);
+            vsnprintf(content, kFinalBufferSize, format, vl);
             va_end(vl);
         }
 
         logInternal(logTag, author, content, functionName, fileName, lineNumber, finalBuffer);
 
-        printf(finalBuffer);
+        printf("%s", finalBuffer);
     }
 
     void Logger::logAlert(const char* const logTag, const char* const author, const char* const functionName, const char* const fileName, const uint32 lineNumber, const char* const format, ...)
@@ -74,14 +78,16 @@ namespace mint
         {
             va_list vl;
             va_start(vl, format);
-            vsprintf_s(content, kFinalBufferSize, format, vl);
+            vsnprintf(content, kFinalBufferSize, format, vl);
             va_end(vl);
         }
 
         logInternal(logTag, author, content, functionName, fileName, lineNumber, finalBuffer);
 
-        printf(finalBuffer);
+        printf("%s", finalBuffer);
+#if defined _WIN32
         ::MessageBoxA(nullptr, content, "LOG ALERT", MB_ICONEXCLAMATION);
+#endif
     }
 
     void Logger::logError(const char* const logTag, const char* const author, const char* const functionName, const char* const fileName, const uint32 lineNumber, const char* const format, ...)
@@ -93,14 +99,16 @@ namespace mint
         {
             va_list vl;
             va_start(vl, format);
-            vsprintf_s(content, kFinalBufferSize, format, vl);
+            vsnprintf(content, kFinalBufferSize, format, vl);
             va_end(vl);
         }
 
         logInternal(logTag, author, content, functionName, fileName, lineNumber, finalBuffer);
 
-        printf(finalBuffer);
+        printf("%s", finalBuffer);
+#if defined _WIN32
         ::MessageBoxA(nullptr, content, "LOG ERROR", MB_ICONERROR);
+#endif
     }
 
     void Logger::logInternal(const char* const logTag, const char* const author, const char* const content, const char* const functionName, const char* const fileName, const uint32 lineNumber, char(&outBuffer)[kFinalBufferSize])
@@ -111,21 +119,27 @@ namespace mint
 
             const time_t now = time(nullptr);
             tm localNow;
+#if defined _WIN32
             localtime_s(&localNow, &now);
+#else
+            localtime_r(&now, &localNow);
+#endif
             strftime(timeBuffer, kTimeBufferSize, "%Y-%m-%d-%H:%M:%S", &localNow);
 
             if (nullptr == logTag || nullptr == functionName || nullptr == fileName)
             {
-                sprintf_s(outBuffer, kFinalBufferSize, "[%s] %s\n", author, content);
+                snprintf(outBuffer, kFinalBufferSize, "[%s] %s\n", author, content);
             }
             else
             {
                 const uint32 fileNameLength = static_cast<uint32>(::strlen(fileName));
                 //sprintf_s(outBuffer, kFinalBufferSize, "[%s] %s [%s] %s : %s(%d) %s()\n", logTag, timeBuffer, author, content, fileName + _basePathOffset, lineNumber, functionName);
-                sprintf_s(outBuffer, kFinalBufferSize, "%s(%d): %s() - [%s] %s [%s] %s \n", (_basePathOffset < fileNameLength) ? fileName + _basePathOffset : fileName, lineNumber, functionName, logTag, timeBuffer, author, content);
+                snprintf(outBuffer, kFinalBufferSize, "%s(%d): %s() - [%s] %s [%s] %s \n", (_basePathOffset < fileNameLength) ? fileName + _basePathOffset : fileName, lineNumber, functionName, logTag, timeBuffer, author, content);
             }
 
+#if defined _WIN32
             OutputDebugStringA(outBuffer);
+#endif
 
             _history.append(outBuffer);
         }
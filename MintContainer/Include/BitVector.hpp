@@ -1,10 +1,14 @@
 ﻿#pragma once
 
 
+#include <MintCommon/Include/Logger.h>
+
 #include <MintContainer/Include/BitVector.h>
 
 #include <MintMath/Include/MathCommon.h>
 
+#include <cstring>
+
 
 namespace mint
 {
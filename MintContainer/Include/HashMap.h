@@ -68,7 +68,7 @@ namespace mint
     template<typename Key, typename Value>
     class BucketViewer
     {
-        template<typename Key, typename Value>
+        template<typename HashMapKey, typename HashMapValue>
         friend class HashMap;
 
     private:
@@ -92,7 +92,7 @@ namespace mint
     template<typename Key, typename Value>
     class HashMap final
     {
-        template<typename Key, typename Value>
+        template<typename BucketViewerKey, typename BucketViewerValue>
         friend class BucketViewer;
 
     private:
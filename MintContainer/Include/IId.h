@@ -31,7 +31,7 @@ namespace mint
         const bool                      isValid() const noexcept;
 
     protected:
-        virtual void                    assignRawId(const uint32 rawId) noexcept abstract;
+        virtual void                    assignRawId(const uint32 rawId) noexcept = 0;
 
     protected:
         uint32                          _rawId{ kInvalidRawId };
@@ -2,6 +2,9 @@
 #pragma once
 
 
+#include <MintCommon/Include/Logger.h>
+
+
 namespace mint
 {
     template <typename T, uint32 maxSize>
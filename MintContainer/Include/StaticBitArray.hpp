@@ -85,7 +85,7 @@ namespace mint
     template<uint32 BitCount>
     inline void StaticBitArray<BitCount>::set(const uint32 byteAt, const uint8 bitOffset, const bool value) noexcept
     {
-        mint::BitVector::setBit(_byteArray[mint::min(byteAt, kByteCount - 1)], mint::min(bitOffset, kBitsPerByte - 1), value);
+        mint::BitVector::setBit(_byteArray[mint::min(byteAt, kByteCount - 1)], mint::min<uint32>(bitOffset, kBitsPerByte - 1), value);
     }
 
     template<uint32 BitCount>
@@ -6,6 +6,9 @@
 
 
 #include <string>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
@@ -55,6 +58,19 @@ namespace mint
         void            convertStringToWideString(const std::string& source, std::wstring& destination);
         void            excludeExtension(std::string& inoutText);
 
+        // [first, last) 에서 처음 나오는 ch 의 위치를 반환한다. 없으면 last. (SSE2 를 쓸 수 있으면 16 byte 씩 비교한다.)
+        const char*     findChar(const char* const first, const char* const last, const char ch);
+
+        // std::from_chars 처럼 [first, last) 의 앞부분을 수로 읽고, 읽은 다음 위치를 반환한다.
+        // 공백이나 '+' 는 건너뛰지 않으며, 실패하거나 범위를 넘으면 first 를 반환하고 outValue 는 바뀌지 않는다.
+        const char*     parseInteger(const char* const first, const char* const last, int64& outValue);
+        const char*     parseInteger(const char* const first, const char* const last, int32& outValue);
+        const char*     parseUnsignedInteger(const char* const first, const char* const last, uint64& outValue);
+        // "-12.5e-3" 형태의 10진수만 지원한다. (inf, nan, 16진수 미지원) locale 과 관계없이 '.' 만 소수점으로 본다.
+        // 지수가 너무 커서 결과가 범위를 넘거나 0 으로 사라지면 실패로 본다.
+        const char*     parseFloat(const char* const first, const char* const last, double& outValue);
+        const char*     parseFloat(const char* const first, const char* const last, float& outValue);
+
         static void     tokenize(const std::string& inputString, const char delimiter, mint::Vector<std::string>& outArray);
         static void     tokenize(const std::string& inputString, const mint::Vector<char>& delimiterArray, mint::Vector<std::string>& outArray);
         static void     tokenize(const std::string& inputString, const std::string& delimiterString, mint::Vector<std::string>& outArray);
@@ -10,6 +10,11 @@
 #include <MintContainer/Include/Vector.hpp>
 #include <MintContainer/Include/Tree.hpp>
 
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+
 
 namespace mint
 {
@@ -18,7 +23,7 @@ namespace mint
     {
         va_list args;
         va_start(args, format);
-        ::vsprintf_s(buffer, format, args);
+        ::vsnprintf(buffer, Size, format, args);
         va_end(args);
     }
 
@@ -26,7 +31,7 @@ namespace mint
     {
         va_list args;
         va_start(args, format);
-        ::vsprintf_s(buffer, bufferSize, format, args);
+        ::vsnprintf(buffer, bufferSize, format, args);
         va_end(args);
     }
 
@@ -35,7 +40,7 @@ namespace mint
     {
         va_list args;
         va_start(args, format);
-        ::vswprintf_s(buffer, format, args);
+        ::vswprintf(buffer, Size, format, args);
         va_end(args);
     }
 
@@ -43,7 +48,7 @@ namespace mint
     {
         va_list args;
         va_start(args, format);
-        ::vswprintf_s(buffer, bufferSize, format, args);
+        ::vswprintf(buffer, bufferSize, format, args);
         va_end(args);
     }
 
@@ -79,14 +84,26 @@ namespace mint
     {
         MINT_INLINE void convertWideStringToString(const std::wstring& source, std::string& destination)
         {
+#if defined _WIN32
             destination.resize(source.length());
             ::WideCharToMultiByte(CP_ACP, 0, source.c_str(), static_cast<int>(source.length()), &destination[0], static_cast<int>(destination.length()), nullptr, nullptr);
+#else
+            destination.resize(source.length() * MB_CUR_MAX);
+            const size_t length = ::wcstombs(&destination[0], source.c_str(), destination.length());
+            destination.resize((length == static_cast<size_t>(-1)) ? 0 : length);
+#endif
         }
 
         MINT_INLINE void convertStringToWideString(const std::string& source, std::wstring& destination)
         {
+#if defined _WIN32
             destination.resize(source.length());
             ::MultiByteToWideChar(CP_ACP, 0, source.c_str(), static_cast<int>(source.length()), &destination[0], static_cast<int>(destination.length()));
+#else
+            destination.resize(source.length());
+            const size_t length = ::mbstowcs(&destination[0], source.c_str(), destination.length());
+            destination.resize((length == static_cast<size_t>(-1)) ? 0 : length);
+#endif
         }
 
         MINT_INLINE const bool hasExtension(std::string& inoutText)
@@ -84,7 +84,71 @@ namespace mint
         template<uint32 DestSize>
         MINT_INLINE void strcpy(char(&dest)[DestSize], const char* const source)
         {
+#if defined _MSC_VER
             ::strcpy_s(dest, source);
+#else
+            ::snprintf(dest, DestSize, "%s", source);
+#endif
+        }
+
+        MINT_INLINE const char* parseUnsignedInteger(const char* const first, const char* const last, uint64& outValue)
+        {
+            static constexpr uint64 kMaxBeforeMultiply = kUint64Max / 10;
+
+            uint64 value = 0;
+            const char* at = first;
+            for (; at < last; ++at)
+            {
+                const uint32 digit = static_cast<uint32>(*at - '0');
+                if (9 < digit)
+                {
+                    break;
+                }
+                if (kMaxBeforeMultiply < value || kUint64Max - value * 10 < digit)
+                {
+                    return first;
+                }
+                value = value * 10 + digit;
+            }
+
+            if (at == first)
+            {
+                return first;
+            }
+            outValue = value;
+            return at;
+        }
+
+        MINT_INLINE const char* parseInteger(const char* const first, const char* const last, int64& outValue)
+        {
+            const bool isNegative = (first < last && *first == '-');
+            uint64 magnitude = 0;
+            const char* const digitFirst = first + (isNegative ? 1 : 0);
+            const char* const at = parseUnsignedInteger(digitFirst, last, magnitude);
+            if (at == digitFirst)
+            {
+                return first;
+            }
+
+            const uint64 maxMagnitude = static_cast<uint64>(kInt64Max) + (isNegative ? 1 : 0);
+            if (maxMagnitude < magnitude)
+            {
+                return first;
+            }
+            outValue = isNegative ? static_cast<int64>(0 - magnitude) : static_cast<int64>(magnitude);
+            return at;
+        }
+
+        MINT_INLINE const char* parseInteger(const char* const first, const char* const last, int32& outValue)
+        {
+            int64 value = 0;
+            const char* const at = parseInteger(first, last, value);
+            if (at == first || value < kInt32Min || kInt32Max < value)
+            {
+                return first;
+            }
+            outValue = static_cast<int32>(value);
+            return at;
         }
     }
 }
@@ -81,8 +81,8 @@ namespace mint
     template <typename T>
     class TreeNode
     {
-        friend Tree;
-        friend TreeNodeAccessor;
+        friend Tree<T>;
+        friend TreeNodeAccessor<T>;
 
     public:
         TreeNode()
@@ -1,7 +1,8 @@
 #pragma once
 
 
-#include <stdafx.h>
+#include <MintCommon/Include/Logger.h>
+
 #include <MintContainer/Include/Tree.h>
 
 #include <MintContainer/Include/Vector.hpp>
@@ -222,7 +223,7 @@ namespace mint
     inline TreeNodeAccessor<T> Tree<T>::getRootNode() noexcept
     {
         const TreeNode<T>& rootNode = _nodeArray.front();
-        return TreeNodeAccessor<T>::TreeNodeAccessor(this, static_cast<uint32>(0), rootNode._nodeId); // this == Tree<T>*  const ̸  ǹǷ  Լ const Լ  !!!
+        return TreeNodeAccessor<T>(this, static_cast<uint32>(0), rootNode._nodeId); // this == Tree<T>*  const ̸  ǹǷ  Լ const Լ  !!!
     }
 
     template<typename T>
@@ -389,7 +390,7 @@ namespace mint
         const uint32 nodeId = _nextNodeId;
 
         const TreeNode<T> childNode{ nodeId, nodeAccessor, childNodeData };
-        TreeNodeAccessor<T> childNodeAccessor{ this, nodeId, slotIndex };
+        TreeNodeAccessor<T> childNodeAccessor{ this, slotIndex, nodeId };
         _nodeArray[slotIndex] = childNode;
 
         TreeNode<T>& node = getNodeXXX(nodeAccessor);
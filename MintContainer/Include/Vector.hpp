@@ -197,7 +197,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
 
         _size = size;
@@ -241,7 +241,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
         return nullptr;
     }
@@ -269,7 +269,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
     }
 
@@ -315,7 +315,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
 
         ++_size;
@@ -336,7 +336,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
 
         ++_size;
@@ -360,7 +360,7 @@ namespace mint
         }
         else
         {
-            static_assert(false, "What...");
+            static_assert(sizeof(T) == 0, "What...");
         }
         
 
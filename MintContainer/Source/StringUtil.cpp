@@ -0,0 +1,160 @@
+﻿#include <MintContainer/Include/StringUtil.h>
+
+#include <MintMath/Include/SimdCommon.h>
+
+#include <charconv>
+#include <limits>
+
+#if defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 2) || defined __SSE2__
+    #define MINT_STRING_UTIL_USE_SSE2
+    #include <emmintrin.h>
+#endif
+
+
+namespace mint
+{
+    namespace StringUtil
+    {
+        const char* findChar(const char* const first, const char* const last, const char ch)
+        {
+            const char* at = first;
+#if defined MINT_STRING_UTIL_USE_SSE2
+            const __m128i target = _mm_set1_epi8(ch);
+            while (16 <= last - at)
+            {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+                const uint32 mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, target)));
+                if (mask != 0)
+                {
+                    return at + findFirstSetBit(mask);
+                }
+                at += 16;
+            }
+#endif
+
+            for (; at < last; ++at)
+            {
+                if (*at == ch)
+                {
+                    return at;
+                }
+            }
+            return last;
+        }
+
+        const char* parseFloat(const char* const first, const char* const last, double& outValue)
+        {
+            // double 로 정확히 표현되는 10 의 거듭제곱. (아래의 빠른 경로에서 쓴다.)
+            static constexpr double kPowersOfTen[23]
+            {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+            static constexpr uint32 kMaxSignificantDigitCount = 19;
+            // 이보다 큰 지수는 어차피 범위를 넘으므로 여기서 멈춘다.
+            static constexpr int64 kMaxDecimalExponent = 100000;
+
+            const char* at = first;
+            const bool isNegative = (at < last && *at == '-');
+            if (isNegative == true)
+            {
+                ++at;
+            }
+
+            uint64 mantissa = 0;
+            uint32 significantDigitCount = 0;
+            int64 decimalExponent = 0;
+            uint32 digitCount = 0;
+            for (; at < last && static_cast<uint32>(*at - '0') <= 9; ++at, ++digitCount)
+            {
+                if (significantDigitCount < kMaxSignificantDigitCount)
+                {
+                    mantissa = mantissa * 10 + static_cast<uint32>(*at - '0');
+                    significantDigitCount += (mantissa != 0) ? 1 : 0;
+                }
+                else
+                {
+                    ++decimalExponent;
+                }
+            }
+            if (at < last && *at == '.')
+            {
+                ++at;
+                for (; at < last && static_cast<uint32>(*at - '0') <= 9; ++at, ++digitCount)
+                {
+                    if (significantDigitCount < kMaxSignificantDigitCount)
+                    {
+                        mantissa = mantissa * 10 + static_cast<uint32>(*at - '0');
+                        significantDigitCount += (mantissa != 0) ? 1 : 0;
+                        --decimalExponent;
+                    }
+                }
+            }
+            if (digitCount == 0)
+            {
+                return first;
+            }
+
+            const bool isTruncated = (significantDigitCount == kMaxSignificantDigitCount);
+            if (at < last && (*at == 'e' || *at == 'E'))
+            {
+                const char* exponentFirst = at + 1;
+                const bool isExponentNegative = (exponentFirst < last && *exponentFirst == '-');
+                exponentFirst += (exponentFirst < last && (*exponentFirst == '-' || *exponentFirst == '+')) ? 1 : 0;
+
+                // 지수의 숫자가 없으면 ("1e", "1e+") 수는 'e' 앞에서 끝난다.
+                int64 exponent = 0;
+                const char* exponentLast = exponentFirst;
+                for (; exponentLast < last && static_cast<uint32>(*exponentLast - '0') <= 9; ++exponentLast)
+                {
+                    exponent = mint::min(exponent * 10 + static_cast<uint32>(*exponentLast - '0'), kMaxDecimalExponent);
+                }
+                if (exponentLast != exponentFirst)
+                {
+                    at = exponentLast;
+                    decimalExponent += (isExponentNegative == true) ? -exponent : exponent;
+                }
+            }
+
+            double value = 0.0;
+            if (isTruncated == false && mantissa <= (1ULL << 53) && -22 <= decimalExponent && decimalExponent <= 22)
+            {
+                // Clinger 의 빠른 경로: 두 피연산자가 모두 정확하므로 한 번의 반올림으로 정확한 결과가 나온다.
+                value = static_cast<double>(mantissa);
+                value = (decimalExponent < 0) ? value / kPowersOfTen[-decimalExponent] : value * kPowersOfTen[decimalExponent];
+            }
+            else
+            {
+                // 긴 가수나 큰 지수는 드물므로 std::from_chars 에 맡긴다. (locale 과 무관하고 범위를 넘으면 실패한다.)
+                const char* const digitFirst = first + ((isNegative == true) ? 1 : 0);
+                const std::from_chars_result result = std::from_chars(digitFirst, at, value);
+                if (result.ec != std::errc{} || result.ptr != at)
+                {
+                    return first;
+                }
+            }
+
+            outValue = (isNegative == true) ? -value : value;
+            return at;
+        }
+
+        const char* parseFloat(const char* const first, const char* const last, float& outValue)
+        {
+            double value = 0.0;
+            const char* const at = parseFloat(first, last, value);
+            if (at == first)
+            {
+                return first;
+            }
+
+            // double 로는 되지만 float 의 범위를 넘는 값도 실패로 본다.
+            const double absoluteValue = (value < 0.0) ? -value : value;
+            if (static_cast<double>(std::numeric_limits<float>::max()) < absoluteValue || (absoluteValue != 0.0 && absoluteValue < static_cast<double>(std::numeric_limits<float>::denorm_min())))
+            {
+                return first;
+            }
+            outValue = static_cast<float>(value);
+            return at;
+        }
+    }
+}
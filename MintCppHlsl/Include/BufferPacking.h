@@ -0,0 +1,88 @@
+﻿#pragma once
+
+
+#ifndef MINT_CPP_HLSL_BUFFER_PACKING_H
+#define MINT_CPP_HLSL_BUFFER_PACKING_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        class TypeMetaData;
+
+
+        enum class BufferPackingRule
+        {
+            ConstantBuffer,     // 멤버가 16 바이트 register 경계를 넘을 수 없고, struct, 행렬, 배열은 새 register 에서 시작한다. (배열의 원소도 각각 새 register 에서 시작한다)
+            StructuredBuffer,   // 4 바이트 단위로 빈틈 없이 채운다.
+        };
+
+        struct PackedMember
+        {
+        public:
+                                        PackedMember();
+                                        ~PackedMember() = default;
+
+        public:
+            uint32                      _memberIndex;   // TypeMetaData 에서의 멤버 index
+            uint32                      _byteOffset;
+            uint32                      _size;
+        };
+
+        struct BufferLayout
+        {
+        public:
+                                        BufferLayout();
+                                        ~BufferLayout() = default;
+
+        public:
+            mint::Vector<PackedMember>  _packedMemberArray;
+            uint32                      _size;          // Byte count
+            uint32                      _paddingSize;   // _size 중 멤버가 차지하지 않는 Byte count
+        };
+
+
+        namespace BufferPacking
+        {
+            static constexpr uint32     kRegisterSize = 16;
+            // D3D 는 Structured buffer 의 stride 로 4 바이트의 배수만 요구하지만, 원소가 128 비트 경계에 놓이도록 16 바이트의 배수로 맞춘다.
+            static constexpr uint32     kStructuredBufferStrideAlignment = 16;
+
+            // HLSL cbuffer 에서 [byteOffset, byteOffset + size) 에 놓인 멤버가 규칙을 지키는지. static_assert 에서 쓸 수 있다.
+            constexpr const bool        isConstantBufferMemberPacked(const uint32 byteOffset, const uint32 size) noexcept;
+            constexpr const bool        isConstantBufferSizePacked(const uint32 size) noexcept;
+            constexpr const bool        isStructuredBufferStridePacked(const uint32 stride) noexcept;
+
+            // typeMetaData 의 멤버들을 선언 순서대로 packingRule 에 맞게 배치한다.
+            void                        computeLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, BufferLayout& outLayout) noexcept;
+            
+            // memberOrder 의 순서대로 배치한다. memberOrder 는 typeMetaData 의 모든 멤버 index 를 한 번씩 담고 있어야 한다.
+            void                        computeLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, const mint::Vector<uint32>& memberOrder, BufferLayout& outLayout) noexcept;
+            
+            // typeMetaData 의 byte offset (= C++ 구조체의 layout) 이 packingRule 의 layout 과 같은지 확인한다.
+            // 다르면 처음으로 어긋난 멤버의 index 를 채우고 false 를 반환한다. 크기만 다르면 멤버 개수를 채운다.
+            const bool                  validateLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, uint32& outMismatchMemberIndex) noexcept;
+            
+            // Padding 이 가장 적어지도록 멤버 순서를 고른다. (16 바이트 이상인 멤버를 먼저 두고, 나머지는 큰 것부터 남는 register 에 채운다)
+            void                        computeMinimumSizeMemberOrder(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, mint::Vector<uint32>& outMemberOrder) noexcept;
+        }
+    }
+}
+
+
+// C++ 구조체가 HLSL cbuffer 규칙에 맞는지 compile time 에 확인한다.
+#define MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(type, member) static_assert(mint::CppHlsl::BufferPacking::isConstantBufferMemberPacked(offsetof(type, member), sizeof(type::member)), #type "::" #member " 가 cbuffer 의 16 바이트 register 경계를 넘습니다!")
+#define MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_SIZE(type) static_assert(mint::CppHlsl::BufferPacking::isConstantBufferSizePacked(sizeof(type)), #type " 의 크기가 16 바이트의 배수가 아닙니다!")
+#define MINT_CPP_HLSL_STATIC_ASSERT_STRUCTURED_BUFFER_STRIDE(type) static_assert(mint::CppHlsl::BufferPacking::isStructuredBufferStridePacked(sizeof(type)), #type " 의 크기가 Structured buffer 의 stride 로 쓸 수 있는 16 바이트의 배수가 아닙니다!")
+
+
+#include <MintCppHlsl/Include/BufferPacking.inl>
+
+
+#endif // !MINT_CPP_HLSL_BUFFER_PACKING_H
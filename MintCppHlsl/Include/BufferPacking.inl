@@ -0,0 +1,30 @@
+﻿#pragma once
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        namespace BufferPacking
+        {
+            MINT_INLINE constexpr const bool isConstantBufferMemberPacked(const uint32 byteOffset, const uint32 size) noexcept
+            {
+                if (kRegisterSize <= size)
+                {
+                    return (byteOffset % kRegisterSize) == 0;
+                }
+                return (byteOffset % kRegisterSize) + size <= kRegisterSize;
+            }
+
+            MINT_INLINE constexpr const bool isConstantBufferSizePacked(const uint32 size) noexcept
+            {
+                return (size % kRegisterSize) == 0;
+            }
+
+            MINT_INLINE constexpr const bool isStructuredBufferStridePacked(const uint32 stride) noexcept
+            {
+                return (stride != 0) && (stride % kStructuredBufferStrideAlignment) == 0;
+            }
+        }
+    }
+}
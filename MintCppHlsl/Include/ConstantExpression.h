@@ -0,0 +1,84 @@
+﻿#pragma once
+
+
+#ifndef MINT_CPP_HLSL_CONSTANT_EXPRESSION_H
+#define MINT_CPP_HLSL_CONSTANT_EXPRESSION_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintCppHlsl/Include/LanguageCommon.h>
+
+#include <string>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        // 상수 식 안의 이름을 값으로 바꿔 준다.
+        class IConstantResolver abstract
+        {
+        public:
+                                                    IConstantResolver() = default;
+            virtual                                 ~IConstantResolver() = default;
+
+        public:
+            virtual const bool                      resolveConstant(const std::string_view name, int64& outValue) const noexcept = 0;
+            virtual const bool                      resolveTypeSize(const std::string_view typeName, uint32& outTypeSize) const noexcept = 0;
+        };
+
+
+        // Symbol 들로 된 정수 상수 식을 C++ 의 연산자 우선순위대로 계산한다. 계산은 int64 로 한다.
+        // 정수 literal (10 진수, 0x, 0b, 0 으로 시작하는 8 진수, u/l 접미사), ( ), 단항 + - ~, * / %, + -, << >>, &, ^, |,
+        // sizeof(Type), 이름 있는 상수 (A::B 처럼 namespace 가 붙어도 된다) 를 쓸 수 있다.
+        class ConstantExpressionEvaluator final
+        {
+            static constexpr uint32                 kMaxParenthesisDepth = 64;
+
+        public:
+                                                    ConstantExpressionEvaluator(const mint::Vector<SymbolTableItem>& symbolTable, const IConstantResolver& constantResolver);
+                                                    ~ConstantExpressionEvaluator() = default;
+
+        public:
+            // [beginSymbolPosition, endSymbolPosition) 의 symbol 들을 하나의 식으로 계산한다.
+            // 실패하면 getErrorSymbolPosition() 과 getErrorMessage() 로 원인을 알 수 있다.
+            const bool                              evaluate(const uint32 beginSymbolPosition, const uint32 endSymbolPosition, int64& outValue) noexcept;
+
+        public:
+            const uint32                            getErrorSymbolPosition() const noexcept;
+            const char*                             getErrorMessage() const noexcept;
+
+        public:
+            static const bool                       parseIntegerLiteral(const std::string_view literal, int64& outValue) noexcept;
+
+        private:
+            const bool                              evaluateBinary(const int32 minPrecedence, int64& outValue) noexcept;
+            const bool                              evaluateUnary(int64& outValue) noexcept;
+            const bool                              evaluatePrimary(int64& outValue) noexcept;
+            const bool                              parseQualifiedName(std::string& outName) noexcept;
+            const bool                              applyBinaryOperator(const uint32 operatorPosition, const int64 lhs, const int64 rhs, int64& outValue) noexcept;
+
+        private:
+            const bool                              hasSymbol() const noexcept;
+            const bool                              isSymbol(const char* const symbolString) const noexcept;
+            static const int32                      getBinaryOperatorPrecedence(const SymbolTableItem& symbol) noexcept;
+            static const bool                       isUnaryOperator(const SymbolTableItem& symbol) noexcept;
+            const bool                              reportError(const uint32 symbolPosition, const char* const errorMessage) noexcept;
+
+        private:
+            const mint::Vector<SymbolTableItem>&    _symbolTable;
+            const IConstantResolver&                _constantResolver;
+            uint32                                  _symbolAt;
+            uint32                                  _endSymbolPosition;
+            uint32                                  _parenthesisDepth;
+            uint32                                  _errorSymbolPosition;
+            const char*                             _errorMessage;
+        };
+    }
+}
+
+
+#endif // !MINT_CPP_HLSL_CONSTANT_EXPRESSION_H
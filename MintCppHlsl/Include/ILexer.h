@@ -10,7 +10,7 @@
 #include <MintContainer/Include/Vector.h>
 #include <MintContainer/Include/HashMap.h>
 
-#include <MintRenderingBase/Include/CppHlsl/LanguageCommon.h>
+#include <MintCppHlsl/Include/LanguageCommon.h>
 
 
 namespace mint
@@ -130,10 +130,44 @@ namespace mint
         };
 
 
+        // ϵ ª lexeme (punctuator, operator, line skipper)    DFA
+        // ¸ 256  ̸ Ƿ, ڸ hash   ʰ   lexeme  ã´.
+        class LexemeDfa final
+        {
+        public:
+            static constexpr uint32                 kMaxLexemeLength = 3;
+
+        public:
+                                                    LexemeDfa();
+
+        public:
+            // ̹ ϵ lexeme ̸ false  ȯѴ.
+            const bool                              insert(const char* const lexeme, const uint32 length, const uint32 value);
+            // ch  '\0' ̸  տ . (ch1  '\0' ̸ ch2   ʴ´)
+            const bool                              matchLongest(const char ch0, const char ch1, const char ch2, uint32& outLength, uint32& outValue) const noexcept;
+
+        private:
+            // 0   (root)   ̴ Ƿ 0  ' '  .
+            static constexpr uint16                 kNoTransition = 0;
+
+            struct State
+            {
+                                                    State();
+
+                uint16                              _next[256];
+                uint32                              _value;
+            };
+
+        private:
+            mint::Vector<State>                     _stateArray;
+        };
+
+
         // Lexical Analyzer
         // Tokens of lexeme
         // Also known as Scanner
         // Uses STL (vector, string, unordered_map)
+        //  з 256 ĭ¥ ǥ LexemeDfa  Ѵ.
         class ILexer
         {
             friend IParser;
@@ -158,7 +192,7 @@ namespace mint
             void                                    registerOperator(const char* const operator_, const OperatorClassifier operatorClassifier);
 
         protected:
-            virtual const bool                      execute() abstract;
+            virtual const bool                      execute() = 0;
         
         protected:
             const bool                              continueExecution(const uint32 sourceAt) const noexcept;
@@ -169,6 +203,11 @@ namespace mint
             
         private:
             void                                    advanceExecution(const SymbolClassifier symbolClassifier, const uint32 advance, uint32& prevSourceAt, uint32& sourceAt);
+            // з   (identifier, number )  ̾  ǳʶٰ, ó з  ġ ȯѴ.
+            const uint32                            skipUnclassified(const uint32 sourceAt) const noexcept;
+            // delimiter  ̾  ǳʶٰ, ó delimiter  ƴ  ġ ȯѴ.
+            const uint32                            skipDelimiters(const uint32 sourceAt) const noexcept;
+            void                                    addCharClass(const char input, const uint8 charClass) noexcept;
         
         protected:
             void                                    endExecution();
@@ -184,8 +223,8 @@ namespace mint
             const bool                              isStringQuote(const char input) const noexcept;
             const bool                              isPunctuator(const char ch0, const char ch1, const char ch2, uint32& outAdvance) const noexcept;
             const bool                              isOperator(const char ch0, const char ch1, OperatorTableItem& out) const noexcept;
-            const bool                              isNumber(const std::string& input) const noexcept;
-            const bool                              isKeyword(const std::string& input) const noexcept;
+            const bool                              isNumber(const std::string_view input) const noexcept;
+            const bool                              isKeyword(const std::string_view input) const noexcept;
 
         public:
             const mint::Vector<SymbolTableItem>&    getSymbolTable() const noexcept;
@@ -202,40 +241,55 @@ namespace mint
             char                                    _statementTerminator;
 
         protected:
-            mint::HashMap<char, int8>               _delimiterUmap;
+            static constexpr uint8                  kCharClassDelimiter             = 1 << 0;
+            static constexpr uint8                  kCharClassGrouperOpen           = 1 << 1;
+            static constexpr uint8                  kCharClassGrouperClose          = 1 << 2;
+            static constexpr uint8                  kCharClassStringQuote           = 1 << 3;
+            static constexpr uint8                  kCharClassStatementTerminator   = 1 << 4;
+            static constexpr uint8                  kCharClassPunctuatorBegin       = 1 << 5;
+            static constexpr uint8                  kCharClassOperatorBegin         = 1 << 6;
+            static constexpr uint8                  kCharClassLineSkipperBegin      = 1 << 7;
+
+            //  ڰ  з   , 켱 executeDefault()   .
+            uint8                                   _charClassTable[256];
+            // [a-zA-Z0-9_]  ϳ з ʾ SIMD  identifier  ǳʶ  ִ.
+            bool                                    _canSkipIdentifierWithSimd;
+
+        protected:
+            mint::Vector<char>                      _delimiterArray;
 
         protected:
             mint::Vector<LineSkipperTableItem>      _lineSkipperTable;
-            mint::HashMap<uint64, uint32>           _lineSkipperUmap;
+            LexemeDfa                               _lineSkipperDfa;
 
         protected:
-            mint::Vector<std::string>               _keywordTable;
-            mint::HashMap<uint64, uint32>           _keywordUmap;
+            // ϵ keyword  punctuator ڿ Ѵ. (parse   ʴ´)
+            StringArena                             _lexemeArena;
 
         protected:
-            mint::Vector<GrouperTableItem>          _grouperTable;
-            mint::HashMap<char, uint32>             _grouperUmap;
-            mint::HashMap<char, char>               _grouperOpenToCloseMap;
+            mint::Vector<std::string_view>          _keywordTable;
+            mint::HashMap<uint64, uint32>           _keywordUmap;
 
         protected:
-            mint::HashMap<char, int8>               _stringQuoteUmap;
+            char                                    _grouperCloseTable[256];
 
         protected:
-            mint::Vector<std::string>               _punctuatorTable;
-            mint::HashMap<uint64, uint32>           _punctuatorUmap;
+            mint::Vector<std::string_view>          _punctuatorTable;
+            LexemeDfa                               _punctuatorDfa;
 
         protected:
             mint::Vector<OperatorTableItem>         _operatorTable;
-            mint::HashMap<uint64, uint32>           _operatorUmap;
+            LexemeDfa                               _operatorDfa;
 
         protected:
+            //  SymbolTableItem  _source  (ġ, ) view  Ƿ ڿ  ʴ´.
             mint::Vector<SymbolTableItem>           _symbolTable;
         };
     }
 }
 
 
-#include <MintRenderingBase/Include/CppHlsl/ILexer.inl>
+#include <MintCppHlsl/Include/ILexer.inl>
 
 
 #endif // !MINT_I_LEXER_H
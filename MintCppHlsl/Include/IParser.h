@@ -10,7 +10,9 @@
 #include <MintContainer/Include/Vector.h>
 #include <MintContainer/Include/Tree.h>
 
-#include <MintRenderingBase/Include/CppHlsl/LanguageCommon.h>
+#include <MintCppHlsl/Include/LanguageCommon.h>
+
+#include <iterator>
 
 
 namespace mint
@@ -33,6 +35,7 @@ namespace mint
                 RepetitionOfCode,
                 SymbolNotFound,
                 WrongScope,
+                InvalidExpression,
 
                 COUNT
             };
@@ -48,10 +51,11 @@ namespace mint
                 { "Repetition of code"                  ,  "ڵ尡 ߺ˴ϴ."                                                            },
                 { "Symbol not found"                    ,  "ش ɺ ã  ϴ."                                                 },
                 { "Wrong scope"                         ,  "̰   ϴ."                                                    },
+                { "Invalid expression"                  ,  "    ϴ."                                                 },
             };
 
         protected:
-            static_assert(static_cast<uint32>(ErrorType::COUNT) == ARRAYSIZE(kErrorTypeStringArray));
+            static_assert(static_cast<uint32>(ErrorType::COUNT) == std::size(kErrorTypeStringArray));
             static constexpr const char*                    convertErrorTypeToTypeString(const ErrorType errorType);
             static constexpr const char*                    convertErrorTypeToContentString(const ErrorType errorType);
 
@@ -72,7 +76,7 @@ namespace mint
             virtual                                         ~IParser() = default;
 
         public:
-            virtual const bool                              execute() abstract;
+            virtual const bool                              execute() = 0;
 
         protected:
             void                                            reset();
@@ -112,7 +116,7 @@ namespace mint
 }
 
 
-#include <MintRenderingBase/Include/CppHlsl/IParser.inl>
+#include <MintCppHlsl/Include/IParser.inl>
 
 
 #endif // !MINT_I_PARSER_H
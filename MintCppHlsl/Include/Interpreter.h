@@ -0,0 +1,88 @@
+#pragma once
+
+
+#ifndef MINT_CPP_HLSL_H
+#define MINT_CPP_HLSL_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintCppHlsl/Include/Lexer.h>
+#include <MintCppHlsl/Include/Parser.h>
+
+#include <typeinfo>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        enum class CppHlslFileType
+        {
+            StreamData,
+            ConstantBuffers,
+            StructuredBuffers,
+        };
+
+        class Interpreter
+        {
+        public:
+                                        Interpreter();
+                                        ~Interpreter() = default;
+
+        public:
+            const bool                  parseCppHlslFile(const char* const fileName);
+            // ϸ Lexer  Parser   ξ ķ parse  , TypeMetaData  fileNames   ģ.
+            //  Ͽ  ̸ type   layout    ϳ ġ, ٸ Ѵ.     ģ.
+            const bool                  parseCppHlslFiles(const char* const* const fileNames, const uint32 fileCount);
+            // parseCppHlslFile()  generateHlslString()    Ѵ.
+            //  cacheDirectory   ΰ,  CppHlsl    Lex, Parse, Hlsl   ǳʶڴ.
+            const bool                  interpretCppHlslFile(const char* const fileName, const CppHlslFileType fileType, const char* const cacheDirectory);
+            //  ̸  ٸ   ̸ ̳ ٸ FileType  ؼ  ġǷ, FileType  ü  hash  ִ´.
+            static std::string          makeCacheFileName(const char* const fileName, const CppHlslFileType fileType, const char* const cacheDirectory);
+        
+        public:
+            void                        generateHlslString(const CppHlslFileType fileType);
+            // Built-in  ƴ  Type  memory layout  JSON  .
+            void                        generateLayoutJsonString();
+        
+        public:
+            const char*                 getHlslString() const noexcept;
+            const char*                 getLayoutJsonString() const noexcept;
+            const bool                  isLoadedFromCache() const noexcept;
+
+        public:
+            const uint32                getTypeMetaDataCount() const noexcept;
+            const TypeMetaData&         getTypeMetaData(const uint32 typeIndex) const noexcept;
+            const TypeMetaData&         getTypeMetaData(const std::string& typeName) const noexcept;
+            const TypeMetaData&         getTypeMetaData(const std::type_info& stdTypeInfo) const noexcept;
+        
+        private:
+            void                        warnConstantBufferLayoutMismatch(const TypeMetaData& typeMetaData) const noexcept;
+
+        private:
+            const bool                  loadCacheFile(const char* const cacheFileName, const uint64 sourceHash, const uint32 sourceLength);
+            const bool                  saveCacheFile(const char* const cacheFileName, const uint64 sourceHash, const uint32 sourceLength) const;
+
+        public:
+            static constexpr const char* const  kCacheFileExtension = ".cpphlslcache";
+
+        private:
+            // Cache  ̳ Parser   ٲ ÷ Ѵ!
+            static constexpr uint32     kCacheFileVersion = 2;
+
+        private:
+            Lexer                _lexer;
+            Parser               _parser;
+
+        private:
+            CppHlslFileType             _fileType;
+            std::string                 _hlslString;
+            std::string                 _layoutJsonString;
+            bool                        _isLoadedFromCache;
+        };
+    }
+}
+
+
+#endif // !MINT_CPP_HLSL_H
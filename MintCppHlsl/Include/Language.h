@@ -0,0 +1,17 @@
+#pragma once
+
+
+#ifndef MINT_LANGUAGE_H
+#define MINT_LANGUAGE_H
+
+
+#include <MintCppHlsl/Include/ILexer.h>
+#include <MintCppHlsl/Include/IParser.h>
+
+#include <MintCppHlsl/Include/Tokenizer.h>
+
+#include <MintCppHlsl/Include/Lexer.h>
+#include <MintCppHlsl/Include/Parser.h>
+
+
+#endif // !MINT_LANGUAGE_H
@@ -7,6 +7,11 @@
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
+#include <MintContainer/Include/Vector.h>
+#include <MintContainer/Include/HashMap.h>
+
+#include <string_view>
+
 
 namespace mint
 {
@@ -69,14 +74,56 @@ namespace mint
         static_assert(SymbolClassifier::OPERATOR_ENDS       <    SymbolClassifier::Identifier       );
         
 
+        //   parse   ڿ  δ arena
+        // ڿ ϳ  ʰ reset()  Ѳ , Ҵ  chunk   parse  Ѵ.
+        class StringArena final
+        {
+            static constexpr uint32                 kDefaultChunkCapacity = 4096;
+
+            struct Chunk
+            {
+                char*                               _rawMemory = nullptr;
+                uint32                              _capacity = 0;
+            };
+
+        public:
+                                                    StringArena();
+                                                    StringArena(const StringArena& rhs) = delete;
+                                                    StringArena(StringArena&& rhs) noexcept = delete;
+                                                    ~StringArena();
+
+        public:
+            StringArena&                            operator=(const StringArena& rhs) = delete;
+            StringArena&                            operator=(StringArena&& rhs) noexcept = delete;
+
+        public:
+            //  ڿ   Ѵ. ȯ view  null-terminated ̴.
+            const std::string_view                  intern(const std::string_view string) noexcept;
+            // length + 1 (null) ŭ  ȯѴ.
+            char*                                   allocate(const uint32 length) noexcept;
+            void                                    reset() noexcept;
+
+        public:
+            const uint32                            getChunkCount() const noexcept;
+            const uint32                            getUsedLength() const noexcept;
+
+        private:
+            mint::Vector<Chunk>                     _chunkArray;
+            uint32                                  _chunkAt;
+            uint32                                  _chunkUsedLength;
+            uint32                                  _totalUsedLength;
+            mint::HashMap<uint64, std::string_view> _internMap;
+        };
+
+
         class SymbolTableItem
         {
             friend ILexer;
 
         public:
                                     SymbolTableItem();
-                                    SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string& symbolString, const uint32 sourceAt);
-                                    SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string& symbolString);
+                                    SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string_view symbolString, const uint32 sourceAt);
+                                    SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string_view symbolString);
 
         public:
             const bool              operator==(const SymbolTableItem& rhs) const noexcept;
@@ -88,7 +135,7 @@ namespace mint
 
         public:
             SymbolClassifier        _symbolClassifier;
-            std::string             _symbolString;
+            std::string_view        _symbolString;  // ILexer::_source  ŰǷ Lexer  source  ٲ ȿ ȴ!
 
         private:
             uint32                  _symbolIndex;
@@ -100,7 +147,7 @@ namespace mint
 }
 
 
-#include <MintRenderingBase/Include/CppHlsl/LanguageCommon.inl>
+#include <MintCppHlsl/Include/LanguageCommon.inl>
 
 
 #endif // !MINT_LANGUAGE_COMMON_H
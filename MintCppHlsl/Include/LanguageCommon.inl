@@ -13,7 +13,7 @@ namespace mint
             __noop;
         }
 
-        inline SymbolTableItem::SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string& symbolString, const uint32 sourceAt)
+        inline SymbolTableItem::SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string_view symbolString, const uint32 sourceAt)
             : _symbolClassifier{ symbolClassifier }
             , _symbolString{ symbolString }
             , _symbolIndex{ kUint32Max }
@@ -22,7 +22,7 @@ namespace mint
             __noop;
         }
 
-        inline SymbolTableItem::SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string& symbolString)
+        inline SymbolTableItem::SymbolTableItem(const SymbolClassifier symbolClassifier, const std::string_view symbolString)
             : _symbolClassifier{ symbolClassifier }
             , _symbolString{ symbolString }
             , _symbolIndex{ kUint32Max }
@@ -44,7 +44,7 @@ namespace mint
         MINT_INLINE void SymbolTableItem::clearData()
         {
             _symbolClassifier = SymbolClassifier::POST_CLEARED;
-            _symbolString.clear();
+            _symbolString = std::string_view();
             _symbolIndex = kUint32Max;
             // _sourceAt  ׳ ܵд.
         }
@@ -53,6 +53,17 @@ namespace mint
         {
             return _symbolIndex;
         }
+
+
+        MINT_INLINE const uint32 StringArena::getChunkCount() const noexcept
+        {
+            return _chunkArray.size();
+        }
+
+        MINT_INLINE const uint32 StringArena::getUsedLength() const noexcept
+        {
+            return _totalUsedLength;
+        }
     }
 }
 
@@ -7,7 +7,7 @@
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
-#include <MintRenderingBase/Include/CppHlsl/ILexer.h>
+#include <MintCppHlsl/Include/ILexer.h>
 
 
 namespace mint
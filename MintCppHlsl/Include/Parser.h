@@ -0,0 +1,267 @@
+#pragma once
+
+
+#ifndef MINT_CPP_PARSER_H
+#define MINT_CPP_PARSER_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/HashMap.h>
+#include <MintContainer/Include/BitVector.h>
+
+#include <MintCppHlsl/Include/IParser.h>
+#include <MintCppHlsl/Include/LanguageCommon.h>
+#include <MintCppHlsl/Include/ConstantExpression.h>
+
+
+namespace mint
+{
+    class BinaryFileReader;
+    class BinaryFileWriter;
+
+
+    namespace CppHlsl
+    {
+        class ILexer;
+
+        enum class SyntaxClassifier
+        {
+            ROOT,
+            Namespace,
+            Struct,
+            Variable,
+            DataType,
+
+            SemanticName,
+            RegisterIndex,
+            InstanceData,
+        };
+
+        struct SyntaxTreeItem
+        {
+        public:
+                                    SyntaxTreeItem();
+                                    ~SyntaxTreeItem();
+
+        //private:
+            SyntaxClassifier        _classifier;
+            std::string_view        _identifier;    // Lexer  source  Ų.
+            std::string_view        _value;         // Lexer  source  Ų.
+            int64                   _constantValue; // 迭 ũ, RegisterIndex, InstanceData   
+        };
+
+
+        // ̸  ʰ Lexer  source  Parser  StringArena  ŰǷ
+        // Parser  ٽ execute() ϸ  TypeMetaData  ̸ ȿ ȴ!
+        class TypeMetaData final
+        {
+        public:
+                                            TypeMetaData();
+                                            ~TypeMetaData() = default;
+
+        public:
+            void                            setBaseData(const std::string_view typeName, const bool isBuiltIn);
+            void                            setDeclName(const std::string_view declName);
+            void                            setSize(const uint32 size);
+            void                            setByteOffset(const uint32 byteOffset);
+            void                            setSemanticName(const std::string_view semanticName);
+            void                            setRegisterIndex(const uint32 registerIndex);
+            void                            setInputSlot(const uint32 inputSlot);
+            void                            setInstanceDataStepRate(const uint32 instanceDataStepRate);
+            void                            setArrayCount(const uint32 arrayCount);
+            void                            pushMember(const TypeMetaData& member);
+            void                            pushSlottedStreamData(const TypeMetaData& slottedStreamData);
+
+        public:
+            const bool                      isBuiltIn() const noexcept;
+            const bool                      isRegisterIndexValid() const noexcept;
+            const bool                      isArray() const noexcept;
+
+        public:
+            const std::string_view          getTypeName() const noexcept;
+            const std::string_view          getDeclName() const noexcept;
+            const uint32                    getSize() const noexcept;
+            const uint32                    getByteOffset() const noexcept;
+            const std::string_view          getSemanticName() const noexcept;
+            const uint32                    getRegisterIndex() const noexcept;
+            const uint32                    getInputSlot() const noexcept;
+            const uint32                    getInstanceDataStepRate() const noexcept;
+            const uint32                    getArrayCount() const noexcept;
+            // 迭̸  ϳ ũ, ƴϸ getSize()  .
+            const uint32                    getElementSize() const noexcept;
+            const uint32                    getMemberCount() const noexcept;
+            const TypeMetaData&             getMember(const uint32 memberIndex) const noexcept;
+            const uint32                    getSlottedStreamDataCount() const noexcept;
+            const TypeMetaData&             getSlottedStreamData(const uint32 inputSlot) const noexcept;
+        
+        public:
+            static const TypeMetaData       kInvalidTypeMetaData;
+
+        private:
+            static constexpr uint32         kInvalidRegisterIndex = kUint32Max;
+
+        private:
+            bool                            _isBuiltIn;
+            std::string_view                _typeName;      // namespace + name
+            std::string_view                _declName;
+            std::string_view                _semanticName;
+            uint32                          _registerIndex;
+            uint32                          _inputSlot;
+            uint32                          _instanceDataStepRate;
+            uint32                          _arrayCount;    // 0 ̸ 迭 ƴϴ.
+            uint32                          _size;          // Byte count (迭̸  ü)
+            uint32                          _byteOffset;
+            mint::Vector<TypeMetaData>      _memberArray;   // Member variables
+            mint::Vector<TypeMetaData>      _slottedStreamDatas;
+        };
+
+
+        // Namespace  struct    (static constexpr uint32 kName = ;)
+        struct ConstantMetaData
+        {
+            std::string_view                _name;          // namespace (+ struct) + name
+            std::string_view                _typeName;
+            int64                           _value = 0;     // _typeName  ũ ȣ  ڸ 
+        };
+
+
+        class Parser final : public IParser
+        {
+            //   ̸ scopeNode  scope  ٱ ã´.
+            class ScopedConstantResolver final : public IConstantResolver
+            {
+            public:
+                                                        ScopedConstantResolver(const Parser& parser, const TreeNodeAccessor<SyntaxTreeItem>& scopeNode);
+                virtual                                 ~ScopedConstantResolver() = default;
+
+            public:
+                virtual const bool                      resolveConstant(const std::string_view name, int64& outValue) const noexcept override final;
+                virtual const bool                      resolveTypeSize(const std::string_view typeName, uint32& outTypeSize) const noexcept override final;
+
+            private:
+                const bool                              findScopedIndex(const mint::HashMap<uint64, uint32>& map, const std::string_view name, uint32& outIndex) const noexcept;
+
+            private:
+                const Parser&                           _parser;
+                std::string                             _scopeName;
+            };
+
+        public:
+                                                        Parser(ILexer& lexer);
+            virtual                                     ~Parser();
+
+        public:
+            virtual const bool                          execute() override final;
+
+        private:
+            void                                        registerTypeInternal(const std::string_view typeFullName, const uint32 typeSize, const bool isBuiltIn = false) noexcept;
+            void                                        registerConstant(const ConstantMetaData& constant) noexcept;
+            void                                        resetParseResult() noexcept;
+
+        private:
+            const bool                                  parseCode(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+
+        private:
+            const bool                                  parseNamespace(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+            const bool                                  parseStruct(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+            const bool                                  parseStructMember(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+            const bool                                  parseCustomSyntax(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+            const bool                                  parseConstant(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept;
+            // [beginSymbolPosition, endSymbolPosition)  scopeNode  scope  Ѵ. ϸ  Ѵ.
+            const bool                                  evaluateConstantExpression(const uint32 beginSymbolPosition, const uint32 endSymbolPosition, const TreeNodeAccessor<SyntaxTreeItem>& scopeNode, int64& outValue) noexcept;
+        
+        private:
+            const bool                                  buildTypeMetaData(const TreeNodeAccessor<SyntaxTreeItem>& structNode) noexcept;
+            // ROOT   node  ̸ ::  ̾ δ.
+            static void                                 buildScopeName(const TreeNodeAccessor<SyntaxTreeItem>& node, std::string& outScopeName) noexcept;
+
+        public:
+            const uint32                                getTypeMetaDataCount() const noexcept;
+            const TypeMetaData&                         getTypeMetaData(const std::string_view typeName) const noexcept;
+            const TypeMetaData&                         getTypeMetaData(const int32 typeIndex) const noexcept;
+            const StringArena&                          getStringArena() const noexcept;
+
+        public:
+            const uint32                                getConstantCount() const noexcept;
+            const ConstantMetaData&                     getConstant(const uint32 constantIndex) const noexcept;
+            // name  namespace   ̸̴.
+            const bool                                  findConstantValue(const std::string_view name, int64& outValue) const noexcept;
+        
+        private:
+            TypeMetaData&                               getTypeMetaData(const std::string_view typeName) noexcept;
+
+        public:
+            // Built-in  ƴ TypeMetaData   Ѵ.
+            void                                        serializeTypeMetaDatas(BinaryFileWriter& binaryFileWriter) const noexcept;
+            //  parse   serializeTypeMetaDatas()  ϵ TypeMetaData  ä. ̸ StringArena  Ѵ.
+            const bool                                  deserializeTypeMetaDatas(const BinaryFileReader& binaryFileReader) noexcept;
+
+        private:
+            static void                                 serializeTypeMetaData(const TypeMetaData& typeMetaData, BinaryFileWriter& binaryFileWriter) noexcept;
+            static void                                 serializeString(const std::string_view string, BinaryFileWriter& binaryFileWriter) noexcept;
+            const bool                                  deserializeTypeMetaData(const BinaryFileReader& binaryFileReader, TypeMetaData& outTypeMetaData) noexcept;
+            const bool                                  deserializeString(const BinaryFileReader& binaryFileReader, std::string_view& outString) noexcept;
+
+        public:
+            //  parse   parsers  built-in  ƴ TypeMetaData  parsers   . ̸ StringArena  Ѵ.
+            // ̸  type  layout   ó ͸ , ٸ 浹 type ̸ parser  index  ä false  ȯѴ.
+            //    . ( ٸ 浹̴)
+            const bool                                  mergeTypeMetaDatas(const Parser* const* const parsers, const uint32 parserCount, std::string_view& outConflictingTypeName, uint32& outConflictingParserIndex) noexcept;
+
+        private:
+            void                                        copyTypeMetaData(const TypeMetaData& source, TypeMetaData& outTypeMetaData) noexcept;
+            const std::string_view                      internName(const std::string_view name) noexcept;
+            static const bool                           isSameLayout(const TypeMetaData& lhs, const TypeMetaData& rhs) noexcept;
+
+        private:
+            const int32                                 getSlottedStreamDataInputSlot(const std::string_view typeName, std::string_view& streamDataTypeName) const noexcept;
+            const bool                                  existsTypeMetaData(const std::string_view typeName) const noexcept;
+            static const uint64                         computeTypeNameHash(const std::string_view typeName) noexcept;
+
+        public:
+            static std::string                          convertDeclarationNameToHlslSemanticName(const std::string_view declarationName);
+
+        public:
+            // HLSL  namespace  Ƿ ̸  static const  . 64 Ʈ  .
+            std::string                                 serializeConstantsToHlsl() const;
+            std::string                                 serializeCppHlslTypeToHlslStreamDatum(const TypeMetaData& typeMetaData);
+
+        private:
+            std::string                                 serializeCppHlslTypeToHlslStreamDatumMembers(const TypeMetaData& typeMetaData);
+            static void                                 appendHlslArraySuffix(const TypeMetaData& memberType, std::string& outString);
+
+        public:
+            std::string                                 serializeCppHlslTypeToHlslConstantBuffer(const TypeMetaData& typeMetaData, const uint32 bufferIndex);
+            std::string                                 serializeCppHlslTypeToHlslStructuredBufferDefinition(const TypeMetaData& typeMetaData);
+            // Shader   ̳ ܺ    ֵ Type  ũ  offset  JSON object  .
+            std::string                                 serializeCppHlslTypeToLayoutJson(const TypeMetaData& typeMetaData);
+
+        private:
+            // D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT  . (CppHlsl  D3D   ʵ  д)
+            static constexpr int32                      kVertexInputSlotCount = 32;
+
+        private:
+            mint::Tree<SyntaxTreeItem>                  _syntaxTree;
+
+        private:
+            mint::Vector<TypeMetaData>                  _typeMetaDatas;
+            mint::HashMap<uint64, uint32>               _typeMetaDataMap;   // Key  computeTypeNameHash()
+            uint32                                      _builtInTypeCount;
+
+        private:
+            mint::Vector<ConstantMetaData>              _constants;
+            mint::HashMap<uint64, uint32>               _constantMap;       // Key  computeTypeNameHash()
+
+        private:
+            // namespace   type ̸ó source  ״   ڿ Ѵ.
+            StringArena                                 _stringArena;
+        };
+    }
+}
+
+
+#include <MintCppHlsl/Include/Parser.inl>
+
+
+#endif // !MINT_CPP_PARSER_H
@@ -11,19 +11,20 @@ namespace mint
             , _registerIndex{ kInvalidRegisterIndex }
             , _inputSlot{ 0 }
             , _instanceDataStepRate{ 0 }
+            , _arrayCount{ 0 }
             , _size{ 0 }
             , _byteOffset{ 0 }
         {
             __noop;
         }
 
-        MINT_INLINE void TypeMetaData::setBaseData(const std::string& typeName, const bool isBuiltIn)
+        MINT_INLINE void TypeMetaData::setBaseData(const std::string_view typeName, const bool isBuiltIn)
         {
             _typeName = typeName;
             _isBuiltIn = isBuiltIn;
         }
 
-        MINT_INLINE void TypeMetaData::setDeclName(const std::string& declName)
+        MINT_INLINE void TypeMetaData::setDeclName(const std::string_view declName)
         {
             _declName = declName;
         }
@@ -38,7 +39,7 @@ namespace mint
             _byteOffset = byteOffset;
         }
 
-        MINT_INLINE void TypeMetaData::setSemanticName(const std::string& semanticName)
+        MINT_INLINE void TypeMetaData::setSemanticName(const std::string_view semanticName)
         {
             _semanticName = semanticName;
         }
@@ -58,6 +59,11 @@ namespace mint
             _instanceDataStepRate = instanceDataStepRate;
         }
 
+        MINT_INLINE void TypeMetaData::setArrayCount(const uint32 arrayCount)
+        {
+            _arrayCount = arrayCount;
+        }
+
         MINT_INLINE void TypeMetaData::pushMember(const TypeMetaData& member)
         {
             _memberArray.push_back(member);
@@ -78,12 +84,17 @@ namespace mint
             return (_registerIndex != kInvalidRegisterIndex);
         }
 
-        MINT_INLINE const std::string& TypeMetaData::getTypeName() const noexcept
+        MINT_INLINE const bool TypeMetaData::isArray() const noexcept
+        {
+            return (0 < _arrayCount);
+        }
+
+        MINT_INLINE const std::string_view TypeMetaData::getTypeName() const noexcept
         {
             return _typeName;
         }
 
-        MINT_INLINE const std::string& TypeMetaData::getDeclName() const noexcept
+        MINT_INLINE const std::string_view TypeMetaData::getDeclName() const noexcept
         {
             return _declName;
         }
@@ -98,7 +109,7 @@ namespace mint
             return _byteOffset;
         }
 
-        MINT_INLINE const std::string& TypeMetaData::getSemanticName() const noexcept
+        MINT_INLINE const std::string_view TypeMetaData::getSemanticName() const noexcept
         {
             return _semanticName;
         }
@@ -118,6 +129,16 @@ namespace mint
             return _instanceDataStepRate;
         }
 
+        MINT_INLINE const uint32 TypeMetaData::getArrayCount() const noexcept
+        {
+            return _arrayCount;
+        }
+
+        MINT_INLINE const uint32 TypeMetaData::getElementSize() const noexcept
+        {
+            return (isArray() == true) ? _size / _arrayCount : _size;
+        }
+
         MINT_INLINE const uint32 TypeMetaData::getMemberCount() const noexcept
         {
             return _memberArray.size();
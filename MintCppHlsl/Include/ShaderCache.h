@@ -0,0 +1,91 @@
+﻿#pragma once
+
+
+#ifndef MINT_SHADER_CACHE_H
+#define MINT_SHADER_CACHE_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+#include <MintContainer/Include/HashMap.h>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        // 이 값들 중 하나라도 바뀌면 다른 Shader binary 가 된다.
+        struct ShaderCacheKeyInput
+        {
+        public:
+                                                ShaderCacheKeyInput();
+                                                ~ShaderCacheKeyInput() = default;
+
+        public:
+            std::string_view                    _source;
+            mint::Vector<std::string_view>      _includeContents;   // Source 에서 #include 한 순서대로
+            mint::Vector<std::string_view>      _defines;           // "NAME=VALUE" 또는 값이 1 인 "NAME"
+            std::string_view                    _entryPoint;
+            std::string_view                    _targetProfile;     // 예: "ps_5_0"
+            uint32                              _compileFlags;      // Compiler 에 넘기는 debug, optimization 등의 flag
+        };
+
+
+        // Shader binary 를 내용의 hash (Key) 로 저장하는 Cache. D3D 에 의존하지 않는다.
+        // Manifest 에 Key 마다 binary 크기와 마지막으로 쓴 순서를 기록하고, 전체 크기가 capacity 를 넘으면 가장 오래 안 쓴 것부터 지운다.
+        class ShaderCache final
+        {
+            static constexpr const char* const  kManifestFileName = "ShaderCache.manifest";
+            static constexpr const char* const  kBinaryFileExtension = ".hlslbin";
+            static constexpr uint32             kManifestVersion = 1;
+
+            struct Entry
+            {
+                uint32                          _binarySize = 0;
+                uint64                          _lastUseTick = 0;
+            };
+
+        public:
+                                                ShaderCache(const char* const cacheDirectory, const uint64 capacity);
+                                                ShaderCache(const ShaderCache& rhs) = delete;
+                                                ~ShaderCache();
+
+        public:
+            static const uint64                 computeKey(const ShaderCacheKeyInput& keyInput) noexcept;
+            // #include <Name> 과 #include "Name" 의 Name 들을 source 에 나온 순서대로 채운다.
+            static void                         extractIncludeNames(const std::string_view source, mint::Vector<std::string_view>& outIncludeNames) noexcept;
+
+        public:
+            // Manifest 가 없거나 손상되었으면 빈 Cache 로 시작한다.
+            const bool                          loadManifest() noexcept;
+            const bool                          saveManifest() noexcept;
+
+        public:
+            // 찾으면 LRU 순서를 갱신한다. Manifest 에는 있지만 binary 파일이 없으면 Entry 를 지우고 false 를 반환한다.
+            const bool                          find(const uint64 key, std::string& outBinaryFilePath) noexcept;
+            const bool                          insert(const uint64 key, const byte* const binary, const uint32 binarySize) noexcept;
+            const bool                          contains(const uint64 key) const noexcept;
+
+        public:
+            const uint32                        getEntryCount() const noexcept;
+            const uint64                        getTotalSize() const noexcept;
+            std::string                         makeBinaryFilePath(const uint64 key) const noexcept;
+
+        private:
+            void                                evictIfNecessary() noexcept;
+            void                                eraseEntry(const uint64 key) noexcept;
+
+        private:
+            std::string                         _cacheDirectory;
+            uint64                              _capacity;      // Byte count
+            uint64                              _totalSize;     // Byte count
+            uint64                              _useTick;
+            bool                                _isManifestDirty;
+            mint::HashMap<uint64, Entry>        _entryMap;
+        };
+    }
+}
+
+
+#endif // !MINT_SHADER_CACHE_H
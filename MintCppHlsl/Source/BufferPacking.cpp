@@ -0,0 +1,219 @@
+﻿#include <MintCppHlsl/Include/BufferPacking.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <MintCppHlsl/Include/Parser.h>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+#pragma region Static function definitions
+        static MINT_INLINE const uint32 alignBufferPackingOffset(const uint32 byteOffset, const uint32 alignment) noexcept
+        {
+            return ((byteOffset + alignment - 1) / alignment) * alignment;
+        }
+
+        // struct 나 행렬, 배열처럼 cbuffer 에서 항상 새 register 에서 시작해야 하는 멤버인지
+        static MINT_INLINE const bool startsNewRegister(const TypeMetaData& memberTypeMetaData) noexcept
+        {
+            return (memberTypeMetaData.isBuiltIn() == false) || (memberTypeMetaData.isArray() == true) || (BufferPacking::kRegisterSize < memberTypeMetaData.getSize());
+        }
+#pragma endregion
+
+
+        PackedMember::PackedMember()
+            : _memberIndex{ 0 }
+            , _byteOffset{ 0 }
+            , _size{ 0 }
+        {
+            __noop;
+        }
+
+
+        BufferLayout::BufferLayout()
+            : _size{ 0 }
+            , _paddingSize{ 0 }
+        {
+            __noop;
+        }
+
+
+        namespace BufferPacking
+        {
+            void computeLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, BufferLayout& outLayout) noexcept
+            {
+                const uint32 memberCount = typeMetaData.getMemberCount();
+                mint::Vector<uint32> memberOrder(memberCount);
+                for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+                {
+                    memberOrder[memberIndex] = memberIndex;
+                }
+                computeLayout(typeMetaData, packingRule, memberOrder, outLayout);
+            }
+
+            void computeLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, const mint::Vector<uint32>& memberOrder, BufferLayout& outLayout) noexcept
+            {
+                MINT_ASSERT("김장원", memberOrder.size() == typeMetaData.getMemberCount(), "memberOrder 는 모든 멤버를 담고 있어야 합니다!");
+
+                outLayout._packedMemberArray.clear();
+                outLayout._packedMemberArray.reserve(memberOrder.size());
+
+                uint32 byteOffset = 0;
+                uint32 contentSize = 0; // 하위 struct 의 padding 을 뺀, 실제 데이터의 Byte count
+                const uint32 memberCount = memberOrder.size();
+                for (uint32 orderIndex = 0; orderIndex < memberCount; ++orderIndex)
+                {
+                    const uint32 memberIndex = memberOrder[orderIndex];
+                    const TypeMetaData& memberTypeMetaData = typeMetaData.getMember(memberIndex);
+
+                    uint32 memberSize = memberTypeMetaData.getElementSize();
+                    uint32 memberContentSize = memberSize;
+                    if (memberTypeMetaData.isBuiltIn() == false)
+                    {
+                        BufferLayout memberLayout;
+                        computeLayout(memberTypeMetaData, packingRule, memberLayout);
+                        memberSize = memberLayout._size;
+                        memberContentSize = memberLayout._size - memberLayout._paddingSize;
+                    }
+
+                    if (memberTypeMetaData.isArray() == true)
+                    {
+                        // cbuffer 에서는 마지막 원소를 뺀 원소들이 각각 register 를 통째로 차지한다.
+                        const uint32 arrayCount = memberTypeMetaData.getArrayCount();
+                        const uint32 elementStride = (packingRule == BufferPackingRule::ConstantBuffer) ? alignBufferPackingOffset(memberSize, kRegisterSize) : memberSize;
+                        memberSize = elementStride * (arrayCount - 1) + memberSize;
+                        memberContentSize *= arrayCount;
+                    }
+
+                    if (packingRule == BufferPackingRule::ConstantBuffer)
+                    {
+                        if (startsNewRegister(memberTypeMetaData) == true || isConstantBufferMemberPacked(byteOffset, memberSize) == false)
+                        {
+                            byteOffset = alignBufferPackingOffset(byteOffset, kRegisterSize);
+                        }
+                    }
+                    else
+                    {
+                        byteOffset = alignBufferPackingOffset(byteOffset, 4);
+                    }
+
+                    PackedMember packedMember;
+                    packedMember._memberIndex = memberIndex;
+                    packedMember._byteOffset = byteOffset;
+                    packedMember._size = memberSize;
+                    outLayout._packedMemberArray.push_back(packedMember);
+
+                    byteOffset += memberSize;
+                    contentSize += memberContentSize;
+
+                    // struct 다음 멤버도 새 register 에서 시작한다.
+                    if (packingRule == BufferPackingRule::ConstantBuffer && memberTypeMetaData.isBuiltIn() == false)
+                    {
+                        byteOffset = alignBufferPackingOffset(byteOffset, kRegisterSize);
+                    }
+                }
+
+                outLayout._size = alignBufferPackingOffset(byteOffset, (packingRule == BufferPackingRule::ConstantBuffer) ? kRegisterSize : 4);
+                outLayout._paddingSize = outLayout._size - contentSize;
+            }
+
+            const bool validateLayout(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, uint32& outMismatchMemberIndex) noexcept
+            {
+                BufferLayout layout;
+                computeLayout(typeMetaData, packingRule, layout);
+
+                const uint32 memberCount = typeMetaData.getMemberCount();
+                for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+                {
+                    const PackedMember& packedMember = layout._packedMemberArray[memberIndex];
+                    const TypeMetaData& memberTypeMetaData = typeMetaData.getMember(memberIndex);
+                    if (memberTypeMetaData.getByteOffset() != packedMember._byteOffset || memberTypeMetaData.getSize() != packedMember._size)
+                    {
+                        outMismatchMemberIndex = memberIndex;
+                        return false;
+                    }
+                }
+
+                if (typeMetaData.getSize() != layout._size)
+                {
+                    outMismatchMemberIndex = memberCount;
+                    return false;
+                }
+                return true;
+            }
+
+            void computeMinimumSizeMemberOrder(const TypeMetaData& typeMetaData, const BufferPackingRule packingRule, mint::Vector<uint32>& outMemberOrder) noexcept
+            {
+                const uint32 memberCount = typeMetaData.getMemberCount();
+                outMemberOrder.clear();
+                outMemberOrder.reserve(memberCount);
+
+                // StructuredBuffer 는 순서와 관계 없이 padding 이 생기지 않는다.
+                if (packingRule == BufferPackingRule::StructuredBuffer)
+                {
+                    for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+                    {
+                        outMemberOrder.push_back(memberIndex);
+                    }
+                    return;
+                }
+
+                // register 를 통째로 차지하는 멤버들은 선언 순서대로 앞에 둔다.
+                mint::Vector<uint32> smallMemberIndices;
+                for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+                {
+                    const TypeMetaData& memberTypeMetaData = typeMetaData.getMember(memberIndex);
+                    if (startsNewRegister(memberTypeMetaData) == true || memberTypeMetaData.getSize() == kRegisterSize)
+                    {
+                        outMemberOrder.push_back(memberIndex);
+                    }
+                    else
+                    {
+                        // 크기가 큰 순서로 (같으면 선언 순서로) 넣는다.
+                        uint32 at = smallMemberIndices.size();
+                        while (0 < at && typeMetaData.getMember(smallMemberIndices[at - 1]).getSize() < memberTypeMetaData.getSize())
+                        {
+                            --at;
+                        }
+                        smallMemberIndices.insert(memberIndex, at);
+                    }
+                }
+
+                // First-fit decreasing: 각 멤버를 들어갈 수 있는 첫 register 에 넣는다.
+                mint::Vector<uint32> registerUsedSizes;
+                mint::Vector<uint32> memberRegisterIndices(smallMemberIndices.size());
+                const uint32 smallMemberCount = smallMemberIndices.size();
+                for (uint32 smallMemberIndex = 0; smallMemberIndex < smallMemberCount; ++smallMemberIndex)
+                {
+                    const uint32 memberSize = typeMetaData.getMember(smallMemberIndices[smallMemberIndex]).getSize();
+                    uint32 registerIndex = 0;
+                    const uint32 registerCount = registerUsedSizes.size();
+                    while (registerIndex < registerCount && kRegisterSize < registerUsedSizes[registerIndex] + memberSize)
+                    {
+                        ++registerIndex;
+                    }
+                    if (registerIndex == registerCount)
+                    {
+                        registerUsedSizes.push_back(0);
+                    }
+                    registerUsedSizes[registerIndex] += memberSize;
+                    memberRegisterIndices[smallMemberIndex] = registerIndex;
+                }
+
+                const uint32 registerCount = registerUsedSizes.size();
+                for (uint32 registerIndex = 0; registerIndex < registerCount; ++registerIndex)
+                {
+                    for (uint32 smallMemberIndex = 0; smallMemberIndex < smallMemberCount; ++smallMemberIndex)
+                    {
+                        if (memberRegisterIndices[smallMemberIndex] == registerIndex)
+                        {
+                            outMemberOrder.push_back(smallMemberIndices[smallMemberIndex]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
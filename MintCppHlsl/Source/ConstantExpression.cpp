@@ -0,0 +1,423 @@
+﻿#include <MintCppHlsl/Include/ConstantExpression.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        ConstantExpressionEvaluator::ConstantExpressionEvaluator(const mint::Vector<SymbolTableItem>& symbolTable, const IConstantResolver& constantResolver)
+            : _symbolTable{ symbolTable }
+            , _constantResolver{ constantResolver }
+            , _symbolAt{ 0 }
+            , _endSymbolPosition{ 0 }
+            , _parenthesisDepth{ 0 }
+            , _errorSymbolPosition{ 0 }
+            , _errorMessage{ nullptr }
+        {
+            __noop;
+        }
+
+        const bool ConstantExpressionEvaluator::evaluate(const uint32 beginSymbolPosition, const uint32 endSymbolPosition, int64& outValue) noexcept
+        {
+            MINT_ASSERT("김장원", beginSymbolPosition <= endSymbolPosition && endSymbolPosition <= _symbolTable.size(), "Symbol 범위가 잘못되었습니다!");
+
+            _symbolAt = beginSymbolPosition;
+            _endSymbolPosition = endSymbolPosition;
+            _parenthesisDepth = 0;
+            _errorSymbolPosition = 0;
+            _errorMessage = nullptr;
+
+            int64 value = 0;
+            if (evaluateBinary(0, value) == false)
+            {
+                return false;
+            }
+
+            if (hasSymbol() == true)
+            {
+                return reportError(_symbolAt, "식이 끝나야 할 곳에 symbol 이 더 있습니다.");
+            }
+
+            outValue = value;
+            return true;
+        }
+
+        const uint32 ConstantExpressionEvaluator::getErrorSymbolPosition() const noexcept
+        {
+            return _errorSymbolPosition;
+        }
+
+        const char* ConstantExpressionEvaluator::getErrorMessage() const noexcept
+        {
+            return (_errorMessage == nullptr) ? "" : _errorMessage;
+        }
+
+        const bool ConstantExpressionEvaluator::parseIntegerLiteral(const std::string_view literal, int64& outValue) noexcept
+        {
+            uint64 length = literal.length();
+            while (0 < length && (literal[length - 1] == 'u' || literal[length - 1] == 'U' || literal[length - 1] == 'l' || literal[length - 1] == 'L'))
+            {
+                --length;
+            }
+            if (length == 0)
+            {
+                return false;
+            }
+
+            uint64 radix = 10;
+            uint64 at = 0;
+            if (2 < length && literal[0] == '0' && (literal[1] == 'x' || literal[1] == 'X'))
+            {
+                radix = 16;
+                at = 2;
+            }
+            else if (2 < length && literal[0] == '0' && (literal[1] == 'b' || literal[1] == 'B'))
+            {
+                radix = 2;
+                at = 2;
+            }
+            else if (1 < length && literal[0] == '0')
+            {
+                radix = 8;
+                at = 1;
+            }
+
+            uint64 value = 0;
+            for (; at < length; ++at)
+            {
+                const char ch = literal[at];
+                uint64 digit = radix;
+                if ('0' <= ch && ch <= '9')
+                {
+                    digit = static_cast<uint64>(ch) - '0';
+                }
+                else if ('a' <= ch && ch <= 'f')
+                {
+                    digit = static_cast<uint64>(ch) - 'a' + 10;
+                }
+                else if ('A' <= ch && ch <= 'F')
+                {
+                    digit = static_cast<uint64>(ch) - 'A' + 10;
+                }
+
+                if (radix <= digit || (kUint64Max - digit) / radix < value)
+                {
+                    return false;
+                }
+                value = value * radix + digit;
+            }
+
+            // 0xFFFFFFFFFFFFFFFF 처럼 int64 를 넘는 literal 은 C++ 처럼 bit 를 그대로 옮긴다.
+            outValue = static_cast<int64>(value);
+            return true;
+        }
+
+        const bool ConstantExpressionEvaluator::evaluateBinary(const int32 minPrecedence, int64& outValue) noexcept
+        {
+            int64 lhs = 0;
+            if (evaluateUnary(lhs) == false)
+            {
+                return false;
+            }
+
+            // Precedence climbing: 같은 우선순위는 왼쪽부터 묶는다.
+            while (hasSymbol() == true)
+            {
+                const int32 precedence = getBinaryOperatorPrecedence(_symbolTable[_symbolAt]);
+                if (precedence < minPrecedence)
+                {
+                    break;
+                }
+
+                const uint32 operatorPosition = _symbolAt;
+                ++_symbolAt;
+
+                int64 rhs = 0;
+                if (evaluateBinary(precedence + 1, rhs) == false)
+                {
+                    return false;
+                }
+
+                if (applyBinaryOperator(operatorPosition, lhs, rhs, lhs) == false)
+                {
+                    return false;
+                }
+            }
+
+            outValue = lhs;
+            return true;
+        }
+
+        const bool ConstantExpressionEvaluator::evaluateUnary(int64& outValue) noexcept
+        {
+            // 단항 연산자는 재귀 없이 모아 두었다가 안쪽 것부터 적용한다.
+            const uint32 unaryBeginPosition = _symbolAt;
+            while (hasSymbol() == true && isUnaryOperator(_symbolTable[_symbolAt]) == true)
+            {
+                ++_symbolAt;
+            }
+            const uint32 unaryEndPosition = _symbolAt;
+
+            int64 value = 0;
+            if (evaluatePrimary(value) == false)
+            {
+                return false;
+            }
+
+            for (uint32 unaryPosition = unaryEndPosition; unaryBeginPosition < unaryPosition; --unaryPosition)
+            {
+                const std::string_view unaryOperator = _symbolTable[unaryPosition - 1]._symbolString;
+                if (unaryOperator == "-")
+                {
+                    value = static_cast<int64>(0 - static_cast<uint64>(value));
+                }
+                else if (unaryOperator == "~")
+                {
+                    value = ~value;
+                }
+            }
+
+            outValue = value;
+            return true;
+        }
+
+        const bool ConstantExpressionEvaluator::evaluatePrimary(int64& outValue) noexcept
+        {
+            if (hasSymbol() == false)
+            {
+                return reportError(_symbolAt, "식이 끝나지 않았습니다.");
+            }
+
+            const SymbolTableItem& symbol = _symbolTable[_symbolAt];
+            if (symbol._symbolClassifier == SymbolClassifier::NumberLiteral)
+            {
+                if (parseIntegerLiteral(symbol._symbolString, outValue) == false)
+                {
+                    return reportError(_symbolAt, "정수 literal 이 잘못되었거나 64 비트를 넘습니다.");
+                }
+                ++_symbolAt;
+                return true;
+            }
+
+            if (isSymbol("(") == true)
+            {
+                const uint32 openPosition = _symbolAt;
+                if (kMaxParenthesisDepth <= _parenthesisDepth)
+                {
+                    return reportError(openPosition, "괄호가 너무 깊게 중첩되었습니다.");
+                }
+
+                ++_symbolAt;
+                ++_parenthesisDepth;
+                const bool isEvaluated = evaluateBinary(0, outValue);
+                --_parenthesisDepth;
+                if (isEvaluated == false)
+                {
+                    return false;
+                }
+
+                if (isSymbol(")") == false)
+                {
+                    return reportError(openPosition, "닫는 괄호가 없습니다.");
+                }
+                ++_symbolAt;
+                return true;
+            }
+
+            if (symbol._symbolString == "sizeof")
+            {
+                const uint32 sizeofPosition = _symbolAt;
+                ++_symbolAt;
+                if (isSymbol("(") == false)
+                {
+                    return reportError(sizeofPosition, "sizeof 뒤에는 (Type) 이 와야 합니다.");
+                }
+                ++_symbolAt;
+
+                std::string typeName;
+                if (parseQualifiedName(typeName) == false)
+                {
+                    return false;
+                }
+                if (isSymbol(")") == false)
+                {
+                    return reportError(sizeofPosition, "sizeof 의 닫는 괄호가 없습니다.");
+                }
+                ++_symbolAt;
+
+                uint32 typeSize = 0;
+                if (_constantResolver.resolveTypeSize(typeName, typeSize) == false)
+                {
+                    return reportError(sizeofPosition + 2, "알 수 없는 type 입니다.");
+                }
+                outValue = typeSize;
+                return true;
+            }
+
+            if (symbol._symbolClassifier == SymbolClassifier::Identifier || isSymbol("::") == true)
+            {
+                const uint32 namePosition = _symbolAt;
+                std::string name;
+                if (parseQualifiedName(name) == false)
+                {
+                    return false;
+                }
+
+                if (_constantResolver.resolveConstant(name, outValue) == false)
+                {
+                    return reportError(namePosition, "알 수 없는 상수입니다. (정수 상수만 쓸 수 있습니다)");
+                }
+                return true;
+            }
+
+            return reportError(_symbolAt, "상수 식에 쓸 수 없는 symbol 입니다.");
+        }
+
+        const bool ConstantExpressionEvaluator::parseQualifiedName(std::string& outName) noexcept
+        {
+            outName.clear();
+            if (isSymbol("::") == true)
+            {
+                ++_symbolAt;
+            }
+
+            while (true)
+            {
+                if (hasSymbol() == false || _symbolTable[_symbolAt]._symbolClassifier != SymbolClassifier::Identifier)
+                {
+                    return reportError(_symbolAt, "이름이 와야 합니다.");
+                }
+                outName.append(_symbolTable[_symbolAt]._symbolString);
+                ++_symbolAt;
+
+                if (isSymbol("::") == false)
+                {
+                    return true;
+                }
+                outName.append("::");
+                ++_symbolAt;
+            }
+        }
+
+        const bool ConstantExpressionEvaluator::applyBinaryOperator(const uint32 operatorPosition, const int64 lhs, const int64 rhs, int64& outValue) noexcept
+        {
+            // 덧셈, 뺄셈, 곱셈, 왼쪽 shift 는 uint64 로 계산해서 넘치면 C++ 의 unsigned 처럼 감싼다.
+            const uint64 unsignedLhs = static_cast<uint64>(lhs);
+            const uint64 unsignedRhs = static_cast<uint64>(rhs);
+            const std::string_view binaryOperator = _symbolTable[operatorPosition]._symbolString;
+            if (binaryOperator == "*")
+            {
+                outValue = static_cast<int64>(unsignedLhs * unsignedRhs);
+            }
+            else if (binaryOperator == "/" || binaryOperator == "%")
+            {
+                if (rhs == 0)
+                {
+                    return reportError(operatorPosition, "0 으로 나눌 수 없습니다.");
+                }
+                if (lhs == kInt64Min && rhs == -1)
+                {
+                    return reportError(operatorPosition, "나눗셈의 결과가 int64 를 넘습니다.");
+                }
+                outValue = (binaryOperator == "/") ? lhs / rhs : lhs % rhs;
+            }
+            else if (binaryOperator == "+")
+            {
+                outValue = static_cast<int64>(unsignedLhs + unsignedRhs);
+            }
+            else if (binaryOperator == "-")
+            {
+                outValue = static_cast<int64>(unsignedLhs - unsignedRhs);
+            }
+            else if (binaryOperator == "<<" || binaryOperator == ">>")
+            {
+                if (rhs < 0 || 64 <= rhs)
+                {
+                    return reportError(operatorPosition, "Shift 할 bit 수는 [0, 64) 여야 합니다.");
+                }
+                outValue = (binaryOperator == "<<") ? static_cast<int64>(unsignedLhs << rhs) : (lhs >> rhs);
+            }
+            else if (binaryOperator == "&")
+            {
+                outValue = lhs & rhs;
+            }
+            else if (binaryOperator == "^")
+            {
+                outValue = lhs ^ rhs;
+            }
+            else if (binaryOperator == "|")
+            {
+                outValue = lhs | rhs;
+            }
+            else
+            {
+                MINT_NEVER;
+            }
+            return true;
+        }
+
+        const bool ConstantExpressionEvaluator::hasSymbol() const noexcept
+        {
+            return _symbolAt < _endSymbolPosition;
+        }
+
+        const bool ConstantExpressionEvaluator::isSymbol(const char* const symbolString) const noexcept
+        {
+            return hasSymbol() == true && _symbolTable[_symbolAt]._symbolString == symbolString;
+        }
+
+        const int32 ConstantExpressionEvaluator::getBinaryOperatorPrecedence(const SymbolTableItem& symbol) noexcept
+        {
+            if (symbol._symbolClassifier != SymbolClassifier::ArithmeticOperator && symbol._symbolClassifier != SymbolClassifier::BitwiseOperator)
+            {
+                return -1;
+            }
+
+            const std::string_view binaryOperator = symbol._symbolString;
+            if (binaryOperator == "*" || binaryOperator == "/" || binaryOperator == "%")
+            {
+                return 5;
+            }
+            else if (binaryOperator == "+" || binaryOperator == "-")
+            {
+                return 4;
+            }
+            else if (binaryOperator == "<<" || binaryOperator == ">>")
+            {
+                return 3;
+            }
+            else if (binaryOperator == "&")
+            {
+                return 2;
+            }
+            else if (binaryOperator == "^")
+            {
+                return 1;
+            }
+            else if (binaryOperator == "|")
+            {
+                return 0;
+            }
+            return -1;
+        }
+
+        const bool ConstantExpressionEvaluator::isUnaryOperator(const SymbolTableItem& symbol) noexcept
+        {
+            if (symbol._symbolClassifier != SymbolClassifier::ArithmeticOperator && symbol._symbolClassifier != SymbolClassifier::BitwiseOperator)
+            {
+                return false;
+            }
+            return symbol._symbolString == "-" || symbol._symbolString == "+" || symbol._symbolString == "~";
+        }
+
+        const bool ConstantExpressionEvaluator::reportError(const uint32 symbolPosition, const char* const errorMessage) noexcept
+        {
+            // 식이 도중에 끝났으면 마지막 symbol 을 가리킨다.
+            _errorSymbolPosition = (symbolPosition < _endSymbolPosition || _endSymbolPosition == 0) ? symbolPosition : _endSymbolPosition - 1;
+            _errorMessage = errorMessage;
+            return false;
+        }
+    }
+}
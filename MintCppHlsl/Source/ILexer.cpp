@@ -1,26 +1,97 @@
-#include <stdafx.h>
-#include <MintRenderingBase/Include/CppHlsl/ILexer.h>
+#include <MintCppHlsl/Include/ILexer.h>
 
 #include <MintContainer/Include/Hash.hpp>
 #include <MintContainer/Include/Vector.hpp>
 #include <MintContainer/Include/StringUtil.hpp>
 #include <MintContainer/Include/HashMap.hpp>
 
+#include <MintMath/Include/SimdCommon.h>
+
 
 namespace mint
 {
     namespace CppHlsl
     {
+        LexemeDfa::State::State()
+            : _next{}
+            , _value{ kUint32Max }
+        {
+            __noop;
+        }
+
+        LexemeDfa::LexemeDfa()
+        {
+            _stateArray.push_back(State());
+        }
+
+        const bool LexemeDfa::insert(const char* const lexeme, const uint32 length, const uint32 value)
+        {
+            MINT_ASSERT("", 0 < length && length <= kMaxLexemeLength, "lexeme  ̰ ߸Ǿϴ!");
+
+            uint32 stateIndex = 0;
+            for (uint32 at = 0; at < length; ++at)
+            {
+                const uint8 input = static_cast<uint8>(lexeme[at]);
+                if (_stateArray[stateIndex]._next[input] == kNoTransition)
+                {
+                    _stateArray.push_back(State());
+                    _stateArray[stateIndex]._next[input] = static_cast<uint16>(_stateArray.size() - 1);
+                }
+                stateIndex = _stateArray[stateIndex]._next[input];
+            }
+
+            if (_stateArray[stateIndex]._value != kUint32Max)
+            {
+                return false;
+            }
+            _stateArray[stateIndex]._value = value;
+            return true;
+        }
+
+        const bool LexemeDfa::matchLongest(const char ch0, const char ch1, const char ch2, uint32& outLength, uint32& outValue) const noexcept
+        {
+            const char input[kMaxLexemeLength] = { ch0, ch1, ch2 };
+            bool isMatched = false;
+            uint32 stateIndex = 0;
+            for (uint32 at = 0; at < kMaxLexemeLength; ++at)
+            {
+                if (input[at] == 0)
+                {
+                    break;
+                }
+
+                stateIndex = _stateArray[stateIndex]._next[static_cast<uint8>(input[at])];
+                if (stateIndex == kNoTransition)
+                {
+                    break;
+                }
+
+                if (_stateArray[stateIndex]._value != kUint32Max)
+                {
+                    isMatched = true;
+                    outLength = at + 1;
+                    outValue = _stateArray[stateIndex]._value;
+                }
+            }
+            return isMatched;
+        }
+
+
         ILexer::ILexer()
             : _totalTimeMs{ 0 }
             , _escaper{ '\\' }
-            , _statementTerminator{ ';' }
+            , _statementTerminator{ 0 }
+            , _charClassTable{}
+            , _canSkipIdentifierWithSimd{ true }
+            , _grouperCloseTable{}
         {
-            __noop;
+            setStatementTerminator(';');
         }
 
         void ILexer::setSource(const std::string& source)
         {
+            //  source  Ű symbol   ̻   .
+            _symbolTable.clear();
             _source = source;
         }
 
@@ -31,14 +102,25 @@ namespace mint
 
         void ILexer::setStatementTerminator(const char statementTerminator)
         {
+            if (_statementTerminator != 0)
+            {
+                _charClassTable[static_cast<uint8>(_statementTerminator)] &= ~kCharClassStatementTerminator;
+            }
+
             _statementTerminator = statementTerminator;
+
+            if (_statementTerminator != 0)
+            {
+                addCharClass(_statementTerminator, kCharClassStatementTerminator);
+            }
         }
 
         void ILexer::registerDelimiter(const char delimiter)
         {
-            if (_delimiterUmap.find(delimiter).isValid() == false)
+            if (isDelimiter(delimiter) == false)
             {
-                _delimiterUmap.insert(delimiter, 1);
+                addCharClass(delimiter, kCharClassDelimiter);
+                _delimiterArray.push_back(delimiter);
             }
         }
 
@@ -55,12 +137,10 @@ namespace mint
             // OpenClose
             if (mint::StringUtil::strcmp(lineSkipperOpen, lineSkipperClose) == true)
             {
-                const uint64 keyOpenClose = (1 == lengthOpen) ? lineSkipperOpen[0] : static_cast<uint64>(lineSkipperOpen[1]) * 255 + lineSkipperOpen[0];
-                if (_lineSkipperUmap.find(keyOpenClose).isValid() == false)
+                if (_lineSkipperDfa.insert(lineSkipperOpen, lengthOpen, _lineSkipperTable.size()) == true)
                 {
                     _lineSkipperTable.push_back(LineSkipperTableItem(lineSkipperOpen, LineSkipperClassifier::OpenCloseMarker, 0));
-                    const uint32 lineSkipperIndex = _lineSkipperTable.size() - 1;
-                    _lineSkipperUmap.insert(keyOpenClose, lineSkipperIndex);
+                    addCharClass(lineSkipperOpen[0], kCharClassLineSkipperBegin);
                 }
                 return;
             }
@@ -68,20 +148,16 @@ namespace mint
             // Open & Close
             {
                 const uint16 nextGroupId = LineSkipperTableItem::getNextGroupId();
-                const uint64 keyOpen = (1 == lengthOpen) ? lineSkipperOpen[0] : static_cast<uint64>(lineSkipperOpen[1]) * 255 + lineSkipperOpen[0];
-                if (_lineSkipperUmap.find(keyOpen).isValid() == false)
+                if (_lineSkipperDfa.insert(lineSkipperOpen, lengthOpen, _lineSkipperTable.size()) == true)
                 {
                     _lineSkipperTable.push_back(LineSkipperTableItem(lineSkipperOpen, LineSkipperClassifier::OpenMarker, nextGroupId));
-                    const uint32 lineSkipperIndex = _lineSkipperTable.size() - 1;
-                    _lineSkipperUmap.insert(keyOpen, lineSkipperIndex);
+                    addCharClass(lineSkipperOpen[0], kCharClassLineSkipperBegin);
                 }
 
-                const uint64 keyClose = (1 == lengthClose) ? lineSkipperClose[0] : static_cast<uint64>(lineSkipperClose[1]) * 255 + lineSkipperClose[0];
-                if (_lineSkipperUmap.find(keyClose).isValid() == false)
+                if (_lineSkipperDfa.insert(lineSkipperClose, lengthClose, _lineSkipperTable.size()) == true)
                 {
                     _lineSkipperTable.push_back(LineSkipperTableItem(lineSkipperClose, LineSkipperClassifier::CloseMarker, nextGroupId));
-                    const uint32 lineSkipperIndex = _lineSkipperTable.size() - 1;
-                    _lineSkipperUmap.insert(keyClose, lineSkipperIndex);
+                    addCharClass(lineSkipperClose[0], kCharClassLineSkipperBegin);
                 }
             }
         }
@@ -95,12 +171,10 @@ namespace mint
                 return;
             }
 
-            const uint64 key = (1 == length) ? lineSkipper[0] : static_cast<uint64>(lineSkipper[1]) * 255 + lineSkipper[0];
-            if (_lineSkipperUmap.find(key).isValid() == false)
+            if (_lineSkipperDfa.insert(lineSkipper, length, _lineSkipperTable.size()) == true)
             {
                 _lineSkipperTable.push_back(LineSkipperTableItem(lineSkipper, LineSkipperClassifier::SingleMarker, 0));
-                const uint32 lineSkipperIndex = _lineSkipperTable.size() - 1;
-                _lineSkipperUmap.insert(key, lineSkipperIndex);
+                addCharClass(lineSkipper[0], kCharClassLineSkipperBegin);
             }
         }
 
@@ -109,7 +183,7 @@ namespace mint
             const uint64 hash = mint::computeHash(keyword);
             if (_keywordUmap.find(hash).isValid() == false)
             {
-                _keywordTable.push_back(keyword);
+                _keywordTable.push_back(_lexemeArena.intern(keyword));
                 const uint32 keywordIndex = _keywordTable.size() - 1;
                 _keywordUmap.insert(hash, keywordIndex);
             }
@@ -117,27 +191,17 @@ namespace mint
 
         void ILexer::registerGrouper(const char grouperOpen, const char grouperClose)
         {
-            if (_grouperUmap.find(grouperOpen).isValid() == false)
+            if ((_charClassTable[static_cast<uint8>(grouperOpen)] & (kCharClassGrouperOpen | kCharClassGrouperClose)) == 0)
             {
-                _grouperTable.push_back(GrouperTableItem(grouperOpen, GrouperClassifier::Open));
-                const uint32 grouperOpenIndex = _grouperTable.size() - 1;
-
-                _grouperTable.push_back(GrouperTableItem(grouperClose, GrouperClassifier::Close));
-                const uint32 grouperCloseIndex = _grouperTable.size() - 1;
-
-                _grouperUmap.insert(grouperOpen, grouperOpenIndex);
-                _grouperUmap.insert(grouperClose, grouperCloseIndex);
-
-                _grouperOpenToCloseMap.insert(grouperOpen, grouperClose);
+                addCharClass(grouperOpen, kCharClassGrouperOpen);
+                addCharClass(grouperClose, kCharClassGrouperClose);
+                _grouperCloseTable[static_cast<uint8>(grouperOpen)] = grouperClose;
             }
         }
 
         void ILexer::registerStringQuote(const char stringQuote)
         {
-            if (_stringQuoteUmap.find(stringQuote).isValid() == false)
-            {
-                _stringQuoteUmap.insert(stringQuote, 1);
-            }
+            addCharClass(stringQuote, kCharClassStringQuote);
         }
 
         void ILexer::registerPunctuator(const char* const punctuator)
@@ -149,13 +213,10 @@ namespace mint
                 return;
             }
 
-            const uint64 key = mint::computeHash(punctuator);
-            if (_punctuatorUmap.find(key).isValid() == false)
+            if (_punctuatorDfa.insert(punctuator, length, _punctuatorTable.size()) == true)
             {
-                _punctuatorTable.push_back(punctuator);
-
-                const uint32 punctuatorIndex = _punctuatorTable.size() - 1;
-                _punctuatorUmap.insert(key, punctuatorIndex);
+                _punctuatorTable.push_back(_lexemeArena.intern(punctuator));
+                addCharClass(punctuator[0], kCharClassPunctuatorBegin);
             }
         }
         
@@ -173,12 +234,10 @@ namespace mint
                 return;
             }
 
-            const uint64 key = (1 == length) ? operator_[0] : static_cast<uint64>(operator_[1]) * 255 + operator_[0];
-            if (_operatorUmap.find(key).isValid() == false)
+            if (_operatorDfa.insert(operator_, length, _operatorTable.size()) == true)
             {
                 _operatorTable.push_back(OperatorTableItem(operator_, operatorClassifier));
-                const uint32 operatorIndex = _operatorTable.size() - 1;
-                _operatorUmap.insert(key, operatorIndex);
+                addCharClass(operator_[0], kCharClassOperatorBegin);
             }
         }
 
@@ -205,42 +264,55 @@ namespace mint
         void ILexer::executeDefault(uint32& prevSourceAt, uint32& sourceAt)
         {
             const char ch0 = getCh0(sourceAt);
+            const uint8 charClass = _charClassTable[static_cast<uint8>(ch0)];
+            if (charClass == 0)
+            {
+                // з  ڴ  token  ϹǷ   ǳʶڴ.
+                sourceAt = skipUnclassified(sourceAt + 1);
+                return;
+            }
+
             const char ch1 = getCh1(sourceAt);
             const char ch2 = getCh2(sourceAt);
             
             uint32 advance = 0;
             SymbolClassifier symbolClassifier = SymbolClassifier::Identifier;
-            OperatorTableItem operatorTableItem;
-            GrouperTableItem grouperTableItem;
+            uint32 lexemeIndex = 0;
 
-            if (isDelimiter(ch0) == true)
+            if ((charClass & kCharClassDelimiter) != 0)
             {
+                if (sourceAt == prevSourceAt)
+                {
+                    // տ token   ̾ delimiter    ǳʶڴ.
+                    prevSourceAt = sourceAt = skipDelimiters(sourceAt + 1);
+                    return;
+                }
+
                 symbolClassifier = SymbolClassifier::Delimiter;
                 advance = 1;
             }
-            else if (isGrouper(ch0, grouperTableItem) == true)
+            else if ((charClass & (kCharClassGrouperOpen | kCharClassGrouperClose)) != 0)
             {
-                symbolClassifier = getSymbolClassifierFromGrouperClassifier(grouperTableItem._grouperClassifier);
+                symbolClassifier = getSymbolClassifierFromGrouperClassifier(((charClass & kCharClassGrouperOpen) != 0) ? GrouperClassifier::Open : GrouperClassifier::Close);
                 advance = 1;
             }
-            else if (isStringQuote(ch0) == true)
+            else if ((charClass & kCharClassStringQuote) != 0)
             {
                 symbolClassifier = SymbolClassifier::StringQuote;
                 advance = 1;
             }
-            else if (isPunctuator(ch0, ch1, ch2, advance) == true)
+            else if ((charClass & kCharClassPunctuatorBegin) != 0 && _punctuatorDfa.matchLongest(ch0, ch1, ch2, advance, lexemeIndex) == true)
             {
                 symbolClassifier = SymbolClassifier::Punctuator;
             }
-            else if (isStatementTerminator(ch0) == true)
+            else if ((charClass & kCharClassStatementTerminator) != 0)
             {
                 symbolClassifier = SymbolClassifier::StatementTerminator;
                 advance = 1;
             }
-            else if (isOperator(ch0, ch1, operatorTableItem) == true)
+            else if ((charClass & kCharClassOperatorBegin) != 0 && _operatorDfa.matchLongest(ch0, ch1, 0, advance, lexemeIndex) == true)
             {
-                symbolClassifier = getSymbolClassifierFromOperatorClassifier(operatorTableItem._operatorClassifier);
-                advance = operatorTableItem._length;
+                symbolClassifier = getSymbolClassifierFromOperatorClassifier(_operatorTable[lexemeIndex]._operatorClassifier);
             }
 
             advanceExecution(symbolClassifier, advance, prevSourceAt, sourceAt);
@@ -250,10 +322,6 @@ namespace mint
         {
             if (0 < advance)
             {
-                const char ch0 = getCh0(sourceAt);
-                const char ch1 = getCh1(sourceAt);
-                const char ch2 = getCh2(sourceAt);
-
                 const uint32 tokenLength = sourceAt - prevSourceAt;
                 if (symbolClassifier == SymbolClassifier::Delimiter)
                 {
@@ -276,7 +344,7 @@ namespace mint
 
                 if (0 < tokenLength)
                 {
-                    std::string tokenString = _source.substr(prevSourceAt, tokenLength);
+                    const std::string_view tokenString{ &_source[prevSourceAt], tokenLength };
                     SymbolClassifier tokenSymbolClassifier = SymbolClassifier::Identifier;
                     if (isNumber(tokenString) == true)
                     {
@@ -293,8 +361,8 @@ namespace mint
                 // Delimiter  ڱ ڽŵ symbol ̴!!!
                 if (symbolClassifier != SymbolClassifier::Delimiter)
                 {
-                    char symbolStringRaw[4] = { ch0, (2 == advance) ? ch1 : 0, (3 == advance) ? ch2 : 0, 0 };
-                    _symbolTable.push_back(SymbolTableItem(symbolClassifier, symbolStringRaw, sourceAt));
+                    const std::string_view symbolString{ &_source[sourceAt], advance };
+                    _symbolTable.push_back(SymbolTableItem(symbolClassifier, symbolString, sourceAt));
                 }
 
                 prevSourceAt = sourceAt + advance;
@@ -306,6 +374,86 @@ namespace mint
             ++sourceAt;
         }
 
+        const uint32 ILexer::skipUnclassified(const uint32 sourceAt) const noexcept
+        {
+            const char* const source = _source.c_str();
+            const uint32 sourceLength = static_cast<uint32>(_source.length());
+            uint32 at = sourceAt;
+#if defined MINT_MATH_USE_SIMD
+            if (_canSkipIdentifierWithSimd == true)
+            {
+                // [a-zA-Z0-9_]  16  ȮѴ. (0x80 ̻   񱳿 )
+                const __m128i lowerCaseBit = _mm_set1_epi8(0x20);
+                const __m128i beforeLowerA = _mm_set1_epi8('a' - 1);
+                const __m128i afterLowerZ = _mm_set1_epi8('z' + 1);
+                const __m128i beforeZero = _mm_set1_epi8('0' - 1);
+                const __m128i afterNine = _mm_set1_epi8('9' + 1);
+                const __m128i underscore = _mm_set1_epi8('_');
+                while (at + 16 <= sourceLength)
+                {
+                    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + at));
+                    const __m128i lowerCase = _mm_or_si128(chunk, lowerCaseBit);
+                    const __m128i isAlphabet = _mm_and_si128(_mm_cmpgt_epi8(lowerCase, beforeLowerA), _mm_cmplt_epi8(lowerCase, afterLowerZ));
+                    const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chunk, beforeZero), _mm_cmplt_epi8(chunk, afterNine));
+                    const __m128i isIdentifier = _mm_or_si128(_mm_or_si128(isAlphabet, isDigit), _mm_cmpeq_epi8(chunk, underscore));
+                    const int32 mask = _mm_movemask_epi8(isIdentifier) ^ 0xFFFF;
+                    if (mask != 0)
+                    {
+                        at += findFirstSetBit(static_cast<uint32>(mask));
+                        break;
+                    }
+                    at += 16;
+                }
+            }
+#endif
+            while (at < sourceLength && _charClassTable[static_cast<uint8>(source[at])] == 0)
+            {
+                ++at;
+            }
+            return at;
+        }
+
+        const uint32 ILexer::skipDelimiters(const uint32 sourceAt) const noexcept
+        {
+            const char* const source = _source.c_str();
+            const uint32 sourceLength = static_cast<uint32>(_source.length());
+            uint32 at = sourceAt;
+#if defined MINT_MATH_USE_SIMD
+            const uint32 delimiterCount = _delimiterArray.size();
+            while (at + 16 <= sourceLength)
+            {
+                const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + at));
+                __m128i isDelimiter = _mm_setzero_si128();
+                for (uint32 delimiterIndex = 0; delimiterIndex < delimiterCount; ++delimiterIndex)
+                {
+                    isDelimiter = _mm_or_si128(isDelimiter, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(_delimiterArray[delimiterIndex])));
+                }
+                const int32 mask = _mm_movemask_epi8(isDelimiter) ^ 0xFFFF;
+                if (mask != 0)
+                {
+                    return at + findFirstSetBit(static_cast<uint32>(mask));
+                }
+                at += 16;
+            }
+#endif
+            while (at < sourceLength && (_charClassTable[static_cast<uint8>(source[at])] & kCharClassDelimiter) != 0)
+            {
+                ++at;
+            }
+            return at;
+        }
+
+        void ILexer::addCharClass(const char input, const uint8 charClass) noexcept
+        {
+            _charClassTable[static_cast<uint8>(input)] |= charClass;
+
+            const bool isIdentifierCharacter = ('a' <= input && input <= 'z') || ('A' <= input && input <= 'Z') || ('0' <= input && input <= '9') || (input == '_');
+            if (isIdentifierCharacter == true)
+            {
+                _canSkipIdentifierWithSimd = false;
+            }
+        }
+
         void ILexer::endExecution()
         {
             // String Literal
@@ -347,109 +495,82 @@ namespace mint
 
         const bool ILexer::isDelimiter(const char input) const noexcept
         {
-            return _delimiterUmap.find(input).isValid() == true;
+            return (_charClassTable[static_cast<uint8>(input)] & kCharClassDelimiter) != 0;
         }
 
         const bool ILexer::isLineSkipper(const char ch0, const char ch1, LineSkipperTableItem& out) const noexcept
         {
-            //   2 LineSkipper  Ȯ 
-            // ƴ϶  1 LineSkipper  Ȯ
-            const uint64 key = static_cast<uint64>(ch1) * 255 + ch0;
-            auto found = _lineSkipperUmap.find(key);
-            if (found.isValid() == false)
+            if ((_charClassTable[static_cast<uint8>(ch0)] & kCharClassLineSkipperBegin) == 0)
             {
-                auto found0 = _lineSkipperUmap.find(ch0);
-                if (found0.isValid() == false)
-                {
-                    return false;
-                }
+                return false;
+            }
 
-                out = _lineSkipperTable[*found0._value];
-                return true;
+            //  2 LineSkipper   1 LineSkipper  켱Ѵ.
+            uint32 length = 0;
+            uint32 lineSkipperIndex = 0;
+            if (_lineSkipperDfa.matchLongest(ch0, ch1, 0, length, lineSkipperIndex) == false)
+            {
+                return false;
             }
 
-            out = _lineSkipperTable[*found._value];
+            out = _lineSkipperTable[lineSkipperIndex];
             return true;
         }
 
         const bool ILexer::isStatementTerminator(const char input) const noexcept
         {
-            return (0 == _statementTerminator) ? false : (_statementTerminator == input);
+            return (_charClassTable[static_cast<uint8>(input)] & kCharClassStatementTerminator) != 0;
         }
 
         const bool ILexer::isGrouper(const char input, GrouperTableItem& out) const noexcept
         {
-            auto found = _grouperUmap.find(input);
-            if (found.isValid() == false)
+            const uint8 charClass = _charClassTable[static_cast<uint8>(input)];
+            if ((charClass & (kCharClassGrouperOpen | kCharClassGrouperClose)) == 0)
             {
                 return false;
             }
 
-            out = _grouperTable[*found._value];
+            out = GrouperTableItem(input, ((charClass & kCharClassGrouperOpen) != 0) ? GrouperClassifier::Open : GrouperClassifier::Close);
             return true;
         }
 
         const bool ILexer::isStringQuote(const char input) const noexcept
         {
-            return _stringQuoteUmap.find(input).isValid() == true;
+            return (_charClassTable[static_cast<uint8>(input)] & kCharClassStringQuote) != 0;
         }
 
         const bool ILexer::isPunctuator(const char ch0, const char ch1, const char ch2, uint32& outAdvance) const noexcept
         {
-            const char keyString3[4]{ ch0, ch1, ch2, '\0' };
-            const uint64 key3 = mint::computeHash(keyString3);
-            auto found3 = _punctuatorUmap.find(key3);
-            if (found3.isValid() == true)
-            {
-                outAdvance = 3;
-                return true;
-            }
-
-            const char keyString2[3]{ ch0, ch1, '\0' };
-            const uint64 key2 = mint::computeHash(keyString2);
-            auto found2 = _punctuatorUmap.find(key2);
-            if (found2.isValid() == true)
-            {
-                outAdvance = 2;
-                return true;
-            }
-
-            const char keyString1[2]{ ch0, '\0' };
-            const uint64 key1 = mint::computeHash(keyString1);
-            auto found1 = _punctuatorUmap.find(key1);
-            if (found1.isValid() == true)
+            outAdvance = 0;
+            if ((_charClassTable[static_cast<uint8>(ch0)] & kCharClassPunctuatorBegin) == 0)
             {
-                outAdvance = 1;
-                return true;
+                return false;
             }
 
-            outAdvance = 0;
-            return false;
+            uint32 punctuatorIndex = 0;
+            return _punctuatorDfa.matchLongest(ch0, ch1, ch2, outAdvance, punctuatorIndex);
         }
 
         const bool ILexer::isOperator(const char ch0, const char ch1, OperatorTableItem& out) const noexcept
         {
-            //   2 Operator  Ȯ 
-            // ƴ϶  1 Operator  Ȯ
-            const uint64 key = static_cast<uint64>(ch1) * 255 + ch0;
-            auto found = _operatorUmap.find(key);
-            if (found.isValid() == false)
+            if ((_charClassTable[static_cast<uint8>(ch0)] & kCharClassOperatorBegin) == 0)
             {
-                auto found0 = _operatorUmap.find(ch0);
-                if (found0.isValid() == false)
-                {
-                    return false;
-                }
+                return false;
+            }
 
-                out = _operatorTable[*found0._value];
-                return true;
+            //  2 Operator   1 Operator  켱Ѵ.
+            uint32 length = 0;
+            uint32 operatorIndex = 0;
+            if (_operatorDfa.matchLongest(ch0, ch1, 0, length, operatorIndex) == false)
+            {
+                return false;
             }
 
-            out = _operatorTable[*found._value];
+            out = _operatorTable[operatorIndex];
             return true;
         }
 
-        const bool ILexer::isNumber(const std::string& input) const noexcept
+        const bool ILexer::isNumber(const std::string_view input) const noexcept
         {
             if (input.empty() == true)
             {
@@ -478,9 +599,9 @@ namespace mint
             return false;
         }
 
-        const bool ILexer::isKeyword(const std::string& input) const noexcept
+        const bool ILexer::isKeyword(const std::string_view input) const noexcept
         {
-            return _keywordUmap.find(mint::computeHash(input.c_str())).isValid() == true;
+            return _keywordUmap.find(mint::computeHash(input.data(), static_cast<uint32>(input.length()))).isValid() == true;
         }
 
         const uint32 ILexer::getSymbolCount() const noexcept
@@ -500,7 +621,7 @@ namespace mint
 
         const char ILexer::getGrouperClose(const char grouperOpen) const noexcept
         {
-            return *_grouperOpenToCloseMap.find(grouperOpen)._value;
+            return _grouperCloseTable[static_cast<uint8>(grouperOpen)];
         }
     }
 }
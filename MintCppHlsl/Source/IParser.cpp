@@ -1,7 +1,6 @@
-#include <stdafx.h>
-#include <MintRenderingBase/Include/CppHlsl/IParser.h>
+#include <MintCppHlsl/Include/IParser.h>
 
-#include <MintRenderingBase/Include/CppHlsl/ILexer.h>
+#include <MintCppHlsl/Include/ILexer.h>
 #include <MintContainer/Include/Tree.hpp>
 
 
@@ -0,0 +1,361 @@
+#include <MintCppHlsl/Include/Interpreter.h>
+#include <MintCppHlsl/Include/BufferPacking.h>
+
+#include <MintCommon/Include/ParallelFor.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+#include <MintContainer/Include/Hash.hpp>
+#include <MintContainer/Include/StringUtil.hpp>
+
+#include <MintPlatform/Include/TextFile.h>
+#include <MintPlatform/Include/BinaryFile.hpp>
+#include <MintPlatform/Include/FileUtil.hpp>
+
+#include <filesystem>
+#include <typeindex>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        Interpreter::Interpreter()
+            : _parser{ _lexer }
+            , _fileType{}
+            , _isLoadedFromCache{ false }
+        {
+            __noop;
+        }
+
+        const bool Interpreter::parseCppHlslFile(const char* const fileName)
+        {
+            TextFileReader textFileReader;
+            if (textFileReader.open(fileName) == false)
+            {
+                MINT_LOG("", "CppHlsl [%s]    ߽ϴ!!", fileName);
+                return false;
+            }
+
+            _isLoadedFromCache = false;
+
+            _lexer.setSource(textFileReader.get());
+            _lexer.execute();
+
+            return _parser.execute();
+        }
+
+        const bool Interpreter::parseCppHlslFiles(const char* const* const fileNames, const uint32 fileCount)
+        {
+            _isLoadedFromCache = false;
+
+            // Lexer  ڴ LineSkipper  GroupId  static  ޾ƿǷ worker   thread  ̸  д.
+            Interpreter* workers = MINT_NEW_ARRAY(Interpreter, fileCount);
+            mint::Vector<bool> isParsed(fileCount);
+            mint::parallelFor(fileCount, 1, [&](const uint32 begin, const uint32 end)
+                {
+                    for (uint32 fileIndex = begin; fileIndex < end; ++fileIndex)
+                    {
+                        isParsed[fileIndex] = workers[fileIndex].parseCppHlslFile(fileNames[fileIndex]);
+                    }
+                }
+            );
+
+            bool result = true;
+            mint::Vector<const Parser*> parsers;
+            parsers.reserve(fileCount);
+            for (uint32 fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+            {
+                if (isParsed[fileIndex] == false)
+                {
+                    MINT_LOG("", "CppHlsl [%s]  parse  ߽ϴ!", fileNames[fileIndex]);
+                    result = false;
+                }
+                parsers.push_back(&workers[fileIndex]._parser);
+            }
+
+            if (result == true)
+            {
+                std::string_view conflictingTypeName;
+                uint32 conflictingFileIndex = 0;
+                if (_parser.mergeTypeMetaDatas(parsers.data(), fileCount, conflictingTypeName, conflictingFileIndex) == false)
+                {
+                    MINT_LOG("", "Type ̳ [%.*s]  CppHlsl [%s]  ٸ ٽ ǵǾϴ!", 
+                        static_cast<int32>(conflictingTypeName.length()), conflictingTypeName.data(), fileNames[conflictingFileIndex]);
+                    result = false;
+                }
+            }
+
+            MINT_DELETE_ARRAY(workers);
+            return result;
+        }
+
+        const bool Interpreter::interpretCppHlslFile(const char* const fileName, const CppHlslFileType fileType, const char* const cacheDirectory)
+        {
+            TextFileReader textFileReader;
+            if (textFileReader.open(fileName) == false)
+            {
+                MINT_LOG("", "CppHlsl [%s]    ߽ϴ!!", fileName);
+                return false;
+            }
+
+            const char* const source = textFileReader.get();
+            const uint32 sourceLength = mint::StringUtil::strlen(source);
+            const uint64 sourceHash = mint::computeHash(source, sourceLength);
+
+            const std::string cacheFileName = makeCacheFileName(fileName, fileType, cacheDirectory);
+
+            _fileType = fileType;
+            if (loadCacheFile(cacheFileName.c_str(), sourceHash, sourceLength) == true)
+            {
+                _isLoadedFromCache = true;
+                return true;
+            }
+
+            _isLoadedFromCache = false;
+
+            _lexer.setSource(source);
+            _lexer.execute();
+            if (_parser.execute() == false)
+            {
+                return false;
+            }
+
+            generateHlslString(fileType);
+
+            if (mint::FileUtil::exists(cacheDirectory) == false && mint::FileUtil::createDirectory(cacheDirectory) == false)
+            {
+                MINT_LOG("", "[%s]  ߽ϴ!", cacheDirectory);
+            }
+            else if (saveCacheFile(cacheFileName.c_str(), sourceHash, sourceLength) == false)
+            {
+                MINT_LOG("", "CppHlsl Cache [%s]   ߽ϴ!", cacheFileName.c_str());
+            }
+            return true;
+        }
+
+        void Interpreter::generateHlslString(const CppHlslFileType fileType)
+        {
+            _fileType = fileType;
+
+            _hlslString.clear();
+            _hlslString.append(_parser.serializeConstantsToHlsl());
+
+            const uint32 typeMetaDataCount = _parser.getTypeMetaDataCount();
+            if (_fileType == CppHlslFileType::StructuredBuffers)
+            {
+                for (uint32 typeMetaDataIndex = 0; typeMetaDataIndex < typeMetaDataCount; ++typeMetaDataIndex)
+                {
+                    const TypeMetaData& typeMetaData = _parser.getTypeMetaData(typeMetaDataIndex);
+                    if (typeMetaData.isBuiltIn() == true)
+                    {
+                        continue;
+                    }
+
+                    _hlslString.append(_parser.serializeCppHlslTypeToHlslStructuredBufferDefinition(typeMetaData));
+                }
+            }
+
+            uint32 bufferIndex = 0;
+            uint32 structuredBufferIndex = 0;
+            for (uint32 typeMetaDataIndex = 0; typeMetaDataIndex < typeMetaDataCount; ++typeMetaDataIndex)
+            {
+                const TypeMetaData& typeMetaData = _parser.getTypeMetaData(typeMetaDataIndex);
+                if (typeMetaData.isBuiltIn() == true)
+                {
+                    continue;
+                }
+
+                if (_fileType == CppHlslFileType::StreamData)
+                {
+                    _hlslString.append(_parser.serializeCppHlslTypeToHlslStreamDatum(typeMetaData));
+                }
+                else if (_fileType == CppHlslFileType::ConstantBuffers)
+                {
+                    _hlslString.append(_parser.serializeCppHlslTypeToHlslConstantBuffer(typeMetaData, bufferIndex));
+                    warnConstantBufferLayoutMismatch(typeMetaData);
+
+                    ++bufferIndex;
+                }
+            }
+
+            if (_hlslString.empty() == true)
+            {
+                MINT_LOG_ERROR("", "Hlsl String  Generate  ߽ϴ!! typeMetaDataCount: %d", typeMetaDataCount);
+            }
+        }
+
+        // C++ ü ״ cbuffer  ϹǷ layout  ٸ  ߳. (: float 迭 Ҵ   register  Ѵ)
+        void Interpreter::warnConstantBufferLayoutMismatch(const TypeMetaData& typeMetaData) const noexcept
+        {
+            uint32 mismatchMemberIndex = 0;
+            if (BufferPacking::validateLayout(typeMetaData, BufferPackingRule::ConstantBuffer, mismatchMemberIndex) == true)
+            {
+                return;
+            }
+
+            const std::string_view typeName = typeMetaData.getTypeName();
+            if (mismatchMemberIndex < typeMetaData.getMemberCount())
+            {
+                const std::string_view declName = typeMetaData.getMember(mismatchMemberIndex).getDeclName();
+                MINT_LOG("", "cbuffer[%.*s]  [%.*s]  C++ offset  HLSL offset  ٸϴ!", static_cast<int32>(typeName.length()), typeName.data(), static_cast<int32>(declName.length()), declName.data());
+            }
+            else
+            {
+                MINT_LOG("", "cbuffer[%.*s]  C++ ũⰡ HLSL ũ ٸϴ!", static_cast<int32>(typeName.length()), typeName.data());
+            }
+        }
+
+        void Interpreter::generateLayoutJsonString()
+        {
+            _layoutJsonString.clear();
+            _layoutJsonString.append("{\n\t\"types\": [");
+
+            bool isFirstType = true;
+            const uint32 typeMetaDataCount = _parser.getTypeMetaDataCount();
+            for (uint32 typeMetaDataIndex = 0; typeMetaDataIndex < typeMetaDataCount; ++typeMetaDataIndex)
+            {
+                const TypeMetaData& typeMetaData = _parser.getTypeMetaData(typeMetaDataIndex);
+                if (typeMetaData.isBuiltIn() == true)
+                {
+                    continue;
+                }
+
+                _layoutJsonString.append((isFirstType == true) ? "\n" : ",\n");
+                _layoutJsonString.append(_parser.serializeCppHlslTypeToLayoutJson(typeMetaData));
+                isFirstType = false;
+            }
+
+            _layoutJsonString.append((isFirstType == true) ? "]\n}\n" : "\n\t]\n}\n");
+        }
+
+        const char* Interpreter::getHlslString() const noexcept
+        {
+            return _hlslString.c_str();
+        }
+
+        const char* Interpreter::getLayoutJsonString() const noexcept
+        {
+            return _layoutJsonString.c_str();
+        }
+
+        const bool Interpreter::isLoadedFromCache() const noexcept
+        {
+            return _isLoadedFromCache;
+        }
+
+        std::string Interpreter::makeCacheFileName(const char* const fileName, const CppHlslFileType fileType, const char* const cacheDirectory)
+        {
+            const std::string fullPath = std::filesystem::absolute(fileName).lexically_normal().generic_string();
+            const uint64 fullPathHash = mint::computeHash(fullPath.c_str(), static_cast<uint32>(fullPath.length()));
+
+            std::string stem{ fileName };
+            const uint64 lastSlashPosition = stem.find_last_of("/\\");
+            if (lastSlashPosition != std::string::npos)
+            {
+                stem = stem.substr(lastSlashPosition + 1);
+            }
+            mint::StringUtil::excludeExtension(stem);
+
+            // : CppHlslStreamData.0.0123456789ABCDEF.cpphlslcache
+            char suffix[32]{};
+            mint::formatString(suffix, ".%u.%016llX", static_cast<uint32>(fileType), static_cast<unsigned long long>(fullPathHash));
+
+            std::string cacheFileName{ cacheDirectory };
+            cacheFileName.append(stem);
+            cacheFileName.append(suffix);
+            cacheFileName.append(kCacheFileExtension);
+            return cacheFileName;
+        }
+
+        // Cache  ų ջǾ ٽ Parse ϸ ǹǷ   ʴ´.
+        const bool Interpreter::loadCacheFile(const char* const cacheFileName, const uint64 sourceHash, const uint32 sourceLength)
+        {
+            if (mint::FileUtil::exists(cacheFileName) == false)
+            {
+                return false;
+            }
+
+            BinaryFileReader binaryFileReader;
+            if (binaryFileReader.open(cacheFileName) == false)
+            {
+                return false;
+            }
+
+            // Header: magic number, version, file type, source length, source hash
+            const char* const magicNumber = binaryFileReader.read<char>(4);
+            const uint32* const header = binaryFileReader.read<uint32>(3);
+            const uint64* const cachedSourceHash = binaryFileReader.read<uint64>();
+            if (magicNumber == nullptr || header == nullptr || cachedSourceHash == nullptr)
+            {
+                return false;
+            }
+
+            if (mint::StringUtil::strcmp(magicNumber, "CHC") == false || header[0] != kCacheFileVersion
+                || header[1] != static_cast<uint32>(_fileType) || header[2] != sourceLength || *cachedSourceHash != sourceHash)
+            {
+                return false;
+            }
+
+            if (_parser.deserializeTypeMetaDatas(binaryFileReader) == false)
+            {
+                MINT_LOG("", "CppHlsl Cache [%s]  ջǾϴ!", cacheFileName);
+                return false;
+            }
+
+            const uint32* const hlslStringLength = binaryFileReader.read<uint32>();
+            const char* const hlslString = (hlslStringLength == nullptr) ? nullptr : binaryFileReader.read<char>(*hlslStringLength);
+            if (hlslString == nullptr)
+            {
+                MINT_LOG("", "CppHlsl Cache [%s]  ջǾϴ!", cacheFileName);
+                return false;
+            }
+
+            _hlslString.assign(hlslString, *hlslStringLength);
+            return true;
+        }
+
+        const bool Interpreter::saveCacheFile(const char* const cacheFileName, const uint64 sourceHash, const uint32 sourceLength) const
+        {
+            BinaryFileWriter binaryFileWriter;
+            binaryFileWriter.write("CHC");
+            binaryFileWriter.write(kCacheFileVersion);
+            binaryFileWriter.write(static_cast<uint32>(_fileType));
+            binaryFileWriter.write(sourceLength);
+            binaryFileWriter.write(sourceHash);
+
+            _parser.serializeTypeMetaDatas(binaryFileWriter);
+
+            binaryFileWriter.write(static_cast<uint32>(_hlslString.length()));
+            binaryFileWriter.writeSpan(_hlslString.c_str(), static_cast<uint32>(_hlslString.length()));
+            return binaryFileWriter.save(cacheFileName);
+        }
+
+        const uint32 Interpreter::getTypeMetaDataCount() const noexcept
+        {
+            return _parser.getTypeMetaDataCount();
+        }
+
+        const TypeMetaData& Interpreter::getTypeMetaData(const uint32 typeIndex) const noexcept
+        {
+            return _parser.getTypeMetaData(typeIndex);
+        }
+
+        const TypeMetaData& Interpreter::getTypeMetaData(const std::string& typeName) const noexcept
+        {
+            return _parser.getTypeMetaData(typeName);
+        }
+
+        const TypeMetaData& Interpreter::getTypeMetaData(const std::type_info& stdTypeInfo) const noexcept
+        {
+            std::string stdTypeName = stdTypeInfo.name();
+            const uint64 firstSpacePosition = stdTypeName.find(' ');
+            if (firstSpacePosition != std::string::npos)
+            {
+                stdTypeName = stdTypeName.substr(firstSpacePosition + 1);
+            }
+            return getTypeMetaData(stdTypeName);
+        }
+
+    }
+}
@@ -0,0 +1,82 @@
+﻿#include <MintCppHlsl/Include/LanguageCommon.h>
+
+#include <MintContainer/Include/Hash.hpp>
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        StringArena::StringArena()
+            : _chunkAt{ 0 }
+            , _chunkUsedLength{ 0 }
+            , _totalUsedLength{ 0 }
+        {
+            __noop;
+        }
+
+        StringArena::~StringArena()
+        {
+            const uint32 chunkCount = _chunkArray.size();
+            for (uint32 chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+            {
+                MINT_DELETE_ARRAY(_chunkArray[chunkIndex]._rawMemory);
+            }
+        }
+
+        const std::string_view StringArena::intern(const std::string_view string) noexcept
+        {
+            const uint32 length = static_cast<uint32>(string.length());
+            const uint64 hash = mint::computeHash(string.data(), length);
+            const KeyValuePair found = _internMap.find(hash);
+            if (found.isValid() == true && *found._value == string)
+            {
+                return *found._value;
+            }
+
+            char* const rawString = allocate(length);
+            memcpy(rawString, string.data(), length);
+            const std::string_view interned{ rawString, length };
+            if (found.isValid() == false)
+            {
+                // hash 가 충돌하면 등록하지 않고 따로 저장만 한다.
+                _internMap.insert(hash, interned);
+            }
+            return interned;
+        }
+
+        char* StringArena::allocate(const uint32 length) noexcept
+        {
+            const uint32 lengthNullIncluded = length + 1;
+            while (_chunkAt < _chunkArray.size() && _chunkArray[_chunkAt]._capacity < _chunkUsedLength + lengthNullIncluded)
+            {
+                ++_chunkAt;
+                _chunkUsedLength = 0;
+            }
+
+            if (_chunkAt == _chunkArray.size())
+            {
+                Chunk chunk;
+                chunk._capacity = max(kDefaultChunkCapacity, lengthNullIncluded);
+                chunk._rawMemory = MINT_NEW_ARRAY(char, chunk._capacity);
+                _chunkArray.push_back(chunk);
+            }
+
+            char* const result = &_chunkArray[_chunkAt]._rawMemory[_chunkUsedLength];
+            result[length] = 0;
+            _chunkUsedLength += lengthNullIncluded;
+            _totalUsedLength += lengthNullIncluded;
+            return result;
+        }
+
+        void StringArena::reset() noexcept
+        {
+            _chunkAt = 0;
+            _chunkUsedLength = 0;
+            _totalUsedLength = 0;
+            _internMap.clear();
+        }
+    }
+}
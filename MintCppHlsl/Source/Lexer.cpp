@@ -1,5 +1,4 @@
-#include <stdafx.h>
-#include <MintRenderingBase/Include/CppHlsl/Lexer.h>
+#include <MintCppHlsl/Include/Lexer.h>
 
 #include <MintContainer/Include/StringUtil.hpp>
 #include <MintContainer/Include/HashMap.hpp>
@@ -36,10 +35,28 @@ namespace mint
             registerPunctuator("#");
             registerPunctuator("::");
 
+            //   (迭 ũ, register index )   ڵ
+            registerOperator("=", OperatorClassifier::AssignmentOperator);
+            registerOperator("+", OperatorClassifier::ArithmeticOperator);
+            registerOperator("-", OperatorClassifier::ArithmeticOperator);
+            registerOperator("*", OperatorClassifier::ArithmeticOperator);
+            registerOperator("/", OperatorClassifier::ArithmeticOperator);
+            registerOperator("%", OperatorClassifier::ArithmeticOperator);
+            registerOperator("<<", OperatorClassifier::BitwiseOperator);
+            registerOperator(">>", OperatorClassifier::BitwiseOperator);
+            registerOperator("&", OperatorClassifier::BitwiseOperator);
+            registerOperator("|", OperatorClassifier::BitwiseOperator);
+            registerOperator("^", OperatorClassifier::BitwiseOperator);
+            registerOperator("~", OperatorClassifier::BitwiseOperator);
+
             registerKeyword("struct");
             registerKeyword("using");
             registerKeyword("namespace");
             registerKeyword("alignas");
+            registerKeyword("static");
+            registerKeyword("constexpr");
+            registerKeyword("const");
+            registerKeyword("sizeof");
         }
 
         Lexer::Lexer(const std::string& source)
@@ -0,0 +1,1330 @@
+#include <MintCppHlsl/Include/Parser.h>
+
+#include <MintContainer/Include/Hash.hpp>
+#include <MintContainer/Include/BitVector.hpp>
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/StringUtil.hpp>
+#include <MintContainer/Include/Tree.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+#include <MintPlatform/Include/BinaryFile.hpp>
+
+#include <MintCppHlsl/Include/ILexer.h>
+
+#include <functional>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+        namespace TypeUtils
+        {
+            const std::string_view extractPureTypeName(const std::string_view typeFullName) noexcept
+            {
+                const size_t found = typeFullName.find_last_of("::");
+                if (std::string_view::npos != found)
+                {
+                    return typeFullName.substr(found + 1);
+                }
+                return typeFullName;
+            }
+        }        
+
+
+#pragma region Static function definitions
+        //    ִ  type . HLSL type   64 Ʈ type  C++  .
+        struct IntegralConstantType
+        {
+            const char*     _typeName;
+            const char*     _hlslTypeName;
+            uint32          _byteCount;
+            bool            _isSigned;
+        };
+        static constexpr IntegralConstantType kIntegralConstantTypes[]
+        {
+            { "int"     , "int"     , 4, true   },
+            { "uint"    , "uint"    , 4, false  },
+            { "int8"    , "int"     , 1, true   },
+            { "uint8"   , "uint"    , 1, false  },
+            { "int16"   , "int"     , 2, true   },
+            { "uint16"  , "uint"    , 2, false  },
+            { "int32"   , "int"     , 4, true   },
+            { "uint32"  , "uint"    , 4, false  },
+            { "int64"   , nullptr   , 8, true   },
+            { "uint64"  , nullptr   , 8, false  },
+        };
+
+        static const IntegralConstantType* findIntegralConstantType(const std::string_view typeName) noexcept
+        {
+            const std::string_view pureTypeName = TypeUtils::extractPureTypeName(typeName);
+            for (const IntegralConstantType& integralConstantType : kIntegralConstantTypes)
+            {
+                if (pureTypeName == integralConstantType._typeName)
+                {
+                    return &integralConstantType;
+                }
+            }
+            return nullptr;
+        }
+
+        // C++   type    ó  ڸ.
+        static const int64 truncateConstantValue(const IntegralConstantType& integralConstantType, const int64 value) noexcept
+        {
+            if (8 <= integralConstantType._byteCount)
+            {
+                return value;
+            }
+
+            const uint32 bitCount = integralConstantType._byteCount * 8;
+            const uint64 mask = (static_cast<uint64>(1) << bitCount) - 1;
+            uint64 truncatedValue = static_cast<uint64>(value) & mask;
+            if (integralConstantType._isSigned == true && ((truncatedValue >> (bitCount - 1)) & 1) != 0)
+            {
+                truncatedValue |= ~mask;
+            }
+            return static_cast<int64>(truncatedValue);
+        }
+
+        static const bool isConstantSpecifier(const SymbolTableItem& symbol) noexcept
+        {
+            return symbol._symbolClassifier == SymbolClassifier::Keyword
+                && (symbol._symbolString == "static" || symbol._symbolString == "constexpr" || symbol._symbolString == "const");
+        }
+#pragma endregion
+
+
+        SyntaxTreeItem::SyntaxTreeItem()
+            : _constantValue{ 0 }
+        {
+            __noop;
+        }
+
+        SyntaxTreeItem::~SyntaxTreeItem()
+        {
+            __noop;
+        }
+
+
+        const TypeMetaData TypeMetaData::kInvalidTypeMetaData;
+        Parser::Parser(ILexer& lexer)
+            : IParser(lexer)
+            , _builtInTypeCount{ 0 }
+        {
+            registerTypeInternal("void"       ,  0, true);
+            registerTypeInternal("bool"       ,  4, true); // TypeSize = 4 ӿ !!!
+            registerTypeInternal("int"        ,  4, true);
+            registerTypeInternal("int1"       ,  4, true);
+            registerTypeInternal("int2"       ,  8, true);
+            registerTypeInternal("int3"       , 12, true);
+            registerTypeInternal("int4"       , 16, true);
+            registerTypeInternal("uint"       ,  4, true);
+            registerTypeInternal("uint1"      ,  4, true);
+            registerTypeInternal("uint2"      ,  8, true);
+            registerTypeInternal("uint3"      , 12, true);
+            registerTypeInternal("uint4"      , 16, true);
+            registerTypeInternal("float"      ,  4, true);
+            registerTypeInternal("float1"     ,  4, true);
+            registerTypeInternal("float2"     ,  8, true);
+            registerTypeInternal("float3"     , 12, true);
+            registerTypeInternal("float4"     , 16, true);
+            registerTypeInternal("float4x4"   , 64, true);
+
+            _builtInTypeCount = _typeMetaDatas.size();
+        }
+
+        Parser::~Parser()
+        {
+            __noop;
+        }
+
+        const bool Parser::execute()
+        {
+            reset();
+            resetParseResult();
+
+            uint32 advanceCount = 0;
+            SyntaxTreeItem rootItem;
+            rootItem._classifier = SyntaxClassifier::ROOT;
+            rootItem._identifier = "ROOT";
+            TreeNodeAccessor<SyntaxTreeItem> syntaxTreeRootNode = _syntaxTree.createRootNode(rootItem);
+            while (continueParsing() == true)
+            {
+                if (parseCode(getSymbolPosition(), syntaxTreeRootNode, advanceCount) == false)
+                {
+                    break;
+                }
+
+                advanceSymbolPositionXXX(advanceCount);
+
+                advanceCount = 0;
+            }
+
+            if (hasReportedErrors() == true)
+            {
+                MINT_LOG_ERROR("", " ־ϴ!!!");
+
+                return false;
+            }
+
+            return true;
+        }
+
+        void mint::CppHlsl::Parser::registerTypeInternal(const std::string_view typeFullName, const uint32 typeSize, const bool isBuiltIn) noexcept
+        {
+            TypeMetaData typeMetaData;
+            typeMetaData.setBaseData(TypeUtils::extractPureTypeName(typeFullName), isBuiltIn);
+            typeMetaData.setSize(typeSize);
+            _typeMetaDatas.push_back(typeMetaData);
+            _typeMetaDataMap.insert(computeTypeNameHash(typeFullName), _typeMetaDatas.size() - 1);
+        }
+
+        void Parser::registerConstant(const ConstantMetaData& constant) noexcept
+        {
+            _constants.push_back(constant);
+            _constantMap.insert(computeTypeNameHash(constant._name), _constants.size() - 1);
+        }
+
+        void Parser::resetParseResult() noexcept
+        {
+            //  parse   Ѳ . (Built-in type  ̸ string literal ̹Ƿ ܵд)
+            // Root node  ٽ Ƿ ڽĵ鸸 .
+            TreeNodeAccessor<SyntaxTreeItem> syntaxTreeRootNode = _syntaxTree.getRootNode();
+            _syntaxTree.clearChildNodes(syntaxTreeRootNode);
+
+            while (_builtInTypeCount < _typeMetaDatas.size())
+            {
+                _typeMetaDatas.pop_back();
+            }
+
+            _typeMetaDataMap.clear();
+            for (uint32 typeIndex = 0; typeIndex < _builtInTypeCount; ++typeIndex)
+            {
+                _typeMetaDataMap.insert(computeTypeNameHash(_typeMetaDatas[typeIndex].getTypeName()), typeIndex);
+            }
+
+            _constants.clear();
+            _constantMap.clear();
+
+            _stringArena.reset();
+        }
+
+        const bool Parser::parseCode(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            if (_symbolTable[symbolPosition]._symbolClassifier == SymbolClassifier::Keyword)
+            {
+                if (_symbolTable[symbolPosition]._symbolString == "namespace")
+                {
+                    return parseNamespace(symbolPosition, currentNode, outAdvanceCount);
+                }
+                else if (_symbolTable[symbolPosition]._symbolString == "struct")
+                {
+                    return parseStruct(symbolPosition, currentNode, outAdvanceCount);
+                }
+                else if (isConstantSpecifier(_symbolTable[symbolPosition]) == true)
+                {
+                    return parseConstant(symbolPosition, currentNode, outAdvanceCount);
+                }
+            }
+            else if (_symbolTable[symbolPosition]._symbolClassifier == SymbolClassifier::StatementTerminator)
+            {
+                outAdvanceCount = 1;
+                return true;
+            }
+            else if (_symbolTable[symbolPosition]._symbolClassifier == SymbolClassifier::Grouper_Close)
+            {
+                currentNode = currentNode.getParentNode();
+                outAdvanceCount = 1;
+                return true;
+            }
+            return false;
+        }
+
+        const bool Parser::parseNamespace(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            MINT_ASSURE(hasSymbol(symbolPosition + 3));
+            MINT_ASSURE(_symbolTable[symbolPosition + 1]._symbolClassifier == SymbolClassifier::Identifier);
+            MINT_ASSURE(IParser::findNextDepthMatchingGrouperCloseSymbol(symbolPosition + 2));
+
+            SyntaxTreeItem syntaxTreeItem;
+            syntaxTreeItem._classifier = SyntaxClassifier::Namespace;
+            syntaxTreeItem._identifier = _symbolTable[symbolPosition + 1]._symbolString;
+            TreeNodeAccessor<SyntaxTreeItem> newNode = currentNode.insertChildNode(syntaxTreeItem);
+            currentNode = newNode;
+            
+            outAdvanceCount += 2 + 1;
+            return true;
+        }
+
+        const bool Parser::parseStruct(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            MINT_ASSURE(hasSymbol(symbolPosition + 4)); // ; !
+            MINT_ASSURE(_symbolTable[symbolPosition + 1]._symbolClassifier == SymbolClassifier::Identifier);
+
+            bool hasCustomSyntax = false;
+            if (_symbolTable[symbolPosition + 2]._symbolString == "{")
+            {
+                MINT_ASSURE(IParser::findNextDepthMatchingGrouperCloseSymbol(symbolPosition + 2));
+            }
+            else
+            {
+                hasCustomSyntax = true;
+            }
+
+            SyntaxTreeItem syntaxTreeItem;
+            syntaxTreeItem._classifier = SyntaxClassifier::Struct;
+            syntaxTreeItem._identifier = _symbolTable[symbolPosition + 1]._symbolString;
+            TreeNodeAccessor<SyntaxTreeItem> newNode = currentNode.insertChildNode(syntaxTreeItem);
+            currentNode = newNode;
+            outAdvanceCount += 2 + 1;
+
+            if (hasCustomSyntax == true)
+            {
+                MINT_ASSURE(parseCustomSyntax(symbolPosition + 2, currentNode, outAdvanceCount) == true);
+            }
+
+            // Member
+            while (parseStructMember(symbolPosition + outAdvanceCount, currentNode, outAdvanceCount) == true)
+            {
+                __noop;
+            }
+
+            if (buildTypeMetaData(newNode) == false)
+            {
+                reportError(_symbolTable[symbolPosition + 1], ErrorType::InvalidExpression, "struct  ũⰡ uint32  ѽϴ.");
+                return false;
+            }
+            return true;
+        }
+
+        const bool Parser::parseStructMember(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            const uint32 kSemicolonMinOffset = 2;
+            MINT_ASSURE_SILENT(_symbolTable[symbolPosition]._symbolClassifier != SymbolClassifier::Grouper_Close); // ֿ켱 ˻
+            MINT_ASSURE(hasSymbol(symbolPosition + kSemicolonMinOffset));
+
+            if (isConstantSpecifier(_symbolTable[symbolPosition]) == true)
+            {
+                // struct    ƴϴ.
+                uint32 constantAdvanceCount = 0;
+                if (parseConstant(symbolPosition, currentNode, constantAdvanceCount) == false)
+                {
+                    return false;
+                }
+                outAdvanceCount += constantAdvanceCount;
+                return true;
+            }
+
+            SyntaxTreeItem syntaxTreeItem;
+            syntaxTreeItem._classifier = SyntaxClassifier::Variable;
+            syntaxTreeItem._identifier = _symbolTable[symbolPosition + 1]._symbolString;
+
+            uint32 memberSymbolPosition = symbolPosition + kSemicolonMinOffset;
+            if (_symbolTable[memberSymbolPosition]._symbolString == "[")
+            {
+                // 迭 ũ  ̴.
+                uint32 closeSymbolPosition = 0;
+                MINT_ASSURE(findNextDepthMatchingGrouperCloseSymbol(memberSymbolPosition, &closeSymbolPosition) == true);
+                if (evaluateConstantExpression(memberSymbolPosition + 1, closeSymbolPosition, currentNode, syntaxTreeItem._constantValue) == false)
+                {
+                    return false;
+                }
+                if (syntaxTreeItem._constantValue <= 0 || kUint32Max < syntaxTreeItem._constantValue)
+                {
+                    reportError(_symbolTable[memberSymbolPosition], ErrorType::InvalidExpression, "迭 ũ  մϴ.");
+                    return false;
+                }
+
+                // 迭 ü ũ⵵ uint32  ܾ Ѵ.
+                const std::string_view memberTypeName = _symbolTable[symbolPosition]._symbolString;
+                if (existsTypeMetaData(memberTypeName) == true
+                    && kUint32Max < static_cast<uint64>(getTypeMetaData(memberTypeName).getSize()) * static_cast<uint64>(syntaxTreeItem._constantValue))
+                {
+                    reportError(_symbolTable[memberSymbolPosition], ErrorType::InvalidExpression, "迭 ü ũⰡ uint32  ѽϴ.");
+                    return false;
+                }
+
+                memberSymbolPosition = closeSymbolPosition + 1;
+                MINT_ASSURE(hasSymbol(memberSymbolPosition));
+            }
+
+            TreeNodeAccessor<SyntaxTreeItem> newNode = currentNode.insertChildNode(syntaxTreeItem);
+            {
+                // DataType  Variable Identifier  ڽ!
+                SyntaxTreeItem syntaxTreeItemChild;
+                syntaxTreeItemChild._classifier = SyntaxClassifier::DataType;
+                syntaxTreeItemChild._identifier = _symbolTable[symbolPosition]._symbolString;
+                newNode.insertChildNode(syntaxTreeItemChild);
+
+                if (_symbolTable[memberSymbolPosition]._symbolString == "{")
+                {
+                    // ʱȭ! HLSL   ʱȭ  Ƿ н!
+                    uint32 closeSymbolPosition = 0;
+                    MINT_ASSURE(findNextDepthMatchingGrouperCloseSymbol(memberSymbolPosition, &closeSymbolPosition) == true);
+                    memberSymbolPosition = closeSymbolPosition + 1;
+                }
+                else if (_symbolTable[memberSymbolPosition]._symbolString == "=")
+                {
+                    // =  ϴ ʱȭ н!
+                    MINT_ASSURE(findNextSymbol(memberSymbolPosition, SymbolClassifier::StatementTerminator, memberSymbolPosition) == true);
+                }
+                else if (_symbolTable[memberSymbolPosition]._symbolClassifier == SymbolClassifier::Identifier)
+                {
+                    // Custom syntax
+                    uint32 customSyntaxAdvanceCount = 0;
+                    MINT_ASSURE(parseCustomSyntax(memberSymbolPosition, newNode, customSyntaxAdvanceCount) == true);
+                    memberSymbolPosition += customSyntaxAdvanceCount;
+                }
+            }
+            //currentNode = newNode;
+
+            MINT_ASSURE(hasSymbol(memberSymbolPosition) == true && _symbolTable[memberSymbolPosition]._symbolClassifier == SymbolClassifier::StatementTerminator);
+            outAdvanceCount += memberSymbolPosition - symbolPosition + 1;
+            return true;
+        }
+
+        const bool Parser::parseCustomSyntax(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            const uint32 kCloseParenthesisMinOffset = 3;
+            MINT_ASSURE(hasSymbol(symbolPosition + kCloseParenthesisMinOffset));
+            uint32 closeParenthesisPosition = 0;
+            MINT_ASSURE(findNextDepthMatchingGrouperCloseSymbol(symbolPosition + 1, &closeParenthesisPosition) == true);
+            MINT_ASSURE(symbolPosition + 2 < closeParenthesisPosition);
+
+            // ȣ  source ü
+            const std::string_view argumentBegin = _symbolTable[symbolPosition + 2]._symbolString;
+            const std::string_view argumentEnd = _symbolTable[closeParenthesisPosition - 1]._symbolString;
+            const std::string_view argument{ argumentBegin.data(), static_cast<size_t>(argumentEnd.data() + argumentEnd.length() - argumentBegin.data()) };
+
+            SyntaxTreeItem syntaxTreeItem;
+            if (_symbolTable[symbolPosition]._symbolString == "CPP_HLSL_SEMANTIC_NAME")
+            {
+                syntaxTreeItem._classifier = SyntaxClassifier::SemanticName;
+                syntaxTreeItem._identifier = _symbolTable[symbolPosition + 2]._symbolString;
+            }
+            else if (_symbolTable[symbolPosition]._symbolString == "CPP_HLSL_REGISTER_INDEX")
+            {
+                syntaxTreeItem._classifier = SyntaxClassifier::RegisterIndex;
+                syntaxTreeItem._value = argument;
+                if (evaluateConstantExpression(symbolPosition + 2, closeParenthesisPosition, currentNode, syntaxTreeItem._constantValue) == false)
+                {
+                    return false;
+                }
+                if (syntaxTreeItem._constantValue < 0 || kUint32Max <= syntaxTreeItem._constantValue)
+                {
+                    reportError(_symbolTable[symbolPosition + 2], ErrorType::InvalidExpression, "Register index   ϴ.");
+                    return false;
+                }
+            }
+            else if (_symbolTable[symbolPosition]._symbolString == "CPP_HLSL_INSTANCE_DATA")
+            {
+                syntaxTreeItem._classifier = SyntaxClassifier::InstanceData;
+                syntaxTreeItem._value = argument;
+                if (evaluateConstantExpression(symbolPosition + 2, closeParenthesisPosition, currentNode, syntaxTreeItem._constantValue) == false)
+                {
+                    return false;
+                }
+                if (syntaxTreeItem._constantValue < 0 || kUint32Max < syntaxTreeItem._constantValue)
+                {
+                    reportError(_symbolTable[symbolPosition + 2], ErrorType::InvalidExpression, "Instance data step rate   ϴ.");
+                    return false;
+                }
+            }
+            else
+            {
+                MINT_NEVER;
+            }
+
+            currentNode.insertChildNode(syntaxTreeItem);
+            outAdvanceCount += closeParenthesisPosition - symbolPosition + 1;
+            return true;
+        }
+
+        const bool Parser::parseConstant(const uint32 symbolPosition, TreeNodeAccessor<SyntaxTreeItem>& currentNode, uint32& outAdvanceCount) noexcept
+        {
+            // static constexpr uint32 kName = ;
+            uint32 terminatorPosition = 0;
+            MINT_ASSURE(findNextSymbol(symbolPosition, SymbolClassifier::StatementTerminator, terminatorPosition) == true);
+
+            uint32 assignmentPosition = 0;
+            if (findNextSymbol(symbolPosition, "=", assignmentPosition) == false || terminatorPosition < assignmentPosition)
+            {
+                reportError(_symbolTable[symbolPosition], ErrorType::LackOfCode, "    ؾ մϴ.");
+                return false;
+            }
+
+            // ̸ ٷ  type ̴. (mint::uint32 ó namespace    ִ)
+            const uint32 namePosition = assignmentPosition - 1;
+            if (namePosition < symbolPosition + 2
+                || _symbolTable[namePosition]._symbolClassifier != SymbolClassifier::Identifier
+                || _symbolTable[namePosition - 1]._symbolClassifier != SymbolClassifier::Identifier)
+            {
+                reportError(_symbolTable[assignmentPosition], ErrorType::WrongPredecessor, "Type  ̸ ; մϴ.");
+                return false;
+            }
+
+            outAdvanceCount += terminatorPosition - symbolPosition + 1;
+
+            const std::string_view typeName = _symbolTable[namePosition - 1]._symbolString;
+            const IntegralConstantType* const integralConstantType = findIntegralConstantType(typeName);
+            if (integralConstantType == nullptr)
+            {
+                // float    Ŀ   Ƿ ǳʶڴ.
+                return true;
+            }
+
+            int64 value = 0;
+            if (evaluateConstantExpression(assignmentPosition + 1, terminatorPosition, currentNode, value) == false)
+            {
+                return false;
+            }
+
+            std::string name;
+            buildScopeName(currentNode, name);
+            if (name.empty() == false)
+            {
+                name.append("::");
+            }
+            name.append(_symbolTable[namePosition]._symbolString);
+            if (_constantMap.find(computeTypeNameHash(name)).isValid() == true)
+            {
+                reportError(_symbolTable[namePosition], ErrorType::RepetitionOfCode, " ̸  ̹ ֽϴ.");
+                return false;
+            }
+
+            ConstantMetaData constant;
+            constant._name = internName(name);
+            constant._typeName = typeName;
+            constant._value = truncateConstantValue(*integralConstantType, value);
+            registerConstant(constant);
+            return true;
+        }
+
+        const bool Parser::evaluateConstantExpression(const uint32 beginSymbolPosition, const uint32 endSymbolPosition, const TreeNodeAccessor<SyntaxTreeItem>& scopeNode, int64& outValue) noexcept
+        {
+            const ScopedConstantResolver scopedConstantResolver{ *this, scopeNode };
+            ConstantExpressionEvaluator constantExpressionEvaluator{ _symbolTable, scopedConstantResolver };
+            if (constantExpressionEvaluator.evaluate(beginSymbolPosition, endSymbolPosition, outValue) == false)
+            {
+                reportError(_symbolTable[constantExpressionEvaluator.getErrorSymbolPosition()], ErrorType::InvalidExpression, constantExpressionEvaluator.getErrorMessage());
+                return false;
+            }
+            return true;
+        }
+
+        const bool Parser::buildTypeMetaData(const TreeNodeAccessor<SyntaxTreeItem>& structNode) noexcept
+        {
+            const SyntaxTreeItem& structNodeSyntaxTreeItem = structNode.getNodeData();
+
+            // namespace  struct ̸ ̾  ̸  ؼ StringArena    ҴѴ.
+            uint32 fullTypeNameLength = static_cast<uint32>(structNodeSyntaxTreeItem._identifier.length());
+            TreeNodeAccessor<SyntaxTreeItem> parentNode = structNode.getParentNode();
+            while (parentNode.isValid() == true && parentNode.getNodeData()._classifier != SyntaxClassifier::ROOT)
+            {
+                fullTypeNameLength += static_cast<uint32>(parentNode.getNodeData()._identifier.length()) + 2;
+                parentNode = parentNode.getParentNode();
+            }
+
+            char* const fullTypeNameRaw = _stringArena.allocate(fullTypeNameLength);
+            uint32 fullTypeNameAt = fullTypeNameLength - static_cast<uint32>(structNodeSyntaxTreeItem._identifier.length());
+            memcpy(&fullTypeNameRaw[fullTypeNameAt], structNodeSyntaxTreeItem._identifier.data(), structNodeSyntaxTreeItem._identifier.length());
+            parentNode = structNode.getParentNode();
+            while (parentNode.isValid() == true && parentNode.getNodeData()._classifier != SyntaxClassifier::ROOT)
+            {
+                const std::string_view namespaceName = parentNode.getNodeData()._identifier;
+                fullTypeNameAt -= 2;
+                fullTypeNameRaw[fullTypeNameAt] = ':';
+                fullTypeNameRaw[fullTypeNameAt + 1] = ':';
+                fullTypeNameAt -= static_cast<uint32>(namespaceName.length());
+                memcpy(&fullTypeNameRaw[fullTypeNameAt], namespaceName.data(), namespaceName.length());
+                parentNode = parentNode.getParentNode();
+            }
+            const std::string_view fullTypeName{ fullTypeNameRaw, fullTypeNameLength };
+
+            if (existsTypeMetaData(fullTypeName) == true)
+            {
+                return true;
+            }
+
+            TypeMetaData typeMetaData;
+            typeMetaData.setBaseData(fullTypeName, false);
+            
+            uint32 structSize = 0;
+            std::string_view streamDataTypeNameForSlots;
+            const int32 inputSlot = getSlottedStreamDataInputSlot(fullTypeName, streamDataTypeNameForSlots);
+            const uint32 childNodeCount = structNode.getChildNodeCount();
+            for (uint32 childNodeIndex = 0; childNodeIndex < childNodeCount; ++childNodeIndex)
+            {
+                TreeNodeAccessor<SyntaxTreeItem> childNode = structNode.getChildNode(childNodeIndex);
+                const SyntaxTreeItem& childNodeData = childNode.getNodeData();
+                if (childNodeData._classifier == SyntaxClassifier::Variable)
+                {
+                    const uint32 attributeCount = childNode.getChildNodeCount();
+                    TreeNodeAccessor<SyntaxTreeItem> dataTypeNode = childNode.getChildNode(0);
+                    TypeMetaData memberTypeMetaData = getTypeMetaData(dataTypeNode.getNodeData()._identifier);
+                    memberTypeMetaData.setByteOffset(structSize);
+                    uint64 memberSize = memberTypeMetaData.getSize();
+                    if (0 < childNodeData._constantValue)
+                    {
+                        const uint32 arrayCount = static_cast<uint32>(childNodeData._constantValue);
+                        memberTypeMetaData.setArrayCount(arrayCount);
+                        memberSize *= arrayCount;
+                    }
+                    if (kUint32Max < structSize + memberSize)
+                    {
+                        return false;
+                    }
+                    memberTypeMetaData.setSize(static_cast<uint32>(memberSize));
+                    structSize += static_cast<uint32>(memberSize);
+                    memberTypeMetaData.setDeclName(childNodeData._identifier);
+                    memberTypeMetaData.setInputSlot(inputSlot);
+
+                    if (2 <= attributeCount)
+                    {
+                        // SemanticName
+                        TreeNodeAccessor<SyntaxTreeItem> attribute1 = childNode.getChildNode(1);
+                        const SyntaxTreeItem& attribute1Data = attribute1.getNodeData();
+                        if (attribute1Data._classifier == SyntaxClassifier::SemanticName)
+                        {
+                            memberTypeMetaData.setSemanticName(attribute1Data._identifier);
+                        }
+                        else
+                        {
+                            MINT_NEVER;
+                        }
+                    }
+
+                    typeMetaData.pushMember(memberTypeMetaData);
+                }
+                else if (childNodeData._classifier == SyntaxClassifier::RegisterIndex)
+                {
+                    typeMetaData.setRegisterIndex(static_cast<uint32>(childNodeData._constantValue));
+                }
+                else if (childNodeData._classifier == SyntaxClassifier::InstanceData)
+                {
+                    typeMetaData.setInstanceDataStepRate(static_cast<uint32>(childNodeData._constantValue));
+                }
+                else
+                {
+                    MINT_NEVER;
+                }
+            }
+            typeMetaData.setSize(structSize);
+            
+            _typeMetaDatas.push_back(typeMetaData);
+            _typeMetaDataMap.insert(computeTypeNameHash(fullTypeName), _typeMetaDatas.size() - 1);
+
+            if (0 < inputSlot)
+            {
+                TypeMetaData& streamDataForSlots = getTypeMetaData(streamDataTypeNameForSlots);
+                streamDataForSlots.pushSlottedStreamData(typeMetaData);
+            }
+            return true;
+        }
+
+        void Parser::buildScopeName(const TreeNodeAccessor<SyntaxTreeItem>& node, std::string& outScopeName) noexcept
+        {
+            mint::Vector<std::string_view> names;
+            TreeNodeAccessor<SyntaxTreeItem> scopeNode = node;
+            while (scopeNode.isValid() == true && scopeNode.getNodeData()._classifier != SyntaxClassifier::ROOT)
+            {
+                names.push_back(scopeNode.getNodeData()._identifier);
+                scopeNode = scopeNode.getParentNode();
+            }
+
+            outScopeName.clear();
+            for (uint32 nameIndex = names.size(); 0 < nameIndex; --nameIndex)
+            {
+                outScopeName.append(names[nameIndex - 1]);
+                if (1 < nameIndex)
+                {
+                    outScopeName.append("::");
+                }
+            }
+        }
+
+        std::string Parser::convertDeclarationNameToHlslSemanticName(const std::string_view declarationName)
+        {
+            if (declarationName.empty() == true)
+            {
+                MINT_NEVER;
+            }
+
+            std::string semanticName{ declarationName.substr(1) };
+            const uint32 semanticNameLength = static_cast<uint32>(semanticName.length());
+            for (uint32 semanticNameIter = 0; semanticNameIter < semanticNameLength; ++semanticNameIter)
+            {
+                semanticName[semanticNameIter] = ::toupper(semanticName[semanticNameIter]);
+            }
+            return semanticName;
+        }
+
+        const uint32 Parser::getTypeMetaDataCount() const noexcept
+        {
+            return _typeMetaDatas.size();
+        }
+
+        const TypeMetaData& Parser::getTypeMetaData(const std::string_view typeName) const noexcept
+        {
+            KeyValuePair found = _typeMetaDataMap.find(computeTypeNameHash(typeName));
+            MINT_ASSERT("", found.isValid() == true, "Type[%.*s]   ʽϴ!", static_cast<int32>(typeName.length()), typeName.data());
+
+            const uint32 typeIndex = *found._value;
+            return _typeMetaDatas[typeIndex];
+        }
+
+        const TypeMetaData& Parser::getTypeMetaData(const int32 typeIndex) const noexcept
+        {
+            return _typeMetaDatas[typeIndex];
+        }
+
+        const StringArena& Parser::getStringArena() const noexcept
+        {
+            return _stringArena;
+        }
+
+        const uint32 Parser::getConstantCount() const noexcept
+        {
+            return _constants.size();
+        }
+
+        const ConstantMetaData& Parser::getConstant(const uint32 constantIndex) const noexcept
+        {
+            return _constants[constantIndex];
+        }
+
+        const bool Parser::findConstantValue(const std::string_view name, int64& outValue) const noexcept
+        {
+            const KeyValuePair found = _constantMap.find(computeTypeNameHash(name));
+            if (found.isValid() == false)
+            {
+                return false;
+            }
+            outValue = _constants[*found._value]._value;
+            return true;
+        }
+
+        TypeMetaData& Parser::getTypeMetaData(const std::string_view typeName) noexcept
+        {
+            KeyValuePair found = _typeMetaDataMap.find(computeTypeNameHash(typeName));
+            MINT_ASSERT("", found.isValid() == true, "Type[%.*s]   ʽϴ!", static_cast<int32>(typeName.length()), typeName.data());
+
+            const uint32 typeIndex = *found._value;
+            return _typeMetaDatas[typeIndex];
+        }
+
+        const int32 Parser::getSlottedStreamDataInputSlot(const std::string_view typeName, std::string_view& streamDataTypeName) const noexcept
+        {
+            // 0  ڱ ڽ ǹϹǷ
+            //  Slotted StreamData  InputSlot  1 Ѵ!
+
+            const bool isBackDigit = ::isdigit(typeName.back());
+            if (isBackDigit == false)
+            {
+                return 0;
+            }
+
+            const int32 digitCount = (::isdigit(typeName[typeName.size() - 2]) != 0) ? 2 : 1;
+            int32 inputSlot = 0;
+            StringUtil::parseInteger(typeName.data() + typeName.size() - digitCount, typeName.data() + typeName.size(), inputSlot);
+            streamDataTypeName = typeName.substr(0, typeName.size() - digitCount);
+            if (existsTypeMetaData(streamDataTypeName) == true)
+            {
+                return inputSlot;
+            }
+            return 0;
+        }
+
+        const bool Parser::existsTypeMetaData(const std::string_view typeName) const noexcept
+        {
+            return _typeMetaDataMap.find(computeTypeNameHash(typeName)).isValid();
+        }
+
+        const uint64 Parser::computeTypeNameHash(const std::string_view typeName) noexcept
+        {
+            return mint::computeHash(typeName.data(), static_cast<uint32>(typeName.length()));
+        }
+
+        void Parser::serializeTypeMetaDatas(BinaryFileWriter& binaryFileWriter) const noexcept
+        {
+            const uint32 typeMetaDataCount = _typeMetaDatas.size();
+            binaryFileWriter.write(typeMetaDataCount - _builtInTypeCount);
+            for (uint32 typeIndex = _builtInTypeCount; typeIndex < typeMetaDataCount; ++typeIndex)
+            {
+                serializeTypeMetaData(_typeMetaDatas[typeIndex], binaryFileWriter);
+            }
+
+            const uint32 constantCount = _constants.size();
+            binaryFileWriter.write(constantCount);
+            for (uint32 constantIndex = 0; constantIndex < constantCount; ++constantIndex)
+            {
+                serializeString(_constants[constantIndex]._name, binaryFileWriter);
+                serializeString(_constants[constantIndex]._typeName, binaryFileWriter);
+                binaryFileWriter.write(_constants[constantIndex]._value);
+            }
+        }
+
+        const bool Parser::deserializeTypeMetaDatas(const BinaryFileReader& binaryFileReader) noexcept
+        {
+            resetParseResult();
+
+            const uint32* const typeMetaDataCount = binaryFileReader.read<uint32>();
+            if (typeMetaDataCount == nullptr)
+            {
+                return false;
+            }
+
+            for (uint32 typeMetaDataIndex = 0; typeMetaDataIndex < *typeMetaDataCount; ++typeMetaDataIndex)
+            {
+                TypeMetaData typeMetaData;
+                if (deserializeTypeMetaData(binaryFileReader, typeMetaData) == false || typeMetaData.isBuiltIn() == true)
+                {
+                    resetParseResult();
+                    return false;
+                }
+
+                _typeMetaDatas.push_back(typeMetaData);
+                _typeMetaDataMap.insert(computeTypeNameHash(typeMetaData.getTypeName()), _typeMetaDatas.size() - 1);
+            }
+
+            const uint32* const constantCount = binaryFileReader.read<uint32>();
+            if (constantCount == nullptr)
+            {
+                resetParseResult();
+                return false;
+            }
+
+            for (uint32 constantIndex = 0; constantIndex < *constantCount; ++constantIndex)
+            {
+                ConstantMetaData constant;
+                if (deserializeString(binaryFileReader, constant._name) == false || deserializeString(binaryFileReader, constant._typeName) == false)
+                {
+                    resetParseResult();
+                    return false;
+                }
+
+                const int64* const value = binaryFileReader.read<int64>();
+                if (value == nullptr)
+                {
+                    resetParseResult();
+                    return false;
+                }
+
+                constant._value = *value;
+                registerConstant(constant);
+            }
+            return true;
+        }
+
+        void Parser::serializeTypeMetaData(const TypeMetaData& typeMetaData, BinaryFileWriter& binaryFileWriter) noexcept
+        {
+            binaryFileWriter.write(typeMetaData.isBuiltIn());
+            serializeString(typeMetaData.getTypeName(), binaryFileWriter);
+            serializeString(typeMetaData.getDeclName(), binaryFileWriter);
+            serializeString(typeMetaData.getSemanticName(), binaryFileWriter);
+            binaryFileWriter.write(typeMetaData.getRegisterIndex());
+            binaryFileWriter.write(typeMetaData.getInputSlot());
+            binaryFileWriter.write(typeMetaData.getInstanceDataStepRate());
+            binaryFileWriter.write(typeMetaData.getArrayCount());
+            binaryFileWriter.write(typeMetaData.getSize());
+            binaryFileWriter.write(typeMetaData.getByteOffset());
+
+            const uint32 memberCount = typeMetaData.getMemberCount();
+            binaryFileWriter.write(memberCount);
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                serializeTypeMetaData(typeMetaData.getMember(memberIndex), binaryFileWriter);
+            }
+
+            const uint32 slottedStreamDataCount = typeMetaData.getSlottedStreamDataCount();
+            binaryFileWriter.write(slottedStreamDataCount);
+            for (uint32 slottedStreamDataIndex = 0; slottedStreamDataIndex < slottedStreamDataCount; ++slottedStreamDataIndex)
+            {
+                serializeTypeMetaData(typeMetaData.getSlottedStreamData(slottedStreamDataIndex), binaryFileWriter);
+            }
+        }
+
+        void Parser::serializeString(const std::string_view string, BinaryFileWriter& binaryFileWriter) noexcept
+        {
+            binaryFileWriter.write(static_cast<uint32>(string.length()));
+            binaryFileWriter.writeSpan(string.data(), static_cast<uint32>(string.length()));
+        }
+
+        const bool Parser::deserializeTypeMetaData(const BinaryFileReader& binaryFileReader, TypeMetaData& outTypeMetaData) noexcept
+        {
+            const bool* const isBuiltIn = binaryFileReader.read<bool>();
+            if (isBuiltIn == nullptr)
+            {
+                return false;
+            }
+
+            std::string_view typeName;
+            std::string_view declName;
+            std::string_view semanticName;
+            if (deserializeString(binaryFileReader, typeName) == false
+                || deserializeString(binaryFileReader, declName) == false
+                || deserializeString(binaryFileReader, semanticName) == false)
+            {
+                return false;
+            }
+
+            // registerIndex, inputSlot, instanceDataStepRate, arrayCount, size, byteOffset, memberCount
+            const uint32* const values = binaryFileReader.read<uint32>(7);
+            if (values == nullptr)
+            {
+                return false;
+            }
+
+            outTypeMetaData.setBaseData(typeName, *isBuiltIn);
+            outTypeMetaData.setDeclName(declName);
+            outTypeMetaData.setSemanticName(semanticName);
+            outTypeMetaData.setRegisterIndex(values[0]);
+            outTypeMetaData.setInputSlot(values[1]);
+            outTypeMetaData.setInstanceDataStepRate(values[2]);
+            outTypeMetaData.setArrayCount(values[3]);
+            outTypeMetaData.setSize(values[4]);
+            outTypeMetaData.setByteOffset(values[5]);
+
+            const uint32 memberCount = values[6];
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                TypeMetaData member;
+                if (deserializeTypeMetaData(binaryFileReader, member) == false)
+                {
+                    return false;
+                }
+                outTypeMetaData.pushMember(member);
+            }
+
+            const uint32* const slottedStreamDataCount = binaryFileReader.read<uint32>();
+            if (slottedStreamDataCount == nullptr)
+            {
+                return false;
+            }
+
+            for (uint32 slottedStreamDataIndex = 0; slottedStreamDataIndex < *slottedStreamDataCount; ++slottedStreamDataIndex)
+            {
+                TypeMetaData slottedStreamData;
+                if (deserializeTypeMetaData(binaryFileReader, slottedStreamData) == false)
+                {
+                    return false;
+                }
+                outTypeMetaData.pushSlottedStreamData(slottedStreamData);
+            }
+            return true;
+        }
+
+        const bool Parser::deserializeString(const BinaryFileReader& binaryFileReader, std::string_view& outString) noexcept
+        {
+            const uint32* const length = binaryFileReader.read<uint32>();
+            if (length == nullptr)
+            {
+                return false;
+            }
+
+            const char* const string = binaryFileReader.read<char>(*length);
+            if (string == nullptr)
+            {
+                return false;
+            }
+
+            outString = internName(std::string_view(string, *length));
+            return true;
+        }
+
+        const bool Parser::mergeTypeMetaDatas(const Parser* const* const parsers, const uint32 parserCount, std::string_view& outConflictingTypeName, uint32& outConflictingParserIndex) noexcept
+        {
+            resetParseResult();
+
+            for (uint32 parserIndex = 0; parserIndex < parserCount; ++parserIndex)
+            {
+                const Parser& parser = *parsers[parserIndex];
+                const uint32 typeMetaDataCount = parser._typeMetaDatas.size();
+                for (uint32 typeIndex = parser._builtInTypeCount; typeIndex < typeMetaDataCount; ++typeIndex)
+                {
+                    const TypeMetaData& typeMetaData = parser._typeMetaDatas[typeIndex];
+                    const KeyValuePair found = _typeMetaDataMap.find(computeTypeNameHash(typeMetaData.getTypeName()));
+                    if (found.isValid() == true)
+                    {
+                        if (isSameLayout(_typeMetaDatas[*found._value], typeMetaData) == true)
+                        {
+                            continue;
+                        }
+
+                        outConflictingTypeName = _typeMetaDatas[*found._value].getTypeName();
+                        outConflictingParserIndex = parserIndex;
+                        return false;
+                    }
+
+                    TypeMetaData mergedTypeMetaData;
+                    copyTypeMetaData(typeMetaData, mergedTypeMetaData);
+                    _typeMetaDatas.push_back(mergedTypeMetaData);
+                    _typeMetaDataMap.insert(computeTypeNameHash(mergedTypeMetaData.getTypeName()), _typeMetaDatas.size() - 1);
+                }
+
+                const uint32 constantCount = parser._constants.size();
+                for (uint32 constantIndex = 0; constantIndex < constantCount; ++constantIndex)
+                {
+                    const ConstantMetaData& constant = parser._constants[constantIndex];
+                    const KeyValuePair found = _constantMap.find(computeTypeNameHash(constant._name));
+                    if (found.isValid() == true)
+                    {
+                        if (_constants[*found._value]._value == constant._value)
+                        {
+                            continue;
+                        }
+
+                        outConflictingTypeName = _constants[*found._value]._name;
+                        outConflictingParserIndex = parserIndex;
+                        return false;
+                    }
+
+                    ConstantMetaData mergedConstant;
+                    mergedConstant._name = internName(constant._name);
+                    mergedConstant._typeName = internName(constant._typeName);
+                    mergedConstant._value = constant._value;
+                    registerConstant(mergedConstant);
+                }
+            }
+            return true;
+        }
+
+        void Parser::copyTypeMetaData(const TypeMetaData& source, TypeMetaData& outTypeMetaData) noexcept
+        {
+            outTypeMetaData.setBaseData(internName(source.getTypeName()), source.isBuiltIn());
+            outTypeMetaData.setDeclName(internName(source.getDeclName()));
+            outTypeMetaData.setSemanticName(internName(source.getSemanticName()));
+            outTypeMetaData.setRegisterIndex(source.getRegisterIndex());
+            outTypeMetaData.setInputSlot(source.getInputSlot());
+            outTypeMetaData.setInstanceDataStepRate(source.getInstanceDataStepRate());
+            outTypeMetaData.setArrayCount(source.getArrayCount());
+            outTypeMetaData.setSize(source.getSize());
+            outTypeMetaData.setByteOffset(source.getByteOffset());
+
+            const uint32 memberCount = source.getMemberCount();
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                TypeMetaData member;
+                copyTypeMetaData(source.getMember(memberIndex), member);
+                outTypeMetaData.pushMember(member);
+            }
+
+            const uint32 slottedStreamDataCount = source.getSlottedStreamDataCount();
+            for (uint32 slottedStreamDataIndex = 0; slottedStreamDataIndex < slottedStreamDataCount; ++slottedStreamDataIndex)
+            {
+                TypeMetaData slottedStreamData;
+                copyTypeMetaData(source.getSlottedStreamData(slottedStreamDataIndex), slottedStreamData);
+                outTypeMetaData.pushSlottedStreamData(slottedStreamData);
+            }
+        }
+
+        const std::string_view Parser::internName(const std::string_view name) noexcept
+        {
+            return (name.empty() == true) ? std::string_view() : _stringArena.intern(name);
+        }
+
+        const bool Parser::isSameLayout(const TypeMetaData& lhs, const TypeMetaData& rhs) noexcept
+        {
+            if (lhs.getTypeName() != rhs.getTypeName() || lhs.getDeclName() != rhs.getDeclName() || lhs.getSemanticName() != rhs.getSemanticName())
+            {
+                return false;
+            }
+
+            if (lhs.getSize() != rhs.getSize() || lhs.getByteOffset() != rhs.getByteOffset() || lhs.getRegisterIndex() != rhs.getRegisterIndex()
+                || lhs.getInputSlot() != rhs.getInputSlot() || lhs.getInstanceDataStepRate() != rhs.getInstanceDataStepRate() || lhs.getArrayCount() != rhs.getArrayCount())
+            {
+                return false;
+            }
+
+            const uint32 memberCount = lhs.getMemberCount();
+            if (memberCount != rhs.getMemberCount() || lhs.getSlottedStreamDataCount() != rhs.getSlottedStreamDataCount())
+            {
+                return false;
+            }
+
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                if (isSameLayout(lhs.getMember(memberIndex), rhs.getMember(memberIndex)) == false)
+                {
+                    return false;
+                }
+            }
+
+            const uint32 slottedStreamDataCount = lhs.getSlottedStreamDataCount();
+            for (uint32 slottedStreamDataIndex = 0; slottedStreamDataIndex < slottedStreamDataCount; ++slottedStreamDataIndex)
+            {
+                if (isSameLayout(lhs.getSlottedStreamData(slottedStreamDataIndex), rhs.getSlottedStreamData(slottedStreamDataIndex)) == false)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string Parser::serializeConstantsToHlsl() const
+        {
+            std::string result;
+            const uint32 constantCount = _constants.size();
+            for (uint32 constantIndex = 0; constantIndex < constantCount; ++constantIndex)
+            {
+                const ConstantMetaData& constant = _constants[constantIndex];
+                const IntegralConstantType* const integralConstantType = findIntegralConstantType(constant._typeName);
+                if (integralConstantType == nullptr || integralConstantType->_hlslTypeName == nullptr)
+                {
+                    continue;
+                }
+
+                result.append("static const ");
+                result.append(integralConstantType->_hlslTypeName);
+                result.append(" ");
+                result.append(TypeUtils::extractPureTypeName(constant._name));
+                result.append(" = ");
+                result.append((integralConstantType->_isSigned == true) ? std::to_string(constant._value) : std::to_string(static_cast<uint64>(constant._value)));
+                result.append(";\n");
+            }
+
+            if (result.empty() == false)
+            {
+                result.append("\n");
+            }
+            return result;
+        }
+
+        std::string Parser::serializeCppHlslTypeToHlslStreamDatum(const TypeMetaData& typeMetaData)
+        {
+            const std::string_view pureTypeName = TypeUtils::extractPureTypeName(typeMetaData.getTypeName());
+
+            // inputSlot 0   ڽ̴!
+            mint::Vector<TypeMetaData> slottedDatas;
+            for (int32 inputSlot = 1; inputSlot < kVertexInputSlotCount; ++inputSlot)
+            {
+                std::string typeName{ typeMetaData.getTypeName() };
+                typeName += std::to_string(inputSlot);
+                if (false == existsTypeMetaData(typeName))
+                {
+                    break;
+                }
+
+                slottedDatas.push_back(getTypeMetaData(typeName));
+            }
+            
+            std::string result;
+            result.append("struct ");
+            result.append(pureTypeName);
+            result.append("\n{\n");
+            result.append(serializeCppHlslTypeToHlslStreamDatumMembers(typeMetaData));
+
+            const uint32 slottedDataCount = slottedDatas.size();
+            for (uint32 slottedDataIndex = 0; slottedDataIndex < slottedDataCount; ++slottedDataIndex)
+            {
+                result += serializeCppHlslTypeToHlslStreamDatumMembers(slottedDatas[slottedDataIndex]);
+            }
+
+            result.append("};\n\n");
+            return result;
+        }
+
+        std::string Parser::serializeCppHlslTypeToHlslStreamDatumMembers(const TypeMetaData& typeMetaData)
+        {
+            std::string result;
+            const uint32 memberCount = typeMetaData.getMemberCount();
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                const TypeMetaData& memberType = typeMetaData.getMember(memberIndex);
+                result.append("\t");
+                result.append(memberType.getTypeName());
+                result.append(" ");
+                result.append(memberType.getDeclName());
+                appendHlslArraySuffix(memberType, result);
+                result.append(" : ");
+                if (memberType.getSemanticName().empty() == true)
+                {
+                    result.append(convertDeclarationNameToHlslSemanticName(memberType.getDeclName()));
+                }
+                else
+                {
+                    result.append(memberType.getSemanticName());
+                }
+                result.append(";\n");
+            }
+            return result;
+        }
+
+        void Parser::appendHlslArraySuffix(const TypeMetaData& memberType, std::string& outString)
+        {
+            if (memberType.isArray() == true)
+            {
+                outString.append("[");
+                outString.append(std::to_string(memberType.getArrayCount()));
+                outString.append("]");
+            }
+        }
+
+        std::string Parser::serializeCppHlslTypeToHlslConstantBuffer(const TypeMetaData& typeMetaData, const uint32 bufferIndex)
+        {
+            std::string result;
+
+            result.append("cbuffer ");
+            const std::string_view pureTypeName = TypeUtils::extractPureTypeName(typeMetaData.getTypeName());
+            result.append(pureTypeName);
+            result.append(" : register(");
+            result.append("b" + std::to_string((typeMetaData.isRegisterIndexValid() == true) ? typeMetaData.getRegisterIndex() : bufferIndex));
+            result.append(")\n{\n");
+
+            const uint32 memberCount = typeMetaData.getMemberCount();
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                const TypeMetaData& memberType = typeMetaData.getMember(memberIndex);
+                result.append("\t");
+                result.append(memberType.getTypeName());
+                result.append(" ");
+                result.append(memberType.getDeclName());
+                appendHlslArraySuffix(memberType, result);
+                result.append(";\n");
+            }
+            result.append("};\n\n");
+            return result;
+        }
+
+        std::string Parser::serializeCppHlslTypeToHlslStructuredBufferDefinition(const TypeMetaData& typeMetaData)
+        {
+            std::string result;
+
+            const std::string_view pureTypeName = TypeUtils::extractPureTypeName(typeMetaData.getTypeName());
+            result.append("struct ");
+            result.append(pureTypeName);
+            result.append("\n{\n");
+            const uint32 memberCount = typeMetaData.getMemberCount();
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                const TypeMetaData& memberType = typeMetaData.getMember(memberIndex);
+                result.append("\t");
+                result.append(memberType.getTypeName());
+                result.append(" ");
+                result.append(memberType.getDeclName());
+                appendHlslArraySuffix(memberType, result);
+                result.append(";\n");
+            }
+
+            result.append("};\n\n");
+            return result;
+        }
+
+        std::string Parser::serializeCppHlslTypeToLayoutJson(const TypeMetaData& typeMetaData)
+        {
+            std::string result;
+            result.append("\t\t{\n");
+            result.append("\t\t\t\"name\": \"");
+            result.append(typeMetaData.getTypeName());
+            result.append("\",\n\t\t\t\"size\": ");
+            result.append(std::to_string(typeMetaData.getSize()));
+            if (typeMetaData.isRegisterIndexValid() == true)
+            {
+                result.append(",\n\t\t\t\"registerIndex\": ");
+                result.append(std::to_string(typeMetaData.getRegisterIndex()));
+            }
+            if (0 < typeMetaData.getInstanceDataStepRate())
+            {
+                result.append(",\n\t\t\t\"instanceDataStepRate\": ");
+                result.append(std::to_string(typeMetaData.getInstanceDataStepRate()));
+            }
+            result.append(",\n\t\t\t\"members\": [");
+
+            const uint32 memberCount = typeMetaData.getMemberCount();
+            for (uint32 memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+            {
+                const TypeMetaData& memberType = typeMetaData.getMember(memberIndex);
+                result.append((memberIndex == 0) ? "\n" : ",\n");
+                result.append("\t\t\t\t{ \"name\": \"");
+                result.append(memberType.getDeclName());
+                result.append("\", \"type\": \"");
+                result.append(memberType.getTypeName());
+                result.append("\", \"offset\": ");
+                result.append(std::to_string(memberType.getByteOffset()));
+                result.append(", \"size\": ");
+                result.append(std::to_string(memberType.getSize()));
+                if (memberType.isArray() == true)
+                {
+                    result.append(", \"arrayCount\": ");
+                    result.append(std::to_string(memberType.getArrayCount()));
+                }
+                if (memberType.getSemanticName().empty() == false)
+                {
+                    result.append(", \"semantic\": \"");
+                    result.append(memberType.getSemanticName());
+                    result.append("\"");
+                }
+                result.append(" }");
+            }
+            result.append((memberCount == 0) ? "]\n" : "\n\t\t\t]\n");
+            result.append("\t\t}");
+            return result;
+        }
+
+
+        Parser::ScopedConstantResolver::ScopedConstantResolver(const Parser& parser, const TreeNodeAccessor<SyntaxTreeItem>& scopeNode)
+            : _parser{ parser }
+        {
+            buildScopeName(scopeNode, _scopeName);
+        }
+
+        const bool Parser::ScopedConstantResolver::resolveConstant(const std::string_view name, int64& outValue) const noexcept
+        {
+            uint32 constantIndex = 0;
+            if (findScopedIndex(_parser._constantMap, name, constantIndex) == false)
+            {
+                return false;
+            }
+            outValue = _parser._constants[constantIndex]._value;
+            return true;
+        }
+
+        const bool Parser::ScopedConstantResolver::resolveTypeSize(const std::string_view typeName, uint32& outTypeSize) const noexcept
+        {
+            uint32 typeIndex = 0;
+            if (findScopedIndex(_parser._typeMetaDataMap, typeName, typeIndex) == false)
+            {
+                // mint::float4 ó namespace   built-in type
+                const KeyValuePair found = _parser._typeMetaDataMap.find(computeTypeNameHash(TypeUtils::extractPureTypeName(typeName)));
+                if (found.isValid() == false || _parser._typeMetaDatas[*found._value].isBuiltIn() == false)
+                {
+                    return false;
+                }
+                typeIndex = *found._value;
+            }
+            outTypeSize = _parser._typeMetaDatas[typeIndex].getSize();
+            return true;
+        }
+
+        const bool Parser::ScopedConstantResolver::findScopedIndex(const mint::HashMap<uint64, uint32>& map, const std::string_view name, uint32& outIndex) const noexcept
+        {
+            // C++ ó  scope  ã´.
+            std::string_view scopeName = _scopeName;
+            std::string scopedName;
+            while (true)
+            {
+                scopedName.assign(scopeName);
+                if (scopeName.empty() == false)
+                {
+                    scopedName.append("::");
+                }
+                scopedName.append(name);
+
+                const KeyValuePair found = map.find(computeTypeNameHash(scopedName));
+                if (found.isValid() == true)
+                {
+                    outIndex = *found._value;
+                    return true;
+                }
+
+                if (scopeName.empty() == true)
+                {
+                    return false;
+                }
+
+                const size_t lastScopePosition = scopeName.rfind("::");
+                scopeName = (lastScopePosition == std::string_view::npos) ? std::string_view() : scopeName.substr(0, lastScopePosition);
+            }
+        }
+    }
+}
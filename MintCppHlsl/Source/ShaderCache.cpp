@@ -0,0 +1,344 @@
+﻿#include <MintCppHlsl/Include/ShaderCache.h>
+
+#include <MintCommon/Include/Logger.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+#include <MintContainer/Include/StringUtil.hpp>
+
+#include <MintPlatform/Include/BinaryFile.hpp>
+#include <MintPlatform/Include/FileUtil.hpp>
+
+
+namespace mint
+{
+    namespace CppHlsl
+    {
+#pragma region Static function definitions
+        // FNV1a 를 이어서 계산한다. 길이를 먼저 넣어서 ("ab", "c") 와 ("a", "bc") 가 다른 Key 가 되게 한다.
+        static void appendShaderCacheKey(uint64& inoutKey, const std::string_view data) noexcept
+        {
+            static constexpr uint64 kPrime = 0x00000100000001B3;
+
+            const uint32 length = static_cast<uint32>(data.length());
+            const byte* const lengthBytes = reinterpret_cast<const byte*>(&length);
+            for (uint32 byteIndex = 0; byteIndex < sizeof(length); ++byteIndex)
+            {
+                inoutKey ^= lengthBytes[byteIndex];
+                inoutKey *= kPrime;
+            }
+
+            for (uint32 at = 0; at < length; ++at)
+            {
+                inoutKey ^= static_cast<uint8>(data[at]);
+                inoutKey *= kPrime;
+            }
+        }
+#pragma endregion
+
+
+        ShaderCacheKeyInput::ShaderCacheKeyInput()
+            : _compileFlags{ 0 }
+        {
+            __noop;
+        }
+
+
+        ShaderCache::ShaderCache(const char* const cacheDirectory, const uint64 capacity)
+            : _cacheDirectory{ cacheDirectory }
+            , _capacity{ capacity }
+            , _totalSize{ 0 }
+            , _useTick{ 0 }
+            , _isManifestDirty{ false }
+        {
+            __noop;
+        }
+
+        ShaderCache::~ShaderCache()
+        {
+            if (_isManifestDirty == true)
+            {
+                saveManifest();
+            }
+        }
+
+        const uint64 ShaderCache::computeKey(const ShaderCacheKeyInput& keyInput) noexcept
+        {
+            uint64 key = 0xcbf29ce484222325;
+            appendShaderCacheKey(key, keyInput._source);
+
+            const uint32 includeCount = keyInput._includeContents.size();
+            appendShaderCacheKey(key, std::string_view(reinterpret_cast<const char*>(&includeCount), sizeof(includeCount)));
+            for (uint32 includeIndex = 0; includeIndex < includeCount; ++includeIndex)
+            {
+                appendShaderCacheKey(key, keyInput._includeContents[includeIndex]);
+            }
+
+            const uint32 defineCount = keyInput._defines.size();
+            appendShaderCacheKey(key, std::string_view(reinterpret_cast<const char*>(&defineCount), sizeof(defineCount)));
+            for (uint32 defineIndex = 0; defineIndex < defineCount; ++defineIndex)
+            {
+                appendShaderCacheKey(key, keyInput._defines[defineIndex]);
+            }
+
+            appendShaderCacheKey(key, keyInput._entryPoint);
+            appendShaderCacheKey(key, keyInput._targetProfile);
+            appendShaderCacheKey(key, std::string_view(reinterpret_cast<const char*>(&keyInput._compileFlags), sizeof(keyInput._compileFlags)));
+            return key;
+        }
+
+        void ShaderCache::extractIncludeNames(const std::string_view source, mint::Vector<std::string_view>& outIncludeNames) noexcept
+        {
+            static constexpr std::string_view kIncludeDirective = "#include";
+
+            outIncludeNames.clear();
+
+            uint64 at = 0;
+            while (true)
+            {
+                at = source.find(kIncludeDirective, at);
+                if (at == std::string_view::npos)
+                {
+                    break;
+                }
+
+                at += kIncludeDirective.length();
+                while (at < source.length() && (source[at] == ' ' || source[at] == '\t'))
+                {
+                    ++at;
+                }
+                if (source.length() <= at || (source[at] != '<' && source[at] != '"'))
+                {
+                    continue;
+                }
+
+                const char closer = (source[at] == '<') ? '>' : '"';
+                const uint64 nameBegin = at + 1;
+                const uint64 nameEnd = source.find_first_of(closer == '>' ? ">\n" : "\"\n", nameBegin);
+                if (nameEnd == std::string_view::npos || source[nameEnd] != closer)
+                {
+                    continue;
+                }
+
+                outIncludeNames.push_back(source.substr(nameBegin, nameEnd - nameBegin));
+                at = nameEnd + 1;
+            }
+        }
+
+        const bool ShaderCache::loadManifest() noexcept
+        {
+            _entryMap.clear();
+            _totalSize = 0;
+            _useTick = 0;
+            _isManifestDirty = false;
+
+            const std::string manifestFilePath = _cacheDirectory + kManifestFileName;
+            if (mint::FileUtil::exists(manifestFilePath.c_str()) == false)
+            {
+                return false;
+            }
+
+            BinaryFileReader binaryFileReader;
+            if (binaryFileReader.open(manifestFilePath.c_str()) == false)
+            {
+                return false;
+            }
+
+            // Header: magic number, version, entry count, padding, use tick
+            // uint64 들이 8 바이트 경계에 오도록 Header 와 Entry 의 크기를 8 의 배수로 맞춘다.
+            const char* const magicNumber = binaryFileReader.read<char>(4);
+            const uint32* const header = binaryFileReader.read<uint32>(3);
+            const uint64* const useTick = binaryFileReader.read<uint64>();
+            if (magicNumber == nullptr || header == nullptr || useTick == nullptr
+                || mint::StringUtil::strcmp(magicNumber, "SCM") == false || header[0] != kManifestVersion)
+            {
+                MINT_LOG("김장원", "ShaderCache Manifest[%s] 를 읽을 수 없어 빈 Cache 로 시작합니다.", manifestFilePath.c_str());
+                return false;
+            }
+
+            const uint32 entryCount = header[1];
+            for (uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+            {
+                const uint64* const key = binaryFileReader.read<uint64>();
+                const uint64* const lastUseTick = binaryFileReader.read<uint64>();
+                const uint32* const binarySize = binaryFileReader.read<uint32>(2);
+                if (key == nullptr || lastUseTick == nullptr || binarySize == nullptr)
+                {
+                    MINT_LOG("김장원", "ShaderCache Manifest[%s] 가 손상되어 빈 Cache 로 시작합니다.", manifestFilePath.c_str());
+                    _entryMap.clear();
+                    _totalSize = 0;
+                    return false;
+                }
+
+                Entry entry;
+                entry._binarySize = *binarySize;
+                entry._lastUseTick = *lastUseTick;
+                _entryMap.insert(*key, entry);
+                _totalSize += entry._binarySize;
+            }
+            _useTick = *useTick;
+            return true;
+        }
+
+        const bool ShaderCache::saveManifest() noexcept
+        {
+            if (mint::FileUtil::exists(_cacheDirectory.c_str()) == false && mint::FileUtil::createDirectory(_cacheDirectory.c_str()) == false)
+            {
+                MINT_LOG("김장원", "경로[%s] 생성에 실패했습니다!", _cacheDirectory.c_str());
+                return false;
+            }
+
+            BinaryFileWriter binaryFileWriter;
+            binaryFileWriter.write("SCM");
+            binaryFileWriter.write(kManifestVersion);
+            binaryFileWriter.write(_entryMap.size());
+            binaryFileWriter.write(static_cast<uint32>(0));
+            binaryFileWriter.write(_useTick);
+            if (_entryMap.empty() == false)
+            {
+                for (mint::BucketViewer bucketViewer = _entryMap.getBucketViewer(); bucketViewer.isValid(); bucketViewer.next())
+                {
+                    const KeyValuePairConst<uint64, Entry> keyValuePair = bucketViewer.view();
+                    binaryFileWriter.write(*keyValuePair._key);
+                    binaryFileWriter.write(keyValuePair._value->_lastUseTick);
+                    binaryFileWriter.write(keyValuePair._value->_binarySize);
+                    binaryFileWriter.write(static_cast<uint32>(0));
+                }
+            }
+
+            const std::string manifestFilePath = _cacheDirectory + kManifestFileName;
+            if (binaryFileWriter.save(manifestFilePath.c_str()) == false)
+            {
+                MINT_LOG("김장원", "ShaderCache Manifest[%s] 를 저장하지 못했습니다!", manifestFilePath.c_str());
+                return false;
+            }
+            _isManifestDirty = false;
+            return true;
+        }
+
+        const bool ShaderCache::find(const uint64 key, std::string& outBinaryFilePath) noexcept
+        {
+            const KeyValuePair<uint64, Entry> found = _entryMap.find(key);
+            if (found.isValid() == false)
+            {
+                return false;
+            }
+
+            std::string binaryFilePath = makeBinaryFilePath(key);
+            if (mint::FileUtil::exists(binaryFilePath.c_str()) == false)
+            {
+                eraseEntry(key);
+                return false;
+            }
+
+            found._value->_lastUseTick = ++_useTick;
+            _isManifestDirty = true;
+            outBinaryFilePath = std::move(binaryFilePath);
+            return true;
+        }
+
+        const bool ShaderCache::insert(const uint64 key, const byte* const binary, const uint32 binarySize) noexcept
+        {
+            if (mint::FileUtil::exists(_cacheDirectory.c_str()) == false && mint::FileUtil::createDirectory(_cacheDirectory.c_str()) == false)
+            {
+                MINT_LOG("김장원", "경로[%s] 생성에 실패했습니다!", _cacheDirectory.c_str());
+                return false;
+            }
+
+            BinaryFileWriter binaryFileWriter;
+            binaryFileWriter.writeSpan(binary, binarySize);
+            const std::string binaryFilePath = makeBinaryFilePath(key);
+            if (binaryFileWriter.save(binaryFilePath.c_str()) == false)
+            {
+                MINT_LOG("김장원", "ShaderCache 파일[%s] 을 저장하지 못했습니다!", binaryFilePath.c_str());
+                return false;
+            }
+
+            const KeyValuePair<uint64, Entry> found = _entryMap.find(key);
+            if (found.isValid() == true)
+            {
+                _totalSize -= found._value->_binarySize;
+                found._value->_binarySize = binarySize;
+                found._value->_lastUseTick = ++_useTick;
+            }
+            else
+            {
+                Entry entry;
+                entry._binarySize = binarySize;
+                entry._lastUseTick = ++_useTick;
+                _entryMap.insert(key, entry);
+            }
+            _totalSize += binarySize;
+            _isManifestDirty = true;
+
+            evictIfNecessary();
+            return true;
+        }
+
+        const bool ShaderCache::contains(const uint64 key) const noexcept
+        {
+            return _entryMap.contains(key);
+        }
+
+        const uint32 ShaderCache::getEntryCount() const noexcept
+        {
+            return _entryMap.size();
+        }
+
+        const uint64 ShaderCache::getTotalSize() const noexcept
+        {
+            return _totalSize;
+        }
+
+        std::string ShaderCache::makeBinaryFilePath(const uint64 key) const noexcept
+        {
+            static constexpr char kHexDigits[] = "0123456789abcdef";
+
+            char keyString[17]{};
+            for (uint32 digitIndex = 0; digitIndex < 16; ++digitIndex)
+            {
+                keyString[15 - digitIndex] = kHexDigits[(key >> (digitIndex * 4)) & 0xF];
+            }
+
+            std::string binaryFilePath = _cacheDirectory;
+            binaryFilePath.append(keyString);
+            binaryFilePath.append(kBinaryFileExtension);
+            return binaryFilePath;
+        }
+
+        void ShaderCache::evictIfNecessary() noexcept
+        {
+            // 방금 넣은 Entry 하나만 남았다면 capacity 를 넘더라도 지우지 않는다.
+            while (_capacity < _totalSize && 1 < _entryMap.size())
+            {
+                uint64 oldestKey = 0;
+                uint64 oldestUseTick = kUint64Max;
+                for (mint::BucketViewer bucketViewer = _entryMap.getBucketViewer(); bucketViewer.isValid(); bucketViewer.next())
+                {
+                    const KeyValuePairConst<uint64, Entry> keyValuePair = bucketViewer.view();
+                    if (keyValuePair._value->_lastUseTick < oldestUseTick)
+                    {
+                        oldestKey = *keyValuePair._key;
+                        oldestUseTick = keyValuePair._value->_lastUseTick;
+                    }
+                }
+
+                mint::FileUtil::deleteFile(makeBinaryFilePath(oldestKey).c_str());
+                eraseEntry(oldestKey);
+            }
+        }
+
+        void ShaderCache::eraseEntry(const uint64 key) noexcept
+        {
+            const KeyValuePair<uint64, Entry> found = _entryMap.find(key);
+            if (found.isValid() == false)
+            {
+                return;
+            }
+
+            _totalSize -= found._value->_binarySize;
+            _entryMap.erase(key);
+            _isManifestDirty = true;
+        }
+    }
+}
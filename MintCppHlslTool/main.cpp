@@ -0,0 +1,128 @@
+﻿#include <MintContainer/Include/StringUtil.h>
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+#include <MintPlatform/Include/TextFile.h>
+
+#include <MintCppHlsl/Include/Interpreter.h>
+#include <MintCppHlsl/Include/BufferPacking.h>
+
+
+// GraphicDevice 없이 CppHlsl 헤더를 HLSL 과 layout JSON 으로 바꾼다.
+// 사용법: MintCppHlslTool <StreamData | ConstantBuffers | StructuredBuffers> <input.h> <output.hlsl> [output.json]
+
+
+const bool parseFileType(const char* const fileTypeString, mint::CppHlsl::CppHlslFileType& outFileType)
+{
+    if (mint::StringUtil::strcmp(fileTypeString, "StreamData") == true)
+    {
+        outFileType = mint::CppHlsl::CppHlslFileType::StreamData;
+        return true;
+    }
+    else if (mint::StringUtil::strcmp(fileTypeString, "ConstantBuffers") == true)
+    {
+        outFileType = mint::CppHlsl::CppHlslFileType::ConstantBuffers;
+        return true;
+    }
+    else if (mint::StringUtil::strcmp(fileTypeString, "StructuredBuffers") == true)
+    {
+        outFileType = mint::CppHlsl::CppHlslFileType::StructuredBuffers;
+        return true;
+    }
+    return false;
+}
+
+// Buffer 마다 padding 을 출력하고, 멤버 순서를 바꿔 크기를 줄일 수 있으면 그 순서도 출력한다.
+void printBufferPackingReport(const mint::CppHlsl::Interpreter& interpreter, const mint::CppHlsl::BufferPackingRule packingRule)
+{
+    const uint32 typeMetaDataCount = interpreter.getTypeMetaDataCount();
+    for (uint32 typeIndex = 0; typeIndex < typeMetaDataCount; ++typeIndex)
+    {
+        const mint::CppHlsl::TypeMetaData& typeMetaData = interpreter.getTypeMetaData(typeIndex);
+        if (typeMetaData.isBuiltIn() == true)
+        {
+            continue;
+        }
+
+        mint::CppHlsl::BufferLayout layout;
+        mint::CppHlsl::BufferPacking::computeLayout(typeMetaData, packingRule, layout);
+        printf("%.*s: %u bytes, %u bytes padding\n", static_cast<int32>(typeMetaData.getTypeName().length()), typeMetaData.getTypeName().data(), layout._size, layout._paddingSize);
+
+        uint32 mismatchMemberIndex = 0;
+        if (mint::CppHlsl::BufferPacking::validateLayout(typeMetaData, packingRule, mismatchMemberIndex) == false && mismatchMemberIndex < typeMetaData.getMemberCount())
+        {
+            const std::string_view declName = typeMetaData.getMember(mismatchMemberIndex).getDeclName();
+            printf("    [%.*s] 의 C++ offset 이 HLSL offset(%u) 과 다릅니다!\n", static_cast<int32>(declName.length()), declName.data(), layout._packedMemberArray[mismatchMemberIndex]._byteOffset);
+        }
+
+        mint::Vector<uint32> memberOrder;
+        mint::CppHlsl::BufferPacking::computeMinimumSizeMemberOrder(typeMetaData, packingRule, memberOrder);
+        mint::CppHlsl::BufferLayout reorderedLayout;
+        mint::CppHlsl::BufferPacking::computeLayout(typeMetaData, packingRule, memberOrder, reorderedLayout);
+        if (reorderedLayout._size < layout._size)
+        {
+            printf("    다음 순서로 바꾸면 %u bytes 가 됩니다:", reorderedLayout._size);
+            for (uint32 orderIndex = 0; orderIndex < memberOrder.size(); ++orderIndex)
+            {
+                const std::string_view declName = typeMetaData.getMember(memberOrder[orderIndex]).getDeclName();
+                printf(" %.*s", static_cast<int32>(declName.length()), declName.data());
+            }
+            printf("\n");
+        }
+    }
+}
+
+const bool saveTextFile(const char* const fileName, const char* const text)
+{
+    mint::TextFileWriter textFileWriter;
+    textFileWriter.write(text);
+    if (textFileWriter.save(fileName) == false)
+    {
+        printf("[%s] 파일을 저장하지 못했습니다.\n", fileName);
+        return false;
+    }
+    return true;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    if (argc < 4)
+    {
+        printf("Usage: MintCppHlslTool <StreamData | ConstantBuffers | StructuredBuffers> <input.h> <output.hlsl> [output.json]\n");
+        return 1;
+    }
+
+    mint::CppHlsl::CppHlslFileType fileType;
+    if (parseFileType(argv[1], fileType) == false)
+    {
+        printf("[%s] 는 알 수 없는 FileType 입니다.\n", argv[1]);
+        return 1;
+    }
+
+    mint::CppHlsl::Interpreter interpreter;
+    if (interpreter.parseCppHlslFile(argv[2]) == false)
+    {
+        printf("[%s] 파일을 parse 하지 못했습니다.\n", argv[2]);
+        return 1;
+    }
+
+    interpreter.generateHlslString(fileType);
+    if (fileType != mint::CppHlsl::CppHlslFileType::StreamData)
+    {
+        printBufferPackingReport(interpreter, (fileType == mint::CppHlsl::CppHlslFileType::ConstantBuffers) ? mint::CppHlsl::BufferPackingRule::ConstantBuffer : mint::CppHlsl::BufferPackingRule::StructuredBuffer);
+    }
+    if (saveTextFile(argv[3], interpreter.getHlslString()) == false)
+    {
+        return 1;
+    }
+
+    if (5 <= argc)
+    {
+        interpreter.generateLayoutJsonString();
+        if (saveTextFile(argv[4], interpreter.getLayoutJsonString()) == false)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
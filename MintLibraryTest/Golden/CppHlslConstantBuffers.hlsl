@@ -0,0 +1,13 @@
+cbuffer CB_View : register(b0)
+{
+	float4x4 _cb2DProjectionMatrix;
+	float4x4 _cb3DProjectionMatrix;
+	float4x4 _cbViewMatrix;
+	float4x4 _cbViewProjectionMatrix;
+};
+
+cbuffer CB_Transform : register(b1)
+{
+	float4x4 _cbWorldMatrix;
+};
+
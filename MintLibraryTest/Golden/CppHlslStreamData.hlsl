@@ -0,0 +1,36 @@
+struct VS_INPUT
+{
+	float4 _positionU : POSITIONU;
+	float4 _tangentV : TANGENTV;
+	float4 _bitangentW : BITANGENTW;
+	uint _materialId : MATERIALID;
+};
+
+struct VS_INPUT_SHAPE
+{
+	float4 _position : POSITION;
+	float4 _color : COLOR;
+	float4 _texCoord : TEXCOORD;
+	float4 _info : INFO;
+};
+
+struct VS_OUTPUT
+{
+	float4 _screenPosition : SV_POSITION;
+	float4 _worldPosition : WORLDPOSITION;
+	float4 _worldNormal : WORLDNORMAL;
+	float4 _worldTangent : WORLDTANGENT;
+	float4 _worldBitangent : WORLDBITANGENT;
+	float4 _texCoord : TEXCOORD;
+	uint _materialId : MATERIALID;
+};
+
+struct VS_OUTPUT_SHAPE
+{
+	float4 _position : SV_POSITION;
+	float4 _color : COLOR;
+	float4 _texCoord : TEXCOORD;
+	float4 _info : INFO;
+	uint _viewportIndex : SV_ViewportArrayIndex;
+};
+
@@ -0,0 +1,10 @@
+struct SB_Transform
+{
+	float4x4 _transformMatrix;
+};
+
+struct SB_Material
+{
+	float4 _diffuseColor;
+};
+
@@ -0,0 +1,17 @@
+﻿#include <MintLibraryTest/ShaderCacheTest.h>
+
+#include <cstdio>
+
+
+// MintLibraryTest 는 Windows 에서만 빌드되므로 ShaderCache 만 따로 돌린다. (CMakeLists.txt 의 MintShaderCacheTest)
+int main(const int argc, const char* const argv[])
+{
+    const char* const cacheDirectory = (2 <= argc) ? argv[1] : "ShaderCacheTest/";
+    if (testShaderCache(cacheDirectory) == false)
+    {
+        printf("ShaderCache test failed!\n");
+        return 1;
+    }
+    printf("ShaderCache test passed.\n");
+    return 0;
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+
+
+#ifndef MINT_SHADER_CACHE_TEST_H
+#define MINT_SHADER_CACHE_TEST_H
+
+
+#include <MintCommon/Include/Logger.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+#include <MintPlatform/Include/FileUtil.hpp>
+
+#include <MintCppHlsl/Include/ShaderCache.h>
+
+
+// ShaderCache: Key 는 내용만으로 정해지고, capacity 를 넘으면 가장 오래 안 쓴 binary 부터 지운다.
+// D3D 없이 돌아가므로 MintLibraryTest 와 CMake 의 MintShaderCacheTest 가 함께 쓴다. cacheDirectory 는 '/' 로 끝나야 하고, 끝나면 비워 둔다.
+inline const bool testShaderCache(const char* const cacheDirectory)
+{
+    using namespace mint;
+
+    CppHlsl::ShaderCacheKeyInput keyInput;
+    keyInput._source = "#include <ShaderStructDefinitions>\n#include \"Common.hlsli\"\n#include Wrong\nfloat4 main() : SV_TARGET { return 1; }";
+    keyInput._entryPoint = "main";
+    keyInput._targetProfile = "ps_5_0";
+
+    Vector<std::string_view> includeNames;
+    CppHlsl::ShaderCache::extractIncludeNames(keyInput._source, includeNames);
+    MINT_ASSURE(includeNames.size() == 2);
+    MINT_ASSURE(includeNames[0] == "ShaderStructDefinitions" && includeNames[1] == "Common.hlsli");
+
+    const uint64 key = CppHlsl::ShaderCache::computeKey(keyInput);
+    MINT_ASSURE(CppHlsl::ShaderCache::computeKey(keyInput) == key);
+    keyInput._targetProfile = "ps_4_0";
+    const uint64 otherProfileKey = CppHlsl::ShaderCache::computeKey(keyInput);
+    MINT_ASSURE(otherProfileKey != key);
+    keyInput._includeContents.push_back("struct VS_OUTPUT { float4 _position : SV_POSITION; };");
+    const uint64 includeKey = CppHlsl::ShaderCache::computeKey(keyInput);
+    MINT_ASSURE(includeKey != otherProfileKey);
+    keyInput._defines.push_back("USE_TEXTURE=1");
+    const uint64 defineKey = CppHlsl::ShaderCache::computeKey(keyInput);
+    MINT_ASSURE(defineKey != includeKey);
+    keyInput._compileFlags = 1;
+    MINT_ASSURE(CppHlsl::ShaderCache::computeKey(keyInput) != defineKey);
+
+    const std::string manifestFilePath = std::string(cacheDirectory) + "ShaderCache.manifest";
+    FileUtil::deleteFile(manifestFilePath.c_str());
+    const byte binary[8]{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    {
+        CppHlsl::ShaderCache shaderCache{ cacheDirectory, 16 };
+        MINT_ASSURE(shaderCache.loadManifest() == false);
+        MINT_ASSURE(shaderCache.insert(1, binary, 8) == true);
+        MINT_ASSURE(shaderCache.insert(2, binary, 8) == true);
+
+        std::string binaryFilePath;
+        MINT_ASSURE(shaderCache.find(1, binaryFilePath) == true);
+        MINT_ASSURE(shaderCache.insert(3, binary, 8) == true);
+        MINT_ASSURE(shaderCache.contains(1) == true && shaderCache.contains(2) == false && shaderCache.contains(3) == true);
+        MINT_ASSURE(FileUtil::exists(shaderCache.makeBinaryFilePath(2).c_str()) == false);
+        MINT_ASSURE(shaderCache.getTotalSize() == 16);
+    }
+    std::string remainingBinaryFilePath;
+    {
+        CppHlsl::ShaderCache shaderCache{ cacheDirectory, 16 };
+        MINT_ASSURE(shaderCache.loadManifest() == true);
+        MINT_ASSURE(shaderCache.getEntryCount() == 2);
+
+        // binary 파일이 없어졌으면 Entry 도 지운다.
+        FileUtil::deleteFile(shaderCache.makeBinaryFilePath(3).c_str());
+        std::string binaryFilePath;
+        MINT_ASSURE(shaderCache.find(3, binaryFilePath) == false);
+        MINT_ASSURE(shaderCache.getEntryCount() == 1);
+        MINT_ASSURE(shaderCache.find(1, remainingBinaryFilePath) == true);
+    }
+
+    MINT_ASSURE(FileUtil::deleteFile(remainingBinaryFilePath.c_str()) == true);
+    MINT_ASSURE(FileUtil::deleteFile(manifestFilePath.c_str()) == true);
+    MINT_ASSURE(FileUtil::deleteFile(cacheDirectory) == true);
+    return true;
+}
+
+
+#endif // !MINT_SHADER_CACHE_TEST_H
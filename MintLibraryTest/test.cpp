@@ -1,6 +1,8 @@
 ﻿#include <MintLibrary/Include/AllHeaders.h>
 #include <MintLibrary/Include/AllHpps.h>
 
+#include <MintLibraryTest/ShaderCacheTest.h>
+
 
 #ifdef MINT_DEBUG
     #define _CRTDBG_MAP_ALLOC
@@ -16,6 +18,35 @@
 //#define MINT_TEST_PERFORMANCE
 
 
+#if defined MINT_TEST_PERFORMANCE
+// Performance test 블록을 시작할 때 불러서 printProfilerLogs() 에 넘길 Log 의 수를 얻는다.
+const uint32 getProfilerLogCount()
+{
+    return static_cast<uint32>(mint::Profiler::ScopedCpuProfiler::getEntireLogArray().size());
+}
+
+// logBeginIndex 부터 쌓인 Log 들만 출력해서, 앞선 블록들의 Log 가 다시 나오지 않게 한다.
+// processedByteCount 가 0 이 아니면 걸린 시간 대신 처리량을 MB/s 로 출력한다.
+void printProfilerLogs(const uint32 logBeginIndex, const uint64 processedByteCount = 0)
+{
+    const std::vector<mint::Profiler::ScopedCpuProfiler::Log>& logArray = mint::Profiler::ScopedCpuProfiler::getEntireLogArray();
+    const uint32 logCount = static_cast<uint32>(logArray.size());
+    for (uint32 logIndex = logBeginIndex; logIndex < logCount; ++logIndex)
+    {
+        const mint::Profiler::ScopedCpuProfiler::Log& log = logArray[logIndex];
+        if (processedByteCount == 0)
+        {
+            printf("%s: %llu ms\n", log._content.c_str(), log._durationMs);
+        }
+        else
+        {
+            printf("%s: %.1f MB/s\n", log._content.c_str(), (processedByteCount / (1024.0 * 1024.0)) / (mint::max(log._durationMs, static_cast<uint64>(1)) * 0.001));
+        }
+    }
+}
+#endif
+
+
 void testIntTypes()
 {
     using namespace mint;
@@ -492,6 +523,55 @@ const bool testStringUtil()
     mint::Vector<std::string> testBTokenized;
     mint::StringUtil::tokenize(testB, delimiterArray, testBTokenized);
 
+    {
+        const char* const textBegin = testB.c_str();
+        const char* const textEnd = textBegin + testB.length();
+        const char* const newLine = mint::StringUtil::findChar(textBegin + 1, textEnd, '\n');
+        const char* const notFound = mint::StringUtil::findChar(textBegin, textEnd, '@');
+        MINT_ASSURE((newLine - textBegin) == static_cast<int64>(testB.find('\n', 1)));
+        MINT_ASSURE(notFound == textEnd);
+    }
+
+    {
+        static constexpr const char* const kNumbers = "-123 4294967296 3.25e2 .5 -0.125x 1e";
+        const char* const end = kNumbers + mint::StringUtil::strlen(kNumbers);
+        int32 a = 0;
+        int64 b = 0;
+        float c = 0.0f;
+        double d = 0.0;
+        double e = 0.0;
+        double f = 0.0;
+        const char* at = mint::StringUtil::parseInteger(kNumbers, end, a);
+        MINT_ASSURE(a == -123);
+        MINT_ASSURE(mint::StringUtil::parseInteger(at + 1, end, a) == at + 1); // int32 범위를 넘는다.
+        at = mint::StringUtil::parseInteger(at + 1, end, b);
+        MINT_ASSURE(b == 4294967296);
+        at = mint::StringUtil::parseFloat(at + 1, end, c);
+        MINT_ASSURE(c == 325.0f);
+        at = mint::StringUtil::parseFloat(at + 1, end, d);
+        MINT_ASSURE(d == 0.5);
+        at = mint::StringUtil::parseFloat(at + 1, end, e);
+        MINT_ASSURE(e == -0.125 && *at == 'x');
+        at = mint::StringUtil::parseFloat(at + 2, end, f);
+        MINT_ASSURE(f == 1.0 && *at == 'e');
+    }
+
+    {
+        // 범위를 넘는 수는 실패하고 outValue 는 바뀌지 않는다.
+        static constexpr const char* const kHugeExponent = "1e999999999999999999999";
+        static constexpr const char* const kTinyExponent = "1e-400";
+        double d = 7.0;
+        float f = 7.0f;
+        MINT_ASSURE(mint::StringUtil::parseFloat(kHugeExponent, kHugeExponent + mint::StringUtil::strlen(kHugeExponent), d) == kHugeExponent && d == 7.0);
+        MINT_ASSURE(mint::StringUtil::parseFloat(kTinyExponent, kTinyExponent + mint::StringUtil::strlen(kTinyExponent), d) == kTinyExponent && d == 7.0);
+        MINT_ASSURE(mint::StringUtil::parseFloat(kHugeExponent, kHugeExponent + 4, f) == kHugeExponent && f == 7.0f); // "1e99" 는 float 의 범위를 넘는다.
+
+        // 빠른 경로를 쓰지 못하는 긴 가수도 locale 과 관계없이 '.' 을 소수점으로 읽는다.
+        static constexpr const char* const kLongMantissa = "3.14159265358979323846264338327950288";
+        const char* const longMantissaEnd = kLongMantissa + mint::StringUtil::strlen(kLongMantissa);
+        MINT_ASSURE(mint::StringUtil::parseFloat(kLongMantissa, longMantissaEnd, d) == longMantissaEnd && d == 3.141592653589793);
+    }
+
     return true;
 }
 
@@ -554,9 +634,260 @@ const bool testFiles()
         printf("File[%s] %s %s\n", kFileName, d, e);
     }
 
+    mint::BinaryFileReader bfrMapped;
+    bfrMapped.openMapped(kFileName, mint::FileAccessHint::Sequential);
+    if (bfrMapped.isOpen() == true)
+    {
+        auto a = bfrMapped.read<float>();
+        bfrMapped.skip(sizeof(bool) + sizeof(uint16));
+        auto d = bfrMapped.read<char>(6);
+        const uint64 at = bfrMapped.tell();
+        auto e = bfrMapped.read<char>(4);
+        bfrMapped.seek(at);
+        auto eAgain = bfrMapped.read<char>(4);
+        auto beyondEnd = bfrMapped.read<char>(bfrMapped.getFileSize());
+        printf("File[%s] mapped %.2f %s %s %s %d\n", kFileName, *a, d, e, eAgain, (beyondEnd == nullptr) ? 1 : 0);
+    }
+
+    {
+        // 크기가 0 인 파일도 열린 상태여야 한다.
+        static constexpr const char* const kEmptyFileName = "MintLibraryTest/test_empty.bin";
+        {
+            mint::BinaryFileStreamWriter bfswEmpty;
+            MINT_ASSURE(bfswEmpty.open(kEmptyFileName) == true);
+            MINT_ASSURE(bfswEmpty.close(false) == true);
+        }
+
+        mint::BinaryFileReader bfrEmpty;
+        MINT_ASSURE(bfrEmpty.open(kEmptyFileName) == true);
+        MINT_ASSURE(bfrEmpty.isOpen() == true && bfrEmpty.getFileSize() == 0);
+        MINT_ASSURE(bfrEmpty.read<byte>() == nullptr);
+        mint::FileUtil::deleteFile(kEmptyFileName);
+    }
+
+    {
+        static constexpr const char* const kStreamFileName = "MintLibraryTest/test_stream.bin";
+        mint::Vector<uint32> values(50000);
+        for (uint32 index = 0; index < values.size(); ++index)
+        {
+            values[index] = index * 7;
+        }
+
+        mint::BinaryFileStreamWriter bfsw{ 4096, true };
+        bfsw.open(kStreamFileName);
+        bfsw.write("STR");
+        bfsw.write(values.size());
+        bfsw.writeSpan(&values[0], values.size());
+        bfsw.write(static_cast<uint16>(0xABCD));
+        const uint64 writtenSize = bfsw.getWrittenSize();
+        const bool isClosed = bfsw.close(true);
+
+        mint::BinaryFileReader bfrStream;
+        bfrStream.openMapped(kStreamFileName, mint::FileAccessHint::Sequential);
+        if (bfrStream.isOpen() == true)
+        {
+            auto magic = bfrStream.read<char>(4);
+            const uint32 count = *bfrStream.read<uint32>();
+            const uint32* const readValues = bfrStream.read<uint32>(count);
+            const uint16 tail = *bfrStream.read<uint16>();
+            const bool isSame = (bfrStream.getFileSize() == writtenSize) && (memcmp(readValues, &values[0], sizeof(uint32) * count) == 0) && (tail == 0xABCD);
+            printf("File[%s] stream %s %d %d\n", kStreamFileName, magic, (isClosed == true) ? 1 : 0, (isSame == true) ? 1 : 0);
+        }
+    }
+
+    {
+        static constexpr const char* const kAsyncFileName = "MintLibraryTest/test_async.bin";
+        mint::AsyncFileService asyncFileService{ 2 };
+        mint::Vector<byte> byteArray(1024);
+        for (uint32 index = 0; index < byteArray.size(); ++index)
+        {
+            byteArray[index] = static_cast<byte>(index);
+        }
+        asyncFileService.writeAsync(kAsyncFileName, std::move(byteArray), mint::AsyncFilePriority::Normal);
+        asyncFileService.waitForAll();
+
+        asyncFileService.beginBatch();
+        const mint::AsyncFileRequestId lowRequestId = asyncFileService.readAsync("MintLibraryTest/test.cpp", mint::AsyncFilePriority::Low);
+        const mint::AsyncFileRequestId highRequestId = asyncFileService.readAsync(kAsyncFileName, mint::AsyncFilePriority::High);
+        asyncFileService.endBatch();
+
+        uint32 completionCount = 0;
+        bool isSame = false;
+        mint::AsyncFileCompletion completion;
+        while (completionCount < 2)
+        {
+            // Frame Loop 에서처럼 Blocking 없이 완료된 것만 꺼낸다.
+            while (asyncFileService.pollCompletion(completion) == true)
+            {
+                ++completionCount;
+                if (completion._requestId == highRequestId)
+                {
+                    isSame = (completion._isSucceeded == true) && (completion._byteArray.size() == 1024) && (completion._byteArray[255] == 255);
+                }
+            }
+            std::this_thread::yield();
+        }
+        printf("File[%s] async %d %d\n", kAsyncFileName, (isSame == true) ? 1 : 0, (lowRequestId != highRequestId) ? 1 : 0);
+    }
+
+    {
+        static constexpr const char* const kPackFileName = "MintLibraryTest/test.mpak";
+        mint::AssetPackWriter assetPackWriter;
+        const uint32 addedFileCount = assetPackWriter.addDirectory("Assets/HlslBinary", mint::AssetPackCompression::None);
+        assetPackWriter.addFile("Hlsl\\VsDefault.hlsl", "Assets/Hlsl/VsDefault.hlsl", mint::AssetPackCompression::Lz4);
+        assetPackWriter.addFile("noto_sans_kr_medium.fnt", "Assets/noto_sans_kr_medium.fnt", mint::AssetPackCompression::Lz4);
+        const bool isSaved = assetPackWriter.save(kPackFileName);
+
+        mint::AssetPackReader assetPackReader;
+        if (isSaved == true && assetPackReader.open(kPackFileName) == true)
+        {
+            mint::BinaryFileReader bfrOriginal;
+            bfrOriginal.open("Assets/HlslBinary/VsDefault.hlslbin");
+            const mint::AssetView assetView = assetPackReader.getView("VsDefault.hlslbin");
+            const bool isViewSame = (assetView._size == bfrOriginal.getFileSize()) && (memcmp(assetView._data, bfrOriginal.getData(), assetView._size) == 0);
+
+            mint::BinaryFileReader bfrFont;
+            bfrFont.open("Assets/noto_sans_kr_medium.fnt");
+            mint::Vector<byte> fontBytes;
+            const bool isFontRead = assetPackReader.read("noto_sans_kr_medium.fnt", fontBytes);
+            const bool isFontSame = (isFontRead == true) && (fontBytes.size() == bfrFont.getFileSize()) && (memcmp(fontBytes.data(), bfrFont.getData(), fontBytes.size()) == 0);
+            const bool isMissing = (assetPackReader.findEntry("NotExisting.bin") == nullptr) && (assetPackReader.getView("Hlsl/VsDefault.hlsl")._data == nullptr);
+            printf("File[%s] pack %u %u %d %d %d\n", kPackFileName, addedFileCount, assetPackReader.getEntryCount(), (isViewSame == true) ? 1 : 0, (isFontSame == true) ? 1 : 0, (isMissing == true) ? 1 : 0);
+
+            // 손상된 Pack: 압축되지 않은 Entry 는 _storedSize 를 키우고, 압축된 Entry 는 Path 를 Path table 밖으로 보낸다.
+            static constexpr const char* const kCorruptPackFileName = "MintLibraryTest/test_corrupt.mpak";
+            const uint32 viewEntryIndex = static_cast<uint32>(assetPackReader.findEntry("VsDefault.hlslbin") - &assetPackReader.getEntry(0));
+            const uint32 fontEntryIndex = static_cast<uint32>(assetPackReader.findEntry("noto_sans_kr_medium.fnt") - &assetPackReader.getEntry(0));
+            mint::BinaryFileReader bfrPack;
+            bfrPack.open(kPackFileName);
+            mint::Vector<byte> corruptBytes(static_cast<uint32>(bfrPack.getFileSize()));
+            memcpy(&corruptBytes[0], bfrPack.getData(), corruptBytes.size());
+            const mint::AssetPackHeader& corruptHeader = *reinterpret_cast<const mint::AssetPackHeader*>(&corruptBytes[0]);
+            mint::AssetPackEntry* const corruptEntries = reinterpret_cast<mint::AssetPackEntry*>(&corruptBytes[static_cast<uint32>(corruptHeader._entryTableOffset)]);
+            corruptEntries[viewEntryIndex]._storedSize += 1;
+            corruptEntries[fontEntryIndex]._pathOffset = static_cast<uint32>(corruptHeader._pathTableSize);
+            mint::BinaryFileWriter bfwCorrupt;
+            bfwCorrupt.writeSpan(&corruptBytes[0], corruptBytes.size());
+            bfwCorrupt.save(kCorruptPackFileName);
+
+            mint::AssetPackReader corruptPackReader;
+            mint::Vector<byte> corruptReadBytes;
+            MINT_ASSURE(corruptPackReader.open(kCorruptPackFileName) == true);
+            MINT_ASSURE(corruptPackReader.read("VsDefault.hlslbin", corruptReadBytes) == false);
+            MINT_ASSURE(corruptPackReader.getView("VsDefault.hlslbin")._data == nullptr);
+            MINT_ASSURE(corruptPackReader.findEntry("noto_sans_kr_medium.fnt") == nullptr);
+            MINT_ASSURE(corruptPackReader.getEntryPath(fontEntryIndex) == nullptr);
+            MINT_ASSURE(mint::AssetPackReader().open("MintLibraryTest/test.cpp") == false);
+        }
+    }
+
     mint::TextFileReader tfr;
     tfr.open("MintLibraryTest/test.cpp");
 
+    mint::TextFileReader tfrMapped;
+    tfrMapped.openMapped("MintLibraryTest/test.cpp", mint::FileAccessHint::Random);
+    const bool isSameText = (tfr.getFileSize() == tfrMapped.getFileSize() + 1) && (tfr.get(tfrMapped.getFileSize() - 1) == tfrMapped.get(tfrMapped.getFileSize() - 1));
+
+    {
+        uint64 newLineCount = 0;
+        for (uint64 at = 0; at < tfr.getTextLength(); ++at)
+        {
+            newLineCount += (tfr.get(at) == '\n') ? 1 : 0;
+        }
+
+        uint64 lineCount = 0;
+        uint64 mappedLineCount = 0;
+        for (const mint::TextLine& textLine : tfr.getLines())
+        {
+            MINT_ASSURE(textLine._lineIndex == lineCount);
+            MINT_ASSURE(textLine.length() == 0 || textLine._end[-1] != '\r');
+            ++lineCount;
+        }
+        for (const mint::TextLine& textLine : tfrMapped.getLines())
+        {
+            ++mappedLineCount;
+        }
+        MINT_ASSURE(lineCount == mappedLineCount);
+        MINT_ASSURE(lineCount == newLineCount || lineCount == newLineCount + 1);
+    }
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        // 100 MB 정도의 Text 파일
+        static constexpr const char* const kLargeTextFileName = "MintLibraryTest/test_large.txt";
+        static constexpr uint32 kLineCount = 5'000'000;
+        {
+            mint::BinaryFileStreamWriter bfsw;
+            bfsw.open(kLargeTextFileName);
+            char lineBuffer[64]{};
+            for (uint32 lineIndex = 0; lineIndex < kLineCount; ++lineIndex)
+            {
+                mint::formatString(lineBuffer, "%u %.6f %d\r\n", lineIndex, lineIndex * 0.37f, -static_cast<int32>(lineIndex));
+                bfsw.writeSpan(lineBuffer, mint::StringUtil::strlen(lineBuffer));
+            }
+            bfsw.close();
+        }
+
+        mint::TextFileReader largeTextFileReader;
+        largeTextFileReader.openMapped(kLargeTextFileName, mint::FileAccessHint::Sequential);
+        const uint64 textLength = largeTextFileReader.getTextLength();
+
+        uint64 scalarLineCount = 0;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) new line per char get(at)" };
+            for (uint64 at = 0; at < textLength; ++at)
+            {
+                scalarLineCount += (largeTextFileReader.get(at) == '\n') ? 1 : 0;
+            }
+        }
+
+        uint64 simdLineCount = 0;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) new line SSE2 getLines()" };
+            for (const mint::TextLine& textLine : largeTextFileReader.getLines())
+            {
+                ++simdLineCount;
+            }
+        }
+
+        double sumFromChars = 0.0;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) parse numbers StringUtil" };
+            for (const mint::TextLine& textLine : largeTextFileReader.getLines())
+            {
+                uint64 index = 0;
+                double value = 0.0;
+                int32 negativeIndex = 0;
+                const char* at = mint::StringUtil::parseUnsignedInteger(textLine._begin, textLine._end, index);
+                at = mint::StringUtil::parseFloat(at + 1, textLine._end, value);
+                mint::StringUtil::parseInteger(at + 1, textLine._end, negativeIndex);
+                sumFromChars += value + index + negativeIndex;
+            }
+        }
+
+        double sumStd = 0.0;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) parse numbers std::string + std::sto*" };
+            std::string line;
+            for (const mint::TextLine& textLine : largeTextFileReader.getLines())
+            {
+                line.assign(textLine._begin, textLine._end);
+                size_t at = 0;
+                const uint64 index = std::stoull(line, &at);
+                line.erase(0, at + 1);
+                const double value = std::stod(line, &at);
+                line.erase(0, at + 1);
+                const int32 negativeIndex = std::stoi(line);
+                sumStd += value + index + negativeIndex;
+            }
+        }
+
+        printProfilerLogs(logBeginIndex, textLength);
+        printf("lines %llu %llu, sum %f %f\n", scalarLineCount, simdLineCount, sumFromChars, sumStd);
+    }
+#endif
+
     return true;
 }
 
@@ -573,6 +904,454 @@ const bool testLanguage()
     CppHlsl::Parser cppHlslParser{ cppHlslLexer };
     cppHlslParser.execute();
 
+    // Parser 를 다시 execute() 하면 이전 결과를 한꺼번에 버리고 StringArena 를 재사용한다.
+    {
+        const uint32 typeMetaDataCount = cppHlslParser.getTypeMetaDataCount();
+        const uint32 arenaChunkCount = cppHlslParser.getStringArena().getChunkCount();
+        const uint32 arenaUsedLength = cppHlslParser.getStringArena().getUsedLength();
+        MINT_ASSURE(cppHlslParser.execute() == true);
+        MINT_ASSURE(cppHlslParser.getTypeMetaDataCount() == typeMetaDataCount);
+        MINT_ASSURE(cppHlslParser.getStringArena().getChunkCount() == arenaChunkCount);
+        MINT_ASSURE(cppHlslParser.getStringArena().getUsedLength() == arenaUsedLength);
+
+        const CppHlsl::Parser& constParser = cppHlslParser;
+        const CppHlsl::TypeMetaData& vsOutput = constParser.getTypeMetaData("mint::RenderingBase::VS_OUTPUT");
+        MINT_ASSURE(vsOutput.getTypeName() == "mint::RenderingBase::VS_OUTPUT");
+        MINT_ASSURE(vsOutput.getMember(0).getTypeName() == "float4");
+        MINT_ASSURE(vsOutput.getMember(0).getDeclName() == "_screenPosition");
+        MINT_ASSURE(vsOutput.getMember(0).getSemanticName() == "SV_POSITION");
+        MINT_ASSURE(vsOutput.getMember(1).getByteOffset() == 16);
+    }
+
+    // Cache 에서 읽은 결과는 처음부터 Interpret 한 결과와 같아야 한다.
+    {
+        static constexpr const char* const kCacheDirectory = "Assets/CppHlslCache/";
+        const std::string cacheFileName = CppHlsl::Interpreter::makeCacheFileName("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory);
+        const std::string otherTypeCacheFileName = CppHlsl::Interpreter::makeCacheFileName("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::ConstantBuffers, kCacheDirectory);
+        MINT_ASSURE(cacheFileName != otherTypeCacheFileName);
+        MINT_ASSURE(cacheFileName != CppHlsl::Interpreter::makeCacheFileName("Assets/Other/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory));
+        MINT_ASSURE(cacheFileName == CppHlsl::Interpreter::makeCacheFileName("Assets/CppHlsl/../CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory));
+        FileUtil::deleteFile(cacheFileName.c_str());
+        FileUtil::deleteFile(otherTypeCacheFileName.c_str());
+
+        CppHlsl::Interpreter interpreter;
+        MINT_ASSURE(interpreter.interpretCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory) == true);
+        MINT_ASSURE(interpreter.isLoadedFromCache() == false);
+        MINT_ASSURE(FileUtil::exists(cacheFileName.c_str()) == true);
+
+        CppHlsl::Interpreter cachedInterpreter;
+        MINT_ASSURE(cachedInterpreter.interpretCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory) == true);
+        MINT_ASSURE(cachedInterpreter.isLoadedFromCache() == true);
+        MINT_ASSURE(StringUtil::strcmp(interpreter.getHlslString(), cachedInterpreter.getHlslString()) == true);
+        MINT_ASSURE(interpreter.getTypeMetaDataCount() == cachedInterpreter.getTypeMetaDataCount());
+
+        const CppHlsl::TypeMetaData& vsInput = interpreter.getTypeMetaData(typeid(RenderingBase::VS_INPUT_SHAPE));
+        const CppHlsl::TypeMetaData& cachedVsInput = cachedInterpreter.getTypeMetaData(typeid(RenderingBase::VS_INPUT_SHAPE));
+        MINT_ASSURE(cachedVsInput.getTypeName() == vsInput.getTypeName());
+        MINT_ASSURE(cachedVsInput.getSize() == vsInput.getSize());
+        MINT_ASSURE(cachedVsInput.getMemberCount() == vsInput.getMemberCount());
+        for (uint32 memberIndex = 0; memberIndex < vsInput.getMemberCount(); ++memberIndex)
+        {
+            MINT_ASSURE(cachedVsInput.getMember(memberIndex).getDeclName() == vsInput.getMember(memberIndex).getDeclName());
+            MINT_ASSURE(cachedVsInput.getMember(memberIndex).getSemanticName() == vsInput.getMember(memberIndex).getSemanticName());
+            MINT_ASSURE(cachedVsInput.getMember(memberIndex).getByteOffset() == vsInput.getMember(memberIndex).getByteOffset());
+        }
+
+        // 다른 FileType 으로 읽으면 Cache 를 쓰지 않는다.
+        CppHlsl::Interpreter otherTypeInterpreter;
+        MINT_ASSURE(otherTypeInterpreter.interpretCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::ConstantBuffers, kCacheDirectory) == true);
+        MINT_ASSURE(otherTypeInterpreter.isLoadedFromCache() == false);
+
+        // 다른 FileType 의 Cache 가 원래 Cache 를 덮어쓰지 않는다.
+        CppHlsl::Interpreter recachedInterpreter;
+        MINT_ASSURE(recachedInterpreter.interpretCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h", CppHlsl::CppHlslFileType::StreamData, kCacheDirectory) == true);
+        MINT_ASSURE(recachedInterpreter.isLoadedFromCache() == true);
+
+        MINT_ASSURE(FileUtil::deleteFile(cacheFileName.c_str()) == true);
+        MINT_ASSURE(FileUtil::deleteFile(otherTypeCacheFileName.c_str()) == true);
+    }
+
+    // 여러 파일을 병렬로 parse 하고 파일 순서대로 합친다.
+    {
+        static constexpr const char* const kFileNames[] =
+        {
+            "Assets/CppHlsl/CppHlslStreamData.h",
+            "Assets/CppHlsl/CppHlslConstantBuffers.h",
+            "Assets/CppHlsl/CppHlslStructuredBuffers.h",
+            "Assets/CppHlsl/CppHlslStreamData.h", // layout 이 같은 type 은 하나로 합친다.
+        };
+        CppHlsl::Interpreter interpreter;
+        MINT_ASSURE(interpreter.parseCppHlslFiles(kFileNames, static_cast<uint32>(ARRAYSIZE(kFileNames))) == true);
+
+        uint32 mergedTypeCount = 0;
+        for (uint32 typeIndex = 0; typeIndex < interpreter.getTypeMetaDataCount(); ++typeIndex)
+        {
+            mergedTypeCount += (interpreter.getTypeMetaData(typeIndex).isBuiltIn() == true) ? 0 : 1;
+        }
+
+        uint32 singleTypeCount = 0;
+        for (uint32 fileIndex = 0; fileIndex < 3; ++fileIndex)
+        {
+            CppHlsl::Interpreter singleInterpreter;
+            MINT_ASSURE(singleInterpreter.parseCppHlslFile(kFileNames[fileIndex]) == true);
+            for (uint32 typeIndex = 0; typeIndex < singleInterpreter.getTypeMetaDataCount(); ++typeIndex)
+            {
+                const CppHlsl::TypeMetaData& typeMetaData = singleInterpreter.getTypeMetaData(typeIndex);
+                if (typeMetaData.isBuiltIn() == true)
+                {
+                    continue;
+                }
+
+                const CppHlsl::TypeMetaData& mergedTypeMetaData = interpreter.getTypeMetaData(std::string(typeMetaData.getTypeName()));
+                MINT_ASSURE(mergedTypeMetaData.getSize() == typeMetaData.getSize());
+                MINT_ASSURE(mergedTypeMetaData.getMemberCount() == typeMetaData.getMemberCount());
+                MINT_ASSURE(mergedTypeMetaData.getRegisterIndex() == typeMetaData.getRegisterIndex());
+                ++singleTypeCount;
+            }
+        }
+        MINT_ASSURE(mergedTypeCount == singleTypeCount);
+
+        // 같은 이름의 type 이 다른 layout 으로 정의되면 실패한다.
+        static constexpr const char* const kConflictFileNames[] = { "MintLibraryTest/CppHlslConflict0.h", "MintLibraryTest/CppHlslConflict1.h" };
+        TextFileWriter conflictFileWriter0;
+        conflictFileWriter0.write("namespace mint { struct TestType { float4 _value; }; }");
+        conflictFileWriter0.save(kConflictFileNames[0]);
+        TextFileWriter conflictFileWriter1;
+        conflictFileWriter1.write("namespace mint { struct TestType { float2 _value; }; }");
+        conflictFileWriter1.save(kConflictFileNames[1]);
+
+        CppHlsl::Interpreter conflictInterpreter;
+        MINT_ASSURE(conflictInterpreter.parseCppHlslFiles(kConflictFileNames, static_cast<uint32>(ARRAYSIZE(kConflictFileNames))) == false);
+
+        // 열 수 없는 파일이 있어도 프로세스를 끝내지 않고 false 를 반환한다.
+        static constexpr const char* const kMissingFileNames[] = { "Assets/CppHlsl/CppHlslStreamData.h", "Assets/CppHlsl/NotExisting.h" };
+        CppHlsl::Interpreter missingFileInterpreter;
+        MINT_ASSURE(missingFileInterpreter.parseCppHlslFiles(kMissingFileNames, static_cast<uint32>(ARRAYSIZE(kMissingFileNames))) == false);
+    }
+
+    // Buffer packing
+    {
+        CppHlsl::Lexer lexer{ "namespace mint { struct PackingTest { float3 _a; float2 _b; float _c; float4x4 _d; float2 _e; }; }" };
+        MINT_ASSURE(lexer.execute() == true);
+        CppHlsl::Parser parser{ lexer };
+        MINT_ASSURE(parser.execute() == true);
+        const CppHlsl::Parser& constParser = parser;
+        const CppHlsl::TypeMetaData& packingTest = constParser.getTypeMetaData("mint::PackingTest");
+
+        // cbuffer 에서는 _b 가 register 경계를 넘으므로 다음 register 로 밀리고, 행렬도 새 register 에서 시작한다.
+        CppHlsl::BufferLayout constantBufferLayout;
+        CppHlsl::BufferPacking::computeLayout(packingTest, CppHlsl::BufferPackingRule::ConstantBuffer, constantBufferLayout);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[1]._byteOffset == 16);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[2]._byteOffset == 24);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[3]._byteOffset == 32);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[4]._byteOffset == 96);
+        MINT_ASSURE(constantBufferLayout._size == 112);
+        MINT_ASSURE(constantBufferLayout._paddingSize == 16);
+
+        uint32 mismatchMemberIndex = 0;
+        MINT_ASSURE(CppHlsl::BufferPacking::validateLayout(packingTest, CppHlsl::BufferPackingRule::ConstantBuffer, mismatchMemberIndex) == false);
+        MINT_ASSURE(mismatchMemberIndex == 1);
+        MINT_ASSURE(CppHlsl::BufferPacking::validateLayout(packingTest, CppHlsl::BufferPackingRule::StructuredBuffer, mismatchMemberIndex) == true);
+
+        // 순서를 바꾸면 padding 이 없어진다.
+        Vector<uint32> memberOrder;
+        CppHlsl::BufferPacking::computeMinimumSizeMemberOrder(packingTest, CppHlsl::BufferPackingRule::ConstantBuffer, memberOrder);
+        CppHlsl::BufferLayout reorderedLayout;
+        CppHlsl::BufferPacking::computeLayout(packingTest, CppHlsl::BufferPackingRule::ConstantBuffer, memberOrder, reorderedLayout);
+        MINT_ASSURE(memberOrder[0] == 3);
+        MINT_ASSURE(reorderedLayout._size == 96);
+        MINT_ASSURE(reorderedLayout._paddingSize == 0);
+
+        CppHlsl::Interpreter interpreter;
+        MINT_ASSURE(interpreter.parseCppHlslFile("Assets/CppHlsl/CppHlslConstantBuffers.h") == true);
+        const CppHlsl::TypeMetaData& cbView = interpreter.getTypeMetaData(typeid(RenderingBase::CB_View));
+        MINT_ASSURE(CppHlsl::BufferPacking::validateLayout(cbView, CppHlsl::BufferPackingRule::ConstantBuffer, mismatchMemberIndex) == true);
+    }
+
+    // Constant expression: 배열 크기와 register index 를 상수 식으로 정하고, 상수는 안쪽 scope 부터 찾는다.
+    {
+        CppHlsl::Lexer lexer
+        {
+            "namespace mint { namespace RenderingBase {\n"
+            "static constexpr uint32 kLightCount = 1 << 2;\n"
+            "static constexpr uint32 kLightStride = sizeof(float4) * 2 + (0x1F & ~0xF);\n"
+            "constexpr int32 kNegative = -(7 % 4) - 1;\n"
+            "static constexpr uint8 kTruncated = 0x1FF;\n"
+            "static constexpr float kPi = 3.14f;\n"
+            "struct CB_Lights CPP_HLSL_REGISTER_INDEX(kLightCount - 2)\n"
+            "{\n"
+            "    static constexpr uint32 kHalfCount = RenderingBase::kLightCount / 2;\n"
+            "    float4 _positions[kLightCount];\n"
+            "    float4 _colors[kHalfCount];\n"
+            "    float _intensities[mint::RenderingBase::kLightCount];\n"
+            "    uint _lightCount{ kLightCount };\n"
+            "};\n"
+            "} }"
+        };
+        MINT_ASSURE(lexer.execute() == true);
+        CppHlsl::Parser parser{ lexer };
+        MINT_ASSURE(parser.execute() == true);
+
+        int64 value = 0;
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::kLightCount", value) == true && value == 4);
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::kLightStride", value) == true && value == 48);
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::kNegative", value) == true && value == -4);
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::kTruncated", value) == true && value == 0xFF);
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::CB_Lights::kHalfCount", value) == true && value == 2);
+        MINT_ASSURE(parser.findConstantValue("mint::RenderingBase::kPi", value) == false);
+        MINT_ASSURE(parser.findConstantValue("kLightCount", value) == false);
+        MINT_ASSURE(parser.getConstantCount() == 5);
+
+        const CppHlsl::Parser& constParser = parser;
+        const CppHlsl::TypeMetaData& cbLights = constParser.getTypeMetaData("mint::RenderingBase::CB_Lights");
+        MINT_ASSURE(cbLights.getRegisterIndex() == 2);
+        MINT_ASSURE(cbLights.getMemberCount() == 4);
+        MINT_ASSURE(cbLights.getMember(0).getArrayCount() == 4 && cbLights.getMember(0).getSize() == 64 && cbLights.getMember(0).getElementSize() == 16);
+        MINT_ASSURE(cbLights.getMember(1).getArrayCount() == 2 && cbLights.getMember(1).getByteOffset() == 64);
+        MINT_ASSURE(cbLights.getMember(2).getArrayCount() == 4 && cbLights.getMember(2).getSize() == 16 && cbLights.getMember(2).getByteOffset() == 96);
+        MINT_ASSURE(cbLights.getMember(3).isArray() == false && cbLights.getMember(3).getByteOffset() == 112);
+        MINT_ASSURE(cbLights.getSize() == 116);
+
+        const std::string constantBuffer = parser.serializeCppHlslTypeToHlslConstantBuffer(cbLights, 0);
+        MINT_ASSURE(constantBuffer.find("cbuffer CB_Lights : register(b2)") != std::string::npos);
+        MINT_ASSURE(constantBuffer.find("\tfloat4 _positions[4];\n") != std::string::npos);
+        MINT_ASSURE(constantBuffer.find("\tfloat _intensities[4];\n") != std::string::npos);
+        const std::string constants = parser.serializeConstantsToHlsl();
+        MINT_ASSURE(constants.find("static const uint kLightCount = 4;\n") != std::string::npos);
+        MINT_ASSURE(constants.find("static const int kNegative = -4;\n") != std::string::npos);
+        MINT_ASSURE(constants.find("kHalfCount = 2;") != std::string::npos);
+
+        // cbuffer 에서 float 배열의 원소는 각각 register 를 차지하므로 C++ 의 layout 과 다르다.
+        CppHlsl::BufferLayout constantBufferLayout;
+        CppHlsl::BufferPacking::computeLayout(cbLights, CppHlsl::BufferPackingRule::ConstantBuffer, constantBufferLayout);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[2]._byteOffset == 96 && constantBufferLayout._packedMemberArray[2]._size == 52);
+        MINT_ASSURE(constantBufferLayout._packedMemberArray[3]._byteOffset == 148);
+        MINT_ASSURE(constantBufferLayout._size == 160);
+        uint32 mismatchMemberIndex = 0;
+        MINT_ASSURE(CppHlsl::BufferPacking::validateLayout(cbLights, CppHlsl::BufferPackingRule::ConstantBuffer, mismatchMemberIndex) == false && mismatchMemberIndex == 2);
+        MINT_ASSURE(CppHlsl::BufferPacking::validateLayout(cbLights, CppHlsl::BufferPackingRule::StructuredBuffer, mismatchMemberIndex) == true);
+
+        // Evaluator 만 따로: 우선순위와 에러
+        class TestConstantResolver final : public CppHlsl::IConstantResolver
+        {
+        public:
+            virtual const bool resolveConstant(const std::string_view name, int64& outValue) const noexcept override final
+            {
+                outValue = 10;
+                return name == "kTen";
+            }
+            virtual const bool resolveTypeSize(const std::string_view typeName, uint32& outTypeSize) const noexcept override final
+            {
+                outTypeSize = 4;
+                return typeName == "mint::uint32";
+            }
+        };
+        const TestConstantResolver testConstantResolver;
+        const auto evaluate = [&testConstantResolver](const char* const expression, int64& outValue, std::string& outErrorSymbol)
+        {
+            // 식 뒤에 ; 를 붙여 마지막 token 도 symbol 이 되게 한다.
+            CppHlsl::Lexer expressionLexer{ std::string(expression) + ";" };
+            expressionLexer.execute();
+            CppHlsl::ConstantExpressionEvaluator evaluator{ expressionLexer.getSymbolTable(), testConstantResolver };
+            const bool isEvaluated = evaluator.evaluate(0, expressionLexer.getSymbolCount() - 1, outValue);
+            // Symbol 은 expressionLexer 의 source 를 가리키므로 복사해 둔다.
+            outErrorSymbol = (isEvaluated == true) ? std::string() : std::string(expressionLexer.getSymbol(evaluator.getErrorSymbolPosition())._symbolString);
+            return isEvaluated;
+        };
+        std::string errorSymbol;
+        MINT_ASSURE(evaluate("1 + 2 * 3 - (8 >> 1) | 0x100", value, errorSymbol) == true && value == 259);
+        MINT_ASSURE(evaluate("kTen - 2 - 3 ^ 0b11", value, errorSymbol) == true && value == 6);
+        MINT_ASSURE(evaluate("- - ~kTen + 010 + 1u * sizeof(mint::uint32)", value, errorSymbol) == true && value == 1);
+        MINT_ASSURE(evaluate("(((kTen)))", value, errorSymbol) == true && value == 10);
+        MINT_ASSURE(evaluate("kTen / (kTen - 10)", value, errorSymbol) == false && errorSymbol == "/");
+        MINT_ASSURE(evaluate("1 << 64", value, errorSymbol) == false && errorSymbol == "<<");
+        MINT_ASSURE(evaluate("kTen + kEleven", value, errorSymbol) == false && errorSymbol == "kEleven");
+        MINT_ASSURE(evaluate("sizeof(float5)", value, errorSymbol) == false && errorSymbol == "float5");
+        MINT_ASSURE(evaluate("(1 + 2", value, errorSymbol) == false && errorSymbol == "(");
+        MINT_ASSURE(evaluate("1 2", value, errorSymbol) == false && errorSymbol == "2");
+        MINT_ASSURE(evaluate("0x1G", value, errorSymbol) == false && errorSymbol == "0x1G");
+    }
+
+    // Golden: Assets/CppHlsl 의 헤더들로 만든 HLSL 과 layout JSON 은 MintLibraryTest/Golden 의 파일들과 글자 하나까지 같아야 한다.
+    // 출력이 의도적으로 바뀌었다면 MintCppHlslTool 로 Golden 파일들을 다시 만든다.
+    {
+        struct GoldenCase
+        {
+            const char*                 _name;
+            CppHlsl::CppHlslFileType    _fileType;
+        };
+        static constexpr GoldenCase kGoldenCases[] =
+        {
+            { "CppHlslStreamData"       , CppHlsl::CppHlslFileType::StreamData          },
+            { "CppHlslConstantBuffers"  , CppHlsl::CppHlslFileType::ConstantBuffers     },
+            { "CppHlslStructuredBuffers", CppHlsl::CppHlslFileType::StructuredBuffers   },
+        };
+        for (const GoldenCase& goldenCase : kGoldenCases)
+        {
+            CppHlsl::Interpreter interpreter;
+            MINT_ASSURE(interpreter.parseCppHlslFile((std::string("Assets/CppHlsl/") + goldenCase._name + ".h").c_str()) == true);
+            interpreter.generateHlslString(goldenCase._fileType);
+            interpreter.generateLayoutJsonString();
+
+            TextFileReader goldenHlslReader;
+            MINT_ASSURE(goldenHlslReader.open((std::string("MintLibraryTest/Golden/") + goldenCase._name + ".hlsl").c_str()) == true);
+            MINT_ASSURE(StringUtil::strcmp(goldenHlslReader.get(), interpreter.getHlslString()) == true);
+
+            TextFileReader goldenJsonReader;
+            MINT_ASSURE(goldenJsonReader.open((std::string("MintLibraryTest/Golden/") + goldenCase._name + ".json").c_str()) == true);
+            MINT_ASSURE(StringUtil::strcmp(goldenJsonReader.get(), interpreter.getLayoutJsonString()) == true);
+        }
+    }
+
+    MINT_ASSURE(testShaderCache("MintLibraryTest/ShaderCache/") == true);
+
+    // ShaderCompileQueue: D3D 없이 가짜 compiler 로 scheduling 을 확인한다.
+    {
+        class FakeShaderCompiler final : public RenderingBase::IShaderCompiler
+        {
+        public:
+            virtual const bool compile(const RenderingBase::ShaderCompileRequest& request, RenderingBase::ShaderCompileResult& outResult) noexcept override final
+            {
+                _compileCount.fetch_add(1);
+                if (request._source.find("error") != std::string_view::npos)
+                {
+                    outResult._errorMessage = request._identifier;
+                    return false;
+                }
+
+                // Binary 는 source 를 뒤집은 것
+                outResult._binary.resize(static_cast<uint32>(request._source.length()));
+                for (uint32 at = 0; at < outResult._binary.size(); ++at)
+                {
+                    outResult._binary[at] = static_cast<byte>(request._source[request._source.length() - 1 - at]);
+                }
+                return true;
+            }
+
+        public:
+            std::atomic<uint32> _compileCount{ 0 };
+        };
+
+        static constexpr const char* const kSources[] = { "VsA", "PsB", "GsC", "error", "PsE", "VsF", "PsG", "GsH" };
+        for (const uint32 maxWorkerCount : { 1u, 0u })
+        {
+            FakeShaderCompiler fakeShaderCompiler;
+            RenderingBase::ShaderCompileQueue shaderCompileQueue{ fakeShaderCompiler };
+            for (const char* const source : kSources)
+            {
+                RenderingBase::ShaderCompileRequest request;
+                request._identifier = source;
+                request._source = source;
+                request._entryPoint = "main";
+                request._targetProfile = "ps_5_0";
+                shaderCompileQueue.push(request);
+            }
+            shaderCompileQueue.execute(maxWorkerCount);
+
+            MINT_ASSURE(fakeShaderCompiler._compileCount.load() == ARRAYSIZE(kSources));
+            MINT_ASSURE(shaderCompileQueue.isAllSucceeded() == false);
+            MINT_ASSURE(shaderCompileQueue.getResult(3)._isSucceeded == false && shaderCompileQueue.getResult(3)._errorMessage == "error");
+            MINT_ASSURE(shaderCompileQueue.getResult(5)._isSucceeded == true && shaderCompileQueue.getResult(5)._binary.size() == 3);
+            MINT_ASSURE(shaderCompileQueue.getResult(5)._binary[0] == 'F' && shaderCompileQueue.getResult(5)._binary[2] == 'V');
+        }
+    }
+
+    // ShaderPermutation: 가짜 compiler 로 variant 를 찾고 처음 쓸 때만 compile 하는지 확인한다.
+    {
+        class EchoShaderCompiler final : public RenderingBase::IShaderCompiler
+        {
+        public:
+            virtual const bool compile(const RenderingBase::ShaderCompileRequest& request, RenderingBase::ShaderCompileResult& outResult) noexcept override final
+            {
+                _compileCount.fetch_add(1);
+                if (request._source.find("#define BROKEN 1") != std::string_view::npos)
+                {
+                    outResult._errorMessage = request._identifier;
+                    return false;
+                }
+
+                // Binary 는 Keyword 정의가 붙은 source 그대로
+                outResult._binary.resize(static_cast<uint32>(request._source.length()));
+                for (uint32 at = 0; at < outResult._binary.size(); ++at)
+                {
+                    outResult._binary[at] = static_cast<byte>(request._source[at]);
+                }
+                return true;
+            }
+
+        public:
+            std::atomic<uint32> _compileCount{ 0 };
+        };
+
+        RenderingBase::ShaderKeywordSet keywordSet;
+        MINT_ASSURE(keywordSet.parseDeclaration("//#keywords UNLIT TEXCOORD_AS_COLOR\nfloat4 main() : SV_TARGET { return 0; }\n//#keywords UNLIT BROKEN") == 3);
+        MINT_ASSURE(keywordSet.getKeywordMask("UNLIT") == 1 && keywordSet.getKeywordMask("TEXCOORD_AS_COLOR") == 2 && keywordSet.getKeywordMask("BROKEN") == 4);
+        MINT_ASSURE(keywordSet.getKeywordMask("main") == 0 && keywordSet.getDeclaredMask() == 7);
+        std::string definitionPrefix;
+        keywordSet.makeDefinitionPrefix(5, definitionPrefix);
+        MINT_ASSURE(definitionPrefix == "#define UNLIT 1\n#define BROKEN 1\n#line 1\n");
+        keywordSet.makeDefinitionPrefix(0, definitionPrefix);
+        MINT_ASSURE(definitionPrefix.empty() == true);
+
+        EchoShaderCompiler echoShaderCompiler;
+        RenderingBase::ShaderPermutationCache shaderPermutationCache{ echoShaderCompiler };
+        const std::string_view kSource = "//#keywords UNLIT TEXCOORD_AS_COLOR BROKEN\nfloat4 main() : SV_TARGET { return 0; }";
+        const uint32 shaderIndex = shaderPermutationCache.registerShader("PsTest", kSource, "main", "ps_5_0");
+        const RenderingBase::ShaderKeywordSet& registeredKeywordSet = shaderPermutationCache.getKeywordSet(shaderIndex);
+        const RenderingBase::ShaderKeywordMask unlitMask = registeredKeywordSet.getKeywordMask("UNLIT");
+        const RenderingBase::ShaderKeywordMask texCoordAsColorMask = registeredKeywordSet.getKeywordMask("TEXCOORD_AS_COLOR");
+        const RenderingBase::ShaderKeywordMask brokenMask = registeredKeywordSet.getKeywordMask("BROKEN");
+        MINT_ASSURE(shaderPermutationCache.getVariantCount(shaderIndex) == 0);
+
+        // 처음 쓰는 variant 만 compile 한다.
+        MINT_ASSURE(shaderPermutationCache.getVariant(shaderIndex, 0)._binary.size() == kSource.length());
+        MINT_ASSURE(shaderPermutationCache.getVariant(shaderIndex, 0)._isSucceeded == true);
+        MINT_ASSURE(echoShaderCompiler._compileCount.load() == 1);
+        {
+            const RenderingBase::ShaderCompileResult& variant = shaderPermutationCache.getVariant(shaderIndex, unlitMask | texCoordAsColorMask);
+            const std::string_view variantSource{ reinterpret_cast<const char*>(variant._binary.data()), variant._binary.size() };
+            MINT_ASSURE(variantSource.substr(0, 55) == "#define UNLIT 1\n#define TEXCOORD_AS_COLOR 1\n#line 1\n//#");
+        }
+        MINT_ASSURE(echoShaderCompiler._compileCount.load() == 2);
+        MINT_ASSURE(shaderPermutationCache.hasVariant(shaderIndex, unlitMask | texCoordAsColorMask) == true);
+        MINT_ASSURE(shaderPermutationCache.hasVariant(shaderIndex, unlitMask) == false);
+
+        // 실패한 variant 도 기억한다.
+        MINT_ASSURE(shaderPermutationCache.getVariant(shaderIndex, brokenMask)._isSucceeded == false);
+        MINT_ASSURE(shaderPermutationCache.getVariant(shaderIndex, brokenMask)._errorMessage == "PsTest");
+        MINT_ASSURE(echoShaderCompiler._compileCount.load() == 3);
+
+        // 이미 있거나 겹치는 mask 는 빼고 한꺼번에 compile 한다.
+        const RenderingBase::ShaderKeywordMask keywordMasks[] = { 0, unlitMask, texCoordAsColorMask, unlitMask, unlitMask | texCoordAsColorMask };
+        shaderPermutationCache.compileVariants(shaderIndex, keywordMasks, ARRAYSIZE(keywordMasks));
+        MINT_ASSURE(echoShaderCompiler._compileCount.load() == 5);
+        MINT_ASSURE(shaderPermutationCache.getVariantCount(shaderIndex) == 5);
+        MINT_ASSURE(shaderPermutationCache.getVariant(shaderIndex, texCoordAsColorMask)._isSucceeded == true);
+        MINT_ASSURE(echoShaderCompiler._compileCount.load() == 5);
+
+        // Source 가 바뀌면 variant 를 모두 버린다.
+        MINT_ASSURE(shaderPermutationCache.updateSource(shaderIndex, kSource) == false);
+        MINT_ASSURE(shaderPermutationCache.updateSource(shaderIndex, "//#keywords TEXCOORD_AS_COLOR\nfloat4 main() : SV_TARGET { return 1; }") == true);
+        MINT_ASSURE(shaderPermutationCache.getVariantCount(shaderIndex) == 0);
+        MINT_ASSURE(shaderPermutationCache.getKeywordSet(shaderIndex).getKeywordMask("TEXCOORD_AS_COLOR") == 1);
+    }
+
+    // Lexer
+    {
+        CppHlsl::Lexer lexer{ "struct VS_INPUT\n{\n    float4\t_position : POSITION0;\n    uint    _flags[2], _id;\n};" };
+        MINT_ASSURE(lexer.execute() == true);
+        MINT_ASSURE(lexer.getSymbolCount() == 18);
+        MINT_ASSURE(lexer.getSymbol(0)._symbolClassifier == CppHlsl::SymbolClassifier::Keyword && lexer.getSymbol(0)._symbolString == "struct");
+        MINT_ASSURE(lexer.getSymbol(1)._symbolClassifier == CppHlsl::SymbolClassifier::Identifier && lexer.getSymbol(1)._symbolString == "VS_INPUT");
+        MINT_ASSURE(lexer.getSymbol(2)._symbolClassifier == CppHlsl::SymbolClassifier::Grouper_Open && lexer.getSymbol(2)._symbolString == "{");
+        MINT_ASSURE(lexer.getSymbol(4)._symbolClassifier == CppHlsl::SymbolClassifier::Identifier && lexer.getSymbol(4)._symbolString == "_position");
+        MINT_ASSURE(lexer.getSymbol(7)._symbolClassifier == CppHlsl::SymbolClassifier::StatementTerminator && lexer.getSymbol(7)._symbolString == ";");
+        MINT_ASSURE(lexer.getSymbol(11)._symbolClassifier == CppHlsl::SymbolClassifier::NumberLiteral && lexer.getSymbol(11)._symbolString == "2");
+        MINT_ASSURE(lexer.getSymbol(13)._symbolClassifier == CppHlsl::SymbolClassifier::Punctuator && lexer.getSymbol(13)._symbolString == ",");
+        MINT_ASSURE(lexer.getSymbol(14)._symbolClassifier == CppHlsl::SymbolClassifier::Identifier && lexer.getSymbol(14)._symbolString == "_id");
+        MINT_ASSURE(lexer.getSymbol(17)._symbolClassifier == CppHlsl::SymbolClassifier::StatementTerminator && lexer.getSymbol(17)._symbolString == ";");
+    }
+
     struct TestStruct
     {
         mint::float1 _a           = 1.0f;                             // v[0]
@@ -588,6 +1367,79 @@ const bool testLanguage()
     TestStruct ts;
     uint64 tss = sizeof(TestStruct);
 
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr const char* const kSourceFileNames[] =
+        {
+            "Assets/CppHlsl/CppHlslConstantBuffers.h",
+            "Assets/CppHlsl/CppHlslStreamData.h",
+            "Assets/CppHlsl/CppHlslStructuredBuffers.h",
+            "Assets/Hlsl/GsMeshDebug.hlsl",
+            "Assets/Hlsl/PsDefault.hlsl",
+            "Assets/Hlsl/VsDefault.hlsl",
+        };
+        std::string corpus;
+        for (const char* const sourceFileName : kSourceFileNames)
+        {
+            TextFileReader sourceFileReader;
+            if (sourceFileReader.open(sourceFileName) == true)
+            {
+                corpus.append(sourceFileReader.get());
+                corpus.push_back('\n');
+            }
+        }
+
+        std::string largeSource;
+        while (corpus.empty() == false && largeSource.size() < 4 * 1024 * 1024)
+        {
+            largeSource.append(corpus);
+        }
+
+        CppHlsl::Lexer largeLexer{ largeSource };
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "CppHlsl::Lexer::execute()" };
+            largeLexer.execute();
+        }
+
+        printProfilerLogs(logBeginIndex, largeSource.size());
+        printf("symbols %u\n", largeLexer.getSymbolCount());
+    }
+
+    // CppHlsl 헤더 하나를 Lex, Parse 하고 HLSL 과 layout JSON 을 만드는 데까지 걸리는 시간
+    {
+        static constexpr uint32 kRepeatCount = 1000;
+        static constexpr const char* const kCppHlslFileNames[] =
+        {
+            "Assets/CppHlsl/CppHlslStreamData.h",
+            "Assets/CppHlsl/CppHlslConstantBuffers.h",
+            "Assets/CppHlsl/CppHlslStructuredBuffers.h",
+        };
+        static constexpr CppHlsl::CppHlslFileType kCppHlslFileTypes[] =
+        {
+            CppHlsl::CppHlslFileType::StreamData,
+            CppHlsl::CppHlslFileType::ConstantBuffers,
+            CppHlsl::CppHlslFileType::StructuredBuffers,
+        };
+
+        const uint32 logBeginIndex = getProfilerLogCount();
+        for (uint32 fileIndex = 0; fileIndex < ARRAYSIZE(kCppHlslFileNames); ++fileIndex)
+        {
+            CppHlsl::Interpreter interpreter;
+            mint::Profiler::ScopedCpuProfiler profiler{ kCppHlslFileNames[fileIndex] };
+            for (uint32 repeatIndex = 0; repeatIndex < kRepeatCount; ++repeatIndex)
+            {
+                interpreter.parseCppHlslFile(kCppHlslFileNames[fileIndex]);
+                interpreter.generateHlslString(kCppHlslFileTypes[fileIndex]);
+                interpreter.generateLayoutJsonString();
+            }
+        }
+
+        printf("%u repeats per file\n", kRepeatCount);
+        printProfilerLogs(logBeginIndex);
+    }
+#endif
+
     //std::string syntaxTreeString = cppHlslParser.getSyntaxTreeString();
     //const mint::CppHlsl::TypeMetaData& typeMetaData0 = cppHlslParser.getTypeMetaData("VS_INPUT_SHAPE");
     //const mint::CppHlsl::TypeMetaData& typeMetaData1 = cppHlslParser.getTypeMetaData(1);
@@ -663,6 +1515,1092 @@ const bool testLinearAlgebra()
     mint::Math::Matrix<2, 2> mat3;
     const bool isMat3Idempotent = mat3.isIdempotentMatrix();
 
+    {
+        constexpr mint::Math::Matrix<3, 3> constexprMatrix{ 0.0, 2.0, 1.0, 1.0, 1.0, 0.0, 3.0, 0.0, 4.0 };
+        constexpr mint::Math::Matrix<3, 3> constexprSquared = constexprMatrix * constexprMatrix;
+        static_assert(constexprSquared.getElement(2, 2) == 19.0, "constexpr Matrix multiplication is broken!");
+        static_assert(mint::Math::absolute(constexprMatrix.determinant() + 11.0) < 1e-12, "constexpr Matrix determinant is broken!");
+
+        // 첫 pivot 이 0 이라 pivoting 없이는 분해할 수 없는 행렬
+        mint::Math::Matrixf<4, 4> a{ 0.0f, 2.0f, 1.0f, 3.0f, 1.0f, 1.0f, 0.0f, 2.0f, 3.0f, 0.0f, 4.0f, 1.0f, 2.0f, 5.0f, 1.0f, 0.0f };
+        const mint::Math::VectorRf<4> b{ 1.0f, 2.0f, 3.0f, 4.0f };
+        mint::Math::VectorRf<4> x;
+        MINT_ASSURE(a.solve(b, x) == true);
+        const mint::Math::VectorRf<4> ax = a * x;
+        mint::Math::Matrixf<4, 4> aInverse;
+        MINT_ASSURE(a.inverse(aInverse) == true);
+        const mint::Math::Matrixf<4, 4> identity = a * aInverse;
+        mint::Math::Matrixf<4, 4> l;
+        mint::Math::Matrixf<4, 4> u;
+        int32 rowPermutation[4]{};
+        MINT_ASSURE(a.factorizeLu(l, u, rowPermutation) == true);
+        const mint::Math::Matrixf<4, 4> lu = l * u;
+        for (uint32 rowIndex = 0; rowIndex < 4; ++rowIndex)
+        {
+            MINT_ASSURE(mint::Math::equals(ax[rowIndex], b[rowIndex], 0.0001f));
+            for (uint32 columnIndex = 0; columnIndex < 4; ++columnIndex)
+            {
+                MINT_ASSURE(mint::Math::equals(identity.getElement(rowIndex, columnIndex), (rowIndex == columnIndex) ? 1.0f : 0.0f, 0.0001f));
+                MINT_ASSURE(mint::Math::equals(lu.getElement(rowIndex, columnIndex), a.getElement(rowPermutation[rowIndex], columnIndex), 0.0001f));
+            }
+        }
+
+        const mint::Math::Matrix<3, 3> spd{ 4.0, 12.0, -16.0, 12.0, 37.0, -43.0, -16.0, -43.0, 98.0 };
+        mint::Math::Matrix<3, 3> cholesky;
+        MINT_ASSURE(spd.factorizeCholesky(cholesky) == true);
+        MINT_ASSURE(cholesky == (mint::Math::Matrix<3, 3>{ 2.0, 0.0, 0.0, 6.0, 1.0, 0.0, -8.0, 5.0, 3.0 }));
+        MINT_ASSURE(constexprMatrix.factorizeCholesky(cholesky) == false);
+
+        const mint::Math::Matrix<2, 2> singular{ 1.0, 2.0, 2.0, 4.0 };
+        mint::Math::Matrix<2, 2> singularInverse;
+        MINT_ASSURE(singular.inverse(singularInverse) == false);
+        MINT_ASSURE(singular.determinant() == 0.0);
+    }
+
+    {
+        const mint::Float4x4 srt = mint::Float4x4::srtMatrix(mint::Float3(1.0f, 2.0f, 3.0f), mint::Quaternion::makeRotationQuaternion(mint::Float3(1.0f, 1.0f, 0.0f), 0.7f), mint::Float3(4.0f, 5.0f, 6.0f));
+        const mint::Float4x4 srtInverse = srt.inverse();
+        const mint::Float4x4 identity = srt * srtInverse;
+        const mint::Float4x4 srtInverseScalar = srt.adjugate() / (srt._11 * srt.minor(0, 0).determinant() - srt._12 * srt.minor(0, 1).determinant() + srt._13 * srt.minor(0, 2).determinant() - srt._14 * srt.minor(0, 3).determinant());
+        for (uint32 rowIndex = 0; rowIndex < 4; ++rowIndex)
+        {
+            for (uint32 columnIndex = 0; columnIndex < 4; ++columnIndex)
+            {
+                MINT_ASSURE(mint::Math::equals(identity._m[rowIndex][columnIndex], (rowIndex == columnIndex) ? 1.0f : 0.0f, 0.0001f));
+                MINT_ASSURE(mint::Math::equals(srtInverse._m[rowIndex][columnIndex], srtInverseScalar._m[rowIndex][columnIndex], 0.0001f));
+                MINT_ASSURE(srt.transpose()._m[columnIndex][rowIndex] == srt._m[rowIndex][columnIndex]);
+            }
+        }
+        MINT_ASSURE(mint::Math::equals(srt.determinant(), 6.0f, 0.0001f));
+
+        const mint::Float4 v{ 1.0f, 2.0f, 3.0f, 1.0f };
+        const mint::Float4 transformed = srt * v;
+        MINT_ASSURE(mint::Math::equals(transformed._x, mint::Float4::dotProductRaw(srt._row[0]._f, v._f), 0.0001f));
+        MINT_ASSURE(mint::Math::equals(transformed._w, 1.0f));
+
+        const mint::Float4 cross = mint::Float4::cross(mint::Float4(1.0f, 0.0f, 0.0f, 5.0f), mint::Float4(0.0f, 1.0f, 0.0f, 7.0f));
+        MINT_ASSURE(cross == mint::Float4(0.0f, 0.0f, 1.0f, 0.0f));
+        MINT_ASSURE(mint::Math::equals(mint::Float4::normalize(v).length(), 1.0f));
+        MINT_ASSURE(mint::Float4::normalize(mint::Float4::kZero) == mint::Float4::kZero);
+    }
+
+    {
+        const mint::Float4x4 srt = mint::Float4x4::srtMatrix(mint::Float3(1.0f, 2.0f, 3.0f), mint::Quaternion::makeRotationQuaternion(mint::Float3(0.0f, 1.0f, 1.0f), 1.3f), mint::Float3(-1.0f, 0.5f, 2.0f));
+        static constexpr uint32 kCount = 1031;
+        std::vector<mint::Float3> points(kCount);
+        std::vector<mint::Float3> transformedPoints(kCount);
+        std::vector<mint::Float3> transformedNormals(kCount);
+        std::vector<mint::Float4> points4(kCount);
+        std::vector<float> xs(kCount);
+        std::vector<float> ys(kCount);
+        std::vector<float> zs(kCount);
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            points[i].set(i * 0.25f, 1.0f - i, static_cast<float>(i % 7));
+            points4[i] = mint::Float4(points[i]._x, points[i]._y, points[i]._z, 1.0f);
+            xs[i] = points[i]._x;
+            ys[i] = points[i]._y;
+            zs[i] = points[i]._z;
+        }
+        mint::BatchTransform::transformPoints(srt, points.data(), transformedPoints.data(), kCount);
+        mint::BatchTransform::transformNormals(srt, points.data(), transformedNormals.data(), kCount);
+        mint::BatchTransform::transformPoints(srt, points4.data(), points4.data(), kCount, true);
+        mint::BatchTransform::transformPointsSoA(srt, xs.data(), ys.data(), zs.data(), xs.data(), ys.data(), zs.data(), kCount);
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            const mint::Float4 expectedPoint = srt * mint::Float4(points[i]._x, points[i]._y, points[i]._z, 1.0f);
+            const mint::Float4 expectedNormal = srt * mint::Float4(points[i]._x, points[i]._y, points[i]._z, 0.0f);
+            const float epsilon = 0.0001f * (1.0f + i);
+            MINT_ASSURE(mint::Math::equals(transformedPoints[i]._x, expectedPoint._x, epsilon) && mint::Math::equals(transformedPoints[i]._z, expectedPoint._z, epsilon));
+            MINT_ASSURE(mint::Math::equals(transformedNormals[i]._y, expectedNormal._y, epsilon));
+            MINT_ASSURE(mint::Math::equals(points4[i]._y, expectedPoint._y, epsilon) && mint::Math::equals(points4[i]._w, 1.0f));
+            MINT_ASSURE(mint::Math::equals(xs[i], expectedPoint._x, epsilon) && mint::Math::equals(zs[i], expectedPoint._z, epsilon));
+        }
+
+        std::vector<mint::Float4x4> locals(kCount);
+        std::vector<mint::Float4x4> worlds(kCount);
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            locals[i] = mint::Float4x4::rotationMatrixY(i * 0.01f);
+        }
+        mint::BatchTransform::multiplyMatrices(srt, locals.data(), worlds.data(), kCount);
+        mint::BatchTransform::multiplyMatrices(locals.data(), worlds.data(), locals.data(), kCount, true);
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            const mint::Float4x4 local = mint::Float4x4::rotationMatrixY(i * 0.01f);
+            const mint::Float4x4 expected = local * (srt * local);
+            MINT_ASSURE(mint::Math::equals(worlds[i]._m[1][2], (srt * local)._m[1][2], 0.0001f));
+            MINT_ASSURE(mint::Math::equals(locals[i]._m[0][3], expected._m[0][3], 0.0001f));
+        }
+    }
+
+    {
+        static constexpr uint32 kCount = 37;
+        mint::Vector<mint::Float4> positions;
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            positions.push_back(mint::Float4(i * 1.0f, -(i * 2.0f), (i % 5) * 3.0f, 1.0f));
+        }
+        mint::Float3SoA positionStream;
+        positionStream.assignFromAoS(positions.data(), positions.size());
+        MINT_ASSURE(positionStream.size() == kCount);
+        MINT_ASSURE(positionStream.capacity() % mint::Float3SoA::kLaneAlignment == 0);
+        MINT_ASSURE(positionStream.get(5) == mint::Float3(5.0f, -10.0f, 0.0f));
+
+        mint::Float3 aabbMin;
+        mint::Float3 aabbMax;
+        MINT_ASSURE(positionStream.computeAABB(aabbMin, aabbMax) == true);
+        MINT_ASSURE(aabbMin == mint::Float3(0.0f, -72.0f, 0.0f));
+        MINT_ASSURE(aabbMax == mint::Float3(36.0f, 0.0f, 12.0f));
+        mint::Float3 sphereCenter;
+        float sphereRadius = 0.0f;
+        MINT_ASSURE(positionStream.computeBoundingSphere(sphereCenter, sphereRadius) == true);
+        for (uint32 i = 0; i < kCount; ++i)
+        {
+            MINT_ASSURE((positionStream.get(i) - sphereCenter).length() <= sphereRadius + 0.0001f);
+        }
+
+        mint::Float3SoA directionStream = positionStream;
+        directionStream.push_back(mint::Float3(0.0f, 0.0f, 1.0f));
+        positionStream.push_back(mint::Float3(1.0f, 0.0f, 0.0f));
+        mint::Float3SoA crossStream;
+        mint::Float3SoA::cross(positionStream, directionStream, crossStream);
+        MINT_ASSURE(crossStream.get(kCount) == mint::Float3(0.0f, -1.0f, 0.0f));
+        float dots[kCount + 1];
+        mint::Float3SoA::dot(crossStream, positionStream, dots);
+        directionStream.normalize();
+        float lengths[kCount + 1];
+        directionStream.computeLengths(lengths);
+        for (uint32 i = 1; i < kCount + 1; ++i)
+        {
+            MINT_ASSURE(mint::Math::equals(dots[i], 0.0f, 0.01f));
+            MINT_ASSURE(mint::Math::equals(lengths[i], 1.0f));
+        }
+
+        mint::Vector<mint::Float4> roundTrip(kCount + 1);
+        directionStream.copyToAoS(&roundTrip[0], 0.0f);
+        MINT_ASSURE(roundTrip[kCount] == mint::Float4(0.0f, 0.0f, 1.0f, 0.0f));
+    }
+
+    {
+        // Quaternion: SIMD Hamilton product, fast rotateVector, 행렬 변환, 보간
+        const mint::Quaternion a = mint::Quaternion::makeRotationQuaternion(mint::Float3(1.0f, 2.0f, 3.0f), 0.9f);
+        const mint::Quaternion b = mint::Quaternion::makeRotationQuaternion(mint::Float3(-2.0f, 0.5f, 1.0f), 2.1f);
+        const mint::Quaternion product = a * b;
+        const float expectedW = a._w * b._w - a._x * b._x - a._y * b._y - a._z * b._z;
+        const float expectedX = a._w * b._x + a._x * b._w + a._y * b._z - a._z * b._y;
+        const float expectedY = a._w * b._y - a._x * b._z + a._y * b._w + a._z * b._x;
+        const float expectedZ = a._w * b._z + a._x * b._y - a._y * b._x + a._z * b._w;
+        MINT_ASSURE(mint::Math::equals(product._w, expectedW) && mint::Math::equals(product._x, expectedX));
+        MINT_ASSURE(mint::Math::equals(product._y, expectedY) && mint::Math::equals(product._z, expectedZ));
+        mint::Quaternion productAssign = a;
+        productAssign *= b;
+        MINT_ASSURE(productAssign._data == product._data);
+
+        // 회전 행렬과 axis-angle 행렬이 같아야 하고, rotateVector 와 행렬 곱의 결과도 같아야 한다.
+        const mint::Float4x4 rotationA = mint::Float4x4::rotationMatrix(a);
+        const mint::Float4x4 axisAngleA = mint::Float4x4::rotationMatrixAxisAngle(mint::Float3(1.0f, 2.0f, 3.0f), 0.9f);
+        for (uint32 i = 0; i < 16; ++i)
+        {
+            MINT_ASSURE(mint::Math::equals(rotationA._m[i / 4][i % 4], axisAngleA._m[i / 4][i % 4], 0.0001f));
+        }
+        const mint::Float4 vector{ 3.0f, -1.0f, 2.0f, 7.0f };
+        const mint::Float4 rotatedByQuaternion = a.rotateVector(vector);
+        const mint::Float4 rotatedByMatrix = rotationA * mint::Float4(vector._x, vector._y, vector._z, 0.0f);
+        const mint::Float3 rotated3 = a.rotateVector(mint::Float3(3.0f, -1.0f, 2.0f));
+        MINT_ASSURE(mint::Math::equals(rotatedByQuaternion._x, rotatedByMatrix._x, 0.0001f) && mint::Math::equals(rotatedByQuaternion._y, rotatedByMatrix._y, 0.0001f));
+        MINT_ASSURE(mint::Math::equals(rotatedByQuaternion._z, rotatedByMatrix._z, 0.0001f) && rotatedByQuaternion._w == 7.0f);
+        MINT_ASSURE(mint::Math::equals(rotated3._x, rotatedByMatrix._x, 0.0001f) && mint::Math::equals(rotated3._z, rotatedByMatrix._z, 0.0001f));
+
+        // Batch (SIMD 경로 + 나머지 scalar 경로) 결과가 하나씩 계산한 결과와 같아야 한다.
+        static constexpr uint32 kJointCount = 7;
+        mint::Quaternion rotations[kJointCount];
+        mint::Float3 scales[kJointCount];
+        mint::Float3 translations[kJointCount];
+        for (uint32 i = 0; i < kJointCount; ++i)
+        {
+            rotations[i] = mint::Quaternion::makeRotationQuaternion(mint::Float3(1.0f, static_cast<float>(i), -2.0f), 0.3f * i);
+            scales[i] = mint::Float3(1.0f + i, 2.0f, 0.5f * i);
+            translations[i] = mint::Float3(static_cast<float>(i), -1.0f, 3.0f);
+        }
+        mint::Float4x4 rotationMatrices[kJointCount];
+        mint::Float4x4 srtMatrices[kJointCount];
+        mint::Quaternion products[kJointCount];
+        mint::Float3 rotatedVectors[kJointCount];
+        mint::BatchTransform::rotationMatrices(rotations, rotationMatrices, kJointCount);
+        mint::BatchTransform::srtMatrices(scales, rotations, translations, srtMatrices, kJointCount);
+        mint::BatchTransform::multiplyQuaternions(rotations, rotations, products, kJointCount);
+        mint::BatchTransform::rotateVectors(a, translations, rotatedVectors, kJointCount);
+        for (uint32 i = 0; i < kJointCount; ++i)
+        {
+            const mint::Float4x4 expectedRotation = mint::Float4x4::rotationMatrix(rotations[i]);
+            const mint::Float4x4 expectedSrt = mint::Float4x4::srtMatrix(scales[i], rotations[i], translations[i]);
+            for (uint32 j = 0; j < 16; ++j)
+            {
+                MINT_ASSURE(mint::Math::equals(rotationMatrices[i]._m[j / 4][j % 4], expectedRotation._m[j / 4][j % 4], 0.0001f));
+                MINT_ASSURE(mint::Math::equals(srtMatrices[i]._m[j / 4][j % 4], expectedSrt._m[j / 4][j % 4], 0.0001f));
+            }
+            const mint::Quaternion expectedProduct = rotations[i] * rotations[i];
+            MINT_ASSURE(mint::Math::equals(products[i]._w, expectedProduct._w) && mint::Math::equals(products[i]._z, expectedProduct._z));
+            const mint::Float3 expectedRotated = a.rotateVector(translations[i]);
+            MINT_ASSURE(mint::Math::equals(rotatedVectors[i]._x, expectedRotated._x, 0.0001f) && mint::Math::equals(rotatedVectors[i]._y, expectedRotated._y, 0.0001f));
+        }
+
+        // 보간: 양 끝점, 짧은 경로, 그리고 근사 slerp 의 각도 오차
+        const mint::Quaternion negativeB = b * -1.0f;
+        MINT_ASSURE(mint::Math::equals(mint::Quaternion::dot(mint::Quaternion::slerp(a, b, 0.0f), a), 1.0f));
+        MINT_ASSURE(mint::Math::equals(fabsf(mint::Quaternion::dot(mint::Quaternion::slerp(a, b, 1.0f), b)), 1.0f));
+        MINT_ASSURE(mint::Math::equals(mint::Quaternion::dot(mint::Quaternion::nlerp(a, b, 0.5f), mint::Quaternion::nlerp(a, negativeB, 0.5f)), 1.0f));
+        float maxAngleError = 0.0f;
+        for (uint32 i = 0; i < 64; ++i)
+        {
+            const mint::Quaternion to = mint::Quaternion::makeRotationQuaternion(mint::Float3(0.5f, -1.0f, static_cast<float>(i)), 0.05f * i);
+            for (uint32 step = 0; step <= 16; ++step)
+            {
+                const float t = step / 16.0f;
+                const mint::Quaternion exact = mint::Quaternion::slerp(a, to, t);
+                const mint::Quaternion approximate = mint::Quaternion::slerpApproximate(a, to, t);
+                const float cosHalfError = mint::min(fabsf(mint::Quaternion::dot(exact, approximate)), 1.0f);
+                maxAngleError = mint::max(maxAngleError, 2.0f * acosf(cosHalfError));
+            }
+        }
+        MINT_ASSURE(maxAngleError < 0.002f);
+    }
+
+    {
+        // Transform3x4, DualQuaternion 은 같은 Float4x4 합성과 결과가 같아야 한다.
+        const mint::Quaternion parentRotation = mint::Quaternion::makeRotationQuaternion(mint::Float3(0.0f, 1.0f, 1.0f), 0.8f);
+        const mint::Quaternion childRotation = mint::Quaternion::makeRotationQuaternion(mint::Float3(1.0f, -1.0f, 0.5f), -1.9f);
+        const mint::Float3 parentTranslation(1.0f, 2.0f, -3.0f);
+        const mint::Float3 childTranslation(-0.5f, 4.0f, 0.25f);
+        const mint::Float3 parentScale(2.0f, 0.5f, 1.5f);
+        const mint::Float4x4 parentMatrix = mint::Float4x4::srtMatrix(parentScale, parentRotation, parentTranslation);
+        const mint::Float4x4 childMatrix = mint::Float4x4::srtMatrix(mint::Float3::kUnitScale, childRotation, childTranslation);
+        const mint::Float4x4 expectedMatrix = parentMatrix * childMatrix;
+
+        const mint::Transform3x4 parentTransform = mint::Transform3x4::srt(parentScale, parentRotation, parentTranslation);
+        const mint::Transform3x4 childTransform = mint::Transform3x4::fromMatrix(childMatrix);
+        const mint::Float4x4 composedMatrix = (parentTransform * childTransform).toMatrix();
+        for (uint32 i = 0; i < 16; ++i)
+        {
+            MINT_ASSURE(mint::Math::equals(composedMatrix._m[i / 4][i % 4], expectedMatrix._m[i / 4][i % 4], 0.0001f));
+        }
+        const mint::Float3 point(3.0f, -2.0f, 1.0f);
+        const mint::Float4 expectedPoint = expectedMatrix * mint::Float4(point._x, point._y, point._z, 1.0f);
+        const mint::Float3 transformedPoint = (parentTransform * childTransform).transformPoint(point);
+        MINT_ASSURE(mint::Math::equals(transformedPoint._x, expectedPoint._x, 0.0001f) && mint::Math::equals(transformedPoint._z, expectedPoint._z, 0.0001f));
+        const mint::Float3 roundTripPoint = parentTransform.inverse().transformPoint(parentTransform.transformPoint(point));
+        MINT_ASSURE(mint::Math::equals(roundTripPoint._x, point._x, 0.0001f) && mint::Math::equals(roundTripPoint._y, point._y, 0.0001f) && mint::Math::equals(roundTripPoint._z, point._z, 0.0001f));
+        MINT_ASSURE(mint::Transform3x4::kIdentity * parentTransform == parentTransform);
+
+        const mint::DualQuaternion parentDualQuaternion = mint::DualQuaternion::fromTransform(parentRotation, parentTranslation);
+        const mint::DualQuaternion childDualQuaternion = mint::DualQuaternion::fromTransform(childRotation, childTranslation);
+        const mint::DualQuaternion composedDualQuaternion = parentDualQuaternion * childDualQuaternion;
+        const mint::Float4x4 expectedRigidMatrix = mint::Float4x4::srtMatrix(mint::Float3::kUnitScale, parentRotation, parentTranslation) * childMatrix;
+        const mint::Float4x4 dualQuaternionMatrix = composedDualQuaternion.toMatrix();
+        const mint::Float4x4 dualQuaternionTransform = composedDualQuaternion.toTransform3x4().toMatrix();
+        for (uint32 i = 0; i < 16; ++i)
+        {
+            MINT_ASSURE(mint::Math::equals(dualQuaternionMatrix._m[i / 4][i % 4], expectedRigidMatrix._m[i / 4][i % 4], 0.0001f));
+            MINT_ASSURE(mint::Math::equals(dualQuaternionTransform._m[i / 4][i % 4], expectedRigidMatrix._m[i / 4][i % 4], 0.0001f));
+        }
+        const mint::Float3 translation = parentDualQuaternion.getTranslation();
+        MINT_ASSURE(mint::Math::equals(translation._x, parentTranslation._x, 0.0001f) && mint::Math::equals(translation._z, parentTranslation._z, 0.0001f));
+        const mint::Float3 dualQuaternionPoint = composedDualQuaternion.inverse().transformPoint(composedDualQuaternion.transformPoint(point));
+        MINT_ASSURE(mint::Math::equals(dualQuaternionPoint._x, point._x, 0.0001f) && mint::Math::equals(dualQuaternionPoint._y, point._y, 0.0001f) && mint::Math::equals(dualQuaternionPoint._z, point._z, 0.0001f));
+        const mint::Float3 blendedTranslation = mint::DualQuaternion::nlerp(parentDualQuaternion, childDualQuaternion, 1.0f).getTranslation();
+        MINT_ASSURE(mint::Math::equals(blendedTranslation._y, childTranslation._y, 0.0001f));
+    }
+
+    {
+        // Fast 근사 함수의 최대 오차가 FastMath.h 에 적은 값 이내여야 한다.
+        float maxSinCosError = 0.0f;
+        float maxAtan2Error = 0.0f;
+        float maxRsqrtRelativeError = 0.0f;
+        float maxExpRelativeError = 0.0f;
+        float maxLogRelativeError = 0.0f;
+        for (int32 i = -20000; i <= 20000; ++i)
+        {
+            const float angle = i * 0.4096f;
+            float fastSin = 0.0f;
+            float fastCos = 0.0f;
+            mint::Math::sinCos<mint::Math::Precision::Fast>(angle, fastSin, fastCos);
+            maxSinCosError = mint::max(maxSinCosError, mint::max(fabsf(fastSin - static_cast<float>(sin(static_cast<double>(angle)))), fabsf(fastCos - static_cast<float>(cos(static_cast<double>(angle))))));
+
+            const float y = (i % 200) * 0.37f;
+            const float x = (i / 200) * 0.53f;
+            maxAtan2Error = mint::max(maxAtan2Error, fabsf(mint::Math::atan2<mint::Math::Precision::Fast>(y, x) - static_cast<float>(::atan2(static_cast<double>(y), static_cast<double>(x)))));
+
+            const float positive = (i + 20001) * 0.0137f;
+            const double exactRsqrt = 1.0 / ::sqrt(static_cast<double>(positive));
+            maxRsqrtRelativeError = mint::max(maxRsqrtRelativeError, static_cast<float>(fabs(mint::Math::rsqrt<mint::Math::Precision::Fast>(positive) - exactRsqrt) / exactRsqrt));
+            const double exactLog = ::log(static_cast<double>(positive));
+            maxLogRelativeError = mint::max(maxLogRelativeError, static_cast<float>(fabs(mint::Math::log<mint::Math::Precision::Fast>(positive) - exactLog) / mint::max(fabs(exactLog), 1.0)));
+
+            const float exponent = i * 0.0043f;
+            const double exactExp = ::exp(static_cast<double>(exponent));
+            maxExpRelativeError = mint::max(maxExpRelativeError, static_cast<float>(fabs(mint::Math::exp<mint::Math::Precision::Fast>(exponent) - exactExp) / exactExp));
+        }
+        MINT_ASSURE(maxSinCosError < 2e-7f);
+        MINT_ASSURE(maxAtan2Error < 3e-6f);
+#if defined MINT_MATH_USE_SIMD
+        MINT_ASSURE(maxRsqrtRelativeError < 3e-7f);
+#else
+        MINT_ASSURE(maxRsqrtRelativeError < 5e-6f);
+#endif
+        MINT_ASSURE(maxExpRelativeError < 2e-7f);
+        MINT_ASSURE(maxLogRelativeError < 2e-7f);
+        MINT_ASSURE(mint::Math::atan2<mint::Math::Precision::Fast>(0.0f, 0.0f) == 0.0f);
+        MINT_ASSURE(mint::Math::equals(mint::Math::atan2<mint::Math::Precision::Fast>(-1.0f, -1.0f), -mint::Math::kPi * 0.75f, 0.0001f));
+
+#if defined MINT_MATH_USE_SIMD
+        // SIMD 버전은 scalar Fast 버전과 같은 근사이다.
+        const __m128 angles = _mm_set_ps(-100.0f, 2.5f, -0.3f, 7.0f);
+        __m128 sins;
+        __m128 coses;
+        mint::Simd::sinCos(angles, sins, coses);
+        alignas(16) float simdSin[4];
+        alignas(16) float simdCos[4];
+        alignas(16) float simdAtan2[4];
+        alignas(16) float simdExp[4];
+        alignas(16) float simdLog[4];
+        alignas(16) const float inputs[4] = { 7.0f, -0.3f, 2.5f, -100.0f };
+        _mm_store_ps(simdSin, sins);
+        _mm_store_ps(simdCos, coses);
+        _mm_store_ps(simdAtan2, mint::Simd::atan2(angles, _mm_set_ps(-1.0f, 0.0f, -2.0f, 3.0f)));
+        _mm_store_ps(simdExp, mint::Simd::exp(angles));
+        _mm_store_ps(simdLog, mint::Simd::log(_mm_andnot_ps(_mm_set1_ps(-0.0f), angles)));
+        const float atan2Xs[4] = { 3.0f, -2.0f, 0.0f, -1.0f };
+        for (uint32 i = 0; i < 4; ++i)
+        {
+            float fastSin = 0.0f;
+            float fastCos = 0.0f;
+            mint::Math::sinCos<mint::Math::Precision::Fast>(inputs[i], fastSin, fastCos);
+            MINT_ASSURE(mint::Math::equals(simdSin[i], fastSin, 1e-6f) && mint::Math::equals(simdCos[i], fastCos, 1e-6f));
+            MINT_ASSURE(mint::Math::equals(simdAtan2[i], mint::Math::atan2<mint::Math::Precision::Fast>(inputs[i], atan2Xs[i]), 1e-6f));
+            MINT_ASSURE(mint::Math::equals(simdExp[i], mint::Math::exp<mint::Math::Precision::Fast>(inputs[i]), 1e-6f));
+            MINT_ASSURE(mint::Math::equals(simdLog[i], mint::Math::log<mint::Math::Precision::Fast>(fabsf(inputs[i])), 1e-6f));
+        }
+#endif
+    }
+
+    {
+        // Plane, AABB, BoundingSphere
+        const mint::Plane plane = mint::Plane::fromPoints(mint::Float3(0.0f, 2.0f, 0.0f), mint::Float3(0.0f, 2.0f, 1.0f), mint::Float3(1.0f, 2.0f, 0.0f));
+        MINT_ASSURE(mint::Math::equals(plane.signedDistance(mint::Float3(5.0f, 5.0f, -3.0f)), 3.0f));
+        MINT_ASSURE(mint::Math::equals(plane.signedDistance(mint::Float3(0.0f, 0.0f, 0.0f)), -2.0f));
+
+        const mint::Float3 points[4] = { mint::Float3(1.0f, 2.0f, 3.0f), mint::Float3(-1.0f, 0.0f, 5.0f), mint::Float3(0.0f, 4.0f, 4.0f), mint::Float3(2.0f, 1.0f, 3.5f) };
+        const mint::AABB aabb = mint::AABB::fromPoints(points, 4);
+        MINT_ASSURE(aabb._min == mint::Float3(-1.0f, 0.0f, 3.0f) && aabb._max == mint::Float3(2.0f, 4.0f, 5.0f));
+        MINT_ASSURE(aabb.contains(mint::Float3(0.0f, 1.0f, 4.0f)) == true && aabb.contains(mint::Float3(0.0f, 1.0f, 6.0f)) == false);
+        MINT_ASSURE(aabb.intersects(mint::AABB(mint::Float3(1.5f, 3.5f, 4.5f), mint::Float3(9.0f))) == true);
+        MINT_ASSURE(aabb.intersects(mint::AABB(mint::Float3(2.5f, 0.0f, 0.0f), mint::Float3(9.0f))) == false);
+        MINT_ASSURE(mint::AABB().isValid() == false);
+        const mint::AABB rotated = aabb.transform(mint::Float4x4::rotationMatrixY(mint::Math::kPiOverTwo));
+        MINT_ASSURE(mint::Math::equals(rotated._min._x, 3.0f, 0.0001f) && mint::Math::equals(rotated._max._x, 5.0f, 0.0001f));
+        MINT_ASSURE(mint::Math::equals(rotated._min._z, -2.0f, 0.0001f) && mint::Math::equals(rotated._max._z, 1.0f, 0.0001f));
+
+        const mint::BoundingSphere sphere = mint::BoundingSphere::fromPoints(points, 4);
+        for (uint32 i = 0; i < 4; ++i)
+        {
+            MINT_ASSURE(sphere.contains(points[i]) == true);
+        }
+        MINT_ASSURE(sphere.intersects(mint::AABB(mint::Float3(-9.0f), mint::Float3(-1.5f, 2.0f, 4.0f))) == true);
+        MINT_ASSURE(sphere.intersects(mint::BoundingSphere(mint::Float3(10.0f, 2.0f, 4.0f), 1.0f)) == false);
+
+        // Frustum: 원점에서 +z 를 보는 90 도 카메라
+        const mint::Float4x4 projection = mint::Float4x4::projectionMatrixPerspective(mint::Math::kPiOverTwo, 1.0f, 100.0f, 1.0f);
+        const mint::Float4x4 view = mint::Float4x4::translationMatrix(0.0f, 0.0f, -10.0f);
+        const mint::Frustum frustum = mint::Frustum::fromViewProjectionMatrix(projection * view);
+        MINT_ASSURE(frustum.contains(mint::Float3(0.0f, 0.0f, 20.0f)) == true);
+        MINT_ASSURE(frustum.contains(mint::Float3(0.0f, 0.0f, 10.5f)) == false);
+        MINT_ASSURE(frustum.contains(mint::Float3(0.0f, 0.0f, 111.0f)) == false);
+        MINT_ASSURE(frustum.contains(mint::Float3(9.0f, -9.0f, 20.0f)) == true);
+        MINT_ASSURE(frustum.contains(mint::Float3(11.0f, 0.0f, 20.0f)) == false);
+        MINT_ASSURE(mint::Math::equals(frustum.getPlane(mint::Frustum::PlaneIndex::Near).signedDistance(mint::Float3(0.0f, 0.0f, 13.0f)), 2.0f, 0.0001f));
+        MINT_ASSURE(frustum.intersects(mint::BoundingSphere(mint::Float3(0.0f, 0.0f, 9.0f), 2.0f)) == true);
+        MINT_ASSURE(frustum.intersects(mint::BoundingSphere(mint::Float3(0.0f, 30.0f, 20.0f), 2.0f)) == false);
+
+        static constexpr uint32 kBoxCount = 103;
+        mint::AABB boxes[kBoxCount];
+        bool isVisible[kBoxCount];
+        uint32 expectedVisibleCount = 0;
+        for (uint32 i = 0; i < kBoxCount; ++i)
+        {
+            const mint::Float3 center(static_cast<float>(i % 7) * 7.0f - 21.0f, static_cast<float>(i % 5) * 6.0f - 12.0f, static_cast<float>(i) * 1.2f);
+            boxes[i] = mint::AABB::fromCenterExtents(center, mint::Float3(1.0f + (i % 3)));
+            expectedVisibleCount += (frustum.intersects(boxes[i]) == true) ? 1 : 0;
+        }
+        MINT_ASSURE(frustum.cullAABBs(boxes, kBoxCount, isVisible) == expectedVisibleCount);
+        MINT_ASSURE(0 < expectedVisibleCount && expectedVisibleCount < kBoxCount);
+        for (uint32 i = 0; i < kBoxCount; ++i)
+        {
+            MINT_ASSURE(isVisible[i] == frustum.intersects(boxes[i]));
+        }
+
+        // Ray
+        const mint::Ray ray(mint::Float3(0.0f, 0.0f, -5.0f), mint::Float3(0.0f, 0.0f, 1.0f));
+        float distance = 0.0f;
+        MINT_ASSURE(ray.intersects(mint::Plane::fromPointNormal(mint::Float3(0.0f, 0.0f, 3.0f), mint::Float3(0.0f, 0.0f, -1.0f)), distance) == true && mint::Math::equals(distance, 8.0f));
+        MINT_ASSURE(ray.intersects(plane, distance) == false);
+        MINT_ASSURE(ray.intersects(mint::AABB(mint::Float3(-1.0f), mint::Float3(1.0f)), distance) == true && mint::Math::equals(distance, 4.0f));
+        MINT_ASSURE(ray.intersects(mint::AABB(mint::Float3(2.0f), mint::Float3(3.0f)), distance) == false);
+        MINT_ASSURE(ray.intersects(mint::BoundingSphere(mint::Float3(0.0f, 1.0f, 0.0f), 2.0f), distance) == true && mint::Math::equals(distance, 5.0f - ::sqrt(3.0f), 0.0001f));
+        MINT_ASSURE(ray.intersects(mint::BoundingSphere(mint::Float3(0.0f, 0.0f, -9.0f), 1.0f), distance) == false);
+
+        // 여러 triangle 중 가장 가까운 것을 SIMD 경로와 scalar 경로가 똑같이 찾아야 한다.
+        static constexpr uint32 kTriangleCount = 37;
+        mint::Float3 triangleVertices[kTriangleCount * 3];
+        for (uint32 i = 0; i < kTriangleCount; ++i)
+        {
+            const float z = 30.0f - static_cast<float>((i * 7) % kTriangleCount);
+            const float offset = static_cast<float>(i % 4) * 0.5f;
+            triangleVertices[i * 3 + 0] = mint::Float3(-2.0f + offset, -1.0f, z);
+            triangleVertices[i * 3 + 1] = mint::Float3(2.0f + offset, -1.0f, z + 0.5f);
+            triangleVertices[i * 3 + 2] = mint::Float3(offset, 2.0f, z);
+        }
+        for (uint32 rayIndex = 0; rayIndex < 16; ++rayIndex)
+        {
+            const mint::Ray pickingRay(mint::Float3(static_cast<float>(rayIndex % 4) * 0.6f - 0.5f, static_cast<float>(rayIndex / 4) * 0.5f - 0.5f, -1.0f), mint::Float3::normalize(mint::Float3(0.01f * rayIndex, 0.0f, 1.0f)));
+            uint32 expectedIndex = kUint32Max;
+            float expectedDistance = mint::Math::kFloatMax;
+            for (uint32 i = 0; i < kTriangleCount; ++i)
+            {
+                if (pickingRay.intersectsTriangle(triangleVertices[i * 3], triangleVertices[i * 3 + 1], triangleVertices[i * 3 + 2], distance) == true && distance < expectedDistance)
+                {
+                    expectedDistance = distance;
+                    expectedIndex = i;
+                }
+            }
+
+            uint32 triangleIndex = kUint32Max;
+            const bool isHit = pickingRay.intersectsTriangles(triangleVertices, kTriangleCount, triangleIndex, distance);
+            MINT_ASSURE(isHit == (expectedIndex != kUint32Max));
+            if (isHit == true)
+            {
+                MINT_ASSURE(triangleIndex == expectedIndex && mint::Math::equals(distance, expectedDistance, 0.0001f));
+            }
+        }
+    }
+
+    {
+        static constexpr uint32 kRectCount = 23;
+        mint::Rect rects[kRectCount];
+        for (uint32 i = 0; i < kRectCount; ++i)
+        {
+            const float left = static_cast<float>((i * 37) % 100);
+            const float top = static_cast<float>((i * 53) % 80);
+            rects[i] = mint::Rect::fromPositionSize(mint::Float2(left, top), mint::Float2(10.0f + (i % 5) * 15.0f, 8.0f + (i % 3) * 20.0f));
+        }
+        rects[7].setNan();
+
+        mint::RectSoA rectSoA;
+        rectSoA.assignFromAoS(rects, kRectCount);
+        MINT_ASSURE(rectSoA.size() == kRectCount && rectSoA.get(3) == rects[3]);
+
+        bool containsArray[kRectCount];
+        const mint::Float2 positions[3] = { mint::Float2(40.0f, 30.0f), mint::Float2(5.0f, 5.0f), mint::Float2(-1.0f, 0.0f) };
+        for (const mint::Float2& position : positions)
+        {
+            uint32 expectedCount = 0;
+            uint32 expectedLastIndex = kUint32Max;
+            for (uint32 i = 0; i < kRectCount; ++i)
+            {
+                if (rects[i].contains(position) == true)
+                {
+                    ++expectedCount;
+                    expectedLastIndex = i;
+                }
+            }
+            MINT_ASSURE(rectSoA.contains(position, containsArray) == expectedCount);
+            for (uint32 i = 0; i < kRectCount; ++i)
+            {
+                MINT_ASSURE(containsArray[i] == rects[i].contains(position));
+            }
+            MINT_ASSURE(rectSoA.findLastContaining(position) == expectedLastIndex);
+        }
+
+        mint::Rect expectedBoundingRect(rects[0]);
+        for (uint32 i = 1; i < kRectCount; ++i)
+        {
+            if (rects[i].isNan() == false)
+            {
+                expectedBoundingRect = mint::Rect(mint::min(expectedBoundingRect.left(), rects[i].left()), mint::max(expectedBoundingRect.right(), rects[i].right())
+                    , mint::min(expectedBoundingRect.top(), rects[i].top()), mint::max(expectedBoundingRect.bottom(), rects[i].bottom()));
+            }
+        }
+        mint::Rect boundingRect;
+        MINT_ASSURE(rectSoA.computeBoundingRect(boundingRect) == true && boundingRect == expectedBoundingRect);
+        MINT_ASSURE(mint::RectSoA().computeBoundingRect(boundingRect) == false);
+
+        const mint::Rect clipRect(20.0f, 70.0f, 10.0f, 50.0f);
+        rectSoA.clipBy(clipRect);
+        for (uint32 i = 0; i < kRectCount; ++i)
+        {
+            if (i == 7)
+            {
+                continue;
+            }
+            mint::Rect expectedRect = rects[i];
+            expectedRect.clipBy(clipRect);
+            MINT_ASSURE(rectSoA.get(i) == expectedRect);
+        }
+    }
+
+    {
+        MINT_ASSURE(mint::Half(1.0f)._bits == 0x3C00 && mint::Half(-2.0f)._bits == 0xC000 && mint::Half(0.0f)._bits == 0x0000);
+        MINT_ASSURE(mint::Half(65504.0f)._bits == 0x7BFF && mint::Half(65520.0f)._bits == 0x7C00 && mint::Half(0.1f)._bits == 0x2E66);
+        MINT_ASSURE(mint::Half(5.9604645e-8f)._bits == 0x0001 && mint::Half(1e-9f)._bits == 0x0000 && mint::Half(mint::Math::nan()).isNan() == true);
+        // 모든 half 값은 float 을 거쳐도 그대로여야 한다.
+        for (uint32 bits = 0; bits <= kUint16Max; ++bits)
+        {
+            const mint::Half half = mint::Half::fromBits(static_cast<uint16>(bits));
+            if (half.isNan() == true)
+            {
+                MINT_ASSURE(mint::Half(half.toFloat()).isNan() == true);
+            }
+            else
+            {
+                MINT_ASSURE(mint::Half(half.toFloat()) == half);
+            }
+        }
+
+        static constexpr uint32 kValueCount = 39;
+        float values[kValueCount];
+        for (uint32 i = 0; i < kValueCount; ++i)
+        {
+            values[i] = ((i % 2 == 0) ? 1.0f : -1.0f) * ::powf(2.0f, static_cast<float>(i) - 26.0f) * (1.0f + static_cast<float>(i) * 0.013f);
+        }
+        values[5] = 65520.0f;
+        values[6] = 65519.0f;
+        values[7] = mint::Math::kFloatMax;
+        mint::Half halves[kValueCount];
+        float unpackedValues[kValueCount];
+        mint::VertexPacking::packHalves(values, halves, kValueCount);
+        mint::VertexPacking::unpackHalves(halves, unpackedValues, kValueCount);
+        for (uint32 i = 0; i < kValueCount; ++i)
+        {
+            MINT_ASSURE(halves[i] == mint::Half(values[i]));
+            MINT_ASSURE(unpackedValues[i] == halves[i].toFloat());
+        }
+        MINT_ASSURE(mint::Half4(mint::Float4(1.0f, -0.5f, 3.0f, 1024.0f)).toFloat4() == mint::Float4(1.0f, -0.5f, 3.0f, 1024.0f));
+
+        MINT_ASSURE(mint::UNorm8x4(mint::Float4(1.0f, 0.5f, 0.0f, 2.0f))._packed == 0xFF0080FF);
+        const mint::UNorm8x4 color(mint::Float4(0.2f, 0.4f, 0.6f, 0.8f));
+        MINT_ASSURE(color._packed == 0xCC996633);
+        MINT_ASSURE(mint::Math::equals(color.toFloat4()._x, 0.2f, 1e-6f) && mint::Math::equals(color.toFloat4()._w, 0.8f, 1e-6f));
+        MINT_ASSURE(mint::SNorm16x2(mint::Float2(-2.0f, 0.5f))._x == -32767 && mint::SNorm16x2(mint::Float2(-2.0f, 0.5f))._y == 16384);
+        mint::SNorm16x2 minimum;
+        minimum._x = kInt16Min;
+        MINT_ASSURE(minimum.toFloat2() == mint::Float2(-1.0f, 0.0f));
+
+        static constexpr uint32 kColorCount = 11;
+        mint::Float4 colors[kColorCount];
+        mint::UNorm8x4 packedColors[kColorCount];
+        mint::Float4 unpackedColors[kColorCount];
+        for (uint32 i = 0; i < kColorCount; ++i)
+        {
+            colors[i] = mint::Float4(static_cast<float>(i) * 0.1f - 0.05f, static_cast<float>(i) / 255.0f * 0.5f, 1.0f - static_cast<float>(i) * 0.07f, 0.5f);
+        }
+        mint::VertexPacking::packUNorm8x4(colors, packedColors, kColorCount);
+        mint::VertexPacking::unpackUNorm8x4(packedColors, unpackedColors, kColorCount);
+        for (uint32 i = 0; i < kColorCount; ++i)
+        {
+            MINT_ASSURE(packedColors[i]._packed == mint::UNorm8x4(colors[i])._packed);
+            MINT_ASSURE(unpackedColors[i] == packedColors[i].toFloat4());
+        }
+
+        // Octahedral normal: 구 위에 고르게 퍼진 normal 로 오차와 SIMD / scalar 일치를 확인한다.
+        static constexpr uint32 kNormalCount = 1001;
+        std::vector<mint::Float3> normals(kNormalCount);
+        for (uint32 i = 0; i < kNormalCount; ++i)
+        {
+            const float z = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / kNormalCount;
+            const float radius = ::sqrtf(1.0f - z * z);
+            const float angle = static_cast<float>(i) * 2.39996323f;
+            normals[i] = mint::Float3(radius * ::cosf(angle), radius * ::sinf(angle), z);
+        }
+        normals[0] = mint::Float3(0.0f, 0.0f, -1.0f);
+        normals[1] = mint::Float3(-1.0f, 0.0f, 0.0f);
+        std::vector<mint::SNorm16x2> packedNormals(kNormalCount);
+        std::vector<mint::Float3> unpackedNormals(kNormalCount);
+        mint::VertexPacking::packNormals(normals.data(), packedNormals.data(), kNormalCount);
+        mint::VertexPacking::unpackNormals(packedNormals.data(), unpackedNormals.data(), kNormalCount);
+        for (uint32 i = 0; i < kNormalCount; ++i)
+        {
+            const mint::SNorm16x2 packedNormal = mint::VertexPacking::packNormal(normals[i]);
+            MINT_ASSURE(::abs(packedNormals[i]._x - packedNormal._x) <= 1 && ::abs(packedNormals[i]._y - packedNormal._y) <= 1);
+            const mint::Float3 unpackedNormal = mint::VertexPacking::unpackNormal(packedNormals[i]);
+            MINT_ASSURE(mint::Math::equals(unpackedNormals[i]._x, unpackedNormal._x, 1e-6f) && mint::Math::equals(unpackedNormals[i]._y, unpackedNormal._y, 1e-6f) && mint::Math::equals(unpackedNormals[i]._z, unpackedNormal._z, 1e-6f));
+            const float angleError = mint::Float3::cross(normals[i], unpackedNormal).length();
+            MINT_ASSURE(angleError < 1e-4f);
+        }
+    }
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kVertexCount = 1'000'000;
+        const mint::Float4x4 srt = mint::Float4x4::srtMatrix(mint::Float3(2.0f), mint::Quaternion::makeRotationQuaternion(mint::Float3(0.0f, 1.0f, 0.0f), 0.01f), mint::Float3(0.001f));
+        std::vector<mint::Float4> positions(kVertexCount, mint::Float4(1.0f, 2.0f, 3.0f, 1.0f));
+        std::vector<mint::Float3> positions3(kVertexCount, mint::Float3(1.0f, 2.0f, 3.0f));
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Transform 1M Float4 one by one" };
+            for (uint32 i = 0; i < kVertexCount; ++i)
+            {
+                positions[i] = srt * positions[i];
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Transform 1M Float4 batch" };
+            mint::BatchTransform::transformPoints(srt, positions.data(), positions.data(), kVertexCount);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Transform 1M Float4 batch parallel" };
+            mint::BatchTransform::transformPoints(srt, positions.data(), positions.data(), kVertexCount, true);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) Transform 1M Float3 batch parallel" };
+            mint::BatchTransform::transformPoints(srt, positions3.data(), positions3.data(), kVertexCount, true);
+        }
+
+        static constexpr uint32 kObjectCount = 100'000;
+        std::vector<mint::Float4x4> locals(kObjectCount, srt);
+        std::vector<mint::Float4x4> worlds(kObjectCount);
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "5) Update 100K world matrices one by one" };
+            for (uint32 i = 0; i < kObjectCount; ++i)
+            {
+                worlds[i] = srt * locals[i];
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "6) Update 100K world matrices batch parallel" };
+            mint::BatchTransform::multiplyMatrices(srt, locals.data(), worlds.data(), kObjectCount, true);
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f %f\n", positions[0]._x, positions3[0]._x, worlds[0]._11);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kCount = 5'000'000;
+        const mint::Float4x4 rotation = mint::Float4x4::rotationMatrixRollPitchYaw(0.1f, 0.2f, 0.3f);
+        mint::Float4x4 scalarResult = rotation;
+        mint::Float4x4 simdResult = rotation;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Float4x4 mul scalar" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                const mint::Float4x4 copy = scalarResult;
+                for (uint32 rowIndex = 0; rowIndex < 4; ++rowIndex)
+                {
+                    for (uint32 columnIndex = 0; columnIndex < 4; ++columnIndex)
+                    {
+                        scalarResult._m[rowIndex][columnIndex] = mint::Float4::dotProductRaw(copy._row[rowIndex]._f, rotation._m[0][columnIndex], rotation._m[1][columnIndex], rotation._m[2][columnIndex], rotation._m[3][columnIndex]);
+                    }
+                }
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Float4x4 mul SIMD" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                simdResult = simdResult * rotation;
+            }
+        }
+
+        float scalarSum = 0.0f;
+        float simdSum = 0.0f;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Float4x4 inverse scalar (adjugate)" };
+            for (uint32 i = 0; i < kCount / 10; ++i)
+            {
+                scalarSum += (rotation.adjugate() / (rotation._11 * rotation.minor(0, 0).determinant() - rotation._12 * rotation.minor(0, 1).determinant() + rotation._13 * rotation.minor(0, 2).determinant() - rotation._14 * rotation.minor(0, 3).determinant()))._11;
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Float4x4 inverse SIMD" };
+            for (uint32 i = 0; i < kCount / 10; ++i)
+            {
+                simdSum += rotation.inverse()._11;
+            }
+        }
+
+        mint::Float4 scalarVector{ 1.0f, 2.0f, 3.0f, 1.0f };
+        mint::Float4 simdVector = scalarVector;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Float4x4 * Float4 scalar" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                const mint::Float4 copy = scalarVector;
+                scalarVector.set(mint::Float4::dotProductRaw(rotation._row[0]._f, copy._f), mint::Float4::dotProductRaw(rotation._row[1]._f, copy._f), mint::Float4::dotProductRaw(rotation._row[2]._f, copy._f), mint::Float4::dotProductRaw(rotation._row[3]._f, copy._f));
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Float4x4 * Float4 SIMD" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                simdVector = rotation * simdVector;
+            }
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f %f %f %f %f\n", scalarResult._11, simdResult._11, scalarSum, simdSum, scalarVector._x, simdVector._x);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        // Skeletal animation 한 프레임 분량: joint 의 local pose 보간 + 행렬 변환
+        static constexpr uint32 kJointCount = 100'000;
+        std::vector<mint::Quaternion> fromRotations(kJointCount, mint::Quaternion::makeRotationQuaternion(mint::Float3(1.0f, 0.0f, 0.0f), 0.2f));
+        std::vector<mint::Quaternion> toRotations(kJointCount, mint::Quaternion::makeRotationQuaternion(mint::Float3(0.0f, 1.0f, 1.0f), 1.7f));
+        std::vector<mint::Quaternion> rotations(kJointCount);
+        std::vector<mint::Float3> scales(kJointCount, mint::Float3(1.0f));
+        std::vector<mint::Float3> translations(kJointCount, mint::Float3(0.0f, 1.0f, 0.0f));
+        std::vector<mint::Float4x4> matrices(kJointCount);
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Quaternion slerp 100K" };
+            for (uint32 i = 0; i < kJointCount; ++i)
+            {
+                rotations[i] = mint::Quaternion::slerp(fromRotations[i], toRotations[i], 0.37f);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Quaternion slerpApproximate 100K" };
+            for (uint32 i = 0; i < kJointCount; ++i)
+            {
+                rotations[i] = mint::Quaternion::slerpApproximate(fromRotations[i], toRotations[i], 0.37f);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Quaternion nlerp 100K" };
+            for (uint32 i = 0; i < kJointCount; ++i)
+            {
+                rotations[i] = mint::Quaternion::nlerp(fromRotations[i], toRotations[i], 0.37f);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) Quaternion to SRT matrix 100K one by one" };
+            for (uint32 i = 0; i < kJointCount; ++i)
+            {
+                matrices[i] = mint::Float4x4::srtMatrix(scales[i], rotations[i], translations[i]);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "5) Quaternion to SRT matrix 100K batch" };
+            mint::BatchTransform::srtMatrices(scales.data(), rotations.data(), translations.data(), matrices.data(), kJointCount);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "6) Quaternion to SRT matrix 100K batch parallel" };
+            mint::BatchTransform::srtMatrices(scales.data(), rotations.data(), translations.data(), matrices.data(), kJointCount, true);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "7) Quaternion multiply 100K batch" };
+            mint::BatchTransform::multiplyQuaternions(fromRotations.data(), rotations.data(), rotations.data(), kJointCount);
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f\n", rotations[0]._w, matrices[0]._11);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        // 100K 개의 parent-child 합성
+        static constexpr uint32 kNodeCount = 100'000;
+        const mint::Quaternion rotation = mint::Quaternion::makeRotationQuaternion(mint::Float3(0.0f, 1.0f, 0.0f), 0.01f);
+        const mint::Float3 translation(0.0f, 0.001f, 0.0f);
+        std::vector<mint::Float4x4> matrices(kNodeCount, mint::Float4x4::srtMatrix(mint::Float3::kUnitScale, rotation, translation));
+        std::vector<mint::Transform3x4> transforms(kNodeCount, mint::Transform3x4::srt(mint::Float3::kUnitScale, rotation, translation));
+        std::vector<mint::DualQuaternion> dualQuaternions(kNodeCount, mint::DualQuaternion::fromTransform(rotation, translation));
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Compose 100K Float4x4" };
+            for (uint32 i = 1; i < kNodeCount; ++i)
+            {
+                matrices[i] = matrices[i - 1] * matrices[i];
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Compose 100K Transform3x4" };
+            for (uint32 i = 1; i < kNodeCount; ++i)
+            {
+                transforms[i] = transforms[i - 1] * transforms[i];
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Compose 100K DualQuaternion" };
+            for (uint32 i = 1; i < kNodeCount; ++i)
+            {
+                dualQuaternions[i] = dualQuaternions[i - 1] * dualQuaternions[i];
+            }
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f %f\n", matrices[kNodeCount - 1]._24, transforms[kNodeCount - 1]._m[1][3], dualQuaternions[kNodeCount - 1].getTranslation()._y);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kCount = 10'000'000;
+        float exactSum = 0.0f;
+        float fastSum = 0.0f;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) sinCos Exact" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                float s;
+                float c;
+                mint::Math::sinCos(i * 0.001f, s, c);
+                exactSum += s + c;
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) sinCos Fast" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                float s;
+                float c;
+                mint::Math::sinCos<mint::Math::Precision::Fast>(i * 0.001f, s, c);
+                fastSum += s + c;
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) atan2 Exact" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                exactSum += mint::Math::atan2(i * 0.001f, 500.0f - i * 0.0003f);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) atan2 Fast" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                fastSum += mint::Math::atan2<mint::Math::Precision::Fast>(i * 0.001f, 500.0f - i * 0.0003f);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) rsqrt Exact" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                exactSum += mint::Math::rsqrt(1.0f + i);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) rsqrt Fast" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                fastSum += mint::Math::rsqrt<mint::Math::Precision::Fast>(1.0f + i);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) exp + log Exact" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                exactSum += mint::Math::exp(i * 0.000001f) + mint::Math::log(1.0f + i);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) exp + log Fast" };
+            for (uint32 i = 0; i < kCount; ++i)
+            {
+                fastSum += mint::Math::exp<mint::Math::Precision::Fast>(i * 0.000001f) + mint::Math::log<mint::Math::Precision::Fast>(1.0f + i);
+            }
+        }
+#if defined MINT_MATH_USE_SIMD
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "5) sinCos Fast SIMD" };
+            __m128 sum = _mm_setzero_ps();
+            for (uint32 i = 0; i < kCount; i += 4)
+            {
+                __m128 s;
+                __m128 c;
+                mint::Simd::sinCos(_mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(i), _mm_set_epi32(3, 2, 1, 0))), _mm_set1_ps(0.001f)), s, c);
+                sum = _mm_add_ps(sum, _mm_add_ps(s, c));
+            }
+            fastSum += _mm_cvtss_f32(sum);
+        }
+#endif
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f\n", exactSum, fastSum);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kBoxCount = 1'000'000;
+        const mint::Frustum frustum = mint::Frustum::fromViewProjectionMatrix(mint::Float4x4::projectionMatrixPerspective(mint::Math::kPiOverTwo, 1.0f, 1000.0f, 1.0f));
+        std::vector<mint::AABB> boxes(kBoxCount);
+        for (uint32 i = 0; i < kBoxCount; ++i)
+        {
+            boxes[i] = mint::AABB::fromCenterExtents(mint::Float3(static_cast<float>(i % 1000) - 500.0f, 0.0f, static_cast<float>(i / 1000)), mint::Float3(1.0f));
+        }
+        std::vector<uint8> isVisibleScalar(kBoxCount);
+        bool* isVisible = MINT_NEW_ARRAY(bool, kBoxCount);
+        uint32 visibleCount = 0;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Frustum vs 1M AABB one by one" };
+            for (uint32 i = 0; i < kBoxCount; ++i)
+            {
+                isVisibleScalar[i] = frustum.intersects(boxes[i]) ? 1 : 0;
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Frustum vs 1M AABB batch" };
+            visibleCount = frustum.cullAABBs(boxes.data(), kBoxCount, isVisible);
+        }
+
+        static constexpr uint32 kTriangleCount = 100'000;
+        std::vector<mint::Float3> triangleVertices(kTriangleCount * 3);
+        for (uint32 i = 0; i < kTriangleCount; ++i)
+        {
+            const float z = static_cast<float>(i % 977) + 1.0f;
+            triangleVertices[i * 3 + 0] = mint::Float3(-1.0f, -1.0f, z);
+            triangleVertices[i * 3 + 1] = mint::Float3(1.0f, -1.0f, z);
+            triangleVertices[i * 3 + 2] = mint::Float3(0.0f, 1.0f, z);
+        }
+        const mint::Ray ray(mint::Float3(0.0f), mint::Float3(0.0f, 0.0f, 1.0f));
+        uint32 closestIndexScalar = 0;
+        uint32 closestIndex = 0;
+        float closestDistance = mint::Math::kFloatMax;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Ray vs 100K triangles one by one" };
+            for (uint32 i = 0; i < kTriangleCount; ++i)
+            {
+                float distance = 0.0f;
+                if (ray.intersectsTriangle(triangleVertices[i * 3], triangleVertices[i * 3 + 1], triangleVertices[i * 3 + 2], distance) == true && distance < closestDistance)
+                {
+                    closestDistance = distance;
+                    closestIndexScalar = i;
+                }
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) Ray vs 100K triangles batch" };
+            ray.intersectsTriangles(triangleVertices.data(), kTriangleCount, closestIndex, closestDistance);
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%u %u %u %u\n", visibleCount, static_cast<uint32>(isVisibleScalar[0]), closestIndexScalar, closestIndex);
+        MINT_DELETE_ARRAY(isVisible);
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kRectCount = 100'000;
+        std::vector<mint::Rect> rects(kRectCount);
+        for (uint32 i = 0; i < kRectCount; ++i)
+        {
+            rects[i] = mint::Rect::fromPositionSize(mint::Float2(static_cast<float>(i % 1920), static_cast<float>((i / 1920) * 20 % 1080)), mint::Float2(64.0f, 20.0f));
+        }
+        mint::RectSoA rectSoA;
+        rectSoA.assignFromAoS(rects.data(), kRectCount);
+        const mint::Float2 mousePosition(1000.0f, 510.0f);
+        const mint::Rect clipRect(100.0f, 1800.0f, 100.0f, 1000.0f);
+        uint32 lastIndexScalar = kUint32Max;
+        uint32 lastIndex = kUint32Max;
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Hit test 100K Rect x100 one by one" };
+            for (uint32 iteration = 0; iteration < 100; ++iteration)
+            {
+                for (uint32 i = 0; i < kRectCount; ++i)
+                {
+                    if (rects[i].contains(mousePosition) == true)
+                    {
+                        lastIndexScalar = i;
+                    }
+                }
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Hit test 100K Rect x100 SoA" };
+            for (uint32 iteration = 0; iteration < 100; ++iteration)
+            {
+                lastIndex = rectSoA.findLastContaining(mousePosition);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Clip 100K Rect one by one" };
+            for (uint32 i = 0; i < kRectCount; ++i)
+            {
+                rects[i].clipBy(clipRect);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) Clip 100K Rect SoA" };
+            rectSoA.clipBy(clipRect);
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%u %u %f\n", lastIndexScalar, lastIndex, rectSoA.get(kRectCount - 1).left() + rects[kRectCount - 1].left());
+    }
+#endif
+
+#if defined MINT_TEST_PERFORMANCE
+    {
+        const uint32 logBeginIndex = getProfilerLogCount();
+        static constexpr uint32 kVertexCount = 1'000'000;
+        std::vector<mint::Float3> normals(kVertexCount);
+        std::vector<float> values(kVertexCount * 4);
+        for (uint32 i = 0; i < kVertexCount; ++i)
+        {
+            normals[i] = mint::Float3::normalize(mint::Float3(::sinf(i * 0.1f), ::cosf(i * 0.3f), ::sinf(i * 0.7f) + 0.1f));
+        }
+        for (uint32 i = 0; i < kVertexCount * 4; ++i)
+        {
+            values[i] = i * 0.001f - 1000.0f;
+        }
+        std::vector<mint::SNorm16x2> packedNormals(kVertexCount);
+        std::vector<mint::Half> halves(kVertexCount * 4);
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "1) Pack 1M normals one by one" };
+            for (uint32 i = 0; i < kVertexCount; ++i)
+            {
+                packedNormals[i] = mint::VertexPacking::packNormal(normals[i]);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "2) Pack 1M normals batch" };
+            mint::VertexPacking::packNormals(normals.data(), packedNormals.data(), kVertexCount);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "3) Unpack 1M normals batch" };
+            mint::VertexPacking::unpackNormals(packedNormals.data(), normals.data(), kVertexCount);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "4) Pack 4M halves one by one" };
+            for (uint32 i = 0; i < kVertexCount * 4; ++i)
+            {
+                halves[i] = mint::Half(values[i]);
+            }
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "5) Pack 4M halves batch" };
+            mint::VertexPacking::packHalves(values.data(), halves.data(), kVertexCount * 4);
+        }
+        {
+            mint::Profiler::ScopedCpuProfiler profiler{ "6) Unpack 4M halves batch" };
+            mint::VertexPacking::unpackHalves(halves.data(), values.data(), kVertexCount * 4);
+        }
+
+        printProfilerLogs(logBeginIndex);
+        printf("%f %f\n", normals[kVertexCount - 1]._x, values[kVertexCount - 1]);
+    }
+#endif
+
     return true;
 }
 
@@ -0,0 +1,55 @@
+﻿#pragma once
+
+
+#ifndef MINT_AABB_H
+#define MINT_AABB_H
+
+
+#include <MintMath/Include/Float4x4.h>
+
+
+namespace mint
+{
+    // Axis-aligned bounding box
+    class AABB final
+    {
+    public:
+        static AABB             fromPoints(const mint::Float3* const points, const uint32 count) noexcept;
+        static AABB             fromCenterExtents(const mint::Float3& center, const mint::Float3& extents) noexcept;
+
+    public:
+                                // 비어 있는 (isValid() == false) 상태로 만든다.
+                                AABB();
+        explicit                AABB(const mint::Float3& min, const mint::Float3& max);
+                                AABB(const AABB& rhs)           = default;
+                                AABB(AABB&& rhs) noexcept       = default;
+                                ~AABB()                         = default;
+
+    public:
+        AABB&                   operator=(const AABB& rhs)      = default;
+        AABB&                   operator=(AABB&& rhs) noexcept  = default;
+
+    public:
+        const bool              isValid() const noexcept;
+        mint::Float3            getCenter() const noexcept;
+        // 각 축의 절반 크기
+        mint::Float3            getExtents() const noexcept;
+
+    public:
+        void                    expand(const mint::Float3& point) noexcept;
+        void                    merge(const AABB& rhs) noexcept;
+
+    public:
+        const bool              contains(const mint::Float3& point) const noexcept;
+        const bool              intersects(const AABB& rhs) const noexcept;
+        // 변환된 box 를 감싸는 AABB (Arvo 의 방법)
+        AABB                    transform(const mint::Float4x4& matrix) const noexcept;
+
+    public:
+        mint::Float3            _min;
+        mint::Float3            _max;
+    };
+}
+
+
+#endif // !MINT_AABB_H
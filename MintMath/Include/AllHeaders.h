@@ -6,6 +6,8 @@
 
 
 #include <MintMath/Include/MathCommon.h>
+#include <MintMath/Include/SimdCommon.h>
+#include <MintMath/Include/FastMath.h>
 
 #include <MintMath/Include/Float2.h>
 #include <MintMath/Include/Float2x2.h>
@@ -13,8 +15,18 @@
 #include <MintMath/Include/Float3x3.h>
 #include <MintMath/Include/Float4.h>
 #include <MintMath/Include/Float4x4.h>
+#include <MintMath/Include/BatchTransform.h>
+#include <MintMath/Include/FloatSoA.h>
 #include <MintMath/Include/Int2.h>
+#include <MintMath/Include/PackedTypes.h>
 #include <MintMath/Include/Quaternion.h>
+#include <MintMath/Include/Transform3x4.h>
+#include <MintMath/Include/DualQuaternion.h>
+#include <MintMath/Include/Plane.h>
+#include <MintMath/Include/AABB.h>
+#include <MintMath/Include/BoundingSphere.h>
+#include <MintMath/Include/Frustum.h>
+#include <MintMath/Include/Ray.h>
 #include <MintMath/Include/VectorR.h>
 #include <MintMath/Include/Matrix.h>
 
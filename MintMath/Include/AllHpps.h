@@ -7,6 +7,7 @@
 
 #include <MintMath/Include/VectorR.hpp>
 #include <MintMath/Include/Matrix.hpp>
+#include <MintMath/Include/FloatSoA.hpp>
 
 
 #endif // !MINT_MATH_ALL_HPPS_H
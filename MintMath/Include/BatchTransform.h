@@ -0,0 +1,52 @@
+﻿#pragma once
+
+
+#ifndef MINT_BATCH_TRANSFORM_H
+#define MINT_BATCH_TRANSFORM_H
+
+
+#include <MintMath/Include/Float3.h>
+#include <MintMath/Include/Float4.h>
+#include <MintMath/Include/Float4x4.h>
+
+
+namespace mint
+{
+    // 한 번에 많은 vector/matrix 를 변환하는 함수들.
+    // 모든 함수는 input 과 output 이 같은 배열이어도 된다. (in-place)
+    // useParallelFor 가 true 이면 count 가 충분히 클 때 mint::parallelFor 로 나눠서 처리한다.
+    namespace BatchTransform
+    {
+        static constexpr uint32 kParallelMinVectorCount = 1 << 15;
+        static constexpr uint32 kParallelMinMatrixCount = 1 << 11;
+
+
+        // output[i] = matrix * Float4(input[i], 1)
+        void    transformPoints(const Float4x4& matrix, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = matrix * input[i]
+        void    transformPoints(const Float4x4& matrix, const Float4* const input, Float4* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = matrix * Float4(input[i], 0)
+        // Non-uniform scale 이 있다면 matrix 로 inverse-transpose 를 넘겨야 한다. 정규화는 하지 않는다.
+        void    transformNormals(const Float4x4& matrix, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // SoA position stream 을 변환한다. (x, y, z 가 각각 연속된 배열)
+        void    transformPointsSoA(const Float4x4& matrix, const float* const inputX, const float* const inputY, const float* const inputZ,
+                    float* const outputX, float* const outputY, float* const outputZ, const uint32 count, const bool useParallelFor = false) noexcept;
+
+        // output[i] = lhs[i] * rhs[i]
+        void    multiplyMatrices(const Float4x4* const lhs, const Float4x4* const rhs, Float4x4* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = lhs * rhs[i] (예: parent world * local)
+        void    multiplyMatrices(const Float4x4& lhs, const Float4x4* const rhs, Float4x4* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+
+        // output[i] = lhs[i] * rhs[i] (Hamilton product)
+        void    multiplyQuaternions(const Quaternion* const lhs, const Quaternion* const rhs, Quaternion* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = rotation.rotateVector(input[i])
+        void    rotateVectors(const Quaternion& rotation, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = Float4x4::rotationMatrix(rotations[i])
+        void    rotationMatrices(const Quaternion* const rotations, Float4x4* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+        // output[i] = Float4x4::srtMatrix(scales[i], rotations[i], translations[i]) (예: skeleton joint 의 local pose)
+        void    srtMatrices(const Float3* const scales, const Quaternion* const rotations, const Float3* const translations, Float4x4* const output, const uint32 count, const bool useParallelFor = false) noexcept;
+    }
+}
+
+
+#endif // !MINT_BATCH_TRANSFORM_H
@@ -0,0 +1,43 @@
+﻿#pragma once
+
+
+#ifndef MINT_BOUNDING_SPHERE_H
+#define MINT_BOUNDING_SPHERE_H
+
+
+#include <MintMath/Include/AABB.h>
+
+
+namespace mint
+{
+    class BoundingSphere final
+    {
+    public:
+        // AABB 의 center 를 중심으로 모든 점을 감싼다. (최소 구는 아니다)
+        static BoundingSphere   fromPoints(const mint::Float3* const points, const uint32 count) noexcept;
+        static BoundingSphere   fromAABB(const AABB& aabb) noexcept;
+
+    public:
+                                BoundingSphere();
+        explicit                BoundingSphere(const mint::Float3& center, const float radius);
+                                BoundingSphere(const BoundingSphere& rhs)           = default;
+                                BoundingSphere(BoundingSphere&& rhs) noexcept       = default;
+                                ~BoundingSphere()                                   = default;
+
+    public:
+        BoundingSphere&         operator=(const BoundingSphere& rhs)                = default;
+        BoundingSphere&         operator=(BoundingSphere&& rhs) noexcept            = default;
+
+    public:
+        const bool              contains(const mint::Float3& point) const noexcept;
+        const bool              intersects(const BoundingSphere& rhs) const noexcept;
+        const bool              intersects(const AABB& aabb) const noexcept;
+
+    public:
+        mint::Float3            _center;
+        float                   _radius;
+    };
+}
+
+
+#endif // !MINT_BOUNDING_SPHERE_H
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+
+#ifndef MINT_DUAL_QUATERNION_H
+#define MINT_DUAL_QUATERNION_H
+
+
+#include <MintMath/Include/Quaternion.h>
+#include <MintMath/Include/Transform3x4.h>
+
+
+namespace mint
+{
+    // Rigid transform (회전 + 이동) 을 나타내는 unit dual quaternion.
+    // q = real + ε * dual, dual = 0.5 * t * real (t 는 pure quaternion)
+    // Scale 은 표현할 수 없다. 32 bytes 이고 합성 시 곱셈은 48 번이다.
+    class DualQuaternion final
+    {
+#pragma region Static functions
+    public:
+        static DualQuaternion       fromTransform(const mint::Quaternion& rotation, const mint::Float3& translation) noexcept;
+        // Dual quaternion linear blending. Skinning 처럼 여러 transform 을 섞을 때 쓴다.
+        static DualQuaternion       nlerp(const DualQuaternion& from, const DualQuaternion& to, const float t) noexcept;
+#pragma endregion
+
+    public:
+                                    DualQuaternion();
+        explicit                    DualQuaternion(const mint::Quaternion& real, const mint::Quaternion& dual);
+                                    DualQuaternion(const DualQuaternion& rhs)       = default;
+                                    DualQuaternion(DualQuaternion&& rhs) noexcept   = default;
+                                    ~DualQuaternion()                               = default;
+
+    public:
+        DualQuaternion&             operator=(const DualQuaternion& rhs)            = default;
+        DualQuaternion&             operator=(DualQuaternion&& rhs) noexcept        = default;
+
+    public:
+        // rhs 를 먼저 적용한다. (예: parent * child)
+        DualQuaternion              operator*(const DualQuaternion& rhs) const noexcept;
+        DualQuaternion&             operator*=(const DualQuaternion& rhs) noexcept;
+
+    public:
+        void                        normalize() noexcept;
+        // Unit dual quaternion 의 역변환
+        DualQuaternion              inverse() const noexcept;
+        mint::Float3                transformPoint(const mint::Float3& point) const noexcept;
+        mint::Float3                transformVector(const mint::Float3& vector) const noexcept;
+        const mint::Quaternion&     getRotation() const noexcept;
+        mint::Float3                getTranslation() const noexcept;
+        mint::Float4x4              toMatrix() const noexcept;
+        mint::Transform3x4          toTransform3x4() const noexcept;
+
+    public:
+        mint::Quaternion            _real;
+        mint::Quaternion            _dual;
+    };
+}
+
+
+#endif // !MINT_DUAL_QUATERNION_H
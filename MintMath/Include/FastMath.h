@@ -0,0 +1,67 @@
+﻿#pragma once
+
+
+#ifndef MINT_FAST_MATH_H
+#define MINT_FAST_MATH_H
+
+
+#include <MintMath/Include/MathCommon.h>
+#include <MintMath/Include/SimdCommon.h>
+
+
+namespace mint
+{
+    namespace Math
+    {
+        // 호출하는 쪽에서 정확도와 속도 중 하나를 고른다.
+        // - Exact: C runtime 함수를 그대로 쓴다.
+        // - Fast : 다항식 근사. 최대 오차는 함수마다 적어 두었다. (MintLibraryTest 의 testLinearAlgebra 에서 확인)
+        enum class Precision
+        {
+            Exact,
+            Fast,
+        };
+
+
+        // Fast: |angle| <= 8192 에서 최대 절대 오차 2e-7 이하
+        template<Precision kPrecision = Precision::Exact>
+        void            sinCos(const float angle, float& outSin, float& outCos) noexcept;
+
+        // 1 / sqrt(value). value 는 0 보다 커야 한다.
+        // Fast: 하드웨어 rsqrt 추정값에 Newton-Raphson 을 한 번 적용한다. 최대 상대 오차 3e-7 이하
+        // (MINT_MATH_USE_SCALAR 에서는 bit 연산 추정값 + Newton-Raphson 두 번, 최대 상대 오차 5e-6 이하)
+        template<Precision kPrecision = Precision::Exact>
+        const float     rsqrt(const float value) noexcept;
+
+        // Fast: 최대 절대 오차 3e-6 rad 이하. (0, 0) 은 0 을 반환한다.
+        template<Precision kPrecision = Precision::Exact>
+        const float     atan2(const float y, const float x) noexcept;
+
+        // Fast: value 는 [-87.3, 88.3] 으로 clamp 된다. 최대 상대 오차 2e-7 이하
+        template<Precision kPrecision = Precision::Exact>
+        const float     exp(const float value) noexcept;
+
+        // Fast: value 는 양의 정규화된 float 이어야 한다. 최대 오차는 max(|log(value)|, 1) 의 2e-7 배 이하
+        template<Precision kPrecision = Precision::Exact>
+        const float     log(const float value) noexcept;
+    }
+
+
+#if defined MINT_MATH_USE_SIMD
+    namespace Simd
+    {
+        // Math 의 Precision::Fast 버전과 같은 근사를 4 개씩 계산한다.
+        void            sinCos(const __m128 angle, __m128& outSin, __m128& outCos) noexcept;
+        __m128          rsqrt(const __m128 value) noexcept;
+        __m128          atan2(const __m128 y, const __m128 x) noexcept;
+        __m128          exp(const __m128 value) noexcept;
+        __m128          log(const __m128 value) noexcept;
+    }
+#endif
+}
+
+
+#include <MintMath/Include/FastMath.inl>
+
+
+#endif // !MINT_FAST_MATH_H
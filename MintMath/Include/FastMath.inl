@@ -0,0 +1,322 @@
+#pragma once
+
+
+#include <cstring>
+
+
+namespace mint
+{
+    namespace Math
+    {
+        namespace FastMathInternal
+        {
+            // Cody-Waite range reduction 을 위해 pi/2 를 세 부분으로 나눈 값
+            static constexpr float kTwoOverPi           = 0.636619772367581343f;
+            static constexpr float kPiOverTwoHigh       = 1.5703125f;
+            static constexpr float kPiOverTwoMiddle     = 4.837512969970703125e-4f;
+            static constexpr float kPiOverTwoLow        = 7.54978995489188216e-8f;
+
+            // [-pi/4, pi/4] 에서의 minimax 다항식 계수 (Cephes sinf/cosf)
+            static constexpr float kSin0                = -1.9515295891e-4f;
+            static constexpr float kSin1                = 8.3321608736e-3f;
+            static constexpr float kSin2                = -1.6666654611e-1f;
+            static constexpr float kCos0                = 2.443315711809948e-5f;
+            static constexpr float kCos1                = -1.388731625493765e-3f;
+            static constexpr float kCos2                = 4.166664568298827e-2f;
+
+            // [0, 1] 에서의 atan 다항식 계수 (Abramowitz & Stegun 4.4.49)
+            static constexpr float kAtan0               = -0.0117212f;
+            static constexpr float kAtan1               = 0.05265332f;
+            static constexpr float kAtan2               = -0.11643287f;
+            static constexpr float kAtan3               = 0.19354346f;
+            static constexpr float kAtan4               = -0.33262347f;
+            static constexpr float kAtan5               = 0.99997726f;
+
+            // exp(x) = 2^n * exp(r), x = n * ln2 + r (Cephes expf)
+            static constexpr float kExpMin              = -87.3f;
+            static constexpr float kExpMax              = 88.3f;
+            static constexpr float kLog2E               = 1.44269504088896341f;
+            static constexpr float kLn2High             = 0.693359375f;
+            static constexpr float kLn2Low              = -2.12194440e-4f;
+            static constexpr float kExp0                = 1.9875691500e-4f;
+            static constexpr float kExp1                = 1.3981999507e-3f;
+            static constexpr float kExp2                = 8.3334519073e-3f;
+            static constexpr float kExp3                = 4.1665795894e-2f;
+            static constexpr float kExp4                = 1.6666665459e-1f;
+            static constexpr float kExp5                = 5.0000001201e-1f;
+
+            // log(x) = e * ln2 + log(m), m 은 [sqrt(0.5), sqrt(2)) (Cephes logf)
+            static constexpr float kSqrtHalf            = 0.707106781186547524f;
+            static constexpr float kLog0                = 7.0376836292e-2f;
+            static constexpr float kLog1                = -1.1514610310e-1f;
+            static constexpr float kLog2                = 1.1676998740e-1f;
+            static constexpr float kLog3                = -1.2420140846e-1f;
+            static constexpr float kLog4                = 1.4249322787e-1f;
+            static constexpr float kLog5                = -1.6668057665e-1f;
+            static constexpr float kLog6                = 2.0000714765e-1f;
+            static constexpr float kLog7                = -2.4999993993e-1f;
+            static constexpr float kLog8                = 3.3333331174e-1f;
+
+            MINT_INLINE const uint32 floatToBits(const float value) noexcept
+            {
+                uint32 bits;
+                ::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            MINT_INLINE const float bitsToFloat(const uint32 bits) noexcept
+            {
+                float value;
+                ::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            MINT_INLINE const int32 roundToInt(const float value) noexcept
+            {
+                return static_cast<int32>((value < 0.0f) ? value - 0.5f : value + 0.5f);
+            }
+        }
+
+
+        template<Precision kPrecision>
+        MINT_INLINE void sinCos(const float angle, float& outSin, float& outCos) noexcept
+        {
+            if constexpr (kPrecision == Precision::Exact)
+            {
+                outSin = ::sinf(angle);
+                outCos = ::cosf(angle);
+            }
+            else
+            {
+                using namespace FastMathInternal;
+                const int32 quadrant = roundToInt(angle * kTwoOverPi);
+                const float quadrantF = static_cast<float>(quadrant);
+                const float r = ((angle - quadrantF * kPiOverTwoHigh) - quadrantF * kPiOverTwoMiddle) - quadrantF * kPiOverTwoLow;
+                const float r2 = r * r;
+                const float s = r + r * r2 * (kSin2 + r2 * (kSin1 + r2 * kSin0));
+                const float c = 1.0f - 0.5f * r2 + r2 * r2 * (kCos2 + r2 * (kCos1 + r2 * kCos0));
+                // 사분면에 따라 sin, cos 을 바꾸고 부호를 정한다.
+                const bool swap = (quadrant & 1) != 0;
+                const float sinResult = (swap == true) ? c : s;
+                const float cosResult = (swap == true) ? s : c;
+                outSin = ((quadrant & 2) != 0) ? -sinResult : sinResult;
+                outCos = (((quadrant + 1) & 2) != 0) ? -cosResult : cosResult;
+            }
+        }
+
+        template<Precision kPrecision>
+        MINT_INLINE const float rsqrt(const float value) noexcept
+        {
+            if constexpr (kPrecision == Precision::Exact)
+            {
+                return 1.0f / ::sqrtf(value);
+            }
+            else
+            {
+#if defined MINT_MATH_USE_SIMD
+                return _mm_cvtss_f32(Simd::rsqrt(_mm_set_ss(value)));
+#else
+                using namespace FastMathInternal;
+                const float halfValue = value * 0.5f;
+                float y = bitsToFloat(0x5F375A86u - (floatToBits(value) >> 1));
+                y = y * (1.5f - halfValue * y * y);
+                y = y * (1.5f - halfValue * y * y);
+                return y;
+#endif
+            }
+        }
+
+        template<Precision kPrecision>
+        MINT_INLINE const float atan2(const float y, const float x) noexcept
+        {
+            if constexpr (kPrecision == Precision::Exact)
+            {
+                return ::atan2f(y, x);
+            }
+            else
+            {
+                using namespace FastMathInternal;
+                const float absoluteX = absolute(x);
+                const float absoluteY = absolute(y);
+                const float maxXy = (absoluteX < absoluteY) ? absoluteY : absoluteX;
+                if (maxXy == 0.0f)
+                {
+                    return 0.0f;
+                }
+
+                const float minXy = (absoluteX < absoluteY) ? absoluteX : absoluteY;
+                const float a = minXy / maxXy;
+                const float s = a * a;
+                float result = a * (kAtan5 + s * (kAtan4 + s * (kAtan3 + s * (kAtan2 + s * (kAtan1 + s * kAtan0)))));
+                result = (absoluteX < absoluteY) ? kPiOverTwo - result : result;
+                result = (x < 0.0f) ? kPi - result : result;
+                return (y < 0.0f) ? -result : result;
+            }
+        }
+
+        template<Precision kPrecision>
+        MINT_INLINE const float exp(const float value) noexcept
+        {
+            if constexpr (kPrecision == Precision::Exact)
+            {
+                return ::expf(value);
+            }
+            else
+            {
+                using namespace FastMathInternal;
+                const float x = (value < kExpMin) ? kExpMin : ((kExpMax < value) ? kExpMax : value);
+                const int32 n = roundToInt(x * kLog2E);
+                const float nF = static_cast<float>(n);
+                const float r = (x - nF * kLn2High) - nF * kLn2Low;
+                const float p = r * r * (kExp5 + r * (kExp4 + r * (kExp3 + r * (kExp2 + r * (kExp1 + r * kExp0))))) + r + 1.0f;
+                return p * bitsToFloat(static_cast<uint32>(n + 127) << 23);
+            }
+        }
+
+        template<Precision kPrecision>
+        MINT_INLINE const float log(const float value) noexcept
+        {
+            if constexpr (kPrecision == Precision::Exact)
+            {
+                return ::logf(value);
+            }
+            else
+            {
+                using namespace FastMathInternal;
+                const uint32 bits = floatToBits(value);
+                float exponent = static_cast<float>(static_cast<int32>(bits >> 23) - 126);
+                float mantissa = bitsToFloat((bits & 0x007FFFFFu) | 0x3F000000u); // [0.5, 1)
+                if (mantissa < kSqrtHalf)
+                {
+                    exponent -= 1.0f;
+                    mantissa = mantissa + mantissa - 1.0f;
+                }
+                else
+                {
+                    mantissa = mantissa - 1.0f;
+                }
+
+                const float m = mantissa;
+                const float z = m * m;
+                float y = m * z * (kLog8 + m * (kLog7 + m * (kLog6 + m * (kLog5 + m * (kLog4 + m * (kLog3 + m * (kLog2 + m * (kLog1 + m * kLog0))))))));
+                y += exponent * kLn2Low;
+                y -= 0.5f * z;
+                return m + y + exponent * kLn2High;
+            }
+        }
+    }
+
+
+#if defined MINT_MATH_USE_SIMD
+    namespace Simd
+    {
+        MINT_INLINE void sinCos(const __m128 angle, __m128& outSin, __m128& outCos) noexcept
+        {
+            using namespace Math::FastMathInternal;
+            const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(kTwoOverPi)));
+            const __m128 quadrantF = _mm_cvtepi32_ps(quadrant);
+            __m128 r = _mm_sub_ps(angle, _mm_mul_ps(quadrantF, _mm_set1_ps(kPiOverTwoHigh)));
+            r = _mm_sub_ps(r, _mm_mul_ps(quadrantF, _mm_set1_ps(kPiOverTwoMiddle)));
+            r = _mm_sub_ps(r, _mm_mul_ps(quadrantF, _mm_set1_ps(kPiOverTwoLow)));
+            const __m128 r2 = _mm_mul_ps(r, r);
+
+            __m128 s = multiplyAdd(r2, _mm_set1_ps(kSin0), _mm_set1_ps(kSin1));
+            s = multiplyAdd(r2, s, _mm_set1_ps(kSin2));
+            s = multiplyAdd(_mm_mul_ps(r, r2), s, r);
+            __m128 c = multiplyAdd(r2, _mm_set1_ps(kCos0), _mm_set1_ps(kCos1));
+            c = multiplyAdd(r2, c, _mm_set1_ps(kCos2));
+            c = multiplyAdd(_mm_mul_ps(r2, r2), c, _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)));
+
+            const __m128i one = _mm_set1_epi32(1);
+            const __m128i two = _mm_set1_epi32(2);
+            const __m128 swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+            const __m128 sinResult = _mm_or_ps(_mm_and_ps(swapMask, c), _mm_andnot_ps(swapMask, s));
+            const __m128 cosResult = _mm_or_ps(_mm_and_ps(swapMask, s), _mm_andnot_ps(swapMask, c));
+            const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+            const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+            outSin = _mm_xor_ps(sinResult, sinSign);
+            outCos = _mm_xor_ps(cosResult, cosSign);
+        }
+
+        MINT_INLINE __m128 rsqrt(const __m128 value) noexcept
+        {
+            // y' = y * (1.5 - 0.5 * x * y * y)
+            const __m128 y = _mm_rsqrt_ps(value);
+            const __m128 halfValueY = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), value), y);
+            return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValueY, y)));
+        }
+
+        MINT_INLINE __m128 atan2(const __m128 y, const __m128 x) noexcept
+        {
+            using namespace Math::FastMathInternal;
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            const __m128 absoluteX = _mm_andnot_ps(signMask, x);
+            const __m128 absoluteY = _mm_andnot_ps(signMask, y);
+            const __m128 maxXy = _mm_max_ps(absoluteX, absoluteY);
+            const __m128 minXy = _mm_min_ps(absoluteX, absoluteY);
+            const __m128 zeroMask = _mm_cmpeq_ps(maxXy, _mm_setzero_ps());
+            const __m128 a = _mm_div_ps(minXy, _mm_or_ps(_mm_and_ps(zeroMask, _mm_set1_ps(1.0f)), _mm_andnot_ps(zeroMask, maxXy)));
+            const __m128 s = _mm_mul_ps(a, a);
+
+            __m128 result = multiplyAdd(s, _mm_set1_ps(kAtan0), _mm_set1_ps(kAtan1));
+            result = multiplyAdd(s, result, _mm_set1_ps(kAtan2));
+            result = multiplyAdd(s, result, _mm_set1_ps(kAtan3));
+            result = multiplyAdd(s, result, _mm_set1_ps(kAtan4));
+            result = multiplyAdd(s, result, _mm_set1_ps(kAtan5));
+            result = _mm_mul_ps(a, result);
+
+            const __m128 steepMask = _mm_cmplt_ps(absoluteX, absoluteY);
+            result = _mm_or_ps(_mm_and_ps(steepMask, _mm_sub_ps(_mm_set1_ps(Math::kPiOverTwo), result)), _mm_andnot_ps(steepMask, result));
+            const __m128 negativeXMask = _mm_cmplt_ps(x, _mm_setzero_ps());
+            result = _mm_or_ps(_mm_and_ps(negativeXMask, _mm_sub_ps(_mm_set1_ps(Math::kPi), result)), _mm_andnot_ps(negativeXMask, result));
+            result = _mm_xor_ps(result, _mm_and_ps(_mm_cmplt_ps(y, _mm_setzero_ps()), signMask));
+            return _mm_andnot_ps(zeroMask, result);
+        }
+
+        MINT_INLINE __m128 exp(const __m128 value) noexcept
+        {
+            using namespace Math::FastMathInternal;
+            const __m128 x = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(kExpMin)), _mm_set1_ps(kExpMax));
+            const __m128i n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(kLog2E)));
+            const __m128 nF = _mm_cvtepi32_ps(n);
+            const __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(nF, _mm_set1_ps(kLn2High))), _mm_mul_ps(nF, _mm_set1_ps(kLn2Low)));
+
+            __m128 p = multiplyAdd(r, _mm_set1_ps(kExp0), _mm_set1_ps(kExp1));
+            p = multiplyAdd(r, p, _mm_set1_ps(kExp2));
+            p = multiplyAdd(r, p, _mm_set1_ps(kExp3));
+            p = multiplyAdd(r, p, _mm_set1_ps(kExp4));
+            p = multiplyAdd(r, p, _mm_set1_ps(kExp5));
+            p = multiplyAdd(_mm_mul_ps(r, r), p, _mm_add_ps(r, _mm_set1_ps(1.0f)));
+            const __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23));
+            return _mm_mul_ps(p, scale);
+        }
+
+        MINT_INLINE __m128 log(const __m128 value) noexcept
+        {
+            using namespace Math::FastMathInternal;
+            const __m128i bits = _mm_castps_si128(value);
+            __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+            __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+
+            // mantissa < sqrt(0.5) 이면 exponent 를 하나 줄이고 mantissa 를 두 배로 한다.
+            const __m128 smallMask = _mm_cmplt_ps(mantissa, _mm_set1_ps(kSqrtHalf));
+            exponent = _mm_sub_ps(exponent, _mm_and_ps(smallMask, _mm_set1_ps(1.0f)));
+            const __m128 m = _mm_sub_ps(_mm_add_ps(mantissa, _mm_and_ps(smallMask, mantissa)), _mm_set1_ps(1.0f));
+            const __m128 z = _mm_mul_ps(m, m);
+
+            __m128 y = multiplyAdd(m, _mm_set1_ps(kLog0), _mm_set1_ps(kLog1));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog2));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog3));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog4));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog5));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog6));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog7));
+            y = multiplyAdd(m, y, _mm_set1_ps(kLog8));
+            y = _mm_mul_ps(_mm_mul_ps(m, z), y);
+            y = multiplyAdd(exponent, _mm_set1_ps(kLn2Low), y);
+            y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+            return multiplyAdd(exponent, _mm_set1_ps(kLn2High), _mm_add_ps(m, y));
+        }
+    }
+#endif
+}
@@ -6,6 +6,7 @@
 
 
 #include <MintMath/Include/Float3.h>
+#include <MintMath/Include/SimdCommon.h>
 
 
 namespace mint
@@ -32,37 +32,53 @@ namespace mint
 
     MINT_INLINE Float4& Float4::operator+=(const Float4& rhs)
     {
+#if defined MINT_MATH_USE_SIMD
+        _mm_store_ps(_f, _mm_add_ps(_mm_load_ps(_f), _mm_load_ps(rhs._f)));
+#else
         _x += rhs._x;
         _y += rhs._y;
         _z += rhs._z;
         _w += rhs._w;
+#endif
         return *this;
     }
 
     MINT_INLINE Float4& Float4::operator-=(const Float4& rhs)
     {
+#if defined MINT_MATH_USE_SIMD
+        _mm_store_ps(_f, _mm_sub_ps(_mm_load_ps(_f), _mm_load_ps(rhs._f)));
+#else
         _x -= rhs._x;
         _y -= rhs._y;
         _z -= rhs._z;
         _w -= rhs._w;
+#endif
         return *this;
     }
 
     MINT_INLINE Float4& Float4::operator*=(const float s)
     {
+#if defined MINT_MATH_USE_SIMD
+        _mm_store_ps(_f, _mm_mul_ps(_mm_load_ps(_f), _mm_set1_ps(s)));
+#else
         _x *= s;
         _y *= s;
         _z *= s;
         _w *= s;
+#endif
         return *this;
     }
 
     MINT_INLINE Float4& Float4::operator/=(const float s)
     {
+#if defined MINT_MATH_USE_SIMD
+        _mm_store_ps(_f, _mm_div_ps(_mm_load_ps(_f), _mm_set1_ps(s)));
+#else
         _x /= s;
         _y /= s;
         _z /= s;
         _w /= s;
+#endif
         return *this;
     }
 
@@ -73,27 +89,57 @@ namespace mint
 
     MINT_INLINE Float4 Float4::operator-() const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, _mm_xor_ps(_mm_load_ps(_f), _mm_set1_ps(-0.0f)));
+        return result;
+#else
         return Float4(-_x, -_y, -_z, -_w);
+#endif
     }
 
     MINT_INLINE Float4 Float4::operator+(const Float4& rhs) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, _mm_add_ps(_mm_load_ps(_f), _mm_load_ps(rhs._f)));
+        return result;
+#else
         return Float4(_x + rhs._x, _y + rhs._y, _z + rhs._z, _w + rhs._w);
+#endif
     }
 
     MINT_INLINE Float4 Float4::operator-(const Float4& rhs) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, _mm_sub_ps(_mm_load_ps(_f), _mm_load_ps(rhs._f)));
+        return result;
+#else
         return Float4(_x - rhs._x, _y - rhs._y, _z - rhs._z, _w - rhs._w);
+#endif
     }
 
     MINT_INLINE Float4 Float4::operator*(const float s) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, _mm_mul_ps(_mm_load_ps(_f), _mm_set1_ps(s)));
+        return result;
+#else
         return Float4(_x * s, _y * s, _z * s, _w * s);
+#endif
     }
 
     MINT_INLINE Float4 Float4::operator/(const float s) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, _mm_div_ps(_mm_load_ps(_f), _mm_set1_ps(s)));
+        return result;
+#else
         return Float4(_x / s, _y / s, _z / s, _w / s);
+#endif
     }
 
     MINT_INLINE constexpr const bool Float4::operator==(const Float4& rhs) const noexcept
@@ -0,0 +1,102 @@
+﻿#pragma once
+
+
+#ifndef MINT_FLOAT_SOA_H
+#define MINT_FLOAT_SOA_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintMath/Include/Float3.h>
+#include <MintMath/Include/Float4.h>
+
+#include <type_traits>
+
+
+namespace mint
+{
+    // x, y, z(, w) 성분을 각 성분별로 연속된 배열에 담는 SoA container.
+    // 성분 배열은 모두 kAlignment 로 정렬되고 capacity 는 kLaneAlignment 의 배수라서 SIMD 로 바로 load/store 할 수 있다.
+    template <uint32 ComponentCount>
+    class FloatSoA final
+    {
+        static_assert(ComponentCount == 3 || ComponentCount == 4, "FloatSoA supports only 3 or 4 components!");
+
+    public:
+        static constexpr uint32 kAlignment      = 32;
+        static constexpr uint32 kLaneAlignment  = 8;
+        using ElementType                       = std::conditional_t<ComponentCount == 3, Float3, Float4>;
+
+    public:
+                                FloatSoA();
+        explicit                FloatSoA(const uint32 size);
+                                FloatSoA(const FloatSoA& rhs) noexcept;
+                                FloatSoA(FloatSoA&& rhs) noexcept;
+                                ~FloatSoA();
+
+    public:
+        FloatSoA&               operator=(const FloatSoA& rhs) noexcept;
+        FloatSoA&               operator=(FloatSoA&& rhs) noexcept;
+
+    public:
+        void                    reserve(const uint32 capacity) noexcept;
+        // 새로 생기는 원소는 0 으로 채워진다.
+        void                    resize(const uint32 size) noexcept;
+        void                    clear() noexcept;
+        void                    push_back(const ElementType& element) noexcept;
+        void                    set(const uint32 index, const ElementType& element) noexcept;
+        ElementType             get(const uint32 index) const noexcept;
+
+    public:
+        float*                  component(const uint32 componentIndex) noexcept;
+        const float*            component(const uint32 componentIndex) const noexcept;
+        float*                  x() noexcept;
+        const float*            x() const noexcept;
+        float*                  y() noexcept;
+        const float*            y() const noexcept;
+        float*                  z() noexcept;
+        const float*            z() const noexcept;
+        // ComponentCount 가 4 일 때만 쓸 수 있다.
+        float*                  w() noexcept;
+        const float*            w() const noexcept;
+
+    public:
+        const uint32            size() const noexcept;
+        const uint32            capacity() const noexcept;
+        const bool              empty() const noexcept;
+
+    public:
+        // AoSType 은 Float3 또는 Float4 이며 ComponentCount 이상의 성분을 가져야 한다. (남는 성분은 버린다)
+        template <typename AoSType>
+        void                    assignFromAoS(const AoSType* const input, const uint32 count) noexcept;
+        // AoSType 의 성분이 더 많으면 남는 성분 (w) 을 fillValue 로 채운다.
+        template <typename AoSType>
+        void                    copyToAoS(AoSType* const output, const float fillValue = 1.0f) const noexcept;
+
+    public:
+        // output 은 size() 개의 float 을 담을 수 있어야 한다.
+        void                    computeLengths(float* const output) const noexcept;
+        void                    normalize() noexcept;
+        static void             dot(const FloatSoA& lhs, const FloatSoA& rhs, float* const output) noexcept;
+        // ComponentCount 가 3 일 때만 쓸 수 있다.
+        static void             cross(const FloatSoA& lhs, const FloatSoA& rhs, FloatSoA& output) noexcept;
+
+    public:
+        // x, y, z 성분만 사용한다. 비어 있으면 false 를 반환한다.
+        const bool              computeAABB(Float3& outMin, Float3& outMax) const noexcept;
+        // AABB 의 중심을 구의 중심으로 삼으므로 최소 구는 아니다.
+        const bool              computeBoundingSphere(Float3& outCenter, float& outRadius) const noexcept;
+
+    private:
+        float*                  _rawPointer;
+        uint32                  _capacity;
+        uint32                  _size;
+    };
+
+
+    using Float3SoA = FloatSoA<3>;
+    using Float4SoA = FloatSoA<4>;
+}
+
+
+#endif // !MINT_FLOAT_SOA_H
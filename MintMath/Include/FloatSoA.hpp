@@ -0,0 +1,598 @@
+﻿#pragma once
+
+
+#ifndef MINT_FLOAT_SOA_HPP
+#define MINT_FLOAT_SOA_HPP
+
+
+#include <MintMath/Include/FloatSoA.h>
+
+#include <MintCommon/Include/Logger.h>
+
+#include <MintMath/Include/SimdCommon.h>
+
+#include <cmath>
+#include <cstring>
+#include <new>
+
+
+namespace mint
+{
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>::FloatSoA()
+        : _rawPointer{ nullptr }
+        , _capacity{ 0 }
+        , _size{ 0 }
+    {
+        __noop;
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>::FloatSoA(const uint32 size)
+        : FloatSoA()
+    {
+        resize(size);
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>::FloatSoA(const FloatSoA& rhs) noexcept
+        : FloatSoA()
+    {
+        *this = rhs;
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>::FloatSoA(FloatSoA&& rhs) noexcept
+        : _rawPointer{ rhs._rawPointer }
+        , _capacity{ rhs._capacity }
+        , _size{ rhs._size }
+    {
+        rhs._rawPointer = nullptr;
+        rhs._capacity = 0;
+        rhs._size = 0;
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>::~FloatSoA()
+    {
+        if (_rawPointer != nullptr)
+        {
+            ::operator delete(_rawPointer, std::align_val_t{ kAlignment });
+            _rawPointer = nullptr;
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>& FloatSoA<ComponentCount>::operator=(const FloatSoA& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            resize(rhs._size);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                if (_size > 0)
+                {
+                    ::memcpy(component(componentIndex), rhs.component(componentIndex), sizeof(float) * _size);
+                }
+            }
+        }
+        return *this;
+    }
+
+    template<uint32 ComponentCount>
+    inline FloatSoA<ComponentCount>& FloatSoA<ComponentCount>::operator=(FloatSoA&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            this->~FloatSoA();
+
+            _rawPointer = rhs._rawPointer;
+            _capacity = rhs._capacity;
+            _size = rhs._size;
+
+            rhs._rawPointer = nullptr;
+            rhs._capacity = 0;
+            rhs._size = 0;
+        }
+        return *this;
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::reserve(const uint32 capacity) noexcept
+    {
+        if (capacity <= _capacity)
+        {
+            return;
+        }
+
+        // 잦은 reserve 시 성능 최적화!!!
+        uint32 newCapacity = mint::max(capacity, _capacity * 2);
+        newCapacity = ((newCapacity + kLaneAlignment - 1) / kLaneAlignment) * kLaneAlignment;
+
+        float* const newRawPointer = static_cast<float*>(::operator new(sizeof(float) * newCapacity * ComponentCount, std::align_val_t{ kAlignment }));
+        ::memset(newRawPointer, 0, sizeof(float) * newCapacity * ComponentCount);
+        if (_rawPointer != nullptr)
+        {
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                ::memcpy(newRawPointer + newCapacity * componentIndex, _rawPointer + _capacity * componentIndex, sizeof(float) * _size);
+            }
+            ::operator delete(_rawPointer, std::align_val_t{ kAlignment });
+        }
+
+        _rawPointer = newRawPointer;
+        _capacity = newCapacity;
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::resize(const uint32 size) noexcept
+    {
+        reserve(size);
+
+        if (_size < size)
+        {
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                ::memset(component(componentIndex) + _size, 0, sizeof(float) * (size - _size));
+            }
+        }
+        _size = size;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE void FloatSoA<ComponentCount>::clear() noexcept
+    {
+        _size = 0;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE void FloatSoA<ComponentCount>::push_back(const ElementType& element) noexcept
+    {
+        reserve(_size + 1);
+        ++_size;
+        set(_size - 1, element);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE void FloatSoA<ComponentCount>::set(const uint32 index, const ElementType& element) noexcept
+    {
+        MINT_ASSERT("김장원", index < _size, "범위를 벗어난 접근입니다.");
+        for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+        {
+            _rawPointer[_capacity * componentIndex + index] = element[componentIndex];
+        }
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE typename FloatSoA<ComponentCount>::ElementType FloatSoA<ComponentCount>::get(const uint32 index) const noexcept
+    {
+        MINT_ASSERT("김장원", index < _size, "범위를 벗어난 접근입니다.");
+        ElementType element;
+        for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+        {
+            element[componentIndex] = _rawPointer[_capacity * componentIndex + index];
+        }
+        return element;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE float* FloatSoA<ComponentCount>::component(const uint32 componentIndex) noexcept
+    {
+        MINT_ASSERT("김장원", componentIndex < ComponentCount, "범위를 벗어난 접근입니다.");
+        return _rawPointer + _capacity * componentIndex;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const float* FloatSoA<ComponentCount>::component(const uint32 componentIndex) const noexcept
+    {
+        MINT_ASSERT("김장원", componentIndex < ComponentCount, "범위를 벗어난 접근입니다.");
+        return _rawPointer + _capacity * componentIndex;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE float* FloatSoA<ComponentCount>::x() noexcept
+    {
+        return component(0);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const float* FloatSoA<ComponentCount>::x() const noexcept
+    {
+        return component(0);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE float* FloatSoA<ComponentCount>::y() noexcept
+    {
+        return component(1);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const float* FloatSoA<ComponentCount>::y() const noexcept
+    {
+        return component(1);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE float* FloatSoA<ComponentCount>::z() noexcept
+    {
+        return component(2);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const float* FloatSoA<ComponentCount>::z() const noexcept
+    {
+        return component(2);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE float* FloatSoA<ComponentCount>::w() noexcept
+    {
+        static_assert(ComponentCount == 4, "w() is only for Float4SoA!");
+        return component(3);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const float* FloatSoA<ComponentCount>::w() const noexcept
+    {
+        static_assert(ComponentCount == 4, "w() is only for Float4SoA!");
+        return component(3);
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const uint32 FloatSoA<ComponentCount>::size() const noexcept
+    {
+        return _size;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const uint32 FloatSoA<ComponentCount>::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    template<uint32 ComponentCount>
+    MINT_INLINE const bool FloatSoA<ComponentCount>::empty() const noexcept
+    {
+        return (_size == 0);
+    }
+
+    template<uint32 ComponentCount>
+    template<typename AoSType>
+    inline void FloatSoA<ComponentCount>::assignFromAoS(const AoSType* const input, const uint32 count) noexcept
+    {
+        static_assert(std::is_same<AoSType, Float3>::value || std::is_same<AoSType, Float4>::value, "AoSType must be Float3 or Float4!");
+        static constexpr uint32 kAoSComponentCount = sizeof(AoSType) / sizeof(float);
+        static_assert(ComponentCount <= kAoSComponentCount, "AoSType doesn't have enough components!");
+
+        resize(count);
+
+        float* const outX = x();
+        float* const outY = y();
+        float* const outZ = z();
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + 4 <= count; index += 4)
+        {
+            __m128 componentX;
+            __m128 componentY;
+            __m128 componentZ;
+            __m128 componentW;
+            if constexpr (kAoSComponentCount == 4)
+            {
+                componentX = _mm_load_ps(input[index + 0]._f);
+                componentY = _mm_load_ps(input[index + 1]._f);
+                componentZ = _mm_load_ps(input[index + 2]._f);
+                componentW = _mm_load_ps(input[index + 3]._f);
+                Simd::transpose4(componentX, componentY, componentZ, componentW);
+            }
+            else
+            {
+                const float* const source = &input[index]._x;
+                Simd::deinterleave3(_mm_loadu_ps(source + 0), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), componentX, componentY, componentZ);
+            }
+
+            _mm_store_ps(outX + index, componentX);
+            _mm_store_ps(outY + index, componentY);
+            _mm_store_ps(outZ + index, componentZ);
+            if constexpr (ComponentCount == 4)
+            {
+                _mm_store_ps(w() + index, componentW);
+            }
+        }
+#endif
+        for (; index < count; ++index)
+        {
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                _rawPointer[_capacity * componentIndex + index] = input[index][componentIndex];
+            }
+        }
+    }
+
+    template<uint32 ComponentCount>
+    template<typename AoSType>
+    inline void FloatSoA<ComponentCount>::copyToAoS(AoSType* const output, const float fillValue) const noexcept
+    {
+        static_assert(std::is_same<AoSType, Float3>::value || std::is_same<AoSType, Float4>::value, "AoSType must be Float3 or Float4!");
+        static constexpr uint32 kAoSComponentCount = sizeof(AoSType) / sizeof(float);
+
+        const float* const inX = x();
+        const float* const inY = y();
+        const float* const inZ = z();
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + 4 <= _size; index += 4)
+        {
+            __m128 componentX = _mm_load_ps(inX + index);
+            __m128 componentY = _mm_load_ps(inY + index);
+            __m128 componentZ = _mm_load_ps(inZ + index);
+            if constexpr (kAoSComponentCount == 4)
+            {
+                __m128 componentW;
+                if constexpr (ComponentCount == 4)
+                {
+                    componentW = _mm_load_ps(w() + index);
+                }
+                else
+                {
+                    componentW = _mm_set1_ps(fillValue);
+                }
+                Simd::transpose4(componentX, componentY, componentZ, componentW);
+                _mm_store_ps(output[index + 0]._f, componentX);
+                _mm_store_ps(output[index + 1]._f, componentY);
+                _mm_store_ps(output[index + 2]._f, componentZ);
+                _mm_store_ps(output[index + 3]._f, componentW);
+            }
+            else
+            {
+                __m128 a;
+                __m128 b;
+                __m128 c;
+                Simd::interleave3(componentX, componentY, componentZ, a, b, c);
+                float* const destination = &output[index]._x;
+                _mm_storeu_ps(destination + 0, a);
+                _mm_storeu_ps(destination + 4, b);
+                _mm_storeu_ps(destination + 8, c);
+            }
+        }
+#endif
+        for (; index < _size; ++index)
+        {
+            for (uint32 componentIndex = 0; componentIndex < kAoSComponentCount; ++componentIndex)
+            {
+                output[index][componentIndex] = (componentIndex < ComponentCount) ? _rawPointer[_capacity * componentIndex + index] : fillValue;
+            }
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::computeLengths(float* const output) const noexcept
+    {
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + Simd::kWideLaneCount <= _size; index += Simd::kWideLaneCount)
+        {
+            Simd::Wide lengthSquared = Simd::wideSet(0.0f);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                const Simd::Wide value = Simd::wideLoad(component(componentIndex) + index);
+                lengthSquared = Simd::wideMultiplyAdd(value, value, lengthSquared);
+            }
+            Simd::wideStoreUnaligned(output + index, Simd::wideSqrt(lengthSquared));
+        }
+#endif
+        for (; index < _size; ++index)
+        {
+            float lengthSquared = 0.0f;
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                const float value = _rawPointer[_capacity * componentIndex + index];
+                lengthSquared += value * value;
+            }
+            output[index] = ::sqrt(lengthSquared);
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::normalize() noexcept
+    {
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + Simd::kWideLaneCount <= _size; index += Simd::kWideLaneCount)
+        {
+            Simd::Wide values[ComponentCount];
+            Simd::Wide lengthSquared = Simd::wideSet(0.0f);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                values[componentIndex] = Simd::wideLoad(component(componentIndex) + index);
+                lengthSquared = Simd::wideMultiplyAdd(values[componentIndex], values[componentIndex], lengthSquared);
+            }
+            const Simd::Wide length = Simd::wideSqrt(lengthSquared);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                Simd::wideStore(component(componentIndex) + index, Simd::wideDiv(values[componentIndex], length));
+            }
+        }
+#endif
+        for (; index < _size; ++index)
+        {
+            float lengthSquared = 0.0f;
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                const float value = _rawPointer[_capacity * componentIndex + index];
+                lengthSquared += value * value;
+            }
+            const float length = ::sqrt(lengthSquared);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                _rawPointer[_capacity * componentIndex + index] /= length;
+            }
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::dot(const FloatSoA& lhs, const FloatSoA& rhs, float* const output) noexcept
+    {
+        MINT_ASSERT("김장원", lhs._size == rhs._size, "두 FloatSoA 의 크기가 같아야 합니다.");
+
+        const uint32 size = lhs._size;
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + Simd::kWideLaneCount <= size; index += Simd::kWideLaneCount)
+        {
+            Simd::Wide result = Simd::wideSet(0.0f);
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                result = Simd::wideMultiplyAdd(Simd::wideLoad(lhs.component(componentIndex) + index), Simd::wideLoad(rhs.component(componentIndex) + index), result);
+            }
+            Simd::wideStoreUnaligned(output + index, result);
+        }
+#endif
+        for (; index < size; ++index)
+        {
+            float result = 0.0f;
+            for (uint32 componentIndex = 0; componentIndex < ComponentCount; ++componentIndex)
+            {
+                result += lhs._rawPointer[lhs._capacity * componentIndex + index] * rhs._rawPointer[rhs._capacity * componentIndex + index];
+            }
+            output[index] = result;
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline void FloatSoA<ComponentCount>::cross(const FloatSoA& lhs, const FloatSoA& rhs, FloatSoA& output) noexcept
+    {
+        static_assert(ComponentCount == 3, "cross() is only for Float3SoA!");
+        MINT_ASSERT("김장원", lhs._size == rhs._size, "두 FloatSoA 의 크기가 같아야 합니다.");
+
+        const uint32 size = lhs._size;
+        output.resize(size);
+        const float* const lx = lhs.x();
+        const float* const ly = lhs.y();
+        const float* const lz = lhs.z();
+        const float* const rx = rhs.x();
+        const float* const ry = rhs.y();
+        const float* const rz = rhs.z();
+        float* const ox = output.x();
+        float* const oy = output.y();
+        float* const oz = output.z();
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        for (; index + Simd::kWideLaneCount <= size; index += Simd::kWideLaneCount)
+        {
+            const Simd::Wide lX = Simd::wideLoad(lx + index);
+            const Simd::Wide lY = Simd::wideLoad(ly + index);
+            const Simd::Wide lZ = Simd::wideLoad(lz + index);
+            const Simd::Wide rX = Simd::wideLoad(rx + index);
+            const Simd::Wide rY = Simd::wideLoad(ry + index);
+            const Simd::Wide rZ = Simd::wideLoad(rz + index);
+            // output 이 lhs 나 rhs 와 같아도 되도록 모두 load 한 뒤에 store 한다.
+            const Simd::Wide resultX = Simd::wideSub(Simd::wideMul(lY, rZ), Simd::wideMul(lZ, rY));
+            const Simd::Wide resultY = Simd::wideSub(Simd::wideMul(lZ, rX), Simd::wideMul(lX, rZ));
+            const Simd::Wide resultZ = Simd::wideSub(Simd::wideMul(lX, rY), Simd::wideMul(lY, rX));
+            Simd::wideStore(ox + index, resultX);
+            Simd::wideStore(oy + index, resultY);
+            Simd::wideStore(oz + index, resultZ);
+        }
+#endif
+        for (; index < size; ++index)
+        {
+            const float resultX = ly[index] * rz[index] - lz[index] * ry[index];
+            const float resultY = lz[index] * rx[index] - lx[index] * rz[index];
+            const float resultZ = lx[index] * ry[index] - ly[index] * rx[index];
+            ox[index] = resultX;
+            oy[index] = resultY;
+            oz[index] = resultZ;
+        }
+    }
+
+    template<uint32 ComponentCount>
+    inline const bool FloatSoA<ComponentCount>::computeAABB(Float3& outMin, Float3& outMax) const noexcept
+    {
+        if (_size == 0)
+        {
+            return false;
+        }
+
+        for (uint32 componentIndex = 0; componentIndex < 3; ++componentIndex)
+        {
+            const float* const values = component(componentIndex);
+            float minValue = values[0];
+            float maxValue = values[0];
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            if (Simd::kWideLaneCount <= _size)
+            {
+                Simd::Wide wideMinValue = Simd::wideLoad(values);
+                Simd::Wide wideMaxValue = wideMinValue;
+                for (index = Simd::kWideLaneCount; index + Simd::kWideLaneCount <= _size; index += Simd::kWideLaneCount)
+                {
+                    const Simd::Wide value = Simd::wideLoad(values + index);
+                    wideMinValue = Simd::wideMin(wideMinValue, value);
+                    wideMaxValue = Simd::wideMax(wideMaxValue, value);
+                }
+                minValue = Simd::wideHorizontalMin(wideMinValue);
+                maxValue = Simd::wideHorizontalMax(wideMaxValue);
+            }
+#endif
+            for (; index < _size; ++index)
+            {
+                minValue = mint::min(minValue, values[index]);
+                maxValue = mint::max(maxValue, values[index]);
+            }
+            outMin[componentIndex] = minValue;
+            outMax[componentIndex] = maxValue;
+        }
+        return true;
+    }
+
+    template<uint32 ComponentCount>
+    inline const bool FloatSoA<ComponentCount>::computeBoundingSphere(Float3& outCenter, float& outRadius) const noexcept
+    {
+        Float3 aabbMin;
+        Float3 aabbMax;
+        if (computeAABB(aabbMin, aabbMax) == false)
+        {
+            return false;
+        }
+
+        outCenter = (aabbMin + aabbMax) * 0.5f;
+
+        const float* const inX = x();
+        const float* const inY = y();
+        const float* const inZ = z();
+        float maxDistanceSquared = 0.0f;
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        if (Simd::kWideLaneCount <= _size)
+        {
+            const Simd::Wide centerX = Simd::wideSet(outCenter._x);
+            const Simd::Wide centerY = Simd::wideSet(outCenter._y);
+            const Simd::Wide centerZ = Simd::wideSet(outCenter._z);
+            Simd::Wide wideMaxDistanceSquared = Simd::wideSet(0.0f);
+            for (; index + Simd::kWideLaneCount <= _size; index += Simd::kWideLaneCount)
+            {
+                const Simd::Wide dx = Simd::wideSub(Simd::wideLoad(inX + index), centerX);
+                const Simd::Wide dy = Simd::wideSub(Simd::wideLoad(inY + index), centerY);
+                const Simd::Wide dz = Simd::wideSub(Simd::wideLoad(inZ + index), centerZ);
+                const Simd::Wide distanceSquared = Simd::wideMultiplyAdd(dz, dz, Simd::wideMultiplyAdd(dy, dy, Simd::wideMul(dx, dx)));
+                wideMaxDistanceSquared = Simd::wideMax(wideMaxDistanceSquared, distanceSquared);
+            }
+            maxDistanceSquared = Simd::wideHorizontalMax(wideMaxDistanceSquared);
+        }
+#endif
+        for (; index < _size; ++index)
+        {
+            const float dx = inX[index] - outCenter._x;
+            const float dy = inY[index] - outCenter._y;
+            const float dz = inZ[index] - outCenter._z;
+            maxDistanceSquared = mint::max(maxDistanceSquared, dx * dx + dy * dy + dz * dz);
+        }
+        outRadius = ::sqrt(maxDistanceSquared);
+        return true;
+    }
+}
+
+
+#endif // !MINT_FLOAT_SOA_HPP
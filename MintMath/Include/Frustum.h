@@ -0,0 +1,63 @@
+﻿#pragma once
+
+
+#ifndef MINT_FRUSTUM_H
+#define MINT_FRUSTUM_H
+
+
+#include <MintMath/Include/Plane.h>
+#include <MintMath/Include/BoundingSphere.h>
+
+
+namespace mint
+{
+    // 6 개의 평면으로 이루어진 view frustum. 모든 평면의 normal 은 안쪽을 향한다.
+    class Frustum final
+    {
+    public:
+        enum class PlaneIndex : uint32
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            COUNT
+        };
+
+        static constexpr uint32 kPlaneCount = static_cast<uint32>(PlaneIndex::COUNT);
+
+    public:
+        // Column vector 기준의 (projection * view) 행렬에서 평면을 뽑는다. (Gribb-Hartmann)
+        // Clip space z 는 [0, 1] 범위라고 가정한다. (Float4x4::projectionMatrixPerspective)
+        static Frustum          fromViewProjectionMatrix(const mint::Float4x4& viewProjectionMatrix) noexcept;
+
+    public:
+                                Frustum()                           = default;
+                                Frustum(const Frustum& rhs)         = default;
+                                Frustum(Frustum&& rhs) noexcept     = default;
+                                ~Frustum()                          = default;
+
+    public:
+        Frustum&                operator=(const Frustum& rhs)       = default;
+        Frustum&                operator=(Frustum&& rhs) noexcept   = default;
+
+    public:
+        const Plane&            getPlane(const PlaneIndex planeIndex) const noexcept;
+
+    public:
+        const bool              contains(const mint::Float3& point) const noexcept;
+        // 아래 교차 판정은 보수적이다. (frustum 모서리 바깥에 있는 물체를 보인다고 판정할 수 있다)
+        const bool              intersects(const AABB& aabb) const noexcept;
+        const bool              intersects(const BoundingSphere& sphere) const noexcept;
+        // outIsVisible[i] = intersects(aabbs[i]) 를 4 개씩 SIMD 로 계산하고, 보이는 AABB 의 개수를 반환한다.
+        const uint32            cullAABBs(const AABB* const aabbs, const uint32 count, bool* const outIsVisible) const noexcept;
+
+    public:
+        Plane                   _planes[kPlaneCount];
+    };
+}
+
+
+#endif // !MINT_FRUSTUM_H
@@ -6,6 +6,7 @@
 
 
 #include <cmath>
+#include <utility>
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
@@ -111,6 +112,44 @@ namespace mint
         {
             return (::abs(a - b) < epsilon);
         }
+
+        template<typename T>
+        MINT_INLINE constexpr const T absolute(const T value) noexcept
+        {
+            return (value < static_cast<T>(0)) ? -value : value;
+        }
+
+        template<typename Function, int32... Indices>
+        MINT_INLINE constexpr void unrollInternal(Function& function, std::integer_sequence<int32, Indices...>) noexcept
+        {
+            (function(Indices), ...);
+        }
+
+        // function(0), function(1), ..., function(Count - 1) 을 반복문 없이 펼쳐서 호출한다.
+        template<int32 Count, typename Function>
+        MINT_INLINE constexpr void unroll(Function&& function) noexcept
+        {
+            unrollInternal(function, std::make_integer_sequence<int32, Count>{});
+        }
+
+        static constexpr int32 kMaxUnrollCount = 8;
+
+        // Count 가 kMaxUnrollCount 이하면 unroll 하고, 그보다 크면 평범한 반복문으로 function(index) 를 호출한다.
+        template<int32 Count, typename Function>
+        MINT_INLINE constexpr void staticFor(Function&& function) noexcept
+        {
+            if constexpr (Count <= kMaxUnrollCount)
+            {
+                unrollInternal(function, std::make_integer_sequence<int32, Count>{});
+            }
+            else
+            {
+                for (int32 index = 0; index < Count; ++index)
+                {
+                    function(index);
+                }
+            }
+        }
     }
 }
 
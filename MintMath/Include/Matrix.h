@@ -7,94 +7,129 @@
 
 #include <MintCommon/Include/CommonDefinitions.h>
 
+#include <initializer_list>
+#include <type_traits>
+
 
 namespace mint
 {
     namespace Math
     {
-        template <int32 N>
+        template <int32 N, typename T>
         class VectorR;
 
 
-        template <int32 M, int32 N>
+        // T is the storage type (double by default, float for SIMD-friendly small solvers).
+        // Loops over sizes up to kMaxUnrollCount are fully unrolled, and float matrices whose row length is a multiple of 4 use SIMD kernels at run time.
+        // Everything except factorizeCholesky() is constexpr-evaluable.
+        template <int32 M, int32 N, typename T = double>
         class Matrix
         {
             static_assert(0 < M, "M must be greater than 0!");
             static_assert(0 < N, "N must be greater than 0!");
+            static_assert(std::is_floating_point<T>::value, "T must be a floating point type!");
+
+            template <int32 M_, int32 N_, typename T_>
+            friend class Matrix;
 
         public:
-                                    Matrix();
-                                    ~Matrix();
+            using ValueType         = T;
 
         public:
-            const bool              operator==(const Matrix& rhs) const noexcept;
-            const bool              operator!=(const Matrix& rhs) const noexcept;
+            constexpr               Matrix();
+            // Row-major order
+            constexpr               Matrix(const std::initializer_list<T>& initializerList);
+                                    ~Matrix() = default;
 
         public:
-            Matrix&                 operator*=(const double scalar) noexcept;
-            Matrix&                 operator/=(const double scalar) noexcept;
-            Matrix&                 operator+=(const Matrix& rhs) noexcept;
-            Matrix&                 operator-=(const Matrix& rhs) noexcept;
-            Matrix&                 operator*=(const Matrix<N, N>& rhs) noexcept;
+            constexpr const bool    operator==(const Matrix& rhs) const noexcept;
+            constexpr const bool    operator!=(const Matrix& rhs) const noexcept;
 
         public:
-            Matrix                  operator*(const double scalar) noexcept;
-            Matrix                  operator/(const double scalar) noexcept;
-            Matrix                  operator+(const Matrix& rhs) noexcept;
-            Matrix                  operator-(const Matrix& rhs) noexcept;
+            constexpr Matrix&       operator*=(const T scalar) noexcept;
+            constexpr Matrix&       operator/=(const T scalar) noexcept;
+            constexpr Matrix&       operator+=(const Matrix& rhs) noexcept;
+            constexpr Matrix&       operator-=(const Matrix& rhs) noexcept;
+            constexpr Matrix&       operator*=(const Matrix<N, N, T>& rhs) noexcept;
+
+        public:
+            constexpr Matrix        operator*(const T scalar) const noexcept;
+            constexpr Matrix        operator/(const T scalar) const noexcept;
+            constexpr Matrix        operator+(const Matrix& rhs) const noexcept;
+            constexpr Matrix        operator-(const Matrix& rhs) const noexcept;
 
         public:
             template <int32 P>
-            Matrix<M, P>            operator*(const Matrix<N, P>& rhs) const noexcept;
+            constexpr Matrix<M, P, T>   operator*(const Matrix<N, P, T>& rhs) const noexcept;
 
         public:
-            void                    setElement(const uint32 rowIndex, const uint32 columnIndex, const double value) noexcept;
-            const double            getElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept;
-            void                    setRow(const uint32 rowIndex, const VectorR<N>& row) noexcept;
-            VectorR<N>              getRow(const uint32 rowIndex) const noexcept;
-            void                    setColumn(const uint32 columnIndex, const VectorR<M>& column) noexcept;
-            VectorR<M>              getColumn(const uint32 columnIndex) const noexcept;
+            constexpr void          setElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept;
+            constexpr const T       getElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept;
+            constexpr void          setRow(const uint32 rowIndex, const VectorR<N, T>& row) noexcept;
+            constexpr VectorR<N, T> getRow(const uint32 rowIndex) const noexcept;
+            constexpr void          setColumn(const uint32 columnIndex, const VectorR<M, T>& column) noexcept;
+            constexpr VectorR<M, T> getColumn(const uint32 columnIndex) const noexcept;
 
         public:
-            VectorR<N>              multiplyRowVector(const VectorR<M>& rowVector) const noexcept;
-            VectorR<M>              multiplyColumnVector(const VectorR<N>& columnVector) const noexcept;
+            constexpr VectorR<N, T> multiplyRowVector(const VectorR<M, T>& rowVector) const noexcept;
+            constexpr VectorR<M, T> multiplyColumnVector(const VectorR<N, T>& columnVector) const noexcept;
 
         public:
-            Matrix<N, M>            transpose() const noexcept;
-            const double            trace() const noexcept;
+            constexpr Matrix<N, M, T>   transpose() const noexcept;
+            constexpr const T       trace() const noexcept;
 
         public:
-            void                    factorizeLu(Matrix<N, N>& l, Matrix<N, N>& u) const noexcept;
+            // Square matrix only. LU decomposition with partial pivoting: P * A = L * U
+            // rowPermutation[i] is the row of A which became the i-th row. Returns false if the matrix is singular.
+            constexpr const bool    factorizeLu(Matrix<N, N, T>& l, Matrix<N, N, T>& u, int32 (&rowPermutation)[N]) const noexcept;
+            // Square matrix only. Solves A * x = b. Returns false if the matrix is singular.
+            constexpr const bool    solve(const VectorR<N, T>& b, VectorR<N, T>& x) const noexcept;
+            // Square matrix only. Returns false if the matrix is singular.
+            constexpr const bool    inverse(Matrix<N, N, T>& outInverse) const noexcept;
+            // Square matrix only.
+            constexpr const T       determinant() const noexcept;
+            // Symmetric positive-definite matrix only: A = L * transpose(L)
+            // Returns false if the matrix is not positive-definite.
+            const bool              factorizeCholesky(Matrix<N, N, T>& l) const noexcept;
+
+        private:
+            // In-place compact LU (unit diagonal of L is not stored). Returns false if the matrix is singular.
+            constexpr const bool    factorizeLuInternal(Matrix<N, N, T>& inoutLu, int32 (&rowPermutation)[N], int32& swapCount) const noexcept;
+            static constexpr void   solveLuInternal(const Matrix<N, N, T>& lu, const int32 (&rowPermutation)[N], const VectorR<N, T>& b, VectorR<N, T>& x) noexcept;
 
         public:
             constexpr const bool    isSquareMatrix() const noexcept;
-            const bool              isDiagonalMatrix() const noexcept;
-            const bool              isScalarMatrix() const noexcept;
-            const bool              isIdentityMatrix() const noexcept;
-            const bool              isZeroMatrix() const noexcept;
-            const bool              isSymmetricMatrix() const noexcept;
-            const bool              isSkewSymmetricMatrix() const noexcept;
-            const bool              isUpperTriangularMatrix() const noexcept;
-            const bool              isIdempotentMatrix() const noexcept;
-
-            void                    setIdentity() noexcept;
-            void                    setZero() noexcept;
+            constexpr const bool    isDiagonalMatrix() const noexcept;
+            constexpr const bool    isScalarMatrix() const noexcept;
+            constexpr const bool    isIdentityMatrix() const noexcept;
+            constexpr const bool    isZeroMatrix() const noexcept;
+            constexpr const bool    isSymmetricMatrix() const noexcept;
+            constexpr const bool    isSkewSymmetricMatrix() const noexcept;
+            constexpr const bool    isUpperTriangularMatrix() const noexcept;
+            constexpr const bool    isIdempotentMatrix() const noexcept;
+
+            constexpr void          setIdentity() noexcept;
+            constexpr void          setZero() noexcept;
 
         private:
-            double                  _m[M][N];
+            T                       _m[M][N];
         };
 
 
-        template <int32 M, int32 N>
-        Matrix<M, N>                operator*(const double scalar, const Matrix<M, N>& matrix) noexcept;
+        template <int32 M, int32 N, typename T>
+        constexpr Matrix<M, N, T>   operator*(const typename Matrix<M, N, T>::ValueType scalar, const Matrix<M, N, T>& matrix) noexcept;
         
         // Row vector multiplication
-        template <int32 M, int32 N>
-        VectorR<N>                  operator*(const VectorR<M>& rowVector, const Matrix<M, N>& matrix) noexcept;
+        template <int32 M, int32 N, typename T>
+        constexpr VectorR<N, T>     operator*(const VectorR<M, T>& rowVector, const Matrix<M, N, T>& matrix) noexcept;
 
         // Column vector multiplication
+        template <int32 M, int32 N, typename T>
+        constexpr VectorR<M, T>     operator*(const Matrix<M, N, T>& matrix, const VectorR<N, T>& columnVector) noexcept;
+
+
         template <int32 M, int32 N>
-        VectorR<M>                  operator*(const Matrix<M, N>& matrix, const VectorR<N>& columnVector) noexcept;
+        using Matrixf               = Matrix<M, N, float>;
     }
 }
 
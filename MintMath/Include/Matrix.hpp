@@ -3,28 +3,39 @@
 
 #include <MintMath/Include/Matrix.h>
 
+#include <MintMath/Include/MathCommon.h>
+#include <MintMath/Include/SimdCommon.h>
+
 #include <MintMath/Include/VectorR.hpp>
 
+#include <limits>
+
 
 namespace mint
 {
     namespace Math
     {
-        template<int32 M, int32 N>
-        inline Matrix<M, N>::Matrix()
+        template<int32 M, int32 N, typename T>
+        inline constexpr Matrix<M, N, T>::Matrix()
             : _m{}
         {
             __noop;
         }
 
-        template<int32 M, int32 N>
-        inline Matrix<M, N>::~Matrix()
+        template<int32 M, int32 N, typename T>
+        inline constexpr Matrix<M, N, T>::Matrix(const std::initializer_list<T>& initializerList)
+            : _m{}
         {
-            __noop;
+            const int32 count = mint::min(static_cast<int32>(initializerList.size()), M * N);
+            const T* const first = initializerList.begin();
+            for (int32 index = 0; index < count; ++index)
+            {
+                _m[index / N][index % N] = *(first + index);
+            }
         }
 
-        template<int32 M, int32 N>
-        inline const bool Matrix<M, N>::operator==(const Matrix& rhs) const noexcept
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::operator==(const Matrix& rhs) const noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
@@ -39,130 +50,133 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        inline const bool Matrix<M, N>::operator!=(const Matrix& rhs) const noexcept
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::operator!=(const Matrix& rhs) const noexcept
         {
             return !(*this == rhs);
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N>& Matrix<M, N>::operator*=(const double scalar) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const T scalar) noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] *= scalar;
-                }
+                staticFor<N>([&](const int32 columnIndex) { _m[rowIndex][columnIndex] *= scalar; });
             }
             return *this;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N>& Matrix<M, N>::operator/=(const double scalar) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator/=(const T scalar) noexcept
         {
-            MINT_ASSERT("", scalar != 0.0, "0   մϴ!");
+            MINT_ASSERT("", scalar != static_cast<T>(0), "0   մϴ!");
 
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] /= scalar;
-                }
+                staticFor<N>([&](const int32 columnIndex) { _m[rowIndex][columnIndex] /= scalar; });
             }
             return *this;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N>& Matrix<M, N>::operator+=(const Matrix& rhs) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator+=(const Matrix& rhs) noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] += rhs._m[rowIndex][columnIndex];
-                }
+                staticFor<N>([&](const int32 columnIndex) { _m[rowIndex][columnIndex] += rhs._m[rowIndex][columnIndex]; });
             }
             return *this;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N>& Matrix<M, N>::operator-=(const Matrix& rhs) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator-=(const Matrix& rhs) noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] -= rhs._m[rowIndex][columnIndex];
-                }
+                staticFor<N>([&](const int32 columnIndex) { _m[rowIndex][columnIndex] -= rhs._m[rowIndex][columnIndex]; });
             }
             return *this;
         }
 
-        template<int32 M, int32 N>
-        inline Matrix<M, N>& Matrix<M, N>::operator*=(const Matrix<N, N>& rhs) noexcept
+        template<int32 M, int32 N, typename T>
+        inline constexpr Matrix<M, N, T>& Matrix<M, N, T>::operator*=(const Matrix<N, N, T>& rhs) noexcept
         {
             static_assert(M == N, "Power of non-square matrix!!!");
 
-            for (int32 rowIndex = 0; rowIndex < N; ++rowIndex)
-            {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] = mint::Math::VectorR<N>::dot(getRow(rowIndex), rhs.getColumn(columnIndex));
-                }
-            }
+            *this = *this * rhs;
             return *this;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N> Matrix<M, N>::operator*(const double scalar) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator*(const T scalar) const noexcept
         {
             Matrix result = *this;
             result *= scalar;
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N> Matrix<M, N>::operator/(const double scalar) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator/(const T scalar) const noexcept
         {
             Matrix result = *this;
             result /= scalar;
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N> Matrix<M, N>::operator+(const Matrix& rhs) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator+(const Matrix& rhs) const noexcept
         {
             Matrix result = *this;
             result += rhs;
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N> Matrix<M, N>::operator-(const Matrix& rhs) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T> Matrix<M, N, T>::operator-(const Matrix& rhs) const noexcept
         {
             Matrix result = *this;
             result -= rhs;
             return result;
         }
 
-        template<int32 M, int32 N>
+        template<int32 M, int32 N, typename T>
         template<int32 P>
-        MINT_INLINE Matrix<M, P> Matrix<M, N>::operator*(const Matrix<N, P>& rhs) const noexcept
+        MINT_INLINE constexpr Matrix<M, P, T> Matrix<M, N, T>::operator*(const Matrix<N, P, T>& rhs) const noexcept
         {
-            Matrix<M, P> result;
-            for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
+            Matrix<M, P, T> result;
+#if defined MINT_MATH_USE_SIMD
+            if constexpr (std::is_same<T, float>::value == true && (P % 4) == 0)
             {
-                for (int32 columnIndex = 0; columnIndex < P; ++columnIndex)
+                if (MINT_IS_CONSTANT_EVALUATED() == false)
                 {
-                    result._m[rowIndex][columnIndex] = mint::Math::VectorR<N>::dot(getRow(rowIndex), rhs.getColumn(columnIndex));
+                    // result  row =  (this  (row, k)  * rhs  k ° row)
+                    for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
+                    {
+                        staticFor<P / 4>([&](const int32 blockIndex)
+                            {
+                                __m128 sum = _mm_setzero_ps();
+                                staticFor<N>([&](const int32 k) { sum = Simd::multiplyAdd(_mm_set1_ps(_m[rowIndex][k]), _mm_loadu_ps(&rhs._m[k][blockIndex * 4]), sum); });
+                                _mm_storeu_ps(&result._m[rowIndex][blockIndex * 4], sum);
+                            });
+                    }
+                    return result;
                 }
             }
+#endif
+            for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
+            {
+                staticFor<P>([&](const int32 columnIndex)
+                    {
+                        T sum = 0;
+                        staticFor<N>([&](const int32 k) { sum += _m[rowIndex][k] * rhs._m[k][columnIndex]; });
+                        result._m[rowIndex][columnIndex] = sum;
+                    });
+            }
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE void Matrix<M, N>::setElement(const uint32 rowIndex, const uint32 columnIndex, const double value) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr void Matrix<M, N, T>::setElement(const uint32 rowIndex, const uint32 columnIndex, const T value) noexcept
         {
             if (rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N))
             {
@@ -170,108 +184,129 @@ namespace mint
             }
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const double Matrix<M, N>::getElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const T Matrix<M, N, T>::getElement(const uint32 rowIndex, const uint32 columnIndex) const noexcept
         {
             MINT_ASSERT("", (rowIndex < static_cast<uint32>(M) && columnIndex < static_cast<uint32>(N)), "  Դϴ!");
             return _m[rowIndex][columnIndex];
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE void Matrix<M, N>::setRow(const uint32 rowIndex, const VectorR<N>& row) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr void Matrix<M, N, T>::setRow(const uint32 rowIndex, const VectorR<N, T>& row) noexcept
         {
             if (rowIndex < static_cast<uint32>(M))
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    _m[rowIndex][columnIndex] = row[columnIndex];
-                }
+                staticFor<N>([&](const int32 columnIndex) { _m[rowIndex][columnIndex] = row._c[columnIndex]; });
             }
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<N> Matrix<M, N>::getRow(const uint32 rowIndex) const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> Matrix<M, N, T>::getRow(const uint32 rowIndex) const noexcept
         {
             MINT_ASSERT("", rowIndex < static_cast<uint32>(M), "  Դϴ!");
 
-            VectorR<N> result;
-            for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-            {
-                result[columnIndex] = _m[rowIndex][columnIndex];
-            }
+            VectorR<N, T> result;
+            staticFor<N>([&](const int32 columnIndex) { result._c[columnIndex] = _m[rowIndex][columnIndex]; });
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE void Matrix<M, N>::setColumn(const uint32 columnIndex, const VectorR<M>& column) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr void Matrix<M, N, T>::setColumn(const uint32 columnIndex, const VectorR<M, T>& column) noexcept
         {
             if (columnIndex < static_cast<uint32>(N))
             {
-                for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
-                {
-                    _m[rowIndex][columnIndex] = column[rowIndex];
-                }
+                staticFor<M>([&](const int32 rowIndex) { _m[rowIndex][columnIndex] = column._c[rowIndex]; });
             }
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<M> Matrix<M, N>::getColumn(const uint32 columnIndex) const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<M, T> Matrix<M, N, T>::getColumn(const uint32 columnIndex) const noexcept
         {
             MINT_ASSERT("", columnIndex < static_cast<uint32>(N), "  Դϴ!");
 
-            VectorR<M> result;
-            for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
-            {
-                result[rowIndex] = _m[rowIndex][columnIndex];
-            }
+            VectorR<M, T> result;
+            staticFor<M>([&](const int32 rowIndex) { result._c[rowIndex] = _m[rowIndex][columnIndex]; });
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<N> Matrix<M, N>::multiplyRowVector(const VectorR<M>& rowVector) const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> Matrix<M, N, T>::multiplyRowVector(const VectorR<M, T>& rowVector) const noexcept
         {
-            VectorR<N> result;
-            for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
+            VectorR<N, T> result;
+#if defined MINT_MATH_USE_SIMD
+            if constexpr (std::is_same<T, float>::value == true && (N % 4) == 0)
             {
-                result += getRow(rowIndex) * rowVector[rowIndex];
+                if (MINT_IS_CONSTANT_EVALUATED() == false)
+                {
+                    staticFor<N / 4>([&](const int32 blockIndex)
+                        {
+                            __m128 sum = _mm_setzero_ps();
+                            staticFor<M>([&](const int32 rowIndex) { sum = Simd::multiplyAdd(_mm_set1_ps(rowVector._c[rowIndex]), _mm_loadu_ps(&_m[rowIndex][blockIndex * 4]), sum); });
+                            _mm_storeu_ps(&result._c[blockIndex * 4], sum);
+                        });
+                    return result;
+                }
             }
+#endif
+            staticFor<N>([&](const int32 columnIndex)
+                {
+                    T sum = 0;
+                    staticFor<M>([&](const int32 rowIndex) { sum += rowVector._c[rowIndex] * _m[rowIndex][columnIndex]; });
+                    result._c[columnIndex] = sum;
+                });
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<M> Matrix<M, N>::multiplyColumnVector(const VectorR<N>& columnVector) const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<M, T> Matrix<M, N, T>::multiplyColumnVector(const VectorR<N, T>& columnVector) const noexcept
         {
-            VectorR<M> result;
-            for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+            VectorR<M, T> result;
+#if defined MINT_MATH_USE_SIMD
+            if constexpr (std::is_same<T, float>::value == true && (N % 4) == 0)
             {
-                result += getColumn(columnIndex) * columnVector[columnIndex];
+                if (MINT_IS_CONSTANT_EVALUATED() == false)
+                {
+                    staticFor<M>([&](const int32 rowIndex)
+                        {
+                            __m128 sum = _mm_setzero_ps();
+                            staticFor<N / 4>([&](const int32 blockIndex) { sum = Simd::multiplyAdd(_mm_loadu_ps(&_m[rowIndex][blockIndex * 4]), _mm_loadu_ps(&columnVector._c[blockIndex * 4]), sum); });
+                            sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+                            sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+                            result._c[rowIndex] = _mm_cvtss_f32(sum);
+                        });
+                    return result;
+                }
             }
+#endif
+            staticFor<M>([&](const int32 rowIndex)
+                {
+                    T sum = 0;
+                    staticFor<N>([&](const int32 columnIndex) { sum += _m[rowIndex][columnIndex] * columnVector._c[columnIndex]; });
+                    result._c[rowIndex] = sum;
+                });
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<N, M> Matrix<M, N>::transpose() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<N, M, T> Matrix<M, N, T>::transpose() const noexcept
         {
-            Matrix<N, M> result;
+            Matrix<N, M, T> result;
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
-                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
-                {
-                    result.setElement(columnIndex, rowIndex, _m[rowIndex][columnIndex]);
-                }
+                staticFor<N>([&](const int32 columnIndex) { result._m[columnIndex][rowIndex] = _m[rowIndex][columnIndex]; });
             }
             return result;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const double Matrix<M, N>::trace() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const T Matrix<M, N, T>::trace() const noexcept
         {
             if (isSquareMatrix() == false)
             {
                 MINT_LOG_ERROR("", "Tried to calculate trace from a non-square matrix!");
             }
 
-            double trace = 0.0;
+            T trace = 0;
             const int32 safeSize = mint::min(M, N);
             for (int32 index = 0; index < safeSize; ++index)
             {
@@ -280,14 +315,225 @@ namespace mint
             return trace;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE constexpr const bool Matrix<M, N>::isSquareMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::factorizeLu(Matrix<N, N, T>& l, Matrix<N, N, T>& u, int32 (&rowPermutation)[N]) const noexcept
+        {
+            Matrix<N, N, T> lu;
+            int32 swapCount = 0;
+            if (factorizeLuInternal(lu, rowPermutation, swapCount) == false)
+            {
+                return false;
+            }
+
+            for (int32 rowIndex = 0; rowIndex < N; ++rowIndex)
+            {
+                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+                {
+                    if (columnIndex < rowIndex)
+                    {
+                        l._m[rowIndex][columnIndex] = lu._m[rowIndex][columnIndex];
+                        u._m[rowIndex][columnIndex] = 0;
+                    }
+                    else
+                    {
+                        l._m[rowIndex][columnIndex] = (columnIndex == rowIndex) ? static_cast<T>(1) : static_cast<T>(0);
+                        u._m[rowIndex][columnIndex] = lu._m[rowIndex][columnIndex];
+                    }
+                }
+            }
+            return true;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::solve(const VectorR<N, T>& b, VectorR<N, T>& x) const noexcept
+        {
+            Matrix<N, N, T> lu;
+            int32 rowPermutation[N]{};
+            int32 swapCount = 0;
+            if (factorizeLuInternal(lu, rowPermutation, swapCount) == false)
+            {
+                return false;
+            }
+
+            solveLuInternal(lu, rowPermutation, b, x);
+            return true;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::inverse(Matrix<N, N, T>& outInverse) const noexcept
+        {
+            Matrix<N, N, T> lu;
+            int32 rowPermutation[N]{};
+            int32 swapCount = 0;
+            if (factorizeLuInternal(lu, rowPermutation, swapCount) == false)
+            {
+                return false;
+            }
+
+            // ش   ϰ  A * x = e  Ǭ.
+            for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+            {
+                VectorR<N, T> e;
+                e._c[columnIndex] = static_cast<T>(1);
+                VectorR<N, T> column;
+                solveLuInternal(lu, rowPermutation, e, column);
+                outInverse.setColumn(columnIndex, column);
+            }
+            return true;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline constexpr const T Matrix<M, N, T>::determinant() const noexcept
+        {
+            Matrix<N, N, T> lu;
+            int32 rowPermutation[N]{};
+            int32 swapCount = 0;
+            if (factorizeLuInternal(lu, rowPermutation, swapCount) == false)
+            {
+                return static_cast<T>(0);
+            }
+
+            T result = ((swapCount % 2) == 0) ? static_cast<T>(1) : static_cast<T>(-1);
+            staticFor<N>([&](const int32 index) { result *= lu._m[index][index]; });
+            return result;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline const bool Matrix<M, N, T>::factorizeCholesky(Matrix<N, N, T>& l) const noexcept
+        {
+            static_assert(M == N, "Cholesky decomposition of non-square matrix!!!");
+
+            // Ʒ ﰢ κи ϹǷ Ī Ȯ ʴ´.
+            l.setZero();
+            for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+            {
+                T diagonal = _m[columnIndex][columnIndex];
+                for (int32 k = 0; k < columnIndex; ++k)
+                {
+                    diagonal -= l._m[columnIndex][k] * l._m[columnIndex][k];
+                }
+                if (diagonal <= static_cast<T>(0))
+                {
+                    return false;
+                }
+
+                const T lDiagonal = ::sqrt(diagonal);
+                l._m[columnIndex][columnIndex] = lDiagonal;
+                for (int32 rowIndex = columnIndex + 1; rowIndex < N; ++rowIndex)
+                {
+                    T sum = _m[rowIndex][columnIndex];
+                    for (int32 k = 0; k < columnIndex; ++k)
+                    {
+                        sum -= l._m[rowIndex][k] * l._m[columnIndex][k];
+                    }
+                    l._m[rowIndex][columnIndex] = sum / lDiagonal;
+                }
+            }
+            return true;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline constexpr const bool Matrix<M, N, T>::factorizeLuInternal(Matrix<N, N, T>& inoutLu, int32 (&rowPermutation)[N], int32& swapCount) const noexcept
+        {
+            static_assert(M == N, "LU decomposition of non-square matrix!!!");
+
+            inoutLu = *this;
+            swapCount = 0;
+
+            T maxAbsolute = 0;
+            for (int32 rowIndex = 0; rowIndex < N; ++rowIndex)
+            {
+                rowPermutation[rowIndex] = rowIndex;
+                for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+                {
+                    maxAbsolute = mint::max(maxAbsolute, absolute(_m[rowIndex][columnIndex]));
+                }
+            }
+            const T tolerance = maxAbsolute * std::numeric_limits<T>::epsilon() * static_cast<T>(N);
+
+            for (int32 k = 0; k < N; ++k)
+            {
+                // Partial pivoting:   ū   row  pivot  ´.
+                int32 pivotRowIndex = k;
+                T pivotAbsolute = absolute(inoutLu._m[k][k]);
+                for (int32 rowIndex = k + 1; rowIndex < N; ++rowIndex)
+                {
+                    const T candidateAbsolute = absolute(inoutLu._m[rowIndex][k]);
+                    if (pivotAbsolute < candidateAbsolute)
+                    {
+                        pivotAbsolute = candidateAbsolute;
+                        pivotRowIndex = rowIndex;
+                    }
+                }
+                if (pivotAbsolute <= tolerance)
+                {
+                    return false;
+                }
+
+                if (pivotRowIndex != k)
+                {
+                    for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
+                    {
+                        const T temp = inoutLu._m[k][columnIndex];
+                        inoutLu._m[k][columnIndex] = inoutLu._m[pivotRowIndex][columnIndex];
+                        inoutLu._m[pivotRowIndex][columnIndex] = temp;
+                    }
+                    const int32 tempIndex = rowPermutation[k];
+                    rowPermutation[k] = rowPermutation[pivotRowIndex];
+                    rowPermutation[pivotRowIndex] = tempIndex;
+                    ++swapCount;
+                }
+
+                const T pivot = inoutLu._m[k][k];
+                for (int32 rowIndex = k + 1; rowIndex < N; ++rowIndex)
+                {
+                    const T factor = inoutLu._m[rowIndex][k] / pivot;
+                    inoutLu._m[rowIndex][k] = factor;
+                    for (int32 columnIndex = k + 1; columnIndex < N; ++columnIndex)
+                    {
+                        inoutLu._m[rowIndex][columnIndex] -= factor * inoutLu._m[k][columnIndex];
+                    }
+                }
+            }
+            return true;
+        }
+
+        template<int32 M, int32 N, typename T>
+        inline constexpr void Matrix<M, N, T>::solveLuInternal(const Matrix<N, N, T>& lu, const int32 (&rowPermutation)[N], const VectorR<N, T>& b, VectorR<N, T>& x) noexcept
+        {
+            // L * y = P * b (forward substitution)
+            VectorR<N, T> y;
+            for (int32 rowIndex = 0; rowIndex < N; ++rowIndex)
+            {
+                T sum = b._c[rowPermutation[rowIndex]];
+                for (int32 columnIndex = 0; columnIndex < rowIndex; ++columnIndex)
+                {
+                    sum -= lu._m[rowIndex][columnIndex] * y._c[columnIndex];
+                }
+                y._c[rowIndex] = sum;
+            }
+
+            // U * x = y (back substitution)
+            for (int32 rowIndex = N - 1; rowIndex >= 0; --rowIndex)
+            {
+                T sum = y._c[rowIndex];
+                for (int32 columnIndex = rowIndex + 1; columnIndex < N; ++columnIndex)
+                {
+                    sum -= lu._m[rowIndex][columnIndex] * y._c[columnIndex];
+                }
+                y._c[rowIndex] = sum / lu._m[rowIndex][rowIndex];
+            }
+            x = y;
+        }
+
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isSquareMatrix() const noexcept
         {
             return (M == N);
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isDiagonalMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isDiagonalMatrix() const noexcept
         {
             if (isSquareMatrix() == false)
             {
@@ -300,7 +546,7 @@ namespace mint
                 {
                     if (columnIndex != rowIndex)
                     {
-                        if (_m[rowIndex][columnIndex] != 0.0)
+                        if (_m[rowIndex][columnIndex] != static_cast<T>(0))
                         {
                             return false;
                         }
@@ -310,20 +556,20 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isScalarMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isScalarMatrix() const noexcept
         {
             if (isSquareMatrix() == false)
             {
                 return false;
             }
             
-            const double scale = _m[0][0];
+            const T scale = _m[0][0];
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
                 for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
                 {
-                    if (_m[rowIndex][columnIndex] != ((columnIndex == rowIndex) ? scale : 0.0))
+                    if (_m[rowIndex][columnIndex] != ((columnIndex == rowIndex) ? scale : static_cast<T>(0)))
                     {
                         return false;
                     }
@@ -332,8 +578,8 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isIdentityMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isIdentityMatrix() const noexcept
         {
             if (isSquareMatrix() == false)
             {
@@ -344,7 +590,7 @@ namespace mint
             {
                 for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
                 {
-                    if (_m[rowIndex][columnIndex] != ((columnIndex == rowIndex) ? 1.0 : 0.0))
+                    if (_m[rowIndex][columnIndex] != ((columnIndex == rowIndex) ? static_cast<T>(1) : static_cast<T>(0)))
                     {
                         return false;
                     }
@@ -353,14 +599,14 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isZeroMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isZeroMatrix() const noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
                 for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
                 {
-                    if (_m[rowIndex][columnIndex] != 0.0)
+                    if (_m[rowIndex][columnIndex] != static_cast<T>(0))
                     {
                         return false;
                     }
@@ -369,8 +615,8 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isSymmetricMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isSymmetricMatrix() const noexcept
         {
             if (false == isSquareMatrix())
             {
@@ -395,8 +641,8 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isSkewSymmetricMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isSkewSymmetricMatrix() const noexcept
         {
             if (false == isSquareMatrix())
             {
@@ -421,8 +667,8 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isUpperTriangularMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isUpperTriangularMatrix() const noexcept
         {
             if (false == isSquareMatrix())
             {
@@ -433,7 +679,7 @@ namespace mint
             {
                 for (int32 columnIndex = 0; columnIndex < rowIndex; ++columnIndex)
                 {
-                    if (_m[rowIndex][columnIndex] != 0.0)
+                    if (_m[rowIndex][columnIndex] != static_cast<T>(0))
                     {
                         return false;
                     }
@@ -443,16 +689,16 @@ namespace mint
             return true;
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE const bool Matrix<M, N>::isIdempotentMatrix() const noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr const bool Matrix<M, N, T>::isIdempotentMatrix() const noexcept
         {
-            Matrix<M, N> squared = *this;
+            Matrix<M, N, T> squared = *this;
             squared *= *this;
             return (squared == *this);
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE void Matrix<M, N>::setIdentity() noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr void Matrix<M, N, T>::setIdentity() noexcept
         {
             if (isSquareMatrix() == false)
             {
@@ -463,38 +709,38 @@ namespace mint
             {
                 for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
                 {
-                    _m[rowIndex][columnIndex] = (columnIndex == rowIndex) ? 1.0 : 0.0;
+                    _m[rowIndex][columnIndex] = (columnIndex == rowIndex) ? static_cast<T>(1) : static_cast<T>(0);
                 }
             }
         }
 
-        template<int32 M, int32 N>
-        MINT_INLINE void Matrix<M, N>::setZero() noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr void Matrix<M, N, T>::setZero() noexcept
         {
             for (int32 rowIndex = 0; rowIndex < M; ++rowIndex)
             {
                 for (int32 columnIndex = 0; columnIndex < N; ++columnIndex)
                 {
-                    _m[rowIndex][columnIndex] = 0.0;
+                    _m[rowIndex][columnIndex] = 0;
                 }
             }
         }
 
 
-        template<int32 M, int32 N>
-        MINT_INLINE Matrix<M, N> operator*(const double scalar, const Matrix<M, N>& matrix) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr Matrix<M, N, T> operator*(const typename Matrix<M, N, T>::ValueType scalar, const Matrix<M, N, T>& matrix) noexcept
         {
             return (matrix * scalar);
         }
         
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<N> operator*(const VectorR<M>& rowVector, const Matrix<M, N>& matrix) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> operator*(const VectorR<M, T>& rowVector, const Matrix<M, N, T>& matrix) noexcept
         {
             return matrix.multiplyRowVector(rowVector);
         }
         
-        template<int32 M, int32 N>
-        MINT_INLINE VectorR<M> operator*(const Matrix<M, N>& matrix, const VectorR<N>& columnVector) noexcept
+        template<int32 M, int32 N, typename T>
+        MINT_INLINE constexpr VectorR<M, T> operator*(const Matrix<M, N, T>& matrix, const VectorR<N, T>& columnVector) noexcept
         {
             return matrix.multiplyColumnVector(columnVector);
         }
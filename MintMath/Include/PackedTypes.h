@@ -0,0 +1,158 @@
+﻿#pragma once
+
+
+#ifndef MINT_PACKED_TYPES_H
+#define MINT_PACKED_TYPES_H
+
+
+#include <MintMath/Include/Float2.h>
+#include <MintMath/Include/Float3.h>
+#include <MintMath/Include/Float4.h>
+
+
+namespace mint
+{
+    // IEEE 754 binary16. float 로부터의 변환은 round-to-nearest-even 이다.
+    class Half final
+    {
+    public:
+        static Half             fromBits(const uint16 bits) noexcept;
+
+    public:
+                                Half();
+        explicit                Half(const float value);
+                                Half(const Half& rhs)           = default;
+                                Half(Half&& rhs) noexcept       = default;
+                                ~Half()                         = default;
+
+    public:
+        Half&                   operator=(const Half& rhs)      = default;
+        Half&                   operator=(Half&& rhs) noexcept  = default;
+
+    public:
+        // bit 단위로 비교한다.
+        const bool              operator==(const Half& rhs) const noexcept;
+        const bool              operator!=(const Half& rhs) const noexcept;
+
+    public:
+        const float             toFloat() const noexcept;
+        const bool              isNan() const noexcept;
+
+    public:
+        uint16                  _bits;
+    };
+
+    // DXGI_FORMAT_R16G16_FLOAT
+    class Half2 final
+    {
+    public:
+                                Half2()                         = default;
+        explicit                Half2(const mint::Float2& value);
+                                Half2(const Half2& rhs)         = default;
+                                Half2(Half2&& rhs) noexcept     = default;
+                                ~Half2()                        = default;
+
+    public:
+        Half2&                  operator=(const Half2& rhs)     = default;
+        Half2&                  operator=(Half2&& rhs) noexcept = default;
+
+    public:
+        mint::Float2            toFloat2() const noexcept;
+
+    public:
+        Half                    _x;
+        Half                    _y;
+    };
+
+    // DXGI_FORMAT_R16G16B16A16_FLOAT
+    class Half4 final
+    {
+    public:
+                                Half4()                         = default;
+        explicit                Half4(const mint::Float4& value);
+                                Half4(const Half4& rhs)         = default;
+                                Half4(Half4&& rhs) noexcept     = default;
+                                ~Half4()                        = default;
+
+    public:
+        Half4&                  operator=(const Half4& rhs)     = default;
+        Half4&                  operator=(Half4&& rhs) noexcept = default;
+
+    public:
+        mint::Float4            toFloat4() const noexcept;
+
+    public:
+        Half                    _x;
+        Half                    _y;
+        Half                    _z;
+        Half                    _w;
+    };
+
+    // DXGI_FORMAT_R8G8B8A8_UNORM. 각 성분은 [0, 1] 로 clamp 된다. (x 가 가장 낮은 byte)
+    class UNorm8x4 final
+    {
+    public:
+                                UNorm8x4();
+        explicit                UNorm8x4(const mint::Float4& value);
+                                UNorm8x4(const UNorm8x4& rhs)           = default;
+                                UNorm8x4(UNorm8x4&& rhs) noexcept       = default;
+                                ~UNorm8x4()                             = default;
+
+    public:
+        UNorm8x4&               operator=(const UNorm8x4& rhs)          = default;
+        UNorm8x4&               operator=(UNorm8x4&& rhs) noexcept      = default;
+
+    public:
+        mint::Float4            toFloat4() const noexcept;
+
+    public:
+        uint32                  _packed;
+    };
+
+    // DXGI_FORMAT_R16G16_SNORM. 각 성분은 [-1, 1] 로 clamp 된다.
+    class SNorm16x2 final
+    {
+    public:
+                                SNorm16x2();
+        explicit                SNorm16x2(const mint::Float2& value);
+                                SNorm16x2(const SNorm16x2& rhs)         = default;
+                                SNorm16x2(SNorm16x2&& rhs) noexcept     = default;
+                                ~SNorm16x2()                            = default;
+
+    public:
+        SNorm16x2&              operator=(const SNorm16x2& rhs)         = default;
+        SNorm16x2&              operator=(SNorm16x2&& rhs) noexcept     = default;
+
+    public:
+        mint::Float2            toFloat2() const noexcept;
+
+    public:
+        int16                   _x;
+        int16                   _y;
+    };
+
+
+    // Vertex data 를 압축하기 위한 변환 함수들.
+    // 배열 변환 함수는 4 개씩 SIMD 로 처리한다.
+    namespace VertexPacking
+    {
+        // 단위 normal 을 octahedral 사상으로 [-1, 1]^2 에 담는다. normal 은 0 이 아니어야 한다.
+        mint::Float2            encodeOctahedral(const mint::Float3& normal) noexcept;
+        // 반환값은 정규화되어 있다.
+        mint::Float3            decodeOctahedral(const mint::Float2& encoded) noexcept;
+        // 16-bit octahedral normal 의 각도 오차는 1e-4 rad 이하이다. (MintLibraryTest 의 testLinearAlgebra 에서 확인)
+        SNorm16x2               packNormal(const mint::Float3& normal) noexcept;
+        mint::Float3            unpackNormal(const SNorm16x2& packed) noexcept;
+
+        // Half2, Half4 배열은 성분 개수만큼 곱한 count 로 넘기면 된다.
+        void                    packHalves(const float* const input, Half* const output, const uint32 count) noexcept;
+        void                    unpackHalves(const Half* const input, float* const output, const uint32 count) noexcept;
+        void                    packUNorm8x4(const mint::Float4* const input, UNorm8x4* const output, const uint32 count) noexcept;
+        void                    unpackUNorm8x4(const UNorm8x4* const input, mint::Float4* const output, const uint32 count) noexcept;
+        void                    packNormals(const mint::Float3* const input, SNorm16x2* const output, const uint32 count) noexcept;
+        void                    unpackNormals(const SNorm16x2* const input, mint::Float3* const output, const uint32 count) noexcept;
+    }
+}
+
+
+#endif // !MINT_PACKED_TYPES_H
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+
+#ifndef MINT_PLANE_H
+#define MINT_PLANE_H
+
+
+#include <MintMath/Include/Float4.h>
+
+
+namespace mint
+{
+    // dot(normal, p) + distance = 0 인 평면. normal 쪽이 양(+)의 공간이다.
+    class Plane final
+    {
+    public:
+        static Plane            fromPointNormal(const mint::Float3& point, const mint::Float3& normal) noexcept;
+        // 반시계 방향 (a -> b -> c) 에서 보이는 쪽이 양(+)의 공간이다.
+        static Plane            fromPoints(const mint::Float3& a, const mint::Float3& b, const mint::Float3& c) noexcept;
+
+    public:
+                                Plane();
+        explicit                Plane(const float normalX, const float normalY, const float normalZ, const float distance);
+                                Plane(const Plane& rhs)         = default;
+                                Plane(Plane&& rhs) noexcept     = default;
+                                ~Plane()                        = default;
+
+    public:
+        Plane&                  operator=(const Plane& rhs)     = default;
+        Plane&                  operator=(Plane&& rhs) noexcept = default;
+
+    public:
+        // normal 의 길이가 1 이 되도록 전체를 나눈다.
+        void                    normalize() noexcept;
+        // normal 이 정규화되어 있으면 실제 거리다.
+        const float             signedDistance(const mint::Float3& point) const noexcept;
+        mint::Float3            getNormal() const noexcept;
+        const float             getDistance() const noexcept;
+
+    public:
+        // (normal.x, normal.y, normal.z, distance)
+        mint::Float4            _data;
+    };
+}
+
+
+#endif // !MINT_PLANE_H
@@ -26,6 +26,17 @@ namespace mint
 
         // q^(-1)
         static Quaternion           reciprocal(const Quaternion& q) noexcept;
+
+        static const float          dot(const Quaternion& lhs, const Quaternion& rhs) noexcept;
+
+        // 아래 보간 함수들은 모두 unit quaternion 을 받고, 짧은 경로(dot >= 0)로 보간한다.
+        // Normalized lerp. 각속도가 일정하지 않지만 가장 싸다.
+        static Quaternion           nlerp(const Quaternion& from, const Quaternion& to, const float t) noexcept;
+        // acos/sin 을 쓰는 정확한 slerp.
+        static Quaternion           slerp(const Quaternion& from, const Quaternion& to, const float t) noexcept;
+        // t 를 다항식으로 보정한 뒤 nlerp 하는 근사 slerp. 초월함수를 쓰지 않는다.
+        // slerp 대비 최대 회전 각도 오차는 약 1.2e-3 rad (0.07 도) 이다. (MintLibraryTest 의 testLinearAlgebra 에서 확인)
+        static Quaternion           slerpApproximate(const Quaternion& from, const Quaternion& to, const float t) noexcept;
 #pragma endregion
 
     public:
@@ -61,7 +72,11 @@ namespace mint
     public:
         Quaternion                  conjugate() const noexcept;
         Quaternion                  reciprocal() const noexcept;
-        mint::Float4                  rotateVector(const mint::Float4& inputVector);
+        void                        normalize() noexcept;
+        // Unit quaternion 으로 회전한다. (q * v * q^* 와 같지만 cross product 두 번으로 계산한다)
+        // w 성분은 그대로 유지된다.
+        mint::Float4                rotateVector(const mint::Float4& inputVector) const noexcept;
+        mint::Float3                rotateVector(const mint::Float3& inputVector) const noexcept;
         void                        setAxisAngle(const mint::Float3& axis, float angle) noexcept;
         void                        getAxisAngle(mint::Float3& axis, float& angle) const noexcept;
 
@@ -0,0 +1,50 @@
+﻿#pragma once
+
+
+#ifndef MINT_RAY_H
+#define MINT_RAY_H
+
+
+#include <MintMath/Include/Plane.h>
+#include <MintMath/Include/BoundingSphere.h>
+
+
+namespace mint
+{
+    // origin + direction * t (t >= 0)
+    // 교차 함수들의 outDistance 는 t 이므로, direction 이 정규화되어 있어야 실제 거리가 된다.
+    class Ray final
+    {
+    public:
+                                Ray();
+        explicit                Ray(const mint::Float3& origin, const mint::Float3& direction);
+                                Ray(const Ray& rhs)             = default;
+                                Ray(Ray&& rhs) noexcept         = default;
+                                ~Ray()                          = default;
+
+    public:
+        Ray&                    operator=(const Ray& rhs)       = default;
+        Ray&                    operator=(Ray&& rhs) noexcept   = default;
+
+    public:
+        mint::Float3            getPoint(const float t) const noexcept;
+
+    public:
+        const bool              intersects(const Plane& plane, float& outDistance) const noexcept;
+        // origin 이 안쪽에 있으면 outDistance 는 0 이다.
+        const bool              intersects(const AABB& aabb, float& outDistance) const noexcept;
+        const bool              intersects(const BoundingSphere& sphere, float& outDistance) const noexcept;
+        // 양면 판정 (Möller-Trumbore)
+        const bool              intersectsTriangle(const mint::Float3& v0, const mint::Float3& v1, const mint::Float3& v2, float& outDistance) const noexcept;
+        // triangleVertices 는 triangle list (정점 3 * triangleCount 개) 이다.
+        // 가장 가까운 triangle 을 4 개씩 SIMD 로 찾는다.
+        const bool              intersectsTriangles(const mint::Float3* const triangleVertices, const uint32 triangleCount, uint32& outTriangleIndex, float& outDistance) const noexcept;
+
+    public:
+        mint::Float3            _origin;
+        mint::Float3            _direction;
+    };
+}
+
+
+#endif // !MINT_RAY_H
@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef MINT_RECT_H
@@ -8,6 +8,7 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintMath/Include/Float4.h>
+#include <MintMath/Include/FloatSoA.h>
 
 
 namespace mint
@@ -67,6 +68,52 @@ namespace mint
     private:
         mint::Float4                    _raw;
     };
+
+
+    // Rect 를 left, right, top, bottom 성분별 배열로 담는 SoA container.
+    // GUI 처럼 많은 rect 를 한 번에 hit test, clip 할 때 4 개씩 SIMD 로 처리한다.
+    class RectSoA final
+    {
+    public:
+                                        RectSoA()                           = default;
+                                        RectSoA(const RectSoA& rhs)         = default;
+                                        RectSoA(RectSoA&& rhs) noexcept     = default;
+                                        ~RectSoA()                          = default;
+
+    public:
+        RectSoA&                        operator=(const RectSoA& rhs)       = default;
+        RectSoA&                        operator=(RectSoA&& rhs) noexcept   = default;
+
+    public:
+        void                            reserve(const uint32 capacity) noexcept;
+        void                            clear() noexcept;
+        void                            push_back(const Rect& rect) noexcept;
+        void                            set(const uint32 index, const Rect& rect) noexcept;
+        Rect                            get(const uint32 index) const noexcept;
+        void                            assignFromAoS(const Rect* const rects, const uint32 count) noexcept;
+
+    public:
+        const float*                    left() const noexcept;
+        const float*                    right() const noexcept;
+        const float*                    top() const noexcept;
+        const float*                    bottom() const noexcept;
+        const uint32                    size() const noexcept;
+        const bool                      empty() const noexcept;
+
+    public:
+        // outContains[i] = get(i).contains(position) 이고, position 을 포함하는 rect 의 개수를 반환한다.
+        const uint32                    contains(const mint::Float2& position, bool* const outContains) const noexcept;
+        // position 을 포함하는 rect 중 index 가 가장 큰 것 (가장 나중에 그려지는 것) 을 찾는다. 없으면 kUint32Max 를 반환한다.
+        const uint32                    findLastContaining(const mint::Float2& position) const noexcept;
+        // 모든 rect 에 Rect::clipBy(outerRect) 를 적용한다.
+        void                            clipBy(const Rect& outerRect) noexcept;
+        // 모든 rect 를 감싸는 rect. NaN rect 는 무시하며, 비어 있으면 false 를 반환한다.
+        const bool                      computeBoundingRect(Rect& outRect) const noexcept;
+
+    private:
+        // x = left, y = right, z = top, w = bottom
+        Float4SoA                       _raw;
+    };
 }
 
 
@@ -0,0 +1,240 @@
+﻿#pragma once
+
+
+#ifndef MINT_SIMD_COMMON_H
+#define MINT_SIMD_COMMON_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+// SIMD 사용 여부는 Compile time 에 결정된다.
+// - MINT_MATH_USE_SCALAR 를 정의하면 SIMD 를 전혀 쓰지 않는다.
+// - x64 에서는 SSE2 가 기본이고, /arch:AVX 이상이면 SSE4.1 과 AVX 를, /arch:AVX2 이면 FMA 와 F16C 도 쓴다.
+// - MINT_MATH_USE_SSE4_1 은 /arch:AVX 없이도 직접 정의할 수 있다.
+#if !defined MINT_MATH_USE_SCALAR && (defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 2) || defined __SSE2__)
+    #define MINT_MATH_USE_SIMD
+#endif
+
+#if defined MINT_MATH_USE_SIMD
+    #if !defined MINT_MATH_USE_SSE4_1 && (defined __AVX__ || defined __SSE4_1__)
+        #define MINT_MATH_USE_SSE4_1
+    #endif
+
+    #if defined __AVX__
+        #define MINT_MATH_USE_AVX
+    #endif
+
+    #if defined __AVX2__ || defined __FMA__
+        #define MINT_MATH_USE_FMA
+    #endif
+
+    // F16C 는 AVX2 를 지원하는 모든 CPU 에 있다. (MSVC 는 /arch:AVX2 에서 따로 macro 를 정의하지 않는다)
+    #if defined __F16C__ || (defined _MSC_VER && defined __AVX2__)
+        #define MINT_MATH_USE_F16C
+    #endif
+
+    #include <immintrin.h>
+#endif
+
+#if defined _MSC_VER
+    #include <intrin.h>
+#endif
+
+// constexpr 함수 안에서 Compile time 계산일 때는 SIMD 경로를 피하기 위해 쓴다.
+// (MSVC 16.5+, GCC 9+, Clang 9+ 는 C++17 에서도 이 builtin 을 지원한다)
+#define MINT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+
+
+namespace mint
+{
+    // 가장 낮은 set bit 의 위치를 반환한다. (_mm_movemask_* 결과를 index 로 바꿀 때 쓴다) mask 는 0 이 아니어야 한다.
+    MINT_INLINE const uint32 findFirstSetBit(const uint32 mask) noexcept
+    {
+#if defined _MSC_VER
+        unsigned long firstSetBit = 0;
+        _BitScanForward(&firstSetBit, static_cast<unsigned long>(mask));
+        return static_cast<uint32>(firstSetBit);
+#else
+        return static_cast<uint32>(__builtin_ctz(mask));
+#endif
+    }
+}
+
+
+#if defined MINT_MATH_USE_SIMD
+namespace mint
+{
+    namespace Simd
+    {
+        // a * b + c
+        MINT_INLINE __m128 multiplyAdd(const __m128 a, const __m128 b, const __m128 c) noexcept
+        {
+#if defined MINT_MATH_USE_FMA
+            return _mm_fmadd_ps(a, b, c);
+#else
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+        }
+
+        template <int32 Lane>
+        MINT_INLINE __m128 splat(const __m128 v) noexcept
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+        }
+
+        // 결과는 모든 lane 에 들어 있다.
+        MINT_INLINE __m128 dot4(const __m128 a, const __m128 b) noexcept
+        {
+#if defined MINT_MATH_USE_SSE4_1
+            return _mm_dp_ps(a, b, 0xFF);
+#else
+            __m128 product = _mm_mul_ps(a, b);
+            product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif
+        }
+
+        // 3D cross product. w 는 0 이 된다.
+        MINT_INLINE __m128 cross3(const __m128 a, const __m128 b) noexcept
+        {
+            const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+            const __m128 crossZxy = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+            const __m128 cross = _mm_shuffle_ps(crossZxy, crossZxy, _MM_SHUFFLE(3, 0, 2, 1));
+            return _mm_and_ps(cross, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+        }
+
+        // Quaternion Hamilton product. (x, y, z, w) 순서이고 w 가 real part 이다.
+        MINT_INLINE __m128 quaternionMultiply(const __m128 lhs, const __m128 rhs) noexcept
+        {
+            const __m128 rhsWzyx = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+            const __m128 rhsZwxy = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2)), _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f));
+            const __m128 rhsYxwz = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+            __m128 result = _mm_mul_ps(splat<3>(lhs), rhs);
+            result = multiplyAdd(splat<0>(lhs), rhsWzyx, result);
+            result = multiplyAdd(splat<1>(lhs), rhsZwxy, result);
+            return multiplyAdd(splat<2>(lhs), rhsYxwz, result);
+        }
+
+        MINT_INLINE void transpose4(__m128& row0, __m128& row1, __m128& row2, __m128& row3) noexcept
+        {
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        }
+
+        // (dot(row0, v), dot(row1, v), dot(row2, v), dot(row3, v))
+        MINT_INLINE __m128 dot4x4(const __m128 row0, const __m128 row1, const __m128 row2, const __m128 row3, const __m128 v) noexcept
+        {
+            __m128 product0 = _mm_mul_ps(row0, v);
+            __m128 product1 = _mm_mul_ps(row1, v);
+            __m128 product2 = _mm_mul_ps(row2, v);
+            __m128 product3 = _mm_mul_ps(row3, v);
+            _MM_TRANSPOSE4_PS(product0, product1, product2, product3);
+            return _mm_add_ps(_mm_add_ps(product0, product1), _mm_add_ps(product2, product3));
+        }
+
+        // row-major 4x4 행렬의 한 row 와 행렬 rhs 의 곱: row * rhs
+        MINT_INLINE __m128 mulRowMatrix(const __m128 row, const __m128 rhsRow0, const __m128 rhsRow1, const __m128 rhsRow2, const __m128 rhsRow3) noexcept
+        {
+            __m128 result = _mm_mul_ps(splat<0>(row), rhsRow0);
+            result = multiplyAdd(splat<1>(row), rhsRow1, result);
+            result = multiplyAdd(splat<2>(row), rhsRow2, result);
+            return multiplyAdd(splat<3>(row), rhsRow3, result);
+        }
+
+        // 연속된 Float3 4 개 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) 를 x, y, z 로 나눈다.
+        MINT_INLINE void deinterleave3(const __m128 a, const __m128 b, const __m128 c, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            const __m128 x2y2z2x3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2));
+            x = _mm_shuffle_ps(a, x2y2z2x3, _MM_SHUFFLE(3, 0, 3, 0));
+            const __m128 y0y0y1y1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+            const __m128 y2y2y3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+            y = _mm_shuffle_ps(y0y0y1y1, y2y2y3y3, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 z0z0z1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+            const __m128 z2z2z3z3 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+            z = _mm_shuffle_ps(z0z0z1z1, z2z2z3z3, _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        // deinterleave3 의 역
+        MINT_INLINE void interleave3(const __m128 x, const __m128 y, const __m128 z, __m128& a, __m128& b, __m128& c) noexcept
+        {
+            const __m128 xy01 = _mm_unpacklo_ps(x, y);
+            const __m128 xy23 = _mm_unpackhi_ps(x, y);
+            const __m128 z0z0x1x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+            const __m128 y1y1z1z1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 z2z3x3y3 = _mm_shuffle_ps(z, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+            a = _mm_shuffle_ps(xy01, z0z0x1x1, _MM_SHUFFLE(2, 0, 1, 0));
+            b = _mm_shuffle_ps(y1y1z1z1, xy23, _MM_SHUFFLE(1, 0, 2, 0));
+            c = _mm_shuffle_ps(z2z3x3y3, z2z3x3y3, _MM_SHUFFLE(1, 3, 2, 0));
+        }
+
+
+#pragma region Wide
+        // SoA 처리를 위한 register. AVX 가 있으면 8 lane, 없으면 4 lane 이다.
+#if defined MINT_MATH_USE_AVX
+        using Wide = __m256;
+        static constexpr uint32 kWideLaneCount = 8;
+
+        MINT_INLINE Wide wideLoad(const float* const aligned) noexcept { return _mm256_load_ps(aligned); }
+        MINT_INLINE void wideStore(float* const aligned, const Wide v) noexcept { _mm256_store_ps(aligned, v); }
+        MINT_INLINE void wideStoreUnaligned(float* const unaligned, const Wide v) noexcept { _mm256_storeu_ps(unaligned, v); }
+        MINT_INLINE Wide wideSet(const float s) noexcept { return _mm256_set1_ps(s); }
+        MINT_INLINE Wide wideAdd(const Wide a, const Wide b) noexcept { return _mm256_add_ps(a, b); }
+        MINT_INLINE Wide wideSub(const Wide a, const Wide b) noexcept { return _mm256_sub_ps(a, b); }
+        MINT_INLINE Wide wideMul(const Wide a, const Wide b) noexcept { return _mm256_mul_ps(a, b); }
+        MINT_INLINE Wide wideDiv(const Wide a, const Wide b) noexcept { return _mm256_div_ps(a, b); }
+        MINT_INLINE Wide wideSqrt(const Wide v) noexcept { return _mm256_sqrt_ps(v); }
+        MINT_INLINE Wide wideMin(const Wide a, const Wide b) noexcept { return _mm256_min_ps(a, b); }
+        MINT_INLINE Wide wideMax(const Wide a, const Wide b) noexcept { return _mm256_max_ps(a, b); }
+        MINT_INLINE Wide wideMultiplyAdd(const Wide a, const Wide b, const Wide c) noexcept
+        {
+#if defined MINT_MATH_USE_FMA
+            return _mm256_fmadd_ps(a, b, c);
+#else
+            return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+        }
+        MINT_INLINE __m128 wideLow(const Wide v) noexcept { return _mm256_castps256_ps128(v); }
+        MINT_INLINE __m128 wideHigh(const Wide v) noexcept { return _mm256_extractf128_ps(v, 1); }
+#else
+        using Wide = __m128;
+        static constexpr uint32 kWideLaneCount = 4;
+
+        MINT_INLINE Wide wideLoad(const float* const aligned) noexcept { return _mm_load_ps(aligned); }
+        MINT_INLINE void wideStore(float* const aligned, const Wide v) noexcept { _mm_store_ps(aligned, v); }
+        MINT_INLINE void wideStoreUnaligned(float* const unaligned, const Wide v) noexcept { _mm_storeu_ps(unaligned, v); }
+        MINT_INLINE Wide wideSet(const float s) noexcept { return _mm_set1_ps(s); }
+        MINT_INLINE Wide wideAdd(const Wide a, const Wide b) noexcept { return _mm_add_ps(a, b); }
+        MINT_INLINE Wide wideSub(const Wide a, const Wide b) noexcept { return _mm_sub_ps(a, b); }
+        MINT_INLINE Wide wideMul(const Wide a, const Wide b) noexcept { return _mm_mul_ps(a, b); }
+        MINT_INLINE Wide wideDiv(const Wide a, const Wide b) noexcept { return _mm_div_ps(a, b); }
+        MINT_INLINE Wide wideSqrt(const Wide v) noexcept { return _mm_sqrt_ps(v); }
+        MINT_INLINE Wide wideMin(const Wide a, const Wide b) noexcept { return _mm_min_ps(a, b); }
+        MINT_INLINE Wide wideMax(const Wide a, const Wide b) noexcept { return _mm_max_ps(a, b); }
+        MINT_INLINE Wide wideMultiplyAdd(const Wide a, const Wide b, const Wide c) noexcept { return multiplyAdd(a, b, c); }
+        MINT_INLINE __m128 wideLow(const Wide v) noexcept { return v; }
+        MINT_INLINE __m128 wideHigh(const Wide v) noexcept { return v; }
+#endif
+
+        MINT_INLINE const float wideHorizontalMin(const Wide v) noexcept
+        {
+            __m128 result = _mm_min_ps(wideLow(v), wideHigh(v));
+            result = _mm_min_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(2, 3, 0, 1)));
+            result = _mm_min_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(1, 0, 3, 2)));
+            return _mm_cvtss_f32(result);
+        }
+
+        MINT_INLINE const float wideHorizontalMax(const Wide v) noexcept
+        {
+            __m128 result = _mm_max_ps(wideLow(v), wideHigh(v));
+            result = _mm_max_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(2, 3, 0, 1)));
+            result = _mm_max_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(1, 0, 3, 2)));
+            return _mm_cvtss_f32(result);
+        }
+#pragma endregion
+    }
+}
+#endif
+
+
+#endif // !MINT_SIMD_COMMON_H
@@ -0,0 +1,73 @@
+﻿#pragma once
+
+
+#ifndef MINT_TRANSFORM3X4_H
+#define MINT_TRANSFORM3X4_H
+
+
+#include <MintMath/Include/Float4x4.h>
+
+
+namespace mint
+{
+    // Float4x4 에서 항상 (0, 0, 0, 1) 인 마지막 row 를 뺀 affine transform.
+    // Column vector 기준이며 row 는 Float4x4 의 처음 3 개 row 와 같다.
+    // 합성 시 곱셈 36 번 (Float4x4 는 64 번), 메모리는 48 bytes (Float4x4 는 64 bytes) 이다.
+    class Transform3x4 final
+    {
+    public:
+        static const Transform3x4   kIdentity;
+
+#pragma region Static Functions
+    public:
+        static Transform3x4         srt(const mint::Float3& scale, const mint::Quaternion& rotation, const mint::Float3& translation) noexcept;
+        // matrix 의 마지막 row 는 (0, 0, 0, 1) 이라고 가정한다.
+        static Transform3x4         fromMatrix(const mint::Float4x4& matrix) noexcept;
+#pragma endregion
+
+    public:
+                                    Transform3x4();
+        explicit                    Transform3x4(
+                                        const float m00, const float m01, const float m02, const float m03,
+                                        const float m10, const float m11, const float m12, const float m13,
+                                        const float m20, const float m21, const float m22, const float m23);
+                                    Transform3x4(const Transform3x4& rhs)       = default;
+                                    Transform3x4(Transform3x4&& rhs) noexcept   = default;
+                                    ~Transform3x4()                             = default;
+
+    public:
+        Transform3x4&               operator=(const Transform3x4& rhs)          = default;
+        Transform3x4&               operator=(Transform3x4&& rhs) noexcept      = default;
+
+    public:
+        const bool                  operator==(const Transform3x4& rhs) const noexcept;
+        const bool                  operator!=(const Transform3x4& rhs) const noexcept;
+
+    public:
+        // transform(lhs) * transform(rhs). rhs 를 먼저 적용한다. (예: parent * child)
+        Transform3x4                operator*(const Transform3x4& rhs) const noexcept;
+        Transform3x4&               operator*=(const Transform3x4& rhs) noexcept;
+
+    public:
+        mint::Float3                transformPoint(const mint::Float3& point) const noexcept;
+        // Translation 을 적용하지 않는다.
+        mint::Float3                transformVector(const mint::Float3& vector) const noexcept;
+        // 3x3 부분이 역행렬을 가지지 않으면 kIdentity 를 반환한다.
+        Transform3x4                inverse() const noexcept;
+        mint::Float4x4              toMatrix() const noexcept;
+
+    public:
+        void                        setTranslation(const mint::Float3& translation) noexcept;
+        mint::Float3                getTranslation() const noexcept;
+
+    public:
+        union
+        {
+            float                   _m[3][4];
+            mint::Float4            _row[3];
+        };
+    };
+}
+
+
+#endif // !MINT_TRANSFORM3X4_H
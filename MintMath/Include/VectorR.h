@@ -8,88 +8,106 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <initializer_list>
+#include <type_traits>
 
 
 namespace mint
 {
     namespace Math
     {
-        template <int32 M, int32 N>
+        template <int32 M, int32 N, typename T>
         class Matrix;
 
 
-        template <int32 N>
+        // T is the storage type (double by default, float for SIMD-friendly small solvers).
+        // Everything except the functions using sqrt/acos is constexpr-evaluable.
+        template <int32 N, typename T = double>
         class VectorR
         {
             static_assert(0 < N, "N must be greater than 0!");
+            static_assert(std::is_floating_point<T>::value, "T must be a floating point type!");
+
+            template <int32 M_, int32 N_, typename T_>
+            friend class Matrix;
+
+        public:
+            using ValueType                 = T;
 
         public:
-            static VectorR<N>               standardUnitVector(const int32 math_i) noexcept;
-            static const double             dot(const VectorR& lhs, const VectorR& rhs) noexcept;
-            static VectorR<3>               cross(const VectorR<3>& lhs, const VectorR<3>& rhs) noexcept;
-            static const double             distance(const VectorR& lhs, const VectorR& rhs) noexcept;
-            static const double             angle(const VectorR& lhs, const VectorR& rhs) noexcept;
+            static constexpr VectorR<N, T>  standardUnitVector(const int32 math_i) noexcept;
+            static constexpr const T        dot(const VectorR& lhs, const VectorR& rhs) noexcept;
+            static constexpr VectorR<3, T>  cross(const VectorR<3, T>& lhs, const VectorR<3, T>& rhs) noexcept;
+            static const T                  distance(const VectorR& lhs, const VectorR& rhs) noexcept;
+            static const T                  angle(const VectorR& lhs, const VectorR& rhs) noexcept;
             static const bool               isOrthogonal(const VectorR& lhs, const VectorR& rhs) noexcept;
-            static VectorR<N>               projectUOntoV(const VectorR& u, const VectorR& v) noexcept;
+            static constexpr VectorR<N, T>  projectUOntoV(const VectorR& u, const VectorR& v) noexcept;
 
         public:
-                                            VectorR();
+            constexpr                       VectorR();
                                             template <class ...Args>
-                                            VectorR(Args ... args);
-                                            VectorR(const std::initializer_list<double>& initializerList);
-                                            VectorR(const VectorR& rhs) = default;
-                                            VectorR(VectorR&& rhs) noexcept = default;
-                                            ~VectorR();
+            constexpr                       VectorR(Args ... args);
+            constexpr                       VectorR(const std::initializer_list<T>& initializerList);
+            constexpr                       VectorR(const VectorR& rhs) = default;
+            constexpr                       VectorR(VectorR&& rhs) noexcept = default;
+                                            ~VectorR() = default;
         
         public:
-            VectorR&                        operator=(const VectorR& rhs) = default;
-            VectorR&                        operator=(VectorR && rhs) noexcept = default;
+            constexpr VectorR&              operator=(const VectorR& rhs) = default;
+            constexpr VectorR&              operator=(VectorR && rhs) noexcept = default;
 
         public:
-            VectorR&                        operator*=(const double scalar) noexcept;
-            VectorR&                        operator/=(const double scalar) noexcept;
-            VectorR&                        operator+=(const VectorR& rhs) noexcept;
-            VectorR&                        operator-=(const VectorR& rhs) noexcept;
+            constexpr VectorR&              operator*=(const T scalar) noexcept;
+            constexpr VectorR&              operator/=(const T scalar) noexcept;
+            constexpr VectorR&              operator+=(const VectorR& rhs) noexcept;
+            constexpr VectorR&              operator-=(const VectorR& rhs) noexcept;
             
         public:
-            VectorR                         operator*(const double scalar) const noexcept;
-            VectorR                         operator/(const double scalar) const noexcept;
-            VectorR                         operator+(const VectorR& rhs) const noexcept;
-            VectorR                         operator-(const VectorR& rhs) const noexcept;
+            constexpr VectorR               operator*(const T scalar) const noexcept;
+            constexpr VectorR               operator/(const T scalar) const noexcept;
+            constexpr VectorR               operator+(const VectorR& rhs) const noexcept;
+            constexpr VectorR               operator-(const VectorR& rhs) const noexcept;
 
         public:
-            double&                         operator[](const uint32 index) noexcept;
-            const double&                   operator[](const uint32 index) const noexcept;
+            constexpr const bool            operator==(const VectorR& rhs) const noexcept;
+            constexpr const bool            operator!=(const VectorR& rhs) const noexcept;
 
         public:
-            void                            setZero() noexcept;
-            void                            setComponent(const uint32 index, const double value) noexcept;
-            const double                    getComponent(const uint32 index) const noexcept;
-            const double                    maxComponent() const noexcept;
-            const double                    minComponent() const noexcept;
+            constexpr T&                    operator[](const uint32 index) noexcept;
+            constexpr const T&              operator[](const uint32 index) const noexcept;
 
         public:
-            const double                    normSquared() const noexcept;
-            const double                    norm() const noexcept;
-            VectorR<N>&                     setNormalized() noexcept;
-            VectorR<N>                      normalize() const noexcept;
+            constexpr void                  setZero() noexcept;
+            constexpr void                  setComponent(const uint32 index, const T value) noexcept;
+            constexpr const T               getComponent(const uint32 index) const noexcept;
+            constexpr const T               maxComponent() const noexcept;
+            constexpr const T               minComponent() const noexcept;
+
+        public:
+            constexpr const T               normSquared() const noexcept;
+            const T                         norm() const noexcept;
+            VectorR<N, T>&                  setNormalized() noexcept;
+            VectorR<N, T>                   normalize() const noexcept;
             const bool                      isUnitVector() const noexcept;
 
         public:
-            const double                    dot(const VectorR& rhs) const noexcept;
-            VectorR<3>                      cross(const VectorR<3>& rhs) const noexcept;
-            const double                    distance(const VectorR& rhs) const noexcept;
-            const double                    angle(const VectorR& rhs) const noexcept;
+            constexpr const T               dot(const VectorR& rhs) const noexcept;
+            constexpr VectorR<3, T>         cross(const VectorR<3, T>& rhs) const noexcept;
+            const T                         distance(const VectorR& rhs) const noexcept;
+            const T                         angle(const VectorR& rhs) const noexcept;
             const bool                      isOrthogonalTo(const VectorR& rhs) const noexcept;
-            VectorR<N>                      projectOnto(const VectorR& rhs) const noexcept;
+            constexpr VectorR<N, T>         projectOnto(const VectorR& rhs) const noexcept;
 
         private:
-            double                          _c[N];
+            T                               _c[N];
         };
 
 
+        template <int32 N, typename T>
+        constexpr VectorR<N, T>             operator*(const typename VectorR<N, T>::ValueType scalar, const VectorR<N, T>& vector) noexcept;
+
+
         template <int32 N>
-        VectorR<N>                          operator*(const double scalar, const VectorR<N>& vector) noexcept;
+        using VectorRf                      = VectorR<N, float>;
     }
 }
 
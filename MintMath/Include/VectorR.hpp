@@ -12,193 +12,189 @@ namespace mint
 {
     namespace Math
     {
-        template<int32 N>
-        inline VectorR<N>::VectorR()
+        template<int32 N, typename T>
+        inline constexpr VectorR<N, T>::VectorR()
             : _c{}
         {
             __noop;
         }
 
-        template<int32 N>
+        template<int32 N, typename T>
         template <class ...Args>
-        inline VectorR<N>::VectorR(Args... args)
-            : _c{ args... }
+        inline constexpr VectorR<N, T>::VectorR(Args... args)
+            : _c{ static_cast<T>(args)... }
         {
             __noop;
         }
 
-        template<int32 N>
-        inline VectorR<N>::VectorR(const std::initializer_list<double>& initializerList)
+        template<int32 N, typename T>
+        inline constexpr VectorR<N, T>::VectorR(const std::initializer_list<T>& initializerList)
+            : _c{}
         {
             const int32 count = mint::min(static_cast<int32>(initializerList.size()), N);
-            const double* const first = initializerList.begin();
+            const T* const first = initializerList.begin();
             for (int32 index = 0; index < count; ++index)
             {
                 _c[index] = *(first + index);
             }
         }
 
-        template<int32 N>
-        inline VectorR<N>::~VectorR()
-        {
-            __noop;
-        }
-
-        template<int32 N>
-        inline VectorR<N> VectorR<N>::standardUnitVector(const int32 math_i) noexcept
+        template<int32 N, typename T>
+        inline constexpr VectorR<N, T> VectorR<N, T>::standardUnitVector(const int32 math_i) noexcept
         {
-            VectorR<N> result;
-            result.setComponent(math_i - 1, 1.0);
+            VectorR<N, T> result;
+            result.setComponent(math_i - 1, static_cast<T>(1));
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::dot(const VectorR& lhs, const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::dot(const VectorR& lhs, const VectorR& rhs) noexcept
         {
-            double result = 0.0;
-            for (int32 index = 0; index < N; ++index)
-            {
-                result += (lhs._c[index] * rhs._c[index]);
-            }
+            T result = 0;
+            staticFor<N>([&](const int32 index) { result += (lhs._c[index] * rhs._c[index]); });
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<3> VectorR<N>::cross(const VectorR<3>& lhs, const VectorR<3>& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<3, T> VectorR<N, T>::cross(const VectorR<3, T>& lhs, const VectorR<3, T>& rhs) noexcept
         {
-            return VectorR<3>
+            return VectorR<3, T>
                 (
                     {
-                        lhs._c[1] * rhs._c[2] - lhs._c[2] * rhs._c[1],
-                        lhs._c[2] * rhs._c[0] - lhs._c[0] * rhs._c[2],
-                        lhs._c[0] * rhs._c[1] - lhs._c[1] * rhs._c[0]
+                        lhs[1] * rhs[2] - lhs[2] * rhs[1],
+                        lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                        lhs[0] * rhs[1] - lhs[1] * rhs[0]
                     }
             );
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::distance(const VectorR& lhs, const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const T VectorR<N, T>::distance(const VectorR& lhs, const VectorR& rhs) noexcept
         {
             return (rhs - lhs).norm();
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::angle(const VectorR& lhs, const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const T VectorR<N, T>::angle(const VectorR& lhs, const VectorR& rhs) noexcept
         {
             return ::acos(lhs.normalize().dot(rhs.normalize()));
         }
 
-        template<int32 N>
-        MINT_INLINE const bool VectorR<N>::isOrthogonal(const VectorR& lhs, const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const bool VectorR<N, T>::isOrthogonal(const VectorR& lhs, const VectorR& rhs) noexcept
         {
-            return mint::Math::equals(lhs.dot(rhs), 0.0);
+            return mint::Math::equals(lhs.dot(rhs), static_cast<T>(0));
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::projectUOntoV(const VectorR& u, const VectorR& v) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::projectUOntoV(const VectorR& u, const VectorR& v) noexcept
         {
             return (u.dot(v) / u.dot(u)) * u;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N>& VectorR<N>::operator*=(const double scalar) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T>& VectorR<N, T>::operator*=(const T scalar) noexcept
         {
-            for (int32 index = 0; index < N; ++index)
-            {
-                _c[index] *= scalar;
-            }
+            staticFor<N>([&](const int32 index) { _c[index] *= scalar; });
             return *this;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N>& VectorR<N>::operator/=(const double scalar) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T>& VectorR<N, T>::operator/=(const T scalar) noexcept
         {
-            MINT_ASSERT("", scalar != 0.0, "0   մϴ!");
+            MINT_ASSERT("", scalar != static_cast<T>(0), "0   մϴ!");
 
-            for (int32 index = 0; index < N; ++index)
-            {
-                _c[index] /= scalar;
-            }
+            staticFor<N>([&](const int32 index) { _c[index] /= scalar; });
             return *this;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N>& VectorR<N>::operator+=(const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T>& VectorR<N, T>::operator+=(const VectorR& rhs) noexcept
         {
-            for (int32 index = 0; index < N; ++index)
-            {
-                _c[index] += rhs._c[index];
-            }
+            staticFor<N>([&](const int32 index) { _c[index] += rhs._c[index]; });
             return *this;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N>& VectorR<N>::operator-=(const VectorR& rhs) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T>& VectorR<N, T>::operator-=(const VectorR& rhs) noexcept
         {
-            for (int32 index = 0; index < N; ++index)
-            {
-                _c[index] -= rhs._c[index];
-            }
+            staticFor<N>([&](const int32 index) { _c[index] -= rhs._c[index]; });
             return *this;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::operator*(const double scalar) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::operator*(const T scalar) const noexcept
         {
             VectorR result = *this;
             result *= scalar;
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::operator/(const double scalar) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::operator/(const T scalar) const noexcept
         {
             VectorR result = *this;
             result /= scalar;
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::operator+(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::operator+(const VectorR& rhs) const noexcept
         {
             VectorR result = *this;
             result += rhs;
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::operator-(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::operator-(const VectorR& rhs) const noexcept
         {
             VectorR result = *this;
             result -= rhs;
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE double& VectorR<N>::operator[](const uint32 index) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const bool VectorR<N, T>::operator==(const VectorR& rhs) const noexcept
+        {
+            for (int32 index = 0; index < N; ++index)
+            {
+                if (_c[index] != rhs._c[index])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const bool VectorR<N, T>::operator!=(const VectorR& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        template<int32 N, typename T>
+        MINT_INLINE constexpr T& VectorR<N, T>::operator[](const uint32 index) noexcept
         {
             MINT_ASSERT("", index < static_cast<uint32>(N), "  Դϴ!");
             return _c[index];
         }
 
-        template<int32 N>
-        MINT_INLINE const double& VectorR<N>::operator[](const uint32 index) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T& VectorR<N, T>::operator[](const uint32 index) const noexcept
         {
             MINT_ASSERT("", index < static_cast<uint32>(N), "  Դϴ!");
             return _c[index];
         }
 
-        template<int32 N>
-        MINT_INLINE void VectorR<N>::setZero() noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr void VectorR<N, T>::setZero() noexcept
         {
-            for (int32 index = 0; index < N; ++index)
-            {
-                _c[index] = 0.0;
-            }
+            staticFor<N>([&](const int32 index) { _c[index] = 0; });
         }
 
-        template<int32 N>
-        MINT_INLINE void mint::Math::VectorR<N>::setComponent(const uint32 index, const double value) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr void mint::Math::VectorR<N, T>::setComponent(const uint32 index, const T value) noexcept
         {
             if (index < static_cast<uint32>(N))
             {
@@ -206,18 +202,18 @@ namespace mint
             }
         }
         
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::getComponent(const uint32 index) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::getComponent(const uint32 index) const noexcept
         {
             MINT_ASSERT("", index < static_cast<uint32>(N), "  Դϴ!");
             return _c[index];
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::maxComponent() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::maxComponent() const noexcept
         {
-            double result = 1.0e-323;
-            for (int32 index = 0; index < N; ++index)
+            T result = _c[0];
+            for (int32 index = 1; index < N; ++index)
             {
                 if (result < _c[index])
                 {
@@ -227,11 +223,11 @@ namespace mint
             return result;
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::minComponent() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::minComponent() const noexcept
         {
-            double result = 1.0e+308;
-            for (int32 index = 0; index < N; ++index)
+            T result = _c[0];
+            for (int32 index = 1; index < N; ++index)
             {
                 if (_c[index] < result)
                 {
@@ -241,83 +237,79 @@ namespace mint
             return result;
         }
         
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::normSquared() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::normSquared() const noexcept
         {
-            double result = 0.0;
-            for (int32 index = 0; index < N; ++index)
-            {
-                result += (_c[index] * _c[index]);
-            }
-            return result;
+            return dot(*this, *this);
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::norm() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const T VectorR<N, T>::norm() const noexcept
         {
             return ::sqrt(normSquared());
         }
         
-        template<int32 N>
-        MINT_INLINE VectorR<N>& VectorR<N>::setNormalized() noexcept
+        template<int32 N, typename T>
+        MINT_INLINE VectorR<N, T>& VectorR<N, T>::setNormalized() noexcept
         {
-            const double norm_ = norm();
+            const T norm_ = norm();
             *this /= norm_;
             return *this;
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::normalize() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE VectorR<N, T> VectorR<N, T>::normalize() const noexcept
         {
-            VectorR<N> result = *this;
+            VectorR<N, T> result = *this;
             return result.setNormalized();
         }
 
-        template<int32 N>
-        MINT_INLINE const bool VectorR<N>::isUnitVector() const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const bool VectorR<N, T>::isUnitVector() const noexcept
         {
-            return mint::Math::equals(normSquared(), 1.0);
+            return mint::Math::equals(normSquared(), static_cast<T>(1));
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::dot(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr const T VectorR<N, T>::dot(const VectorR& rhs) const noexcept
         {
             return dot(*this, rhs);
         }
 
-        template<>
-        inline VectorR<3> VectorR<3>::cross(const VectorR<3>& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<3, T> VectorR<N, T>::cross(const VectorR<3, T>& rhs) const noexcept
         {
+            static_assert(N == 3, "Cross product is only for VectorR<3>!");
             return cross(*this, rhs);
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::distance(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const T VectorR<N, T>::distance(const VectorR& rhs) const noexcept
         {
             return distance(*this, rhs);
         }
 
-        template<int32 N>
-        MINT_INLINE const double VectorR<N>::angle(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const T VectorR<N, T>::angle(const VectorR& rhs) const noexcept
         {
             return angle(*this, rhs);
         }
 
-        template<int32 N>
-        MINT_INLINE const bool VectorR<N>::isOrthogonalTo(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE const bool VectorR<N, T>::isOrthogonalTo(const VectorR& rhs) const noexcept
         {
             return isOrthogonal(*this, rhs);
         }
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> VectorR<N>::projectOnto(const VectorR& rhs) const noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> VectorR<N, T>::projectOnto(const VectorR& rhs) const noexcept
         {
             return projectUOntoV(*this, rhs);
         }
 
 
-        template<int32 N>
-        MINT_INLINE VectorR<N> operator*(const double scalar, const VectorR<N>& vector) noexcept
+        template<int32 N, typename T>
+        MINT_INLINE constexpr VectorR<N, T> operator*(const typename VectorR<N, T>::ValueType scalar, const VectorR<N, T>& vector) noexcept
         {
             return (vector * scalar);
         }
@@ -0,0 +1,97 @@
+﻿#include <MintMath/Include/AABB.h>
+
+
+namespace mint
+{
+    AABB AABB::fromPoints(const mint::Float3* const points, const uint32 count) noexcept
+    {
+        AABB result;
+        for (uint32 index = 0; index < count; ++index)
+        {
+            result.expand(points[index]);
+        }
+        return result;
+    }
+
+    AABB AABB::fromCenterExtents(const mint::Float3& center, const mint::Float3& extents) noexcept
+    {
+        return AABB(center - extents, center + extents);
+    }
+
+
+    AABB::AABB()
+        : _min{ +Math::kFloatMax }
+        , _max{ -Math::kFloatMax }
+    {
+        __noop;
+    }
+
+    AABB::AABB(const mint::Float3& min, const mint::Float3& max)
+        : _min{ min }
+        , _max{ max }
+    {
+        __noop;
+    }
+
+    const bool AABB::isValid() const noexcept
+    {
+        return (_min._x <= _max._x) && (_min._y <= _max._y) && (_min._z <= _max._z);
+    }
+
+    mint::Float3 AABB::getCenter() const noexcept
+    {
+        return (_min + _max) * 0.5f;
+    }
+
+    mint::Float3 AABB::getExtents() const noexcept
+    {
+        return (_max - _min) * 0.5f;
+    }
+
+    void AABB::expand(const mint::Float3& point) noexcept
+    {
+        for (uint32 axis = 0; axis < 3; ++axis)
+        {
+            _min[axis] = mint::min(_min[axis], point[axis]);
+            _max[axis] = mint::max(_max[axis], point[axis]);
+        }
+    }
+
+    void AABB::merge(const AABB& rhs) noexcept
+    {
+        for (uint32 axis = 0; axis < 3; ++axis)
+        {
+            _min[axis] = mint::min(_min[axis], rhs._min[axis]);
+            _max[axis] = mint::max(_max[axis], rhs._max[axis]);
+        }
+    }
+
+    const bool AABB::contains(const mint::Float3& point) const noexcept
+    {
+        return (_min._x <= point._x) && (point._x <= _max._x)
+            && (_min._y <= point._y) && (point._y <= _max._y)
+            && (_min._z <= point._z) && (point._z <= _max._z);
+    }
+
+    const bool AABB::intersects(const AABB& rhs) const noexcept
+    {
+        return (_min._x <= rhs._max._x) && (rhs._min._x <= _max._x)
+            && (_min._y <= rhs._max._y) && (rhs._min._y <= _max._y)
+            && (_min._z <= rhs._max._z) && (rhs._min._z <= _max._z);
+    }
+
+    AABB AABB::transform(const mint::Float4x4& matrix) const noexcept
+    {
+        // center 는 그대로 변환하고, extents 는 |M| 으로 변환한다.
+        const mint::Float3 center = getCenter();
+        const mint::Float3 extents = getExtents();
+        mint::Float3 newCenter;
+        mint::Float3 newExtents;
+        for (uint32 row = 0; row < 3; ++row)
+        {
+            newCenter[row] = mint::Float4::dotProductRaw(matrix._row[row]._f, center._x, center._y, center._z, 1.0f);
+            newExtents[row] = Math::absolute(matrix._m[row][0]) * extents._x + Math::absolute(matrix._m[row][1]) * extents._y + Math::absolute(matrix._m[row][2]) * extents._z;
+        }
+        return fromCenterExtents(newCenter, newExtents);
+    }
+}
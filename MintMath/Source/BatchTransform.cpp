@@ -0,0 +1,372 @@
+﻿#include <MintMath/Include/BatchTransform.h>
+
+#include <MintCommon/Include/ParallelFor.h>
+
+
+namespace mint
+{
+    namespace BatchTransform
+    {
+        namespace
+        {
+            // SIMD kernel 이 4 개씩 처리하므로 parallelFor 구간 경계도 4 의 배수로 맞춘다.
+            static constexpr uint32 kBatchAlignment = 4;
+
+            template<typename Kernel>
+            MINT_INLINE void dispatch(const uint32 count, const uint32 parallelMinCount, const bool useParallelFor, Kernel&& kernel) noexcept
+            {
+                if (useParallelFor == true)
+                {
+                    parallelFor(count, parallelMinCount, kernel, kBatchAlignment);
+                }
+                else
+                {
+                    kernel(0u, count);
+                }
+            }
+
+            // Float3 (x, y, z) 배열을 변환한다. Point 는 w 를 1 로, normal 은 w 를 0 으로 본다.
+            template<bool kHasTranslation>
+            void transformFloat3Range(const Float4x4& matrix, const Float3* const input, Float3* const output, const uint32 begin, const uint32 end) noexcept
+            {
+                uint32 index = begin;
+#if defined MINT_MATH_USE_SIMD
+                // row 별 성분을 broadcast 해 두고, 4 개의 Float3 (48 bytes) 를 SoA 로 바꿔서 계산한다.
+                const __m128 m11 = _mm_set1_ps(matrix._m[0][0]), m12 = _mm_set1_ps(matrix._m[0][1]), m13 = _mm_set1_ps(matrix._m[0][2]), m14 = _mm_set1_ps(matrix._m[0][3]);
+                const __m128 m21 = _mm_set1_ps(matrix._m[1][0]), m22 = _mm_set1_ps(matrix._m[1][1]), m23 = _mm_set1_ps(matrix._m[1][2]), m24 = _mm_set1_ps(matrix._m[1][3]);
+                const __m128 m31 = _mm_set1_ps(matrix._m[2][0]), m32 = _mm_set1_ps(matrix._m[2][1]), m33 = _mm_set1_ps(matrix._m[2][2]), m34 = _mm_set1_ps(matrix._m[2][3]);
+                for (; index + 4 <= end; index += 4)
+                {
+                    const float* const source = &input[index]._x;
+                    const __m128 a = _mm_loadu_ps(source + 0); // x0 y0 z0 x1
+                    const __m128 b = _mm_loadu_ps(source + 4); // y1 z1 x2 y2
+                    const __m128 c = _mm_loadu_ps(source + 8); // z2 x3 y3 z3
+
+                    __m128 x;
+                    __m128 y;
+                    __m128 z;
+                    Simd::deinterleave3(a, b, c, x, y, z);
+
+                    __m128 resultX = Simd::multiplyAdd(m13, z, Simd::multiplyAdd(m12, y, _mm_mul_ps(m11, x)));
+                    __m128 resultY = Simd::multiplyAdd(m23, z, Simd::multiplyAdd(m22, y, _mm_mul_ps(m21, x)));
+                    __m128 resultZ = Simd::multiplyAdd(m33, z, Simd::multiplyAdd(m32, y, _mm_mul_ps(m31, x)));
+                    if constexpr (kHasTranslation)
+                    {
+                        resultX = _mm_add_ps(resultX, m14);
+                        resultY = _mm_add_ps(resultY, m24);
+                        resultZ = _mm_add_ps(resultZ, m34);
+                    }
+
+                    __m128 resultA;
+                    __m128 resultB;
+                    __m128 resultC;
+                    Simd::interleave3(resultX, resultY, resultZ, resultA, resultB, resultC);
+                    float* const destination = &output[index]._x;
+                    _mm_storeu_ps(destination + 0, resultA);
+                    _mm_storeu_ps(destination + 4, resultB);
+                    _mm_storeu_ps(destination + 8, resultC);
+                }
+#endif
+                for (; index < end; ++index)
+                {
+                    const Float3 source = input[index];
+                    const float w = (kHasTranslation == true) ? 1.0f : 0.0f;
+                    output[index].set(
+                        Float4::dotProductRaw(matrix._row[0]._f, source._x, source._y, source._z, w),
+                        Float4::dotProductRaw(matrix._row[1]._f, source._x, source._y, source._z, w),
+                        Float4::dotProductRaw(matrix._row[2]._f, source._x, source._y, source._z, w));
+                }
+            }
+
+            void transformFloat4Range(const Float4x4& matrix, const Float4* const input, Float4* const output, const uint32 begin, const uint32 end) noexcept
+            {
+                uint32 index = begin;
+#if defined MINT_MATH_USE_SIMD
+                // matrix * v = column0 * v.x + column1 * v.y + column2 * v.z + column3 * v.w
+                __m128 column0 = _mm_load_ps(matrix._row[0]._f);
+                __m128 column1 = _mm_load_ps(matrix._row[1]._f);
+                __m128 column2 = _mm_load_ps(matrix._row[2]._f);
+                __m128 column3 = _mm_load_ps(matrix._row[3]._f);
+                Simd::transpose4(column0, column1, column2, column3);
+                for (; index + 2 <= end; index += 2)
+                {
+                    const __m128 v0 = _mm_load_ps(input[index + 0]._f);
+                    const __m128 v1 = _mm_load_ps(input[index + 1]._f);
+                    const __m128 result0 = Simd::mulRowMatrix(v0, column0, column1, column2, column3);
+                    const __m128 result1 = Simd::mulRowMatrix(v1, column0, column1, column2, column3);
+                    _mm_store_ps(output[index + 0]._f, result0);
+                    _mm_store_ps(output[index + 1]._f, result1);
+                }
+#endif
+                for (; index < end; ++index)
+                {
+                    output[index] = matrix * input[index];
+                }
+            }
+
+            void transformSoARange(const Float4x4& matrix, const float* const inputX, const float* const inputY, const float* const inputZ,
+                float* const outputX, float* const outputY, float* const outputZ, const uint32 begin, const uint32 end) noexcept
+            {
+                uint32 index = begin;
+#if defined MINT_MATH_USE_SIMD
+                const __m128 m11 = _mm_set1_ps(matrix._m[0][0]), m12 = _mm_set1_ps(matrix._m[0][1]), m13 = _mm_set1_ps(matrix._m[0][2]), m14 = _mm_set1_ps(matrix._m[0][3]);
+                const __m128 m21 = _mm_set1_ps(matrix._m[1][0]), m22 = _mm_set1_ps(matrix._m[1][1]), m23 = _mm_set1_ps(matrix._m[1][2]), m24 = _mm_set1_ps(matrix._m[1][3]);
+                const __m128 m31 = _mm_set1_ps(matrix._m[2][0]), m32 = _mm_set1_ps(matrix._m[2][1]), m33 = _mm_set1_ps(matrix._m[2][2]), m34 = _mm_set1_ps(matrix._m[2][3]);
+                for (; index + 4 <= end; index += 4)
+                {
+                    const __m128 x = _mm_loadu_ps(inputX + index);
+                    const __m128 y = _mm_loadu_ps(inputY + index);
+                    const __m128 z = _mm_loadu_ps(inputZ + index);
+                    _mm_storeu_ps(outputX + index, Simd::multiplyAdd(m13, z, Simd::multiplyAdd(m12, y, Simd::multiplyAdd(m11, x, m14))));
+                    _mm_storeu_ps(outputY + index, Simd::multiplyAdd(m23, z, Simd::multiplyAdd(m22, y, Simd::multiplyAdd(m21, x, m24))));
+                    _mm_storeu_ps(outputZ + index, Simd::multiplyAdd(m33, z, Simd::multiplyAdd(m32, y, Simd::multiplyAdd(m31, x, m34))));
+                }
+#endif
+                for (; index < end; ++index)
+                {
+                    const float x = inputX[index];
+                    const float y = inputY[index];
+                    const float z = inputZ[index];
+                    outputX[index] = Float4::dotProductRaw(matrix._row[0]._f, x, y, z, 1.0f);
+                    outputY[index] = Float4::dotProductRaw(matrix._row[1]._f, x, y, z, 1.0f);
+                    outputZ[index] = Float4::dotProductRaw(matrix._row[2]._f, x, y, z, 1.0f);
+                }
+            }
+
+            MINT_INLINE void multiplyMatrix(const Float4x4& lhs, const Float4x4& rhs, Float4x4& output) noexcept
+            {
+#if defined MINT_MATH_USE_SIMD
+                const __m128 rhsRow0 = _mm_load_ps(rhs._row[0]._f);
+                const __m128 rhsRow1 = _mm_load_ps(rhs._row[1]._f);
+                const __m128 rhsRow2 = _mm_load_ps(rhs._row[2]._f);
+                const __m128 rhsRow3 = _mm_load_ps(rhs._row[3]._f);
+                const __m128 result0 = Simd::mulRowMatrix(_mm_load_ps(lhs._row[0]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3);
+                const __m128 result1 = Simd::mulRowMatrix(_mm_load_ps(lhs._row[1]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3);
+                const __m128 result2 = Simd::mulRowMatrix(_mm_load_ps(lhs._row[2]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3);
+                const __m128 result3 = Simd::mulRowMatrix(_mm_load_ps(lhs._row[3]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3);
+                _mm_store_ps(output._row[0]._f, result0);
+                _mm_store_ps(output._row[1]._f, result1);
+                _mm_store_ps(output._row[2]._f, result2);
+                _mm_store_ps(output._row[3]._f, result3);
+#else
+                output = lhs * rhs;
+#endif
+            }
+
+            void rotateFloat3Range(const Quaternion& rotation, const Float3* const input, Float3* const output, const uint32 begin, const uint32 end) noexcept
+            {
+                uint32 index = begin;
+#if defined MINT_MATH_USE_SIMD
+                // Quaternion::rotateVector 와 같은 식을 4 개의 vector 에 대해 SoA 로 계산한다.
+                // t = 2 * (u X v), v' = v + w * t + u X t
+                const __m128 ux = _mm_set1_ps(rotation._x);
+                const __m128 uy = _mm_set1_ps(rotation._y);
+                const __m128 uz = _mm_set1_ps(rotation._z);
+                const __m128 w = _mm_set1_ps(rotation._w);
+                const __m128 two = _mm_set1_ps(2.0f);
+                for (; index + 4 <= end; index += 4)
+                {
+                    const float* const source = &input[index]._x;
+                    __m128 x;
+                    __m128 y;
+                    __m128 z;
+                    Simd::deinterleave3(_mm_loadu_ps(source + 0), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+                    const __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(uy, z), _mm_mul_ps(uz, y)));
+                    const __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(uz, x), _mm_mul_ps(ux, z)));
+                    const __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(ux, y), _mm_mul_ps(uy, x)));
+                    const __m128 resultX = _mm_add_ps(Simd::multiplyAdd(w, tx, x), _mm_sub_ps(_mm_mul_ps(uy, tz), _mm_mul_ps(uz, ty)));
+                    const __m128 resultY = _mm_add_ps(Simd::multiplyAdd(w, ty, y), _mm_sub_ps(_mm_mul_ps(uz, tx), _mm_mul_ps(ux, tz)));
+                    const __m128 resultZ = _mm_add_ps(Simd::multiplyAdd(w, tz, z), _mm_sub_ps(_mm_mul_ps(ux, ty), _mm_mul_ps(uy, tx)));
+
+                    __m128 resultA;
+                    __m128 resultB;
+                    __m128 resultC;
+                    Simd::interleave3(resultX, resultY, resultZ, resultA, resultB, resultC);
+                    float* const destination = &output[index]._x;
+                    _mm_storeu_ps(destination + 0, resultA);
+                    _mm_storeu_ps(destination + 4, resultB);
+                    _mm_storeu_ps(destination + 8, resultC);
+                }
+#endif
+                for (; index < end; ++index)
+                {
+                    output[index] = rotation.rotateVector(input[index]);
+                }
+            }
+
+            // scales 와 translations 가 nullptr 이면 순수한 회전 행렬을 만든다.
+            template<bool kHasScaleTranslation>
+            void quaternionToMatrixRange(const Float3* const scales, const Quaternion* const rotations, const Float3* const translations, Float4x4* const output,
+                const uint32 begin, const uint32 end) noexcept
+            {
+                uint32 index = begin;
+#if defined MINT_MATH_USE_SIMD
+                // 4 개의 quaternion 을 SoA 로 바꿔서 행렬 성분을 lane 별로 계산한 다음,
+                // 각 row 를 transpose 해서 4 개의 행렬에 나눠 쓴다.
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 lastRow = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+                for (; index + 4 <= end; index += 4)
+                {
+                    __m128 x = _mm_load_ps(rotations[index + 0]._data._f);
+                    __m128 y = _mm_load_ps(rotations[index + 1]._data._f);
+                    __m128 z = _mm_load_ps(rotations[index + 2]._data._f);
+                    __m128 w = _mm_load_ps(rotations[index + 3]._data._f);
+                    Simd::transpose4(x, y, z, w);
+
+                    const __m128 x2 = _mm_add_ps(x, x);
+                    const __m128 y2 = _mm_add_ps(y, y);
+                    const __m128 z2 = _mm_add_ps(z, z);
+                    const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+                    const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+                    const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+                    __m128 m11 = _mm_sub_ps(_mm_sub_ps(one, yy), zz), m12 = _mm_sub_ps(xy, wz), m13 = _mm_add_ps(xz, wy);
+                    __m128 m21 = _mm_add_ps(xy, wz), m22 = _mm_sub_ps(_mm_sub_ps(one, xx), zz), m23 = _mm_sub_ps(yz, wx);
+                    __m128 m31 = _mm_sub_ps(xz, wy), m32 = _mm_add_ps(yz, wx), m33 = _mm_sub_ps(_mm_sub_ps(one, xx), yy);
+                    __m128 m14 = _mm_setzero_ps();
+                    __m128 m24 = _mm_setzero_ps();
+                    __m128 m34 = _mm_setzero_ps();
+                    if constexpr (kHasScaleTranslation)
+                    {
+                        // T * R * S 이므로 scale 은 column 에 곱하고, translation 은 4 번째 column 에 들어간다.
+                        const float* const scaleSource = &scales[index]._x;
+                        __m128 sx;
+                        __m128 sy;
+                        __m128 sz;
+                        Simd::deinterleave3(_mm_loadu_ps(scaleSource + 0), _mm_loadu_ps(scaleSource + 4), _mm_loadu_ps(scaleSource + 8), sx, sy, sz);
+                        m11 = _mm_mul_ps(m11, sx); m21 = _mm_mul_ps(m21, sx); m31 = _mm_mul_ps(m31, sx);
+                        m12 = _mm_mul_ps(m12, sy); m22 = _mm_mul_ps(m22, sy); m32 = _mm_mul_ps(m32, sy);
+                        m13 = _mm_mul_ps(m13, sz); m23 = _mm_mul_ps(m23, sz); m33 = _mm_mul_ps(m33, sz);
+
+                        const float* const translationSource = &translations[index]._x;
+                        Simd::deinterleave3(_mm_loadu_ps(translationSource + 0), _mm_loadu_ps(translationSource + 4), _mm_loadu_ps(translationSource + 8), m14, m24, m34);
+                    }
+
+                    Simd::transpose4(m11, m12, m13, m14);
+                    Simd::transpose4(m21, m22, m23, m24);
+                    Simd::transpose4(m31, m32, m33, m34);
+                    _mm_store_ps(output[index + 0]._row[0]._f, m11);
+                    _mm_store_ps(output[index + 0]._row[1]._f, m21);
+                    _mm_store_ps(output[index + 0]._row[2]._f, m31);
+                    _mm_store_ps(output[index + 0]._row[3]._f, lastRow);
+                    _mm_store_ps(output[index + 1]._row[0]._f, m12);
+                    _mm_store_ps(output[index + 1]._row[1]._f, m22);
+                    _mm_store_ps(output[index + 1]._row[2]._f, m32);
+                    _mm_store_ps(output[index + 1]._row[3]._f, lastRow);
+                    _mm_store_ps(output[index + 2]._row[0]._f, m13);
+                    _mm_store_ps(output[index + 2]._row[1]._f, m23);
+                    _mm_store_ps(output[index + 2]._row[2]._f, m33);
+                    _mm_store_ps(output[index + 2]._row[3]._f, lastRow);
+                    _mm_store_ps(output[index + 3]._row[0]._f, m14);
+                    _mm_store_ps(output[index + 3]._row[1]._f, m24);
+                    _mm_store_ps(output[index + 3]._row[2]._f, m34);
+                    _mm_store_ps(output[index + 3]._row[3]._f, lastRow);
+                }
+#endif
+                for (; index < end; ++index)
+                {
+                    if constexpr (kHasScaleTranslation)
+                    {
+                        output[index] = Float4x4::srtMatrix(scales[index], rotations[index], translations[index]);
+                    }
+                    else
+                    {
+                        output[index] = Float4x4::rotationMatrix(rotations[index]);
+                    }
+                }
+            }
+        }
+
+
+        void transformPoints(const Float4x4& matrix, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    transformFloat3Range<true>(matrix, input, output, begin, end);
+                });
+        }
+
+        void transformPoints(const Float4x4& matrix, const Float4* const input, Float4* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    transformFloat4Range(matrix, input, output, begin, end);
+                });
+        }
+
+        void transformNormals(const Float4x4& matrix, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    transformFloat3Range<false>(matrix, input, output, begin, end);
+                });
+        }
+
+        void transformPointsSoA(const Float4x4& matrix, const float* const inputX, const float* const inputY, const float* const inputZ,
+            float* const outputX, float* const outputY, float* const outputZ, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    transformSoARange(matrix, inputX, inputY, inputZ, outputX, outputY, outputZ, begin, end);
+                });
+        }
+
+        void multiplyMatrices(const Float4x4* const lhs, const Float4x4* const rhs, Float4x4* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinMatrixCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    for (uint32 index = begin; index < end; ++index)
+                    {
+                        multiplyMatrix(lhs[index], rhs[index], output[index]);
+                    }
+                });
+        }
+
+        void multiplyMatrices(const Float4x4& lhs, const Float4x4* const rhs, Float4x4* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinMatrixCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    for (uint32 index = begin; index < end; ++index)
+                    {
+                        multiplyMatrix(lhs, rhs[index], output[index]);
+                    }
+                });
+        }
+
+        void multiplyQuaternions(const Quaternion* const lhs, const Quaternion* const rhs, Quaternion* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    for (uint32 index = begin; index < end; ++index)
+                    {
+                        output[index] = lhs[index] * rhs[index];
+                    }
+                });
+        }
+
+        void rotateVectors(const Quaternion& rotation, const Float3* const input, Float3* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinVectorCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    rotateFloat3Range(rotation, input, output, begin, end);
+                });
+        }
+
+        void rotationMatrices(const Quaternion* const rotations, Float4x4* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinMatrixCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    quaternionToMatrixRange<false>(nullptr, rotations, nullptr, output, begin, end);
+                });
+        }
+
+        void srtMatrices(const Float3* const scales, const Quaternion* const rotations, const Float3* const translations, Float4x4* const output, const uint32 count, const bool useParallelFor) noexcept
+        {
+            dispatch(count, kParallelMinMatrixCount, useParallelFor, [&](const uint32 begin, const uint32 end)
+                {
+                    quaternionToMatrixRange<true>(scales, rotations, translations, output, begin, end);
+                });
+        }
+    }
+}
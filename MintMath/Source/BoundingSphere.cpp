@@ -0,0 +1,59 @@
+﻿#include <MintMath/Include/BoundingSphere.h>
+
+
+namespace mint
+{
+    BoundingSphere BoundingSphere::fromPoints(const mint::Float3* const points, const uint32 count) noexcept
+    {
+        const mint::Float3 center = AABB::fromPoints(points, count).getCenter();
+        float radiusSquared = 0.0f;
+        for (uint32 index = 0; index < count; ++index)
+        {
+            radiusSquared = mint::max(radiusSquared, (points[index] - center).lengthSqaure());
+        }
+        return BoundingSphere(center, ::sqrt(radiusSquared));
+    }
+
+    BoundingSphere BoundingSphere::fromAABB(const AABB& aabb) noexcept
+    {
+        return BoundingSphere(aabb.getCenter(), aabb.getExtents().length());
+    }
+
+
+    BoundingSphere::BoundingSphere()
+        : _radius{ 0.0f }
+    {
+        __noop;
+    }
+
+    BoundingSphere::BoundingSphere(const mint::Float3& center, const float radius)
+        : _center{ center }
+        , _radius{ radius }
+    {
+        __noop;
+    }
+
+    const bool BoundingSphere::contains(const mint::Float3& point) const noexcept
+    {
+        return (point - _center).lengthSqaure() <= _radius * _radius;
+    }
+
+    const bool BoundingSphere::intersects(const BoundingSphere& rhs) const noexcept
+    {
+        const float radiusSum = _radius + rhs._radius;
+        return (rhs._center - _center).lengthSqaure() <= radiusSum * radiusSum;
+    }
+
+    const bool BoundingSphere::intersects(const AABB& aabb) const noexcept
+    {
+        // AABB 에서 center 와 가장 가까운 점까지의 거리
+        float distanceSquared = 0.0f;
+        for (uint32 axis = 0; axis < 3; ++axis)
+        {
+            const float closest = Math::clamp(_center[axis], aabb._min[axis], aabb._max[axis]);
+            const float delta = _center[axis] - closest;
+            distanceSquared += delta * delta;
+        }
+        return distanceSquared <= _radius * _radius;
+    }
+}
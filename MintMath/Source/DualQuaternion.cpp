@@ -0,0 +1,98 @@
+﻿#include <MintMath/Include/DualQuaternion.h>
+
+
+namespace mint
+{
+    DualQuaternion DualQuaternion::fromTransform(const mint::Quaternion& rotation, const mint::Float3& translation) noexcept
+    {
+        return DualQuaternion(rotation, mint::Quaternion(0.0f, translation._x, translation._y, translation._z) * rotation * 0.5f);
+    }
+
+    DualQuaternion DualQuaternion::nlerp(const DualQuaternion& from, const DualQuaternion& to, const float t) noexcept
+    {
+        // 짧은 경로로 보간하기 위해 real part 의 부호를 맞춘다.
+        const float tTo = (mint::Quaternion::dot(from._real, to._real) < 0.0f) ? -t : t;
+        DualQuaternion result;
+        result._real._data = from._real._data * (1.0f - t) + to._real._data * tTo;
+        result._dual._data = from._dual._data * (1.0f - t) + to._dual._data * tTo;
+        result.normalize();
+        return result;
+    }
+
+
+    DualQuaternion::DualQuaternion()
+        : _real{}
+        , _dual{ 0.0f, 0.0f, 0.0f, 0.0f }
+    {
+        __noop;
+    }
+
+    DualQuaternion::DualQuaternion(const mint::Quaternion& real, const mint::Quaternion& dual)
+        : _real{ real }
+        , _dual{ dual }
+    {
+        __noop;
+    }
+
+    DualQuaternion DualQuaternion::operator*(const DualQuaternion& rhs) const noexcept
+    {
+        // (r0 + εd0)(r1 + εd1) = r0r1 + ε(r0d1 + d0r1)
+        DualQuaternion result(_real * rhs._real, _real * rhs._dual);
+        result._dual._data += (_dual * rhs._real)._data;
+        return result;
+    }
+
+    DualQuaternion& DualQuaternion::operator*=(const DualQuaternion& rhs) noexcept
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    void DualQuaternion::normalize() noexcept
+    {
+        const float inverseNorm = 1.0f / _real._data.length();
+        _real._data *= inverseNorm;
+        _dual._data *= inverseNorm;
+    }
+
+    DualQuaternion DualQuaternion::inverse() const noexcept
+    {
+        return DualQuaternion(_real.conjugate(), _dual.conjugate());
+    }
+
+    mint::Float3 DualQuaternion::transformPoint(const mint::Float3& point) const noexcept
+    {
+        return _real.rotateVector(point) + getTranslation();
+    }
+
+    mint::Float3 DualQuaternion::transformVector(const mint::Float3& vector) const noexcept
+    {
+        return _real.rotateVector(vector);
+    }
+
+    const mint::Quaternion& DualQuaternion::getRotation() const noexcept
+    {
+        return _real;
+    }
+
+    mint::Float3 DualQuaternion::getTranslation() const noexcept
+    {
+        // t = 2 * dual * real^*
+        const mint::Quaternion translation = _dual * _real.conjugate();
+        return mint::Float3(translation._x * 2.0f, translation._y * 2.0f, translation._z * 2.0f);
+    }
+
+    mint::Float4x4 DualQuaternion::toMatrix() const noexcept
+    {
+        mint::Float4x4 result = mint::Float4x4::rotationMatrix(_real);
+        result.setTranslation(getTranslation());
+        return result;
+    }
+
+    mint::Transform3x4 DualQuaternion::toTransform3x4() const noexcept
+    {
+        mint::Transform3x4 result = mint::Transform3x4::srt(mint::Float3::kUnitScale, _real, mint::Float3());
+        result.setTranslation(getTranslation());
+        return result;
+    }
+}
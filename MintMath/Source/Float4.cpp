@@ -33,11 +33,20 @@ namespace mint
 
     const float Float4::dot(const Float4& lhs, const Float4& rhs) noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        return _mm_cvtss_f32(Simd::dot4(_mm_load_ps(lhs._f), _mm_load_ps(rhs._f)));
+#else
         return dotProductRaw(&lhs._x, &rhs._x);
+#endif
     }
 
     Float4 Float4::cross(const Float4& lhs, const Float4& rhs) noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, Simd::cross3(_mm_load_ps(lhs._f), _mm_load_ps(rhs._f)));
+        return result;
+#else
         return Float4
         (
             lhs._y * rhs._z  -  lhs._z * rhs._y,
@@ -45,6 +54,7 @@ namespace mint
             lhs._x * rhs._y  -  lhs._y * rhs._x,
             0.0f // a vector, not point
         );
+#endif
     }
 
     Float4 Float4::crossNormalize(const Float4& lhs, const Float4& rhs) noexcept
@@ -54,7 +64,26 @@ namespace mint
 
     Float4 Float4::normalize(const Float4& float4) noexcept
     {
-        return (float4 / float4.length());
+        // 길이가 0 이면 0 으로 나누게 되므로 그대로 반환한다.
+#if defined MINT_MATH_USE_SIMD
+        const __m128 v = _mm_load_ps(float4._f);
+        const __m128 lengthSquare = Simd::dot4(v, v);
+        if (_mm_cvtss_f32(lengthSquare) == 0.0f)
+        {
+            return float4;
+        }
+
+        Float4 result;
+        _mm_store_ps(result._f, _mm_div_ps(v, _mm_sqrt_ps(lengthSquare)));
+        return result;
+#else
+        const float length = float4.length();
+        if (length == 0.0f)
+        {
+            return float4;
+        }
+        return (float4 / length);
+#endif
     }
 
     Float4& Float4::transform(const Float4x4& matrix) noexcept
@@ -1,12 +1,56 @@
 ﻿#include <MintMath/Include/Float4x4.h>
 
 #include <MintMath/Include/Float3x3.h>
+#include <MintMath/Include/FastMath.h>
 
 #include <cstring>
 
 
 namespace mint
 {
+#if defined MINT_MATH_USE_SIMD
+    namespace Simd
+    {
+        // 아래의 2x2 행렬은 row-major 로 (_11, _12, _21, _22) 를 한 __m128 에 담는다.
+        // Block 행렬을 이용한 4x4 역행렬 계산에 쓰인다.
+
+        // a * b
+        MINT_INLINE __m128 mul2x2(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // adjugate(a) * b
+        MINT_INLINE __m128 adjugateMul2x2(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        // a * adjugate(b)
+        MINT_INLINE __m128 mulAdjugate2x2(const __m128 a, const __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        MINT_INLINE __m128 horizontalSum(const __m128 v) noexcept
+        {
+            const __m128 sum = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        }
+
+        // (|A|, |B|, |C|, |D|) where M = | A B |
+        //                                | C D |
+        MINT_INLINE __m128 subDeterminants2x2(const __m128 row0, const __m128 row1, const __m128 row2, const __m128 row3) noexcept
+        {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+                _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0)))
+            );
+        }
+    }
+#endif
+
+
     const Float4x4 Float4x4::kIdentity = Float4x4();
 
     Float4 Float4x4::mul(const Float4x4& m, const Float4& v) noexcept
@@ -58,32 +102,41 @@ namespace mint
 
     Float4x4 Float4x4::rotationMatrixX(const float angle) noexcept
     {
+        float s;
+        float c;
+        Math::sinCos(angle, s, c);
         return Float4x4
         (
             1.0f            , 0.0f            , 0.0f            , 0.0f,
-            0.0f            , +cosf(angle)    , -sinf(angle)    , 0.0f,
-            0.0f            , +sinf(angle)    , +cosf(angle)    , 0.0f,
+            0.0f            , +c              , -s              , 0.0f,
+            0.0f            , +s              , +c              , 0.0f,
             0.0f            , 0.0f            , 0.0f            , 1.0f
         );
     }
 
     Float4x4 Float4x4::rotationMatrixY(const float angle) noexcept
     {
+        float s;
+        float c;
+        Math::sinCos(angle, s, c);
         return Float4x4
         (
-            +cosf(angle)    , 0.0f            , +sinf(angle)    , 0.0f,
+            +c              , 0.0f            , +s              , 0.0f,
             0.0f            , 1.0f            , 0.0f            , 0.0f,
-            -sinf(angle)    , 0.0f            , +cosf(angle)    , 0.0f,
+            -s              , 0.0f            , +c              , 0.0f,
             0.0f            , 0.0f            , 0.0f            , 1.0f
         );
     }
 
     Float4x4 Float4x4::rotationMatrixZ(const float angle) noexcept
     {
+        float s;
+        float c;
+        Math::sinCos(angle, s, c);
         return Float4x4
         (
-            +cosf(angle)    , -sinf(angle)    , 0.0f            , 0.0f,
-            +sinf(angle)    , +cosf(angle)    , 0.0f            , 0.0f,
+            +c              , -s              , 0.0f            , 0.0f,
+            +s              , +c              , 0.0f            , 0.0f,
             0.0f            , 0.0f            , 1.0f            , 0.0f,
             0.0f            , 0.0f            , 0.0f            , 1.0f
         );
@@ -99,8 +152,9 @@ namespace mint
         // (v * r)r(1 - cosθ) + vcosθ + (r X v)sinθ
 
         const Float3 r = Float3::normalize(axis);
-        const float c = cosf(angle);
-        const float s = sinf(angle);
+        float s;
+        float c;
+        Math::sinCos(angle, s, c);
 
         const float rx = r._x;
         const float ry = r._y;
@@ -122,10 +176,21 @@ namespace mint
 
     Float4x4 Float4x4::rotationMatrix(const mint::Quaternion& rotation) noexcept
     {
-        mint::Float3 axis;
-        float angle;
-        rotation.getAxisAngle(axis, angle);
-        return rotationMatrixAxisAngle(axis, angle);
+        // Unit quaternion 을 바로 행렬로 바꾼다. (axis-angle 을 거치지 않으므로 삼각함수가 필요 없다)
+        const float x = rotation._x;
+        const float y = rotation._y;
+        const float z = rotation._z;
+        const float w = rotation._w;
+        const float xx = x * x * 2.0f, yy = y * y * 2.0f, zz = z * z * 2.0f;
+        const float xy = x * y * 2.0f, xz = x * z * 2.0f, yz = y * z * 2.0f;
+        const float wx = w * x * 2.0f, wy = w * y * 2.0f, wz = w * z * 2.0f;
+        return Float4x4
+        (
+            1.0f - yy - zz,        xy - wz,        xz + wy, 0.0f,
+                   xy + wz, 1.0f - xx - zz,        yz - wx, 0.0f,
+                   xz - wy,        yz + wx, 1.0f - xx - yy, 0.0f,
+                      0.0f,           0.0f,           0.0f, 1.0f
+        );
     }
 
     Float4x4 Float4x4::axesToColumns(const mint::Float3& axisX, const mint::Float3& axisY, const mint::Float3& axisZ) noexcept
@@ -228,6 +293,9 @@ namespace mint
 
     Float4x4& Float4x4::operator*=(const Float4x4& rhs) noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        *this = mul(rhs);
+#else
         // row 0
         mint::Float4 row = _row[0];
         _row[0]._x = Float4::dotProductRaw(row._f, rhs._m[0][0], rhs._m[1][0], rhs._m[2][0], rhs._m[3][0]);
@@ -255,7 +323,7 @@ namespace mint
         _row[3]._y = Float4::dotProductRaw(row._f, rhs._m[0][1], rhs._m[1][1], rhs._m[2][1], rhs._m[3][1]);
         _row[3]._z = Float4::dotProductRaw(row._f, rhs._m[0][2], rhs._m[1][2], rhs._m[2][2], rhs._m[3][2]);
         _row[3]._w = Float4::dotProductRaw(row._f, rhs._m[0][3], rhs._m[1][3], rhs._m[2][3], rhs._m[3][3]);
-
+#endif
         return *this;
     }
 
@@ -523,15 +591,48 @@ namespace mint
 
     const float Float4x4::determinant() const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        const __m128 row0 = _mm_load_ps(_row[0]._f);
+        const __m128 row1 = _mm_load_ps(_row[1]._f);
+        const __m128 row2 = _mm_load_ps(_row[2]._f);
+        const __m128 row3 = _mm_load_ps(_row[3]._f);
+        const __m128 a = _mm_movelh_ps(row0, row1);
+        const __m128 b = _mm_movehl_ps(row1, row0);
+        const __m128 c = _mm_movelh_ps(row2, row3);
+        const __m128 d = _mm_movehl_ps(row3, row2);
+
+        // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        const __m128 subDeterminants = Simd::subDeterminants2x2(row0, row1, row2, row3);
+        const __m128 dAdjugateC = Simd::adjugateMul2x2(d, c);
+        const __m128 aAdjugateB = Simd::adjugateMul2x2(a, b);
+        const __m128 trace = Simd::horizontalSum(_mm_mul_ps(aAdjugateB, _mm_shuffle_ps(dAdjugateC, dAdjugateC, _MM_SHUFFLE(3, 1, 2, 0))));
+        const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(Simd::splat<0>(subDeterminants), Simd::splat<3>(subDeterminants)), _mm_mul_ps(Simd::splat<1>(subDeterminants), Simd::splat<2>(subDeterminants))), trace);
+        return _mm_cvtss_f32(determinant);
+#else
         const float a = _m[0][0];
         const float b = _m[0][1];
         const float c = _m[0][2];
         const float d = _m[0][3];
         return a * minor(0, 0).determinant() - b * minor(0, 1).determinant() + c * minor(0, 2).determinant() - d * minor(0, 3).determinant();
+#endif
     }
 
     Float4x4 Float4x4::transpose() const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        __m128 row0 = _mm_load_ps(_row[0]._f);
+        __m128 row1 = _mm_load_ps(_row[1]._f);
+        __m128 row2 = _mm_load_ps(_row[2]._f);
+        __m128 row3 = _mm_load_ps(_row[3]._f);
+        Simd::transpose4(row0, row1, row2, row3);
+
+        Float4x4 result;
+        _mm_store_ps(result._row[0]._f, row0);
+        _mm_store_ps(result._row[1]._f, row1);
+        _mm_store_ps(result._row[2]._f, row2);
+        _mm_store_ps(result._row[3]._f, row3);
+        return result;
+#else
         return Float4x4
         (
             _m[0][0], _m[1][0], _m[2][0], _m[3][0],
@@ -539,6 +640,7 @@ namespace mint
             _m[0][2], _m[1][2], _m[2][2], _m[3][2],
             _m[0][3], _m[1][3], _m[2][3], _m[3][3]
         );
+#endif
     }
 
     Float4x4 Float4x4::cofactor() const noexcept
@@ -559,11 +661,92 @@ namespace mint
 
     Float4x4 Float4x4::inverse() const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        // Block 행렬을 이용한 역행렬
+        // M = | A B |  ,  inverse(M) = 1/|M| * | X# Y# |#
+        //     | C D |                          | Z# W# |
+        const __m128 row0 = _mm_load_ps(_row[0]._f);
+        const __m128 row1 = _mm_load_ps(_row[1]._f);
+        const __m128 row2 = _mm_load_ps(_row[2]._f);
+        const __m128 row3 = _mm_load_ps(_row[3]._f);
+        const __m128 a = _mm_movelh_ps(row0, row1);
+        const __m128 b = _mm_movehl_ps(row1, row0);
+        const __m128 c = _mm_movelh_ps(row2, row3);
+        const __m128 d = _mm_movehl_ps(row3, row2);
+
+        const __m128 subDeterminants = Simd::subDeterminants2x2(row0, row1, row2, row3);
+        const __m128 determinantA = Simd::splat<0>(subDeterminants);
+        const __m128 determinantB = Simd::splat<1>(subDeterminants);
+        const __m128 determinantC = Simd::splat<2>(subDeterminants);
+        const __m128 determinantD = Simd::splat<3>(subDeterminants);
+
+        const __m128 dAdjugateC = Simd::adjugateMul2x2(d, c);
+        const __m128 aAdjugateB = Simd::adjugateMul2x2(a, b);
+        __m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), Simd::mul2x2(b, dAdjugateC));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), Simd::mul2x2(c, aAdjugateB));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), Simd::mulAdjugate2x2(d, aAdjugateB));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), Simd::mulAdjugate2x2(a, dAdjugateC));
+
+        const __m128 trace = Simd::horizontalSum(_mm_mul_ps(aAdjugateB, _mm_shuffle_ps(dAdjugateC, dAdjugateC, _MM_SHUFFLE(3, 1, 2, 0))));
+        const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+        const __m128 reciprocalDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+        x = _mm_mul_ps(x, reciprocalDeterminant);
+        y = _mm_mul_ps(y, reciprocalDeterminant);
+        z = _mm_mul_ps(z, reciprocalDeterminant);
+        w = _mm_mul_ps(w, reciprocalDeterminant);
+
+        // adjugate 와 저장 순서를 한 번의 shuffle 로 처리한다.
+        Float4x4 result;
+        _mm_store_ps(result._row[0]._f, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(result._row[1]._f, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_store_ps(result._row[2]._f, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(result._row[3]._f, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+        return result;
+#else
         return adjugate() / determinant();
+#endif
     }
 
     Float4x4 Float4x4::mul(const Float4x4& rhs) const noexcept
     {
+#if defined MINT_MATH_USE_AVX
+        // 두 row 를 한 번에 계산한다.
+        const __m256 rhsRow0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs._row[0]._f));
+        const __m256 rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs._row[1]._f));
+        const __m256 rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs._row[2]._f));
+        const __m256 rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs._row[3]._f));
+
+        Float4x4 result;
+        for (uint32 rowIndex = 0; rowIndex < 4; rowIndex += 2)
+        {
+            const __m256 rows = _mm256_loadu_ps(_row[rowIndex]._f);
+#if defined MINT_MATH_USE_FMA
+            __m256 resultRows = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+            resultRows = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1, resultRows);
+            resultRows = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2, resultRows);
+            resultRows = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3, resultRows);
+#else
+            __m256 resultRows = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+            resultRows = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1), resultRows);
+            resultRows = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2), resultRows);
+            resultRows = _mm256_add_ps(_mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3), resultRows);
+#endif
+            _mm256_storeu_ps(result._row[rowIndex]._f, resultRows);
+        }
+        return result;
+#elif defined MINT_MATH_USE_SIMD
+        const __m128 rhsRow0 = _mm_load_ps(rhs._row[0]._f);
+        const __m128 rhsRow1 = _mm_load_ps(rhs._row[1]._f);
+        const __m128 rhsRow2 = _mm_load_ps(rhs._row[2]._f);
+        const __m128 rhsRow3 = _mm_load_ps(rhs._row[3]._f);
+
+        Float4x4 result;
+        _mm_store_ps(result._row[0]._f, Simd::mulRowMatrix(_mm_load_ps(_row[0]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+        _mm_store_ps(result._row[1]._f, Simd::mulRowMatrix(_mm_load_ps(_row[1]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+        _mm_store_ps(result._row[2]._f, Simd::mulRowMatrix(_mm_load_ps(_row[2]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+        _mm_store_ps(result._row[3]._f, Simd::mulRowMatrix(_mm_load_ps(_row[3]._f), rhsRow0, rhsRow1, rhsRow2, rhsRow3));
+        return result;
+#else
         return Float4x4
         (
             // row 0
@@ -590,10 +773,14 @@ namespace mint
             Float4::dotProductRaw(_row[3]._f, rhs._m[0][2], rhs._m[1][2], rhs._m[2][2], rhs._m[3][2]),
             Float4::dotProductRaw(_row[3]._f, rhs._m[0][3], rhs._m[1][3], rhs._m[2][3], rhs._m[3][3])
         );
+#endif
     }
 
     void Float4x4::mulAssignReverse(const Float4x4& lhs) noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        *this = lhs.mul(*this);
+#else
         static constexpr uint32 kRowCount = 4;
         static constexpr uint32 kColumnCount = 4;
 
@@ -605,10 +792,16 @@ namespace mint
                 _row[rowIndex][columnIndex] = Float4::dotProductRaw(lhs._row[rowIndex]._f, copy._m[0][columnIndex], copy._m[1][columnIndex], copy._m[2][columnIndex], copy._m[3][columnIndex]);
             }
         }
+#endif
     }
 
     Float4 Float4x4::mul(const Float4& v) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Float4 result;
+        _mm_store_ps(result._f, Simd::dot4x4(_mm_load_ps(_row[0]._f), _mm_load_ps(_row[1]._f), _mm_load_ps(_row[2]._f), _mm_load_ps(_row[3]._f), _mm_load_ps(v._f)));
+        return result;
+#else
         return Float4
         (
             // x'
@@ -623,6 +816,7 @@ namespace mint
             // w'
             Float4::dot(_row[3], v)
         );
+#endif
     }
 
     Float3 Float4x4::mul(const Float3& v) const noexcept
@@ -0,0 +1,136 @@
+﻿#include <MintMath/Include/Frustum.h>
+
+
+namespace mint
+{
+    Frustum Frustum::fromViewProjectionMatrix(const mint::Float4x4& viewProjectionMatrix) noexcept
+    {
+        // clip = M * p 일 때, -w <= x <= w, -w <= y <= w, 0 <= z <= w
+        const mint::Float4& row0 = viewProjectionMatrix._row[0];
+        const mint::Float4& row1 = viewProjectionMatrix._row[1];
+        const mint::Float4& row2 = viewProjectionMatrix._row[2];
+        const mint::Float4& row3 = viewProjectionMatrix._row[3];
+        Frustum frustum;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Left)]._data = row3 + row0;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Right)]._data = row3 - row0;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Bottom)]._data = row3 + row1;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Top)]._data = row3 - row1;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Near)]._data = row2;
+        frustum._planes[static_cast<uint32>(PlaneIndex::Far)]._data = row3 - row2;
+        for (uint32 planeIndex = 0; planeIndex < kPlaneCount; ++planeIndex)
+        {
+            frustum._planes[planeIndex].normalize();
+        }
+        return frustum;
+    }
+
+    const Plane& Frustum::getPlane(const PlaneIndex planeIndex) const noexcept
+    {
+        return _planes[static_cast<uint32>(planeIndex)];
+    }
+
+    const bool Frustum::contains(const mint::Float3& point) const noexcept
+    {
+        for (uint32 planeIndex = 0; planeIndex < kPlaneCount; ++planeIndex)
+        {
+            if (_planes[planeIndex].signedDistance(point) < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const bool Frustum::intersects(const AABB& aabb) const noexcept
+    {
+        // 평면 쪽으로 가장 많이 나온 꼭짓점까지의 거리 = dot(n, center) + d + dot(|n|, extents)
+        const mint::Float3 center = aabb.getCenter();
+        const mint::Float3 extents = aabb.getExtents();
+        for (uint32 planeIndex = 0; planeIndex < kPlaneCount; ++planeIndex)
+        {
+            const mint::Float4& plane = _planes[planeIndex]._data;
+            const float radius = Math::absolute(plane._x) * extents._x + Math::absolute(plane._y) * extents._y + Math::absolute(plane._z) * extents._z;
+            if (_planes[planeIndex].signedDistance(center) + radius < 0.0f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const bool Frustum::intersects(const BoundingSphere& sphere) const noexcept
+    {
+        for (uint32 planeIndex = 0; planeIndex < kPlaneCount; ++planeIndex)
+        {
+            if (_planes[planeIndex].signedDistance(sphere._center) < -sphere._radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const uint32 Frustum::cullAABBs(const AABB* const aabbs, const uint32 count, bool* const outIsVisible) const noexcept
+    {
+        uint32 visibleCount = 0;
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        static_assert(sizeof(AABB) == sizeof(mint::Float3) * 2, "AABB 는 Float3 두 개여야 합니다!");
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        for (; index + 4 <= count; index += 4)
+        {
+            // 4 개의 AABB (Float3 8 개) 를 min/max 의 SoA 로 바꾼다.
+            const float* const source = &aabbs[index]._min._x;
+            __m128 x01;
+            __m128 y01;
+            __m128 z01;
+            __m128 x23;
+            __m128 y23;
+            __m128 z23;
+            Simd::deinterleave3(_mm_loadu_ps(source + 0), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x01, y01, z01);
+            Simd::deinterleave3(_mm_loadu_ps(source + 12), _mm_loadu_ps(source + 16), _mm_loadu_ps(source + 20), x23, y23, z23);
+            const __m128 minX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 maxX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 minY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 maxY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 minZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 maxZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 centerX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+            const __m128 centerY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+            const __m128 centerZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+            const __m128 extentX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+            const __m128 extentY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+            const __m128 extentZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+            __m128 outside = _mm_setzero_ps();
+            for (uint32 planeIndex = 0; planeIndex < kPlaneCount; ++planeIndex)
+            {
+                const __m128 plane = _mm_load_ps(_planes[planeIndex]._data._f);
+                const __m128 absolutePlane = _mm_andnot_ps(signMask, plane);
+                __m128 distance = Simd::multiplyAdd(Simd::splat<0>(plane), centerX, Simd::splat<3>(plane));
+                distance = Simd::multiplyAdd(Simd::splat<1>(plane), centerY, distance);
+                distance = Simd::multiplyAdd(Simd::splat<2>(plane), centerZ, distance);
+                distance = Simd::multiplyAdd(Simd::splat<0>(absolutePlane), extentX, distance);
+                distance = Simd::multiplyAdd(Simd::splat<1>(absolutePlane), extentY, distance);
+                distance = Simd::multiplyAdd(Simd::splat<2>(absolutePlane), extentZ, distance);
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+            }
+
+            const int32 outsideMask = _mm_movemask_ps(outside);
+            for (uint32 lane = 0; lane < 4; ++lane)
+            {
+                const bool isVisible = (outsideMask & (1 << lane)) == 0;
+                outIsVisible[index + lane] = isVisible;
+                visibleCount += (isVisible == true) ? 1 : 0;
+            }
+        }
+#endif
+        for (; index < count; ++index)
+        {
+            outIsVisible[index] = intersects(aabbs[index]);
+            visibleCount += (outIsVisible[index] == true) ? 1 : 0;
+        }
+        return visibleCount;
+    }
+}
@@ -0,0 +1,525 @@
+﻿#include <MintMath/Include/PackedTypes.h>
+
+#include <MintMath/Include/SimdCommon.h>
+
+#include <cmath>
+#include <cstring>
+
+
+namespace mint
+{
+    static_assert(sizeof(Half) == 2, "Half must be tightly packed!");
+    static_assert(sizeof(Half2) == 4, "Half2 must be tightly packed!");
+    static_assert(sizeof(Half4) == 8, "Half4 must be tightly packed!");
+    static_assert(sizeof(UNorm8x4) == 4, "UNorm8x4 must be tightly packed!");
+    static_assert(sizeof(SNorm16x2) == 4, "SNorm16x2 must be tightly packed!");
+
+
+    namespace VertexPacking
+    {
+        namespace
+        {
+            // float <-> half 변환은 F16C 가 없을 때 SIMD 와 scalar 모두 같은 bit 연산을 쓴다.
+            // (Fabian Giesen, "float->half variants")
+            static constexpr uint32 kSignMask           = 0x80000000u;
+            static constexpr uint32 kFloatInfinity      = 255u << 23;
+            // 이 값 이상이면 half 로 표현할 수 없다. (65520 은 반올림하면 무한대)
+            static constexpr uint32 kHalfOverflow       = (127u + 16u) << 23;
+            // 이 값 미만이면 half 의 denormal (또는 0) 이 된다.
+            static constexpr uint32 kHalfNormalMin      = 113u << 23;
+            // float 덧셈으로 denormal 의 반올림을 처리하기 위한 값 (0.5f)
+            static constexpr uint32 kDenormalMagic      = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+            // 지수를 float bias 에서 half bias 로 바꾸고, round-to-nearest-even 을 위해 0xFFF 를 더한다.
+            static constexpr uint32 kRebiasAndRound     = ((15u - 127u) << 23) + 0xFFFu;
+            static constexpr uint32 kHalfExponentMask   = 0x7C00u << 13;
+            static constexpr uint32 kExponentAdjust     = (127u - 15u) << 23;
+            static constexpr uint32 kInfNanAdjust       = (128u - 16u) << 23;
+            static constexpr float  kUNorm8Scale        = 255.0f;
+            static constexpr float  kSNorm16Scale       = 32767.0f;
+
+            MINT_INLINE const uint32 floatToBits(const float value) noexcept
+            {
+                uint32 bits;
+                ::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+
+            MINT_INLINE const float bitsToFloat(const uint32 bits) noexcept
+            {
+                float value;
+                ::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            const uint16 floatToHalfBits(const float value) noexcept
+            {
+                uint32 bits = floatToBits(value);
+                const uint32 sign = bits & kSignMask;
+                bits ^= sign;
+
+                uint32 result;
+                if (bits >= kHalfOverflow)
+                {
+                    // 무한대 또는 NaN
+                    result = (bits > kFloatInfinity) ? 0x7E00u : 0x7C00u;
+                }
+                else if (bits < kHalfNormalMin)
+                {
+                    result = floatToBits(bitsToFloat(bits) + bitsToFloat(kDenormalMagic)) - kDenormalMagic;
+                }
+                else
+                {
+                    const uint32 mantissaOdd = (bits >> 13) & 1u;
+                    result = (bits + kRebiasAndRound + mantissaOdd) >> 13;
+                }
+                return static_cast<uint16>(result | (sign >> 16));
+            }
+
+            const float halfBitsToFloat(const uint16 halfBits) noexcept
+            {
+                uint32 bits = static_cast<uint32>(halfBits & 0x7FFFu) << 13;
+                const uint32 exponent = bits & kHalfExponentMask;
+                bits += kExponentAdjust;
+                if (exponent == kHalfExponentMask)
+                {
+                    bits += kInfNanAdjust;
+                }
+                else if (exponent == 0)
+                {
+                    bits = floatToBits(bitsToFloat(bits + (1u << 23)) - bitsToFloat(kHalfNormalMin));
+                }
+                return bitsToFloat(bits | (static_cast<uint32>(halfBits & 0x8000u) << 16));
+            }
+
+            // SIMD 의 _mm_cvtps_epi32 와 같이 round-to-nearest-even 으로 반올림한다.
+            MINT_INLINE const int32 roundToInt(const float value) noexcept
+            {
+                return static_cast<int32>(::lrintf(value));
+            }
+
+            // NaN 은 1 이 된다. (SIMD 의 _mm_max_ps(_mm_min_ps(value, 1), 0) 과 같다)
+            MINT_INLINE const float saturate(const float value) noexcept
+            {
+                const float clampedMax = (value < 1.0f) ? value : 1.0f;
+                return (clampedMax > 0.0f) ? clampedMax : 0.0f;
+            }
+
+            MINT_INLINE const float clampSigned(const float value) noexcept
+            {
+                const float clampedMax = (value < 1.0f) ? value : 1.0f;
+                return (clampedMax > -1.0f) ? clampedMax : -1.0f;
+            }
+
+#if defined MINT_MATH_USE_SIMD
+            MINT_INLINE __m128i select(const __m128i mask, const __m128i trueValue, const __m128i falseValue) noexcept
+            {
+                return _mm_or_si128(_mm_and_si128(mask, trueValue), _mm_andnot_si128(mask, falseValue));
+            }
+
+            MINT_INLINE __m128 select(const __m128 mask, const __m128 trueValue, const __m128 falseValue) noexcept
+            {
+                return _mm_or_ps(_mm_and_ps(mask, trueValue), _mm_andnot_ps(mask, falseValue));
+            }
+
+            // 4 개의 half 를 하위 64 bit 에 담아 반환한다.
+            MINT_INLINE __m128i floatToHalf4(const __m128 value) noexcept
+            {
+#if defined MINT_MATH_USE_F16C
+                return _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+                const __m128i sign = _mm_and_si128(_mm_castps_si128(value), _mm_set1_epi32(static_cast<int32>(kSignMask)));
+                const __m128i bits = _mm_xor_si128(_mm_castps_si128(value), sign);
+
+                const __m128i isNan = _mm_cmpgt_epi32(bits, _mm_set1_epi32(kFloatInfinity));
+                const __m128i infNan = select(isNan, _mm_set1_epi32(0x7E00), _mm_set1_epi32(0x7C00));
+
+                const __m128i magic = _mm_set1_epi32(kDenormalMagic);
+                const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(magic))), magic);
+
+                const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+                const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(static_cast<int32>(kRebiasAndRound))), mantissaOdd), 13);
+
+                const __m128i isOverflow = _mm_cmpgt_epi32(bits, _mm_set1_epi32(kHalfOverflow - 1));
+                const __m128i isDenormal = _mm_cmplt_epi32(bits, _mm_set1_epi32(kHalfNormalMin));
+                __m128i result = select(isOverflow, infNan, select(isDenormal, denormal, normal));
+                result = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+                // _mm_packs_epi32 가 saturate 하지 않도록 부호 확장한 뒤 16 bit 로 줄인다.
+                result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+                return _mm_packs_epi32(result, result);
+#endif
+            }
+
+            // 하위 64 bit 에 담긴 4 개의 half 를 float 으로 바꾼다.
+            MINT_INLINE __m128 half4ToFloat(const __m128i halves) noexcept
+            {
+#if defined MINT_MATH_USE_F16C
+                return _mm_cvtph_ps(halves);
+#else
+                const __m128i halfBits = _mm_unpacklo_epi16(halves, _mm_setzero_si128());
+                __m128i bits = _mm_slli_epi32(_mm_and_si128(halfBits, _mm_set1_epi32(0x7FFF)), 13);
+                const __m128i exponent = _mm_and_si128(bits, _mm_set1_epi32(kHalfExponentMask));
+                bits = _mm_add_epi32(bits, _mm_set1_epi32(kExponentAdjust));
+
+                const __m128i isInfNan = _mm_cmpeq_epi32(exponent, _mm_set1_epi32(kHalfExponentMask));
+                bits = _mm_add_epi32(bits, _mm_and_si128(isInfNan, _mm_set1_epi32(kInfNanAdjust)));
+
+                const __m128i isDenormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+                const __m128 denormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), _mm_castsi128_ps(_mm_set1_epi32(kHalfNormalMin)));
+                bits = select(isDenormal, _mm_castps_si128(denormal), bits);
+
+                const __m128i sign = _mm_slli_epi32(_mm_and_si128(halfBits, _mm_set1_epi32(0x8000)), 16);
+                return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+#endif
+            }
+
+            MINT_INLINE __m128 clampSigned(const __m128 value) noexcept
+            {
+                return _mm_max_ps(_mm_min_ps(value, _mm_set1_ps(1.0f)), _mm_set1_ps(-1.0f));
+            }
+
+            // encodeOctahedral 과 같은 식을 4 개씩 계산한다.
+            MINT_INLINE void encodeOctahedral(const __m128 x, const __m128 y, const __m128 z, __m128& outX, __m128& outY) noexcept
+            {
+                const __m128 signMask = _mm_set1_ps(-0.0f);
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 absX = _mm_andnot_ps(signMask, x);
+                const __m128 absY = _mm_andnot_ps(signMask, y);
+                const __m128 absZ = _mm_andnot_ps(signMask, z);
+                const __m128 inverseL1 = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(absX, absY), absZ));
+                const __m128 octX = _mm_mul_ps(x, inverseL1);
+                const __m128 octY = _mm_mul_ps(y, inverseL1);
+
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 minusOne = _mm_set1_ps(-1.0f);
+                const __m128 signX = select(_mm_cmpge_ps(octX, zero), one, minusOne);
+                const __m128 signY = select(_mm_cmpge_ps(octY, zero), one, minusOne);
+                const __m128 foldedX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, octY)), signX);
+                const __m128 foldedY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, octX)), signY);
+                const __m128 isLowerHemisphere = _mm_cmplt_ps(z, zero);
+                outX = select(isLowerHemisphere, foldedX, octX);
+                outY = select(isLowerHemisphere, foldedY, octY);
+            }
+
+            // decodeOctahedral 과 같은 식을 4 개씩 계산한다.
+            MINT_INLINE void decodeOctahedral(const __m128 encodedX, const __m128 encodedY, __m128& outX, __m128& outY, __m128& outZ) noexcept
+            {
+                const __m128 signMask = _mm_set1_ps(-0.0f);
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 one = _mm_set1_ps(1.0f);
+                const __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, encodedX)), _mm_andnot_ps(signMask, encodedY));
+                const __m128 t = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+                const __m128 x = _mm_add_ps(encodedX, select(_mm_cmpge_ps(encodedX, zero), _mm_sub_ps(zero, t), t));
+                const __m128 y = _mm_add_ps(encodedY, select(_mm_cmpge_ps(encodedY, zero), _mm_sub_ps(zero, t), t));
+                const __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z))));
+                outX = _mm_mul_ps(x, inverseLength);
+                outY = _mm_mul_ps(y, inverseLength);
+                outZ = _mm_mul_ps(z, inverseLength);
+            }
+#endif
+        }
+    }
+
+
+#pragma region Half
+    Half Half::fromBits(const uint16 bits) noexcept
+    {
+        Half half;
+        half._bits = bits;
+        return half;
+    }
+
+    Half::Half()
+        : _bits{ 0 }
+    {
+        __noop;
+    }
+
+    Half::Half(const float value)
+        : _bits{ VertexPacking::floatToHalfBits(value) }
+    {
+        __noop;
+    }
+
+    const bool Half::operator==(const Half& rhs) const noexcept
+    {
+        return _bits == rhs._bits;
+    }
+
+    const bool Half::operator!=(const Half& rhs) const noexcept
+    {
+        return _bits != rhs._bits;
+    }
+
+    const float Half::toFloat() const noexcept
+    {
+        return VertexPacking::halfBitsToFloat(_bits);
+    }
+
+    const bool Half::isNan() const noexcept
+    {
+        return ((_bits & 0x7C00u) == 0x7C00u) && ((_bits & 0x03FFu) != 0);
+    }
+#pragma endregion
+
+
+#pragma region Half2, Half4
+    Half2::Half2(const mint::Float2& value)
+        : _x{ value._x }
+        , _y{ value._y }
+    {
+        __noop;
+    }
+
+    mint::Float2 Half2::toFloat2() const noexcept
+    {
+        return mint::Float2(_x.toFloat(), _y.toFloat());
+    }
+
+    Half4::Half4(const mint::Float4& value)
+        : _x{ value._x }
+        , _y{ value._y }
+        , _z{ value._z }
+        , _w{ value._w }
+    {
+        __noop;
+    }
+
+    mint::Float4 Half4::toFloat4() const noexcept
+    {
+        return mint::Float4(_x.toFloat(), _y.toFloat(), _z.toFloat(), _w.toFloat());
+    }
+#pragma endregion
+
+
+#pragma region UNorm8x4
+    UNorm8x4::UNorm8x4()
+        : _packed{ 0 }
+    {
+        __noop;
+    }
+
+    UNorm8x4::UNorm8x4(const mint::Float4& value)
+        : _packed{ 0 }
+    {
+        for (uint32 componentIndex = 0; componentIndex < 4; ++componentIndex)
+        {
+            const uint32 component = static_cast<uint32>(VertexPacking::roundToInt(VertexPacking::saturate(value[componentIndex]) * VertexPacking::kUNorm8Scale));
+            _packed |= component << (componentIndex * 8);
+        }
+    }
+
+    mint::Float4 UNorm8x4::toFloat4() const noexcept
+    {
+        static constexpr float kInverseScale = 1.0f / VertexPacking::kUNorm8Scale;
+        return mint::Float4(
+            static_cast<float>(_packed & 0xFF) * kInverseScale,
+            static_cast<float>((_packed >> 8) & 0xFF) * kInverseScale,
+            static_cast<float>((_packed >> 16) & 0xFF) * kInverseScale,
+            static_cast<float>(_packed >> 24) * kInverseScale);
+    }
+#pragma endregion
+
+
+#pragma region SNorm16x2
+    SNorm16x2::SNorm16x2()
+        : _x{ 0 }
+        , _y{ 0 }
+    {
+        __noop;
+    }
+
+    SNorm16x2::SNorm16x2(const mint::Float2& value)
+        : _x{ static_cast<int16>(VertexPacking::roundToInt(VertexPacking::clampSigned(value._x) * VertexPacking::kSNorm16Scale)) }
+        , _y{ static_cast<int16>(VertexPacking::roundToInt(VertexPacking::clampSigned(value._y) * VertexPacking::kSNorm16Scale)) }
+    {
+        __noop;
+    }
+
+    mint::Float2 SNorm16x2::toFloat2() const noexcept
+    {
+        // -32768 과 -32767 은 모두 -1 이다.
+        static constexpr float kInverseScale = 1.0f / VertexPacking::kSNorm16Scale;
+        return mint::Float2(mint::max(static_cast<float>(_x) * kInverseScale, -1.0f), mint::max(static_cast<float>(_y) * kInverseScale, -1.0f));
+    }
+#pragma endregion
+
+
+    namespace VertexPacking
+    {
+        mint::Float2 encodeOctahedral(const mint::Float3& normal) noexcept
+        {
+            const float inverseL1 = 1.0f / (::fabsf(normal._x) + ::fabsf(normal._y) + ::fabsf(normal._z));
+            const float octX = normal._x * inverseL1;
+            const float octY = normal._y * inverseL1;
+            if (normal._z < 0.0f)
+            {
+                // 아래 반구는 대각선을 기준으로 접어서 바깥쪽 삼각형들에 담는다.
+                return mint::Float2((1.0f - ::fabsf(octY)) * ((octX >= 0.0f) ? 1.0f : -1.0f), (1.0f - ::fabsf(octX)) * ((octY >= 0.0f) ? 1.0f : -1.0f));
+            }
+            return mint::Float2(octX, octY);
+        }
+
+        mint::Float3 decodeOctahedral(const mint::Float2& encoded) noexcept
+        {
+            const float z = 1.0f - ::fabsf(encoded._x) - ::fabsf(encoded._y);
+            const float t = mint::max(-z, 0.0f);
+            const float x = encoded._x + ((encoded._x >= 0.0f) ? -t : t);
+            const float y = encoded._y + ((encoded._y >= 0.0f) ? -t : t);
+            const float inverseLength = 1.0f / ::sqrtf(x * x + y * y + z * z);
+            return mint::Float3(x * inverseLength, y * inverseLength, z * inverseLength);
+        }
+
+        SNorm16x2 packNormal(const mint::Float3& normal) noexcept
+        {
+            return SNorm16x2(encodeOctahedral(normal));
+        }
+
+        mint::Float3 unpackNormal(const SNorm16x2& packed) noexcept
+        {
+            return decodeOctahedral(packed.toFloat2());
+        }
+
+        void packHalves(const float* const input, Half* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            for (; index + 4 <= count; index += 4)
+            {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(&output[index]), floatToHalf4(_mm_loadu_ps(&input[index])));
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = Half(input[index]);
+            }
+        }
+
+        void unpackHalves(const Half* const input, float* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            for (; index + 4 <= count; index += 4)
+            {
+                _mm_storeu_ps(&output[index], half4ToFloat(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&input[index]))));
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = input[index].toFloat();
+            }
+        }
+
+        void packUNorm8x4(const mint::Float4* const input, UNorm8x4* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 scale = _mm_set1_ps(kUNorm8Scale);
+            for (; index + 4 <= count; index += 4)
+            {
+                __m128i components[4];
+                for (uint32 offset = 0; offset < 4; ++offset)
+                {
+                    const __m128 value = _mm_loadu_ps(&input[index + offset]._x);
+                    components[offset] = _mm_cvtps_epi32(_mm_mul_ps(_mm_max_ps(_mm_min_ps(value, one), zero), scale));
+                }
+                // 32 bit -> 16 bit -> 8 bit 로 줄이면 x 가 가장 낮은 byte 가 된다.
+                const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(components[0], components[1]), _mm_packs_epi32(components[2], components[3]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[index]), packed);
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = UNorm8x4(input[index]);
+            }
+        }
+
+        void unpackUNorm8x4(const UNorm8x4* const input, mint::Float4* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 inverseScale = _mm_set1_ps(1.0f / kUNorm8Scale);
+            for (; index + 4 <= count; index += 4)
+            {
+                const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[index]));
+                const __m128i low = _mm_unpacklo_epi8(packed, zero);
+                const __m128i high = _mm_unpackhi_epi8(packed, zero);
+                _mm_storeu_ps(&output[index + 0]._x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(low, zero)), inverseScale));
+                _mm_storeu_ps(&output[index + 1]._x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(low, zero)), inverseScale));
+                _mm_storeu_ps(&output[index + 2]._x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(high, zero)), inverseScale));
+                _mm_storeu_ps(&output[index + 3]._x, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(high, zero)), inverseScale));
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = input[index].toFloat4();
+            }
+        }
+
+        void packNormals(const mint::Float3* const input, SNorm16x2* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            const __m128 scale = _mm_set1_ps(kSNorm16Scale);
+            for (; index + 4 <= count; index += 4)
+            {
+                const float* const source = &input[index]._x;
+                __m128 x;
+                __m128 y;
+                __m128 z;
+                Simd::deinterleave3(_mm_loadu_ps(source + 0), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+                __m128 encodedX;
+                __m128 encodedY;
+                encodeOctahedral(x, y, z, encodedX, encodedY);
+                const __m128i integerX = _mm_cvtps_epi32(_mm_mul_ps(clampSigned(encodedX), scale));
+                const __m128i integerY = _mm_cvtps_epi32(_mm_mul_ps(clampSigned(encodedY), scale));
+                // (x0 x1 x2 x3 y0 y1 y2 y3) -> (x0 y0 x1 y1 x2 y2 x3 y3)
+                const __m128i packed = _mm_packs_epi32(integerX, integerY);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[index]), _mm_unpacklo_epi16(packed, _mm_unpackhi_epi64(packed, packed)));
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = packNormal(input[index]);
+            }
+        }
+
+        void unpackNormals(const SNorm16x2* const input, mint::Float3* const output, const uint32 count) noexcept
+        {
+            uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+            const __m128 inverseScale = _mm_set1_ps(1.0f / kSNorm16Scale);
+            const __m128 minusOne = _mm_set1_ps(-1.0f);
+            for (; index + 4 <= count; index += 4)
+            {
+                const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[index]));
+                const __m128i integerX = _mm_srai_epi32(_mm_slli_epi32(packed, 16), 16);
+                const __m128i integerY = _mm_srai_epi32(packed, 16);
+                const __m128 encodedX = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(integerX), inverseScale), minusOne);
+                const __m128 encodedY = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(integerY), inverseScale), minusOne);
+
+                __m128 x;
+                __m128 y;
+                __m128 z;
+                decodeOctahedral(encodedX, encodedY, x, y, z);
+
+                __m128 resultA;
+                __m128 resultB;
+                __m128 resultC;
+                Simd::interleave3(x, y, z, resultA, resultB, resultC);
+                float* const destination = &output[index]._x;
+                _mm_storeu_ps(destination + 0, resultA);
+                _mm_storeu_ps(destination + 4, resultB);
+                _mm_storeu_ps(destination + 8, resultC);
+            }
+#endif
+            for (; index < count; ++index)
+            {
+                output[index] = unpackNormal(input[index]);
+            }
+        }
+    }
+}
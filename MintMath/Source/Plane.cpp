@@ -0,0 +1,53 @@
+﻿#include <MintMath/Include/Plane.h>
+
+
+namespace mint
+{
+    Plane Plane::fromPointNormal(const mint::Float3& point, const mint::Float3& normal) noexcept
+    {
+        const mint::Float3 normalizedNormal = mint::Float3::normalize(normal);
+        return Plane(normalizedNormal._x, normalizedNormal._y, normalizedNormal._z, -mint::Float3::dot(normalizedNormal, point));
+    }
+
+    Plane Plane::fromPoints(const mint::Float3& a, const mint::Float3& b, const mint::Float3& c) noexcept
+    {
+        return fromPointNormal(a, mint::Float3::cross(b - a, c - a));
+    }
+
+
+    Plane::Plane()
+        : _data{ 0.0f, 1.0f, 0.0f, 0.0f }
+    {
+        __noop;
+    }
+
+    Plane::Plane(const float normalX, const float normalY, const float normalZ, const float distance)
+        : _data{ normalX, normalY, normalZ, distance }
+    {
+        __noop;
+    }
+
+    void Plane::normalize() noexcept
+    {
+        const float normalLength = getNormal().length();
+        if (normalLength != 0.0f)
+        {
+            _data /= normalLength;
+        }
+    }
+
+    const float Plane::signedDistance(const mint::Float3& point) const noexcept
+    {
+        return mint::Float4::dotProductRaw(_data._f, point._x, point._y, point._z, 1.0f);
+    }
+
+    mint::Float3 Plane::getNormal() const noexcept
+    {
+        return mint::Float3(_data._x, _data._y, _data._z);
+    }
+
+    const float Plane::getDistance() const noexcept
+    {
+        return _data._w;
+    }
+}
@@ -29,6 +29,60 @@ namespace mint
         return Quaternion(cos_half, sin_half * r._x, sin_half * r._y, sin_half * r._z);
     }
 
+    const float Quaternion::dot(const Quaternion& lhs, const Quaternion& rhs) noexcept
+    {
+        return mint::Float4::dot(lhs._data, rhs._data);
+    }
+
+    Quaternion Quaternion::nlerp(const Quaternion& from, const Quaternion& to, const float t) noexcept
+    {
+        // q 와 -q 는 같은 회전이므로 짧은 쪽으로 보간한다.
+        const float tTo = (dot(from, to) < 0.0f) ? -t : t;
+        Quaternion result;
+        result._data = from._data * (1.0f - t) + to._data * tTo;
+        result._data.normalize();
+        return result;
+    }
+
+    Quaternion Quaternion::slerp(const Quaternion& from, const Quaternion& to, const float t) noexcept
+    {
+        float cosTheta = dot(from, to);
+        float sign = 1.0f;
+        if (cosTheta < 0.0f)
+        {
+            cosTheta = -cosTheta;
+            sign = -1.0f;
+        }
+
+        // 각도가 매우 작으면 sin(theta) 로 나누는 것이 불안정하므로 nlerp 로 대신한다.
+        if (cosTheta > 0.9995f)
+        {
+            return nlerp(from, to, t);
+        }
+
+        const float theta = acosf(cosTheta);
+        const float inverseSinTheta = 1.0f / sinf(theta);
+        const float weightFrom = sinf((1.0f - t) * theta) * inverseSinTheta;
+        const float weightTo = sinf(t * theta) * inverseSinTheta * sign;
+        Quaternion result;
+        result._data = from._data * weightFrom + to._data * weightTo;
+        return result;
+    }
+
+    Quaternion Quaternion::slerpApproximate(const Quaternion& from, const Quaternion& to, const float t) noexcept
+    {
+        // nlerp 는 구간 양 끝보다 가운데에서 빠르게 움직이므로, t 를 3 차 다항식으로 보정해서 slerp 의 등속 운동에 맞춘다.
+        // 보정 계수 k 는 cos(theta) 에 대한 다항식으로 fitting 한 값이다. (Kapoulkine, "Approximating slerp")
+        const float cosTheta = dot(from, to);
+        const float d = fabsf(cosTheta);
+        const float a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+        const float b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+        const float centered = t - 0.5f;
+        const float k = a * centered * centered + b;
+        const float correctedT = t + t * centered * (t - 1.0f) * k;
+        return nlerp(from, to, correctedT);
+    }
+
 
     Quaternion::Quaternion()
         : Quaternion(1.0f, 0.0f, 0.0f, 0.0f)
@@ -44,6 +98,9 @@ namespace mint
 
     Quaternion& Quaternion::operator*=(const Quaternion& q) noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        _mm_store_ps(_data._f, Simd::quaternionMultiply(_mm_load_ps(_data._f), _mm_load_ps(q._data._f)));
+#else
         const float a = _a;
         const float b = _b;
         const float c = _c;
@@ -52,6 +109,7 @@ namespace mint
         _b = +a * q._b + b * q._a + c * q._d - d * q._c;
         _c = +a * q._c - b * q._d + c * q._a + d * q._b;
         _d = +a * q._d + b * q._c - c * q._b + d * q._a;
+#endif
         return *this;
     }
 
@@ -82,6 +140,11 @@ namespace mint
 
     Quaternion Quaternion::operator*(const Quaternion& q) const noexcept
     {
+#if defined MINT_MATH_USE_SIMD
+        Quaternion result;
+        _mm_store_ps(result._data._f, Simd::quaternionMultiply(_mm_load_ps(_data._f), _mm_load_ps(q._data._f)));
+        return result;
+#else
         return Quaternion
         (
             +_a * q._a - _b * q._b - _c * q._c - _d * q._d,
@@ -89,6 +152,7 @@ namespace mint
             +_a * q._c - _b * q._d + _c * q._a + _d * q._b,
             +_a * q._d + _b * q._c - _c * q._b + _d * q._a
         );
+#endif
     }
 
     Quaternion Quaternion::operator*(const float s) const noexcept
@@ -111,12 +175,35 @@ namespace mint
         return Quaternion::reciprocal(*this);
     }
 
-    mint::Float4 Quaternion::rotateVector(const mint::Float4& inputVector)
+    void Quaternion::normalize() noexcept
+    {
+        _data.normalize();
+    }
+
+    mint::Float4 Quaternion::rotateVector(const mint::Float4& inputVector) const noexcept
+    {
+        // t = 2 * (u X v)
+        // v' = v + w * t + u X t
+#if defined MINT_MATH_USE_SIMD
+        const __m128 q = _mm_load_ps(_data._f);
+        const __m128 v = _mm_load_ps(inputVector._f);
+        __m128 t = Simd::cross3(q, v);
+        t = _mm_add_ps(t, t);
+        const __m128 result = _mm_add_ps(Simd::multiplyAdd(Simd::splat<3>(q), t, v), Simd::cross3(q, t));
+        mint::Float4 output;
+        _mm_store_ps(output._f, result);
+        return output;
+#else
+        const mint::Float3 rotated = rotateVector(mint::Float3(inputVector._x, inputVector._y, inputVector._z));
+        return mint::Float4(rotated._x, rotated._y, rotated._z, inputVector._w);
+#endif
+    }
+
+    mint::Float3 Quaternion::rotateVector(const mint::Float3& inputVector) const noexcept
     {
-        Quaternion result = *this;
-        result *= inputVector;
-        result *= conjugate();
-        return mint::Float4(result._x, result._y, result._z, inputVector._w);
+        const mint::Float3 u(_x, _y, _z);
+        const mint::Float3 t = mint::Float3::cross(u, inputVector) * 2.0f;
+        return inputVector + t * _w + mint::Float3::cross(u, t);
     }
 
     void Quaternion::setAxisAngle(const mint::Float3& axis, float angle) noexcept
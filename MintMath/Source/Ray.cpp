@@ -0,0 +1,228 @@
+﻿#include <MintMath/Include/Ray.h>
+
+
+namespace mint
+{
+    namespace
+    {
+        // det 이 이보다 작으면 ray 가 triangle 과 평행하다고 본다.
+        static constexpr float kParallelEpsilon = 1e-8f;
+    }
+
+
+    Ray::Ray()
+        : _direction{ 0.0f, 0.0f, 1.0f }
+    {
+        __noop;
+    }
+
+    Ray::Ray(const mint::Float3& origin, const mint::Float3& direction)
+        : _origin{ origin }
+        , _direction{ direction }
+    {
+        __noop;
+    }
+
+    mint::Float3 Ray::getPoint(const float t) const noexcept
+    {
+        return _origin + _direction * t;
+    }
+
+    const bool Ray::intersects(const Plane& plane, float& outDistance) const noexcept
+    {
+        const float denominator = mint::Float3::dot(plane.getNormal(), _direction);
+        if (Math::absolute(denominator) < kParallelEpsilon)
+        {
+            return false;
+        }
+
+        const float t = -plane.signedDistance(_origin) / denominator;
+        if (t < 0.0f)
+        {
+            return false;
+        }
+        outDistance = t;
+        return true;
+    }
+
+    const bool Ray::intersects(const AABB& aabb, float& outDistance) const noexcept
+    {
+        // Slab method. direction 성분이 0 이면 inverse 가 inf 가 되고, 그래도 올바르게 동작한다.
+        float tMin = 0.0f;
+        float tMax = Math::kFloatMax;
+        for (uint32 axis = 0; axis < 3; ++axis)
+        {
+            const float inverseDirection = 1.0f / _direction[axis];
+            float t0 = (aabb._min[axis] - _origin[axis]) * inverseDirection;
+            float t1 = (aabb._max[axis] - _origin[axis]) * inverseDirection;
+            if (t1 < t0)
+            {
+                std::swap(t0, t1);
+            }
+            tMin = mint::max(tMin, t0);
+            tMax = mint::min(tMax, t1);
+            if (tMax < tMin)
+            {
+                return false;
+            }
+        }
+        outDistance = tMin;
+        return true;
+    }
+
+    const bool Ray::intersects(const BoundingSphere& sphere, float& outDistance) const noexcept
+    {
+        // |o + td - c|^2 = r^2
+        const mint::Float3 offset = _origin - sphere._center;
+        const float a = mint::Float3::dot(_direction, _direction);
+        const float b = mint::Float3::dot(offset, _direction);
+        const float c = mint::Float3::dot(offset, offset) - sphere._radius * sphere._radius;
+        const float discriminant = b * b - a * c;
+        if (discriminant < 0.0f || a == 0.0f)
+        {
+            return false;
+        }
+
+        const float squareRoot = ::sqrt(discriminant);
+        const float tFar = (-b + squareRoot) / a;
+        if (tFar < 0.0f)
+        {
+            return false;
+        }
+        const float tNear = (-b - squareRoot) / a;
+        outDistance = mint::max(tNear, 0.0f);
+        return true;
+    }
+
+    const bool Ray::intersectsTriangle(const mint::Float3& v0, const mint::Float3& v1, const mint::Float3& v2, float& outDistance) const noexcept
+    {
+        const mint::Float3 edge1 = v1 - v0;
+        const mint::Float3 edge2 = v2 - v0;
+        const mint::Float3 p = mint::Float3::cross(_direction, edge2);
+        const float determinant = mint::Float3::dot(edge1, p);
+        if (Math::absolute(determinant) < kParallelEpsilon)
+        {
+            return false;
+        }
+
+        const float inverseDeterminant = 1.0f / determinant;
+        const mint::Float3 s = _origin - v0;
+        const float u = mint::Float3::dot(s, p) * inverseDeterminant;
+        if (u < 0.0f || 1.0f < u)
+        {
+            return false;
+        }
+
+        const mint::Float3 q = mint::Float3::cross(s, edge1);
+        const float v = mint::Float3::dot(_direction, q) * inverseDeterminant;
+        if (v < 0.0f || 1.0f < u + v)
+        {
+            return false;
+        }
+
+        const float t = mint::Float3::dot(edge2, q) * inverseDeterminant;
+        if (t < 0.0f)
+        {
+            return false;
+        }
+        outDistance = t;
+        return true;
+    }
+
+    const bool Ray::intersectsTriangles(const mint::Float3* const triangleVertices, const uint32 triangleCount, uint32& outTriangleIndex, float& outDistance) const noexcept
+    {
+        float closestDistance = Math::kFloatMax;
+        uint32 closestIndex = kUint32Max;
+        uint32 triangleIndex = 0;
+#if defined MINT_MATH_USE_SIMD
+        // Möller-Trumbore 를 4 개의 triangle 에 대해 SoA 로 계산한다.
+        const __m128 originX = _mm_set1_ps(_origin._x);
+        const __m128 originY = _mm_set1_ps(_origin._y);
+        const __m128 originZ = _mm_set1_ps(_origin._z);
+        const __m128 directionX = _mm_set1_ps(_direction._x);
+        const __m128 directionY = _mm_set1_ps(_direction._y);
+        const __m128 directionZ = _mm_set1_ps(_direction._z);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 epsilon = _mm_set1_ps(kParallelEpsilon);
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 closest = _mm_set1_ps(Math::kFloatMax);
+        __m128i closestIndices = _mm_set1_epi32(-1);
+        for (; triangleIndex + 4 <= triangleCount; triangleIndex += 4)
+        {
+            const mint::Float3* const t = &triangleVertices[triangleIndex * 3];
+            const __m128 v0X = _mm_setr_ps(t[0]._x, t[3]._x, t[6]._x, t[9]._x);
+            const __m128 v0Y = _mm_setr_ps(t[0]._y, t[3]._y, t[6]._y, t[9]._y);
+            const __m128 v0Z = _mm_setr_ps(t[0]._z, t[3]._z, t[6]._z, t[9]._z);
+            const __m128 edge1X = _mm_sub_ps(_mm_setr_ps(t[1]._x, t[4]._x, t[7]._x, t[10]._x), v0X);
+            const __m128 edge1Y = _mm_sub_ps(_mm_setr_ps(t[1]._y, t[4]._y, t[7]._y, t[10]._y), v0Y);
+            const __m128 edge1Z = _mm_sub_ps(_mm_setr_ps(t[1]._z, t[4]._z, t[7]._z, t[10]._z), v0Z);
+            const __m128 edge2X = _mm_sub_ps(_mm_setr_ps(t[2]._x, t[5]._x, t[8]._x, t[11]._x), v0X);
+            const __m128 edge2Y = _mm_sub_ps(_mm_setr_ps(t[2]._y, t[5]._y, t[8]._y, t[11]._y), v0Y);
+            const __m128 edge2Z = _mm_sub_ps(_mm_setr_ps(t[2]._z, t[5]._z, t[8]._z, t[11]._z), v0Z);
+
+            // p = direction X edge2
+            const __m128 pX = _mm_sub_ps(_mm_mul_ps(directionY, edge2Z), _mm_mul_ps(directionZ, edge2Y));
+            const __m128 pY = _mm_sub_ps(_mm_mul_ps(directionZ, edge2X), _mm_mul_ps(directionX, edge2Z));
+            const __m128 pZ = _mm_sub_ps(_mm_mul_ps(directionX, edge2Y), _mm_mul_ps(directionY, edge2X));
+            const __m128 determinant = Simd::multiplyAdd(edge1Z, pZ, Simd::multiplyAdd(edge1Y, pY, _mm_mul_ps(edge1X, pX)));
+            const __m128 inverseDeterminant = _mm_div_ps(one, determinant);
+
+            const __m128 sX = _mm_sub_ps(originX, v0X);
+            const __m128 sY = _mm_sub_ps(originY, v0Y);
+            const __m128 sZ = _mm_sub_ps(originZ, v0Z);
+            const __m128 u = _mm_mul_ps(Simd::multiplyAdd(sZ, pZ, Simd::multiplyAdd(sY, pY, _mm_mul_ps(sX, pX))), inverseDeterminant);
+
+            // q = s X edge1
+            const __m128 qX = _mm_sub_ps(_mm_mul_ps(sY, edge1Z), _mm_mul_ps(sZ, edge1Y));
+            const __m128 qY = _mm_sub_ps(_mm_mul_ps(sZ, edge1X), _mm_mul_ps(sX, edge1Z));
+            const __m128 qZ = _mm_sub_ps(_mm_mul_ps(sX, edge1Y), _mm_mul_ps(sY, edge1X));
+            const __m128 v = _mm_mul_ps(Simd::multiplyAdd(directionZ, qZ, Simd::multiplyAdd(directionY, qY, _mm_mul_ps(directionX, qX))), inverseDeterminant);
+            const __m128 distance = _mm_mul_ps(Simd::multiplyAdd(edge2Z, qZ, Simd::multiplyAdd(edge2Y, qY, _mm_mul_ps(edge2X, qX))), inverseDeterminant);
+
+            __m128 hit = _mm_cmpge_ps(_mm_andnot_ps(signMask, determinant), epsilon);
+            hit = _mm_and_ps(hit, _mm_cmpge_ps(u, zero));
+            hit = _mm_and_ps(hit, _mm_cmpge_ps(v, zero));
+            hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), one));
+            hit = _mm_and_ps(hit, _mm_cmpge_ps(distance, zero));
+            hit = _mm_and_ps(hit, _mm_cmplt_ps(distance, closest));
+
+            closest = _mm_or_ps(_mm_and_ps(hit, distance), _mm_andnot_ps(hit, closest));
+            const __m128i indices = _mm_add_epi32(_mm_set1_epi32(static_cast<int32>(triangleIndex)), _mm_setr_epi32(0, 1, 2, 3));
+            const __m128i hitMask = _mm_castps_si128(hit);
+            closestIndices = _mm_or_si128(_mm_and_si128(hitMask, indices), _mm_andnot_si128(hitMask, closestIndices));
+        }
+
+        alignas(16) float closestLanes[4];
+        alignas(16) int32 closestIndexLanes[4];
+        _mm_store_ps(closestLanes, closest);
+        _mm_store_si128(reinterpret_cast<__m128i*>(closestIndexLanes), closestIndices);
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            if (closestIndexLanes[lane] >= 0 && closestLanes[lane] < closestDistance)
+            {
+                closestDistance = closestLanes[lane];
+                closestIndex = static_cast<uint32>(closestIndexLanes[lane]);
+            }
+        }
+#endif
+        for (; triangleIndex < triangleCount; ++triangleIndex)
+        {
+            const mint::Float3* const t = &triangleVertices[triangleIndex * 3];
+            float distance = 0.0f;
+            if (intersectsTriangle(t[0], t[1], t[2], distance) == true && distance < closestDistance)
+            {
+                closestDistance = distance;
+                closestIndex = triangleIndex;
+            }
+        }
+
+        if (closestIndex == kUint32Max)
+        {
+            return false;
+        }
+        outTriangleIndex = closestIndex;
+        outDistance = closestDistance;
+        return true;
+    }
+}
@@ -0,0 +1,250 @@
+﻿#include <MintMath/Include/Rect.h>
+
+#include <MintMath/Include/FloatSoA.hpp>
+
+
+namespace mint
+{
+    void RectSoA::reserve(const uint32 capacity) noexcept
+    {
+        _raw.reserve(capacity);
+    }
+
+    void RectSoA::clear() noexcept
+    {
+        _raw.clear();
+    }
+
+    void RectSoA::push_back(const Rect& rect) noexcept
+    {
+        _raw.push_back(mint::Float4(rect.left(), rect.right(), rect.top(), rect.bottom()));
+    }
+
+    void RectSoA::set(const uint32 index, const Rect& rect) noexcept
+    {
+        _raw.set(index, mint::Float4(rect.left(), rect.right(), rect.top(), rect.bottom()));
+    }
+
+    Rect RectSoA::get(const uint32 index) const noexcept
+    {
+        const mint::Float4 raw = _raw.get(index);
+        return Rect(raw._x, raw._y, raw._z, raw._w);
+    }
+
+    void RectSoA::assignFromAoS(const Rect* const rects, const uint32 count) noexcept
+    {
+        _raw.resize(count);
+        float* const lefts = _raw.x();
+        float* const rights = _raw.y();
+        float* const tops = _raw.z();
+        float* const bottoms = _raw.w();
+        for (uint32 index = 0; index < count; ++index)
+        {
+            lefts[index] = rects[index].left();
+            rights[index] = rects[index].right();
+            tops[index] = rects[index].top();
+            bottoms[index] = rects[index].bottom();
+        }
+    }
+
+    const float* RectSoA::left() const noexcept
+    {
+        return _raw.x();
+    }
+
+    const float* RectSoA::right() const noexcept
+    {
+        return _raw.y();
+    }
+
+    const float* RectSoA::top() const noexcept
+    {
+        return _raw.z();
+    }
+
+    const float* RectSoA::bottom() const noexcept
+    {
+        return _raw.w();
+    }
+
+    const uint32 RectSoA::size() const noexcept
+    {
+        return _raw.size();
+    }
+
+    const bool RectSoA::empty() const noexcept
+    {
+        return _raw.empty();
+    }
+
+    const uint32 RectSoA::contains(const mint::Float2& position, bool* const outContains) const noexcept
+    {
+        const uint32 count = _raw.size();
+        const float* const lefts = _raw.x();
+        const float* const rights = _raw.y();
+        const float* const tops = _raw.z();
+        const float* const bottoms = _raw.w();
+        uint32 containingCount = 0;
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        const __m128 x = _mm_set1_ps(position._x);
+        const __m128 y = _mm_set1_ps(position._y);
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 insideX = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(lefts + index), x), _mm_cmple_ps(x, _mm_load_ps(rights + index)));
+            const __m128 insideY = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(tops + index), y), _mm_cmple_ps(y, _mm_load_ps(bottoms + index)));
+            const int32 mask = _mm_movemask_ps(_mm_and_ps(insideX, insideY));
+            for (uint32 lane = 0; lane < 4; ++lane)
+            {
+                const bool isContained = (mask & (1 << lane)) != 0;
+                outContains[index + lane] = isContained;
+                containingCount += (isContained == true) ? 1 : 0;
+            }
+        }
+#endif
+        for (; index < count; ++index)
+        {
+            const bool isContained = (lefts[index] <= position._x && position._x <= rights[index] && tops[index] <= position._y && position._y <= bottoms[index]);
+            outContains[index] = isContained;
+            containingCount += (isContained == true) ? 1 : 0;
+        }
+        return containingCount;
+    }
+
+    const uint32 RectSoA::findLastContaining(const mint::Float2& position) const noexcept
+    {
+        const uint32 count = _raw.size();
+        const float* const lefts = _raw.x();
+        const float* const rights = _raw.y();
+        const float* const tops = _raw.z();
+        const float* const bottoms = _raw.w();
+#if defined MINT_MATH_USE_SIMD
+        const uint32 simdCount = count - (count % 4);
+#else
+        const uint32 simdCount = 0;
+#endif
+        // 뒤에서부터 찾아서 처음 걸리는 것이 답이다.
+        for (uint32 index = count; index > simdCount; --index)
+        {
+            const uint32 rectIndex = index - 1;
+            if (lefts[rectIndex] <= position._x && position._x <= rights[rectIndex] && tops[rectIndex] <= position._y && position._y <= bottoms[rectIndex])
+            {
+                return rectIndex;
+            }
+        }
+#if defined MINT_MATH_USE_SIMD
+        const __m128 x = _mm_set1_ps(position._x);
+        const __m128 y = _mm_set1_ps(position._y);
+        for (uint32 index = simdCount; index > 0; index -= 4)
+        {
+            const uint32 baseIndex = index - 4;
+            const __m128 insideX = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(lefts + baseIndex), x), _mm_cmple_ps(x, _mm_load_ps(rights + baseIndex)));
+            const __m128 insideY = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(tops + baseIndex), y), _mm_cmple_ps(y, _mm_load_ps(bottoms + baseIndex)));
+            const int32 mask = _mm_movemask_ps(_mm_and_ps(insideX, insideY));
+            if (mask != 0)
+            {
+                const uint32 lane = (mask & 8) ? 3 : (mask & 4) ? 2 : (mask & 2) ? 1 : 0;
+                return baseIndex + lane;
+            }
+        }
+#endif
+        return kUint32Max;
+    }
+
+    void RectSoA::clipBy(const Rect& outerRect) noexcept
+    {
+        const uint32 count = _raw.size();
+        float* const lefts = _raw.x();
+        float* const rights = _raw.y();
+        float* const tops = _raw.z();
+        float* const bottoms = _raw.w();
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        // mint::max(a, b) == _mm_max_ps(b, a) 이므로 NaN 에 대해서도 Rect::clipBy() 와 결과가 같다.
+        const __m128 outerLeft = _mm_set1_ps(outerRect.left());
+        const __m128 outerRight = _mm_set1_ps(outerRect.right());
+        const __m128 outerTop = _mm_set1_ps(outerRect.top());
+        const __m128 outerBottom = _mm_set1_ps(outerRect.bottom());
+        for (; index + 4 <= count; index += 4)
+        {
+            const __m128 left = _mm_max_ps(outerLeft, _mm_load_ps(lefts + index));
+            const __m128 right = _mm_min_ps(outerRight, _mm_load_ps(rights + index));
+            const __m128 top = _mm_max_ps(outerTop, _mm_load_ps(tops + index));
+            const __m128 bottom = _mm_min_ps(outerBottom, _mm_load_ps(bottoms + index));
+            _mm_store_ps(lefts + index, left);
+            _mm_store_ps(rights + index, _mm_max_ps(right, left));
+            _mm_store_ps(tops + index, top);
+            _mm_store_ps(bottoms + index, _mm_max_ps(bottom, top));
+        }
+#endif
+        for (; index < count; ++index)
+        {
+            Rect rect(lefts[index], rights[index], tops[index], bottoms[index]);
+            rect.clipBy(outerRect);
+            lefts[index] = rect.left();
+            rights[index] = rect.right();
+            tops[index] = rect.top();
+            bottoms[index] = rect.bottom();
+        }
+    }
+
+    const bool RectSoA::computeBoundingRect(Rect& outRect) const noexcept
+    {
+        const uint32 count = _raw.size();
+        if (count == 0)
+        {
+            return false;
+        }
+
+        const float* const lefts = _raw.x();
+        const float* const rights = _raw.y();
+        const float* const tops = _raw.z();
+        const float* const bottoms = _raw.w();
+        float minLeft = +Math::kFloatMax;
+        float maxRight = -Math::kFloatMax;
+        float minTop = +Math::kFloatMax;
+        float maxBottom = -Math::kFloatMax;
+        uint32 index = 0;
+#if defined MINT_MATH_USE_SIMD
+        // _mm_min_ps(value, accumulated) 는 value 가 NaN 이면 accumulated 를 그대로 돌려준다.
+        __m128 minLefts = _mm_set1_ps(minLeft);
+        __m128 maxRights = _mm_set1_ps(maxRight);
+        __m128 minTops = _mm_set1_ps(minTop);
+        __m128 maxBottoms = _mm_set1_ps(maxBottom);
+        for (; index + 4 <= count; index += 4)
+        {
+            minLefts = _mm_min_ps(_mm_load_ps(lefts + index), minLefts);
+            maxRights = _mm_max_ps(_mm_load_ps(rights + index), maxRights);
+            minTops = _mm_min_ps(_mm_load_ps(tops + index), minTops);
+            maxBottoms = _mm_max_ps(_mm_load_ps(bottoms + index), maxBottoms);
+        }
+        alignas(16) float reduced[4][4];
+        _mm_store_ps(reduced[0], minLefts);
+        _mm_store_ps(reduced[1], maxRights);
+        _mm_store_ps(reduced[2], minTops);
+        _mm_store_ps(reduced[3], maxBottoms);
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            minLeft = mint::min(minLeft, reduced[0][lane]);
+            maxRight = mint::max(maxRight, reduced[1][lane]);
+            minTop = mint::min(minTop, reduced[2][lane]);
+            maxBottom = mint::max(maxBottom, reduced[3][lane]);
+        }
+#endif
+        for (; index < count; ++index)
+        {
+            minLeft = (lefts[index] < minLeft) ? lefts[index] : minLeft;
+            maxRight = (rights[index] > maxRight) ? rights[index] : maxRight;
+            minTop = (tops[index] < minTop) ? tops[index] : minTop;
+            maxBottom = (bottoms[index] > maxBottom) ? bottoms[index] : maxBottom;
+        }
+
+        if (maxRight < minLeft || maxBottom < minTop)
+        {
+            // 모든 rect 가 NaN 이었다.
+            return false;
+        }
+        outRect = Rect(minLeft, maxRight, minTop, maxBottom);
+        return true;
+    }
+}
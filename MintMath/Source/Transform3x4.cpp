@@ -0,0 +1,167 @@
+﻿#include <MintMath/Include/Transform3x4.h>
+
+
+namespace mint
+{
+    const Transform3x4 Transform3x4::kIdentity = Transform3x4();
+
+    Transform3x4 Transform3x4::srt(const mint::Float3& scale, const mint::Quaternion& rotation, const mint::Float3& translation) noexcept
+    {
+        // T * R * S
+        const float x = rotation._x;
+        const float y = rotation._y;
+        const float z = rotation._z;
+        const float w = rotation._w;
+        const float xx = x * x * 2.0f, yy = y * y * 2.0f, zz = z * z * 2.0f;
+        const float xy = x * y * 2.0f, xz = x * z * 2.0f, yz = y * z * 2.0f;
+        const float wx = w * x * 2.0f, wy = w * y * 2.0f, wz = w * z * 2.0f;
+        return Transform3x4
+        (
+            (1.0f - yy - zz) * scale._x, (xy - wz) * scale._y, (xz + wy) * scale._z, translation._x,
+            (xy + wz) * scale._x, (1.0f - xx - zz) * scale._y, (yz - wx) * scale._z, translation._y,
+            (xz - wy) * scale._x, (yz + wx) * scale._y, (1.0f - xx - yy) * scale._z, translation._z
+        );
+    }
+
+    Transform3x4 Transform3x4::fromMatrix(const mint::Float4x4& matrix) noexcept
+    {
+        Transform3x4 result;
+        result._row[0] = matrix._row[0];
+        result._row[1] = matrix._row[1];
+        result._row[2] = matrix._row[2];
+        return result;
+    }
+
+
+    Transform3x4::Transform3x4()
+        : Transform3x4(
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f)
+    {
+        __noop;
+    }
+
+    Transform3x4::Transform3x4(
+        const float m00, const float m01, const float m02, const float m03,
+        const float m10, const float m11, const float m12, const float m13,
+        const float m20, const float m21, const float m22, const float m23)
+        : _row{ mint::Float4(m00, m01, m02, m03), mint::Float4(m10, m11, m12, m13), mint::Float4(m20, m21, m22, m23) }
+    {
+        __noop;
+    }
+
+    const bool Transform3x4::operator==(const Transform3x4& rhs) const noexcept
+    {
+        return (_row[0] == rhs._row[0]) && (_row[1] == rhs._row[1]) && (_row[2] == rhs._row[2]);
+    }
+
+    const bool Transform3x4::operator!=(const Transform3x4& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    Transform3x4 Transform3x4::operator*(const Transform3x4& rhs) const noexcept
+    {
+        Transform3x4 result = *this;
+        result *= rhs;
+        return result;
+    }
+
+    Transform3x4& Transform3x4::operator*=(const Transform3x4& rhs) noexcept
+    {
+        // rhs 의 마지막 row 가 (0, 0, 0, 1) 이므로
+        // result.row[i] = lhs[i][0] * rhs.row[0] + lhs[i][1] * rhs.row[1] + lhs[i][2] * rhs.row[2] + (0, 0, 0, lhs[i][3])
+#if defined MINT_MATH_USE_SIMD
+        const __m128 rhsRow0 = _mm_load_ps(rhs._row[0]._f);
+        const __m128 rhsRow1 = _mm_load_ps(rhs._row[1]._f);
+        const __m128 rhsRow2 = _mm_load_ps(rhs._row[2]._f);
+        const __m128 wMask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+        for (uint32 rowIndex = 0; rowIndex < 3; ++rowIndex)
+        {
+            const __m128 row = _mm_load_ps(_row[rowIndex]._f);
+            __m128 result = Simd::multiplyAdd(Simd::splat<0>(row), rhsRow0, _mm_and_ps(row, wMask));
+            result = Simd::multiplyAdd(Simd::splat<1>(row), rhsRow1, result);
+            result = Simd::multiplyAdd(Simd::splat<2>(row), rhsRow2, result);
+            _mm_store_ps(_row[rowIndex]._f, result);
+        }
+#else
+        for (uint32 rowIndex = 0; rowIndex < 3; ++rowIndex)
+        {
+            const mint::Float4 row = _row[rowIndex];
+            _row[rowIndex] = rhs._row[0] * row._x + rhs._row[1] * row._y + rhs._row[2] * row._z;
+            _row[rowIndex]._w += row._w;
+        }
+#endif
+        return *this;
+    }
+
+    mint::Float3 Transform3x4::transformPoint(const mint::Float3& point) const noexcept
+    {
+        return mint::Float3
+        (
+            mint::Float4::dotProductRaw(_row[0]._f, point._x, point._y, point._z, 1.0f),
+            mint::Float4::dotProductRaw(_row[1]._f, point._x, point._y, point._z, 1.0f),
+            mint::Float4::dotProductRaw(_row[2]._f, point._x, point._y, point._z, 1.0f)
+        );
+    }
+
+    mint::Float3 Transform3x4::transformVector(const mint::Float3& vector) const noexcept
+    {
+        return mint::Float3
+        (
+            mint::Float4::dotProductRaw(_row[0]._f, vector._x, vector._y, vector._z, 0.0f),
+            mint::Float4::dotProductRaw(_row[1]._f, vector._x, vector._y, vector._z, 0.0f),
+            mint::Float4::dotProductRaw(_row[2]._f, vector._x, vector._y, vector._z, 0.0f)
+        );
+    }
+
+    Transform3x4 Transform3x4::inverse() const noexcept
+    {
+        // [A t]^(-1) = [A^(-1) -A^(-1)t]
+        // A^(-1) 의 row 는 A 의 column 끼리의 cross product 를 determinant 로 나눈 것이다.
+        const mint::Float3 column0(_m[0][0], _m[1][0], _m[2][0]);
+        const mint::Float3 column1(_m[0][1], _m[1][1], _m[2][1]);
+        const mint::Float3 column2(_m[0][2], _m[1][2], _m[2][2]);
+        const mint::Float3 row0 = mint::Float3::cross(column1, column2);
+        const float determinant = mint::Float3::dot(column0, row0);
+        if (determinant == 0.0f)
+        {
+            return kIdentity;
+        }
+
+        const float inverseDeterminant = 1.0f / determinant;
+        const mint::Float3 inverseRow0 = row0 * inverseDeterminant;
+        const mint::Float3 inverseRow1 = mint::Float3::cross(column2, column0) * inverseDeterminant;
+        const mint::Float3 inverseRow2 = mint::Float3::cross(column0, column1) * inverseDeterminant;
+        const mint::Float3 translation = getTranslation();
+        return Transform3x4
+        (
+            inverseRow0._x, inverseRow0._y, inverseRow0._z, -mint::Float3::dot(inverseRow0, translation),
+            inverseRow1._x, inverseRow1._y, inverseRow1._z, -mint::Float3::dot(inverseRow1, translation),
+            inverseRow2._x, inverseRow2._y, inverseRow2._z, -mint::Float3::dot(inverseRow2, translation)
+        );
+    }
+
+    mint::Float4x4 Transform3x4::toMatrix() const noexcept
+    {
+        mint::Float4x4 result;
+        result._row[0] = _row[0];
+        result._row[1] = _row[1];
+        result._row[2] = _row[2];
+        result._row[3] = mint::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+        return result;
+    }
+
+    void Transform3x4::setTranslation(const mint::Float3& translation) noexcept
+    {
+        _m[0][3] = translation._x;
+        _m[1][3] = translation._y;
+        _m[2][3] = translation._z;
+    }
+
+    mint::Float3 Transform3x4::getTranslation() const noexcept
+    {
+        return mint::Float3(_m[0][3], _m[1][3], _m[2][3]);
+    }
+}
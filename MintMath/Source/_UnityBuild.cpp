@@ -1,9 +1,19 @@
+#include <MintMath/Source/AABB.cpp>
+#include <MintMath/Source/BatchTransform.cpp>
+#include <MintMath/Source/BoundingSphere.cpp>
+#include <MintMath/Source/DualQuaternion.cpp>
 #include <MintMath/Source/Float2.cpp>
 #include <MintMath/Source/Float2x2.cpp>
 #include <MintMath/Source/Float3.cpp>
 #include <MintMath/Source/Float3x3.cpp>
 #include <MintMath/Source/Float4.cpp>
 #include <MintMath/Source/Float4x4.cpp>
+#include <MintMath/Source/Frustum.cpp>
 #include <MintMath/Source/Int2.cpp>
 #include <MintMath/Source/MathCommon.cpp>
+#include <MintMath/Source/PackedTypes.cpp>
+#include <MintMath/Source/Plane.cpp>
 #include <MintMath/Source/Quaternion.cpp>
+#include <MintMath/Source/Ray.cpp>
+#include <MintMath/Source/Rect.cpp>
+#include <MintMath/Source/Transform3x4.cpp>
@@ -9,9 +9,13 @@
 #include <MintPlatform/Include/WindowsWindow.h>
 
 #include <MintPlatform/Include/IFile.h>
+#include <MintPlatform/Include/MappedFile.h>
 #include <MintPlatform/Include/BinaryFile.h>
 #include <MintPlatform/Include/TextFile.h>
 #include <MintPlatform/Include/FileUtil.h>
+#include <MintPlatform/Include/AsyncFileService.h>
+#include <MintPlatform/Include/Compression.h>
+#include <MintPlatform/Include/AssetPack.h>
 
 
 #endif // !MINT_PLATFORM_ALL_HEADERS_H
@@ -0,0 +1,141 @@
+﻿#pragma once
+
+
+#ifndef MINT_ASSET_PACK_H
+#define MINT_ASSET_PACK_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <MintPlatform/Include/MappedFile.h>
+
+#include <string>
+
+
+namespace mint
+{
+    enum class AssetPackCompression : uint32
+    {
+        None,
+        Lz4,
+    };
+
+
+    // Layout: [Header] [Entry data (각각 _alignment 로 정렬)] [Entry table (_pathHash, path 순으로 정렬)] [Path table]
+    struct AssetPackHeader
+    {
+        static constexpr uint32 kVersion = 1;
+
+        char                    _magic[4];          // "MPAK"
+        uint32                  _version;
+        uint32                  _entryCount;
+        uint32                  _alignment;
+        uint64                  _entryTableOffset;
+        uint64                  _pathTableOffset;
+        uint64                  _pathTableSize;
+    };
+    static_assert(sizeof(AssetPackHeader) == 40, "AssetPackHeader layout must not change!");
+
+    struct AssetPackEntry
+    {
+        uint64                  _pathHash;
+        uint64                  _dataOffset;
+        uint64                  _storedSize;
+        uint64                  _originalSize;
+        uint32                  _pathOffset;        // Path table 안에서의 위치. ('\0' 로 끝난다)
+        uint32                  _pathLength;
+        AssetPackCompression    _compression;
+        uint32                  _reserved;
+    };
+    static_assert(sizeof(AssetPackEntry) == 48, "AssetPackEntry layout must not change!");
+
+
+    struct AssetView
+    {
+        const byte*             _data = nullptr;
+        uint64                  _size = 0;
+    };
+
+
+    class AssetPackWriter final
+    {
+        static constexpr uint32 kDefaultAlignment = 16;
+
+        struct PendingEntry
+        {
+            std::string             _path;
+            std::string             _sourceFileName;    // 비어 있으면 _byteArray 를 쓴다.
+            mint::Vector<byte>      _byteArray;
+            AssetPackCompression    _compression = AssetPackCompression::None;
+        };
+
+    public:
+                                AssetPackWriter();
+                                AssetPackWriter(const uint32 alignment);
+                                ~AssetPackWriter() = default;
+
+    public:
+        // 파일 내용은 save() 할 때 읽는다.
+        void                    addFile(const char* const path, const char* const sourceFileName, const AssetPackCompression compression = AssetPackCompression::None) noexcept;
+        // 메모리의 데이터는 mint::Vector 에 복사해 두므로 4GB 를 넘으면 false 를 반환한다.
+        const bool              addData(const char* const path, const byte* const bytes, const uint64 byteCount, const AssetPackCompression compression = AssetPackCompression::None) noexcept;
+        // directoryName 아래의 모든 파일을 directoryName 기준 상대 경로로 추가한다. 추가된 파일 수를 반환한다.
+        const uint32            addDirectory(const char* const directoryName, const AssetPackCompression compression = AssetPackCompression::None) noexcept;
+        const bool              save(const char* const packFileName) noexcept;
+        void                    clear() noexcept;
+
+    public:
+        const uint32            getEntryCount() const noexcept;
+
+    private:
+        const uint32            _alignment;
+        mint::Vector<PendingEntry>  _pendingEntryArray;
+    };
+
+
+    // Pack 전체를 memory-map 하고, 압축되지 않은 Entry 는 복사 없이 돌려준다.
+    class AssetPackReader final
+    {
+    public:
+                                AssetPackReader();
+                                AssetPackReader(const AssetPackReader& rhs) = delete;
+                                AssetPackReader(AssetPackReader&& rhs)      = delete;
+                                ~AssetPackReader() = default;
+
+    public:
+        const bool              open(const char* const packFileName) noexcept;
+        void                    close() noexcept;
+
+    public:
+        const AssetPackEntry*   findEntry(const char* const path) const noexcept;
+        // 압축된 Entry 이거나 Entry 가 없으면 빈 AssetView 를 반환한다.
+        AssetView               getView(const char* const path) const noexcept;
+        // 압축 여부에 관계없이 원본 내용을 outByteArray 에 복사한다. 원본이 4GB 를 넘으면 false 를 반환한다.
+        const bool              read(const char* const path, mint::Vector<byte>& outByteArray) const noexcept;
+        // 4GB 를 넘는 Entry 도 읽을 수 있다. outByteCapacity 는 Entry 의 _originalSize 이상이어야 한다.
+        const bool              read(const char* const path, byte* const outBytes, const uint64 outByteCapacity) const noexcept;
+
+    public:
+        const bool              isOpen() const noexcept;
+        const uint32            getEntryCount() const noexcept;
+        const AssetPackEntry&   getEntry(const uint32 entryIndex) const noexcept;
+        // Path 가 Path table 을 벗어나는 손상된 Entry 이면 nullptr 를 반환한다.
+        const char*             getEntryPath(const uint32 entryIndex) const noexcept;
+
+    private:
+        const bool              readEntry(const AssetPackEntry& entry, const char* const path, byte* const outBytes) const noexcept;
+        const bool              isEntryInBounds(const AssetPackEntry& entry) const noexcept;
+        const bool              isPathInBounds(const AssetPackEntry& entry) const noexcept;
+
+    private:
+        MappedFile              _mappedFile;
+        const AssetPackHeader*  _header;
+        const AssetPackEntry*   _entries;
+        const char*             _pathTable;
+    };
+}
+
+
+#endif // !MINT_ASSET_PACK_H
@@ -0,0 +1,114 @@
+﻿#pragma once
+
+
+#ifndef MINT_ASYNC_FILE_SERVICE_H
+#define MINT_ASYNC_FILE_SERVICE_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace mint
+{
+    using AsyncFileRequestId = uint64;
+    static constexpr AsyncFileRequestId kInvalidAsyncFileRequestId = 0;
+
+
+    enum class AsyncFileRequestType : uint8
+    {
+        Read,
+        Write,
+    };
+
+    enum class AsyncFilePriority : uint8
+    {
+        High,
+        Normal,
+        Low,
+
+        COUNT
+    };
+
+
+    struct AsyncFileCompletion
+    {
+        AsyncFileRequestId      _requestId      = kInvalidAsyncFileRequestId;
+        AsyncFileRequestType    _requestType    = AsyncFileRequestType::Read;
+        bool                    _isSucceeded    = false;
+        std::string             _fileName;
+        mint::Vector<byte>      _byteArray;     // Read 의 결과. Write 의 경우 비어 있다.
+    };
+
+
+    // Worker Thread 들이 파일 읽기/쓰기를 대신 수행한다.
+    // 결과는 pollCompletion() 으로 Frame Loop 에서 꺼내 간다.
+    class AsyncFileService final
+    {
+        static constexpr uint32 kDefaultWorkerThreadCount   = 2;
+
+        struct Request
+        {
+            AsyncFileRequestId      _requestId      = kInvalidAsyncFileRequestId;
+            AsyncFileRequestType    _requestType    = AsyncFileRequestType::Read;
+            AsyncFilePriority       _priority       = AsyncFilePriority::Normal;
+            bool                    _syncToDisk     = false;
+            std::string             _fileName;
+            mint::Vector<byte>      _byteArray;
+        };
+
+    public:
+                                AsyncFileService();
+                                AsyncFileService(const uint32 workerThreadCount);
+                                AsyncFileService(const AsyncFileService& rhs)   = delete;
+                                AsyncFileService(AsyncFileService&& rhs)        = delete;
+                                ~AsyncFileService();
+
+    public:
+        AsyncFileRequestId      readAsync(const char* const fileName, const AsyncFilePriority priority = AsyncFilePriority::Normal) noexcept;
+        AsyncFileRequestId      writeAsync(const char* const fileName, mint::Vector<byte>&& byteArray, const AsyncFilePriority priority = AsyncFilePriority::Normal, const bool syncToDisk = false) noexcept;
+
+    public:
+        // beginBatch() 와 endBatch() 사이의 요청들은 endBatch() 에서 한꺼번에 Worker 들에게 넘어간다.
+        void                    beginBatch() noexcept;
+        void                    endBatch() noexcept;
+
+    public:
+        // Blocking 없이 완료된 요청 하나를 꺼낸다. 없으면 false.
+        const bool              pollCompletion(AsyncFileCompletion& outCompletion) noexcept;
+        // 제출된 모든 요청이 완료될 때까지 기다린다. (완료 결과는 그대로 남아 있다.)
+        void                    waitForAll() noexcept;
+
+    public:
+        const uint32            getPendingRequestCount() const noexcept;
+
+    private:
+        AsyncFileRequestId      pushRequest(Request&& request) noexcept;
+        void                    runWorker() noexcept;
+        static void             processRequest(Request& request, AsyncFileCompletion& outCompletion) noexcept;
+
+    private:
+        std::vector<std::thread>    _workerThreadArray;
+        mutable std::mutex          _mutex;
+        std::condition_variable     _requestConditionVariable;
+        std::condition_variable     _completionConditionVariable;
+        std::queue<Request>         _requestQueues[static_cast<uint32>(AsyncFilePriority::COUNT)];
+        std::queue<Request>         _batchRequestQueue;
+        std::queue<AsyncFileCompletion> _completionQueue;
+        AsyncFileRequestId          _lastRequestId;
+        uint32                      _pendingRequestCount;
+        uint32                      _batchDepth;
+        bool                        _shouldStop;
+    };
+}
+
+
+#endif // !MINT_ASYNC_FILE_SERVICE_H
@@ -8,9 +8,15 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintPlatform/Include/IFile.h>
+#include <MintPlatform/Include/MappedFile.h>
 
 #include <MintContainer/Include/Vector.h>
 
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
 
 namespace mint
 {
@@ -22,24 +28,33 @@ namespace mint
 
     public:
         virtual const bool      open(const char* const fileName) override;
+        // 파일을 복사하지 않고 Mapping 한다. read() 는 Mapping 된 메모리를 직접 가리킨다.
+        const bool              openMapped(const char* const fileName, const FileAccessHint accessHint = FileAccessHint::Sequential);
         virtual const bool      isOpen() const noexcept override;
-        virtual const uint32    getFileSize() const noexcept override;
+        virtual const uint64    getFileSize() const noexcept override;
 
     public:
         template <typename T>
         const T* const          read() const noexcept;
 
         template <typename T>
-        const T* const          read(const uint32 count) const noexcept;
+        const T* const          read(const uint64 count) const noexcept;
 
-        void                    skip(const uint32 byteCount) const noexcept;
+        void                    skip(const uint64 byteCount) const noexcept;
+        void                    seek(const uint64 at) const noexcept;
+        const uint64            tell() const noexcept;
+        const byte*             getData() const noexcept;
 
     private:
-        const bool              canRead(const uint32 byteCount) const noexcept;
+        const bool              canRead(const uint64 byteCount) const noexcept;
 
     private:
-        mint::Vector<byte>        _byteArray;
-        mutable uint32          _at{ 0 };
+        mint::Vector<byte>      _byteArray;
+        mint::MappedFile        _mappedFile;
+        const byte*             _bytes{ nullptr };
+        uint64                  _byteCount{ 0 };
+        mutable uint64          _at{ 0 };
+        bool                    _isOpen{ false };       // 크기가 0 인 파일도 열 수 있으므로 _byteCount 와 따로 둔다.
     };
 
 
@@ -64,9 +79,76 @@ namespace mint
 
         void                    write(const char* const in) noexcept;
 
+        template <typename T>
+        void                    writeSpan(const T* const in, const uint32 count) noexcept;
+
     private:
         mint::Vector<byte>        _byteArray;
     };
+
+
+    // 고정 크기 Buffer 에 쌓다가 가득 차면 파일에 바로 쓴다.
+    // BinaryFileWriter 와 달리 전체 출력 크기만큼의 메모리를 잡지 않는다.
+    class BinaryFileStreamWriter final
+    {
+    public:
+        static constexpr uint32 kDefaultBufferSize = 1 << 16;
+
+    public:
+                                BinaryFileStreamWriter();
+                                // useBackgroundFlush 가 true 이면 Buffer 두 개를 번갈아 쓰며, 가득 찬 Buffer 는 별도 Thread 가 파일에 쓴다.
+                                BinaryFileStreamWriter(const uint32 bufferSize, const bool useBackgroundFlush);
+                                BinaryFileStreamWriter(const BinaryFileStreamWriter& rhs)   = delete;
+                                BinaryFileStreamWriter(BinaryFileStreamWriter&& rhs)        = delete;
+                                ~BinaryFileStreamWriter();
+
+    public:
+        const bool              open(const char* const fileName) noexcept;
+        // syncToDisk 가 true 이면 OS 의 캐시까지 디스크로 내려보낸다. (fsync)
+        const bool              flush(const bool syncToDisk = false) noexcept;
+        const bool              close(const bool syncToDisk = false) noexcept;
+
+    public:
+        template <typename T>
+        void                    write(const T& in) noexcept;
+
+        void                    write(const char* const in) noexcept;
+
+        template <typename T>
+        void                    writeSpan(const T* const in, const uint64 count) noexcept;
+
+        void                    writeBytes(const void* const in, const uint64 byteCount) noexcept;
+
+    public:
+        const bool              isOpen() const noexcept;
+        const bool              hasError() const noexcept;
+        const uint64            getWrittenSize() const noexcept;
+
+    private:
+        void                    submitFrontBuffer() noexcept;
+        void                    waitForBackgroundFlush() noexcept;
+        void                    writeFileInternal(const byte* const bytes, const uint64 byteCount) noexcept;
+        void                    runBackgroundFlush() noexcept;
+
+    private:
+        void*                   _fileHandle;
+        const uint32            _bufferSize;
+        const bool              _useBackgroundFlush;
+        mint::Vector<byte>      _bufferArray[2];
+        uint32                  _frontBufferIndex;
+        uint32                  _frontBufferAt;
+        uint64                  _writtenSize;
+        std::atomic<bool>       _hasError;              // Flush thread 도 쓰므로 atomic 이다.
+
+    private:
+        std::thread             _flushThread;
+        std::mutex              _flushMutex;
+        std::condition_variable _flushConditionVariable;
+        uint32                  _pendingBufferIndex;    // Worker 가 쓸 Buffer. _flushMutex 를 잡은 상태에서만 바꾼다.
+        uint32                  _pendingByteCount;
+        bool                    _isFlushPending;
+        bool                    _shouldStopFlushThread;
+    };
 }
 
 
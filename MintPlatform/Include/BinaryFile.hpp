@@ -12,10 +12,10 @@ namespace mint
     template <typename T>
     MINT_INLINE const T* const BinaryFileReader::read() const noexcept
     {
-        const uint32 byteCount = static_cast<uint32>(sizeof(T));
+        const uint64 byteCount = static_cast<uint64>(sizeof(T));
         if (canRead(byteCount) == true)
         {
-            const T* const ptr = reinterpret_cast<const T*>(&_byteArray[_at]);
+            const T* const ptr = reinterpret_cast<const T*>(_bytes + _at);
             _at += byteCount;
             return ptr;
         }
@@ -23,26 +23,41 @@ namespace mint
     }
 
     template <typename T>
-    MINT_INLINE const T* const BinaryFileReader::read(const uint32 count) const noexcept
+    MINT_INLINE const T* const BinaryFileReader::read(const uint64 count) const noexcept
     {
-        const uint32 byteCount = static_cast<uint32>(sizeof(T) * count);
+        const uint64 byteCount = static_cast<uint64>(sizeof(T)) * count;
         if (canRead(byteCount) == true)
         {
-            const T* const ptr = reinterpret_cast<const T*>(&_byteArray[_at]);
+            const T* const ptr = reinterpret_cast<const T*>(_bytes + _at);
             _at += byteCount;
             return ptr;
         }
         return nullptr;
     }
 
-    MINT_INLINE void BinaryFileReader::skip(const uint32 byteCount) const noexcept
+    MINT_INLINE void BinaryFileReader::skip(const uint64 byteCount) const noexcept
     {
         _at += byteCount;
     }
 
-    MINT_INLINE const bool BinaryFileReader::canRead(const uint32 byteCount) const noexcept
+    MINT_INLINE void BinaryFileReader::seek(const uint64 at) const noexcept
     {
-        if (static_cast<uint64>(_at) + byteCount <= _byteArray.size())
+        _at = at;
+    }
+
+    MINT_INLINE const uint64 BinaryFileReader::tell() const noexcept
+    {
+        return _at;
+    }
+
+    MINT_INLINE const byte* BinaryFileReader::getData() const noexcept
+    {
+        return _bytes;
+    }
+
+    MINT_INLINE const bool BinaryFileReader::canRead(const uint64 byteCount) const noexcept
+    {
+        if (_at <= _byteCount && byteCount <= _byteCount - _at)
         {
             return true;
         }
@@ -82,5 +97,41 @@ namespace mint
         _byteArray.resize(static_cast<uint64>(currentSize) + deltaSize);
         memcpy(&_byteArray[currentSize], in, deltaSize);
     }
+
+    template <typename T>
+    MINT_INLINE void BinaryFileWriter::writeSpan(const T* const in, const uint32 count) noexcept
+    {
+        if (in == nullptr || count == 0)
+        {
+            return;
+        }
+
+        const uint32 currentSize{ static_cast<uint32>(_byteArray.size()) };
+        const uint32 deltaSize{ static_cast<uint32>(sizeof(T)) * count };
+        _byteArray.resize(static_cast<uint64>(currentSize) + deltaSize);
+        memcpy(&_byteArray[currentSize], in, deltaSize);
+    }
+#pragma endregion
+
+
+#pragma region Binary File Stream Writer
+    template <typename T>
+    MINT_INLINE void BinaryFileStreamWriter::write(const T& in) noexcept
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable!");
+        writeBytes(&in, sizeof(T));
+    }
+
+    MINT_INLINE void BinaryFileStreamWriter::write(const char* const in) noexcept
+    {
+        writeBytes(in, static_cast<uint64>(mint::StringUtil::strlen(in)) + 1);
+    }
+
+    template <typename T>
+    MINT_INLINE void BinaryFileStreamWriter::writeSpan(const T* const in, const uint64 count) noexcept
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable!");
+        writeBytes(in, static_cast<uint64>(sizeof(T)) * count);
+    }
 #pragma endregion
 }
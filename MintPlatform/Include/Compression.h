@@ -0,0 +1,26 @@
+﻿#pragma once
+
+
+#ifndef MINT_COMPRESSION_H
+#define MINT_COMPRESSION_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+namespace mint
+{
+    namespace Compression
+    {
+        // LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md) 과 호환된다.
+        // Frame format 은 지원하지 않으므로 원본 크기는 호출하는 쪽에서 따로 저장해야 한다.
+        const uint64    getLz4BlockBound(const uint64 sourceSize) noexcept;
+        // 실패하면 (destinationCapacity 부족) 0 을 반환한다.
+        const uint64    compressLz4Block(const byte* const source, const uint64 sourceSize, byte* const destination, const uint64 destinationCapacity) noexcept;
+        // destinationSize 는 원본 크기와 정확히 같아야 한다.
+        const bool      decompressLz4Block(const byte* const source, const uint64 sourceSize, byte* const destination, const uint64 destinationSize) noexcept;
+    }
+}
+
+
+#endif // !MINT_COMPRESSION_H
@@ -30,7 +30,7 @@ namespace mint
                 // file doesn't exist yet
                 return false;
             }
-            if (permissions == std::filesystem::perms::_File_attribute_readonly)
+            if ((permissions & std::filesystem::perms::owner_write) == std::filesystem::perms::none)
             {
                 // readonly file
                 return true;
@@ -43,10 +43,10 @@ namespace mint
             auto status{ std::filesystem::status(fileName) };
             auto type{ status.type() };
             auto permissions{ status.permissions() };
-            if (type != std::filesystem::file_type::not_found && permissions == std::filesystem::perms::_File_attribute_readonly)
+            if (type != std::filesystem::file_type::not_found && (permissions & std::filesystem::perms::owner_write) == std::filesystem::perms::none)
             {
                 // make writable
-                std::filesystem::permissions(fileName, permissions | std::filesystem::perms::_All_write);
+                std::filesystem::permissions(fileName, std::filesystem::perms::owner_write, std::filesystem::perm_options::add);
             }
         }
 
@@ -5,6 +5,9 @@
 #define MINT_I_FILE_H
 
 
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
 namespace mint
 {
     class IFileReader abstract
@@ -14,9 +17,9 @@ namespace mint
         virtual                 ~IFileReader()  = default;
 
     public:
-        virtual const bool      open(const char* const fileName) abstract;
-        virtual const bool      isOpen() const noexcept abstract;
-        virtual const uint32    getFileSize() const noexcept abstract;
+        virtual const bool      open(const char* const fileName) = 0;
+        virtual const bool      isOpen() const noexcept = 0;
+        virtual const uint64    getFileSize() const noexcept = 0;
     };
 
 
@@ -27,7 +30,7 @@ namespace mint
         virtual                 ~IFileWriter()  = default;
 
     public:
-        virtual const bool      save(const char* const fileName) abstract;
+        virtual const bool      save(const char* const fileName) = 0;
     };
 }
 
@@ -207,7 +207,7 @@ namespace mint
             virtual                         ~IWindow() = default;
 
         public:
-            virtual bool                    create(const CreationData& creationData) noexcept abstract;
+            virtual bool                    create(const CreationData& creationData) noexcept = 0;
             virtual void                    destroy() noexcept { _isRunning = false; }
         
         public:
@@ -241,12 +241,12 @@ namespace mint
             CreationError                   getCreationError() const noexcept { return _creationError; }
 
         public:
-            virtual void                    setSize(const Int2& newSize) abstract;
+            virtual void                    setSize(const Int2& newSize) = 0;
             const Int2&                     getSize() const noexcept { return _creationData._size; }
             
             const Int2&                     getEntireSize() const noexcept { return _entireSize; }
 
-            virtual void                    setPosition(const Int2& newPosition) abstract;
+            virtual void                    setPosition(const Int2& newPosition) = 0;
             const Int2&                     getPosition() const noexcept { return _creationData._position; }
             
             const mint::Float3&             getBackgroundColor() const noexcept { return _creationData._bgColor; }
@@ -254,16 +254,16 @@ namespace mint
             virtual void                    setCursorType(const CursorType cursorType) noexcept { _currentCursorType = cursorType; }
             const CursorType                getCursorType() const noexcept { return _currentCursorType; }
 
-            virtual const uint32            getCaretBlinkIntervalMs() const noexcept abstract;
+            virtual const uint32            getCaretBlinkIntervalMs() const noexcept = 0;
 
-            virtual const bool              isKeyDown(const EventData::KeyCode keyCode) const noexcept abstract;
-            virtual const bool              isKeyDownFirst(const EventData::KeyCode keyCode) const noexcept abstract;
-            virtual const bool              isMouseDown(const EventData::MouseButton mouseButton) const noexcept abstract;
-            virtual const bool              isMouseDownFirst(const EventData::MouseButton mouseButton) const noexcept abstract;
+            virtual const bool              isKeyDown(const EventData::KeyCode keyCode) const noexcept = 0;
+            virtual const bool              isKeyDownFirst(const EventData::KeyCode keyCode) const noexcept = 0;
+            virtual const bool              isMouseDown(const EventData::MouseButton mouseButton) const noexcept = 0;
+            virtual const bool              isMouseDownFirst(const EventData::MouseButton mouseButton) const noexcept = 0;
 
-            virtual void                    textToClipboard(const wchar_t* const text, const uint32 textLength) const noexcept abstract;
-            virtual void                    textFromClipboard(std::wstring& outText) const noexcept abstract;
-            virtual void                    showMessageBox(const std::wstring& title, const std::wstring& message, const MessageBoxType messageBoxType) const noexcept abstract;
+            virtual void                    textToClipboard(const wchar_t* const text, const uint32 textLength) const noexcept = 0;
+            virtual void                    textFromClipboard(std::wstring& outText) const noexcept = 0;
+            virtual void                    showMessageBox(const std::wstring& title, const std::wstring& message, const MessageBoxType messageBoxType) const noexcept = 0;
 
         protected:
             static constexpr uint32         kEventQueueCapacity = 128;
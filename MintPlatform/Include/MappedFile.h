@@ -0,0 +1,57 @@
+﻿#pragma once
+
+
+#ifndef MINT_MAPPED_FILE_H
+#define MINT_MAPPED_FILE_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+
+namespace mint
+{
+    enum class FileAccessHint
+    {
+        Normal,
+        Sequential, // read-ahead 을 최대한 활용
+        Random,     // read-ahead 를 하지 않음
+    };
+
+
+    // Read-only memory-mapped view of a whole file.
+    // getData() 가 가리키는 메모리는 close() 전까지 유효하다.
+    class MappedFile final
+    {
+    public:
+                                MappedFile();
+                                MappedFile(const MappedFile& rhs)   = delete;
+                                MappedFile(MappedFile&& rhs) noexcept;
+                                ~MappedFile();
+
+    public:
+        MappedFile&             operator=(const MappedFile& rhs)    = delete;
+        MappedFile&             operator=(MappedFile&& rhs) noexcept;
+
+    public:
+        const bool              open(const char* const fileName, const FileAccessHint accessHint) noexcept;
+        void                    close() noexcept;
+
+    public:
+        // Asks the OS to page in the given range ahead of the actual access.
+        void                    prefetch(const uint64 offset, const uint64 byteCount) const noexcept;
+
+    public:
+        const bool              isOpen() const noexcept;
+        const byte*             getData() const noexcept;
+        const uint64            getSize() const noexcept;
+
+    private:
+        void*                   _fileHandle;
+        void*                   _mappingHandle;
+        const byte*             _data;
+        uint64                  _size;
+    };
+}
+
+
+#endif // !MINT_MAPPED_FILE_H
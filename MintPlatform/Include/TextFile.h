@@ -8,6 +8,7 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintPlatform/Include/IFile.h>
+#include <MintPlatform/Include/MappedFile.h>
 
 #include <MintContainer/Include/Vector.h>
 
@@ -21,6 +22,52 @@ namespace mint
     };
 
 
+    // 한 줄의 내용. 줄바꿈 문자 ('\n', "\r\n") 는 포함하지 않는다.
+    struct TextLine
+    {
+        const char*                 _begin      = nullptr;
+        const char*                 _end        = nullptr;
+        uint64                      _lineIndex  = 0;
+
+    public:
+        const uint64                length() const noexcept { return static_cast<uint64>(_end - _begin); }
+    };
+
+
+    // File buffer 를 복사하지 않고 한 줄씩 순회한다. (std::getline 과 같이 마지막 빈 줄은 만들지 않는다.)
+    class TextLineIterator final
+    {
+    public:
+                                    TextLineIterator();
+                                    TextLineIterator(const char* const begin, const char* const end);
+
+    public:
+        const TextLine&             operator*() const noexcept;
+        const TextLine*             operator->() const noexcept;
+        TextLineIterator&           operator++() noexcept;
+        const bool                  operator!=(const TextLineIterator& rhs) const noexcept;
+
+    private:
+        void                        readLine() noexcept;
+
+    private:
+        const char*                 _at;
+        const char*                 _end;
+        TextLine                    _line;
+    };
+
+
+    struct TextLineRange
+    {
+        const char*                 _begin  = nullptr;
+        const char*                 _end    = nullptr;
+
+    public:
+        TextLineIterator            begin() const noexcept { return TextLineIterator(_begin, _end); }
+        TextLineIterator            end() const noexcept { return TextLineIterator(); }
+    };
+
+
     class TextFileReader final : public IFileReader
     {
     public:
@@ -29,15 +76,27 @@ namespace mint
 
     public:
         virtual const bool          open(const char* const fileName) override;
+        // 파일을 복사하지 않고 Mapping 한다.
+        // 이 경우 get() 은 null-terminated 가 아니므로 반드시 getFileSize() 와 함께 써야 한다.
+        const bool                  openMapped(const char* const fileName, const FileAccessHint accessHint = FileAccessHint::Sequential);
         virtual const bool          isOpen() const noexcept override;
-        virtual const uint32        getFileSize() const noexcept override;
+        virtual const uint64        getFileSize() const noexcept override;
 
     public:
-        const char                  get(const uint32 at) const noexcept;
+        const char                  get(const uint64 at) const noexcept;
         const char*                 get() const noexcept;
+        const TextFileEncoding      getEncoding() const noexcept;
+
+    public:
+        // open() 이 붙이는 '\0' 을 제외한 Text 의 길이
+        const uint64                getTextLength() const noexcept;
+        TextLineRange               getLines() const noexcept;
         
     private:
-        mint::Vector<byte>            _byteArray;
+        mint::Vector<byte>          _byteArray;
+        mint::MappedFile            _mappedFile;
+        const byte*                 _bytes = nullptr;
+        uint64                      _byteCount = 0;
         TextFileEncoding            _encoding = TextFileEncoding::ASCII;
     };
 
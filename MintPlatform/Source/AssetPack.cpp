@@ -0,0 +1,437 @@
+﻿#include <MintPlatform/Include/AssetPack.h>
+
+#include <MintCommon/Include/Logger.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/Hash.hpp>
+
+#include <MintPlatform/Include/BinaryFile.hpp>
+#include <MintPlatform/Include/Compression.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <cstdio>
+
+
+namespace mint
+{
+    static constexpr char kAssetPackMagic[4]{ 'M', 'P', 'A', 'K' };
+
+
+    MINT_INLINE void normalizeAssetPath(std::string& inOutPath) noexcept
+    {
+        std::replace(inOutPath.begin(), inOutPath.end(), '\\', '/');
+    }
+
+    MINT_INLINE const uint64 alignAssetPackOffset(const uint64 offset, const uint64 alignment) noexcept
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+
+#pragma region Asset Pack Writer
+    AssetPackWriter::AssetPackWriter()
+        : AssetPackWriter(kDefaultAlignment)
+    {
+        __noop;
+    }
+
+    AssetPackWriter::AssetPackWriter(const uint32 alignment)
+        : _alignment{ mint::max(alignment, static_cast<uint32>(8)) }
+    {
+        MINT_ASSERT("김장원", (_alignment & (_alignment - 1)) == 0, "alignment 는 2 의 거듭제곱이어야 합니다!");
+    }
+
+    void AssetPackWriter::addFile(const char* const path, const char* const sourceFileName, const AssetPackCompression compression) noexcept
+    {
+        PendingEntry pendingEntry;
+        pendingEntry._path = path;
+        pendingEntry._sourceFileName = sourceFileName;
+        pendingEntry._compression = compression;
+        normalizeAssetPath(pendingEntry._path);
+        _pendingEntryArray.push_back(std::move(pendingEntry));
+    }
+
+    const bool AssetPackWriter::addData(const char* const path, const byte* const bytes, const uint64 byteCount, const AssetPackCompression compression) noexcept
+    {
+        if (byteCount > kUint32Max)
+        {
+            MINT_LOG("김장원", "4GB 를 넘는 데이터는 addFile() 로 추가해야 합니다: %s", path);
+            return false;
+        }
+
+        PendingEntry pendingEntry;
+        pendingEntry._path = path;
+        pendingEntry._compression = compression;
+        normalizeAssetPath(pendingEntry._path);
+        pendingEntry._byteArray.resize(static_cast<uint32>(byteCount));
+        if (byteCount > 0)
+        {
+            ::memcpy(&pendingEntry._byteArray[0], bytes, byteCount);
+        }
+        _pendingEntryArray.push_back(std::move(pendingEntry));
+        return true;
+    }
+
+    const uint32 AssetPackWriter::addDirectory(const char* const directoryName, const AssetPackCompression compression) noexcept
+    {
+        std::error_code errorCode;
+        uint32 addedFileCount = 0;
+        for (const std::filesystem::directory_entry& directoryEntry : std::filesystem::recursive_directory_iterator(directoryName, errorCode))
+        {
+            if (directoryEntry.is_regular_file() == false)
+            {
+                continue;
+            }
+
+            const std::string relativePath = std::filesystem::relative(directoryEntry.path(), directoryName).generic_string();
+            addFile(relativePath.c_str(), directoryEntry.path().string().c_str(), compression);
+            ++addedFileCount;
+        }
+        return addedFileCount;
+    }
+
+    const bool AssetPackWriter::save(const char* const packFileName) noexcept
+    {
+        const uint32 entryCount = _pendingEntryArray.size();
+
+        // Entry table 은 (hash, path) 순으로 정렬해 두어 Reader 가 이분 탐색할 수 있게 한다.
+        mint::Vector<AssetPackEntry> entryArray(entryCount);
+        mint::Vector<uint32> sortedIndexArray(entryCount);
+        for (uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            const PendingEntry& pendingEntry = _pendingEntryArray[entryIndex];
+            AssetPackEntry& entry = entryArray[entryIndex];
+            ::memset(&entry, 0, sizeof(AssetPackEntry));
+            entry._pathHash = computeHash(pendingEntry._path.c_str(), static_cast<uint32>(pendingEntry._path.length()));
+            entry._pathLength = static_cast<uint32>(pendingEntry._path.length());
+            sortedIndexArray[entryIndex] = entryIndex;
+        }
+        std::sort(&sortedIndexArray[0], &sortedIndexArray[0] + entryCount, [&](const uint32 a, const uint32 b)
+            {
+                if (entryArray[a]._pathHash != entryArray[b]._pathHash)
+                {
+                    return entryArray[a]._pathHash < entryArray[b]._pathHash;
+                }
+                return _pendingEntryArray[a]._path < _pendingEntryArray[b]._path;
+            });
+        for (uint32 sortedIndex = 1; sortedIndex < entryCount; ++sortedIndex)
+        {
+            if (_pendingEntryArray[sortedIndexArray[sortedIndex - 1]]._path == _pendingEntryArray[sortedIndexArray[sortedIndex]]._path)
+            {
+                MINT_LOG("김장원", "같은 경로가 두 번 추가되었습니다: %s", _pendingEntryArray[sortedIndexArray[sortedIndex]]._path.c_str());
+                return false;
+            }
+        }
+
+        BinaryFileStreamWriter binaryFileStreamWriter;
+        if (binaryFileStreamWriter.open(packFileName) == false)
+        {
+            return false;
+        }
+
+        AssetPackHeader header;
+        ::memset(&header, 0, sizeof(AssetPackHeader));
+        ::memcpy(header._magic, kAssetPackMagic, sizeof(kAssetPackMagic));
+        header._version = AssetPackHeader::kVersion;
+        header._entryCount = entryCount;
+        header._alignment = _alignment;
+        binaryFileStreamWriter.write(header);
+
+        static constexpr byte kPaddingBytes[256]{};
+        auto writePadding = [&](const uint64 alignment)
+        {
+            const uint64 currentOffset = binaryFileStreamWriter.getWrittenSize();
+            uint64 paddingByteCount = alignAssetPackOffset(currentOffset, alignment) - currentOffset;
+            while (paddingByteCount > 0)
+            {
+                const uint64 currentPaddingByteCount = mint::min(paddingByteCount, static_cast<uint64>(sizeof(kPaddingBytes)));
+                binaryFileStreamWriter.writeSpan(kPaddingBytes, currentPaddingByteCount);
+                paddingByteCount -= currentPaddingByteCount;
+            }
+        };
+
+        // Entry data 를 하나씩 읽고 (압축하고) 바로 쓰므로, 한 번에 하나의 Entry 만 메모리에 올라간다.
+        mint::Vector<byte> compressedByteArray;
+        for (uint32 entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            const PendingEntry& pendingEntry = _pendingEntryArray[entryIndex];
+            AssetPackEntry& entry = entryArray[entryIndex];
+
+            MappedFile sourceFile;
+            const byte* sourceBytes = pendingEntry._byteArray.data();
+            uint64 sourceByteCount = pendingEntry._byteArray.size();
+            if (pendingEntry._sourceFileName.empty() == false)
+            {
+                sourceBytes = nullptr;
+                sourceByteCount = 0;
+                if (sourceFile.open(pendingEntry._sourceFileName.c_str(), FileAccessHint::Sequential) == true)
+                {
+                    sourceBytes = sourceFile.getData();
+                    sourceByteCount = sourceFile.getSize();
+                }
+                else if (std::filesystem::is_regular_file(pendingEntry._sourceFileName) == false || std::filesystem::file_size(pendingEntry._sourceFileName) != 0)
+                {
+                    // 크기가 0 인 파일은 memory-map 할 수 없으므로 빈 Entry 로 취급한다.
+                    MINT_LOG("김장원", "파일을 열 수 없습니다: %s", pendingEntry._sourceFileName.c_str());
+                    return false;
+                }
+            }
+
+            entry._originalSize = sourceByteCount;
+            entry._storedSize = sourceByteCount;
+            entry._compression = AssetPackCompression::None;
+            // 압축 Buffer 는 mint::Vector 에 담기므로 4GB 를 넘으면 압축하지 않고 그대로 저장한다.
+            const uint64 compressBound = Compression::getLz4BlockBound(sourceByteCount);
+            if (pendingEntry._compression == AssetPackCompression::Lz4 && sourceByteCount > 0 && compressBound <= kUint32Max)
+            {
+                compressedByteArray.resize(static_cast<uint32>(compressBound));
+                const uint64 compressedByteCount = Compression::compressLz4Block(sourceBytes, sourceByteCount, &compressedByteArray[0], compressedByteArray.size());
+                // 압축해서 커지면 그대로 저장한다.
+                if (compressedByteCount > 0 && compressedByteCount < sourceByteCount)
+                {
+                    sourceBytes = compressedByteArray.data();
+                    entry._storedSize = compressedByteCount;
+                    entry._compression = AssetPackCompression::Lz4;
+                }
+            }
+
+            writePadding(_alignment);
+            entry._dataOffset = binaryFileStreamWriter.getWrittenSize();
+            binaryFileStreamWriter.writeSpan(sourceBytes, entry._storedSize);
+        }
+
+        uint32 pathOffset = 0;
+        for (uint32 sortedIndex = 0; sortedIndex < entryCount; ++sortedIndex)
+        {
+            AssetPackEntry& entry = entryArray[sortedIndexArray[sortedIndex]];
+            entry._pathOffset = pathOffset;
+            pathOffset += entry._pathLength + 1;
+        }
+
+        writePadding(alignof(AssetPackEntry));
+        header._entryTableOffset = binaryFileStreamWriter.getWrittenSize();
+        for (uint32 sortedIndex = 0; sortedIndex < entryCount; ++sortedIndex)
+        {
+            binaryFileStreamWriter.write(entryArray[sortedIndexArray[sortedIndex]]);
+        }
+
+        header._pathTableOffset = binaryFileStreamWriter.getWrittenSize();
+        header._pathTableSize = pathOffset;
+        for (uint32 sortedIndex = 0; sortedIndex < entryCount; ++sortedIndex)
+        {
+            binaryFileStreamWriter.write(_pendingEntryArray[sortedIndexArray[sortedIndex]]._path.c_str());
+        }
+
+        if (binaryFileStreamWriter.close() == false)
+        {
+            return false;
+        }
+
+        // Offset 들은 다 쓴 뒤에야 알 수 있으므로 Header 만 다시 쓴다.
+        std::FILE* file = nullptr;
+        if (::fopen_s(&file, packFileName, "r+b") != 0 || file == nullptr)
+        {
+            return false;
+        }
+        const bool isHeaderWritten = (::fwrite(&header, sizeof(AssetPackHeader), 1, file) == 1);
+        ::fclose(file);
+        return isHeaderWritten;
+    }
+
+    void AssetPackWriter::clear() noexcept
+    {
+        _pendingEntryArray.clear();
+    }
+
+    const uint32 AssetPackWriter::getEntryCount() const noexcept
+    {
+        return _pendingEntryArray.size();
+    }
+#pragma endregion
+
+
+#pragma region Asset Pack Reader
+    AssetPackReader::AssetPackReader()
+        : _header{ nullptr }
+        , _entries{ nullptr }
+        , _pathTable{ nullptr }
+    {
+        __noop;
+    }
+
+    const bool AssetPackReader::open(const char* const packFileName) noexcept
+    {
+        close();
+
+        if (_mappedFile.open(packFileName, FileAccessHint::Random) == false)
+        {
+            return false;
+        }
+
+        const byte* const data = _mappedFile.getData();
+        const uint64 size = _mappedFile.getSize();
+        const AssetPackHeader* const header = reinterpret_cast<const AssetPackHeader*>(data);
+        const uint64 entryTableSize = static_cast<uint64>(sizeof(AssetPackEntry)) * ((size < sizeof(AssetPackHeader)) ? 0 : header->_entryCount);
+        if (size < sizeof(AssetPackHeader)
+            || ::memcmp(header->_magic, kAssetPackMagic, sizeof(kAssetPackMagic)) != 0
+            || header->_version != AssetPackHeader::kVersion
+            || header->_entryTableOffset > size || entryTableSize > size - header->_entryTableOffset
+            || header->_pathTableOffset > size || header->_pathTableSize > size - header->_pathTableOffset)
+        {
+            MINT_LOG("김장원", "잘못된 AssetPack 입니다: %s", packFileName);
+            _mappedFile.close();
+            return false;
+        }
+
+        _header = header;
+        _entries = reinterpret_cast<const AssetPackEntry*>(data + header->_entryTableOffset);
+        _pathTable = reinterpret_cast<const char*>(data + header->_pathTableOffset);
+        return true;
+    }
+
+    void AssetPackReader::close() noexcept
+    {
+        _mappedFile.close();
+        _header = nullptr;
+        _entries = nullptr;
+        _pathTable = nullptr;
+    }
+
+    const AssetPackEntry* AssetPackReader::findEntry(const char* const path) const noexcept
+    {
+        if (isOpen() == false)
+        {
+            return nullptr;
+        }
+
+        std::string normalizedPath{ path };
+        normalizeAssetPath(normalizedPath);
+        const uint32 pathLength = static_cast<uint32>(normalizedPath.length());
+        const uint64 pathHash = computeHash(normalizedPath.c_str(), pathLength);
+
+        const AssetPackEntry* const entriesEnd = _entries + _header->_entryCount;
+        const AssetPackEntry* entry = std::lower_bound(_entries, entriesEnd, pathHash, [](const AssetPackEntry& entry, const uint64 pathHash)
+            {
+                return entry._pathHash < pathHash;
+            });
+        for (; entry != entriesEnd && entry->_pathHash == pathHash; ++entry)
+        {
+            if (entry->_pathLength == pathLength && isPathInBounds(*entry) == true && ::memcmp(_pathTable + entry->_pathOffset, normalizedPath.c_str(), pathLength) == 0)
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    AssetView AssetPackReader::getView(const char* const path) const noexcept
+    {
+        AssetView assetView;
+        const AssetPackEntry* const entry = findEntry(path);
+        if (entry == nullptr || entry->_compression != AssetPackCompression::None || entry->_storedSize != entry->_originalSize || isEntryInBounds(*entry) == false)
+        {
+            return assetView;
+        }
+
+        assetView._data = _mappedFile.getData() + entry->_dataOffset;
+        assetView._size = entry->_storedSize;
+        return assetView;
+    }
+
+    const bool AssetPackReader::read(const char* const path, mint::Vector<byte>& outByteArray) const noexcept
+    {
+        const AssetPackEntry* const entry = findEntry(path);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        if (entry->_originalSize > kUint32Max)
+        {
+            MINT_LOG("김장원", "4GB 를 넘는 Entry 는 mint::Vector 에 담을 수 없습니다. getView() 나 byte* 를 받는 read() 를 써야 합니다: %s", path);
+            return false;
+        }
+
+        outByteArray.resize(static_cast<uint32>(entry->_originalSize));
+        if (entry->_originalSize == 0)
+        {
+            return readEntry(*entry, path, nullptr);
+        }
+        return readEntry(*entry, path, &outByteArray[0]);
+    }
+
+    const bool AssetPackReader::read(const char* const path, byte* const outBytes, const uint64 outByteCapacity) const noexcept
+    {
+        const AssetPackEntry* const entry = findEntry(path);
+        if (entry == nullptr || entry->_originalSize > outByteCapacity)
+        {
+            return false;
+        }
+        return readEntry(*entry, path, outBytes);
+    }
+
+    const bool AssetPackReader::readEntry(const AssetPackEntry& entry, const char* const path, byte* const outBytes) const noexcept
+    {
+        if (isEntryInBounds(entry) == false)
+        {
+            return false;
+        }
+
+        const byte* const storedBytes = _mappedFile.getData() + entry._dataOffset;
+        if (entry._compression == AssetPackCompression::Lz4)
+        {
+            return (entry._originalSize == 0) || Compression::decompressLz4Block(storedBytes, entry._storedSize, outBytes, entry._originalSize);
+        }
+        if (entry._compression != AssetPackCompression::None || entry._storedSize != entry._originalSize)
+        {
+            MINT_LOG("김장원", "잘못된 AssetPack Entry 입니다: %s", path);
+            return false;
+        }
+
+        if (entry._originalSize > 0)
+        {
+            ::memcpy(outBytes, storedBytes, entry._originalSize);
+        }
+        return true;
+    }
+
+    const bool AssetPackReader::isEntryInBounds(const AssetPackEntry& entry) const noexcept
+    {
+        const uint64 size = _mappedFile.getSize();
+        return (entry._dataOffset <= size && entry._storedSize <= size - entry._dataOffset);
+    }
+
+    const bool AssetPackReader::isPathInBounds(const AssetPackEntry& entry) const noexcept
+    {
+        // Path 뒤의 '\0' 까지 Path table 안에 있어야 한다.
+        const uint64 pathTableSize = _header->_pathTableSize;
+        return (entry._pathOffset < pathTableSize && entry._pathLength < pathTableSize - entry._pathOffset && _pathTable[entry._pathOffset + entry._pathLength] == '\0');
+    }
+
+    const bool AssetPackReader::isOpen() const noexcept
+    {
+        return (_header != nullptr);
+    }
+
+    const uint32 AssetPackReader::getEntryCount() const noexcept
+    {
+        return (isOpen() == true) ? _header->_entryCount : 0;
+    }
+
+    const AssetPackEntry& AssetPackReader::getEntry(const uint32 entryIndex) const noexcept
+    {
+        MINT_ASSERT("김장원", entryIndex < getEntryCount(), "범위를 벗어난 접근입니다.");
+        return _entries[entryIndex];
+    }
+
+    const char* AssetPackReader::getEntryPath(const uint32 entryIndex) const noexcept
+    {
+        const AssetPackEntry& entry = getEntry(entryIndex);
+        if (isPathInBounds(entry) == false)
+        {
+            return nullptr;
+        }
+        return _pathTable + entry._pathOffset;
+    }
+#pragma endregion
+}
@@ -0,0 +1,246 @@
+﻿#include <MintPlatform/Include/AsyncFileService.h>
+
+#include <MintCommon/Include/Logger.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <MintPlatform/Include/BinaryFile.hpp>
+
+#include <fstream>
+
+
+namespace mint
+{
+    AsyncFileService::AsyncFileService()
+        : AsyncFileService(kDefaultWorkerThreadCount)
+    {
+        __noop;
+    }
+
+    AsyncFileService::AsyncFileService(const uint32 workerThreadCount)
+        : _lastRequestId{ kInvalidAsyncFileRequestId }
+        , _pendingRequestCount{ 0 }
+        , _batchDepth{ 0 }
+        , _shouldStop{ false }
+    {
+        const uint32 actualWorkerThreadCount = mint::max(workerThreadCount, static_cast<uint32>(1));
+        _workerThreadArray.reserve(actualWorkerThreadCount);
+        for (uint32 workerThreadIndex = 0; workerThreadIndex < actualWorkerThreadCount; ++workerThreadIndex)
+        {
+            _workerThreadArray.emplace_back(&AsyncFileService::runWorker, this);
+        }
+    }
+
+    AsyncFileService::~AsyncFileService()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            _batchDepth = 0;
+            while (_batchRequestQueue.empty() == false)
+            {
+                Request& request = _batchRequestQueue.front();
+                _requestQueues[static_cast<uint32>(request._priority)].push(std::move(request));
+                _batchRequestQueue.pop();
+            }
+            _shouldStop = true;
+        }
+        _requestConditionVariable.notify_all();
+
+        for (std::thread& workerThread : _workerThreadArray)
+        {
+            workerThread.join();
+        }
+    }
+
+    AsyncFileRequestId AsyncFileService::readAsync(const char* const fileName, const AsyncFilePriority priority) noexcept
+    {
+        Request request;
+        request._requestType = AsyncFileRequestType::Read;
+        request._priority = priority;
+        request._fileName = fileName;
+        return pushRequest(std::move(request));
+    }
+
+    AsyncFileRequestId AsyncFileService::writeAsync(const char* const fileName, mint::Vector<byte>&& byteArray, const AsyncFilePriority priority, const bool syncToDisk) noexcept
+    {
+        Request request;
+        request._requestType = AsyncFileRequestType::Write;
+        request._priority = priority;
+        request._syncToDisk = syncToDisk;
+        request._fileName = fileName;
+        request._byteArray = std::move(byteArray);
+        return pushRequest(std::move(request));
+    }
+
+    void AsyncFileService::beginBatch() noexcept
+    {
+        std::lock_guard<std::mutex> lock{ _mutex };
+        ++_batchDepth;
+    }
+
+    void AsyncFileService::endBatch() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            MINT_ASSERT("김장원", _batchDepth > 0, "beginBatch() 없이 endBatch() 가 호출되었습니다!");
+            if (_batchDepth == 0 || --_batchDepth > 0)
+            {
+                return;
+            }
+
+            while (_batchRequestQueue.empty() == false)
+            {
+                Request& request = _batchRequestQueue.front();
+                _requestQueues[static_cast<uint32>(request._priority)].push(std::move(request));
+                _batchRequestQueue.pop();
+            }
+        }
+        _requestConditionVariable.notify_all();
+    }
+
+    const bool AsyncFileService::pollCompletion(AsyncFileCompletion& outCompletion) noexcept
+    {
+        std::lock_guard<std::mutex> lock{ _mutex };
+        if (_completionQueue.empty() == true)
+        {
+            return false;
+        }
+
+        outCompletion = std::move(_completionQueue.front());
+        _completionQueue.pop();
+        return true;
+    }
+
+    void AsyncFileService::waitForAll() noexcept
+    {
+        std::unique_lock<std::mutex> lock{ _mutex };
+        MINT_ASSERT("김장원", _batchDepth == 0, "Batch 가 열려 있는 동안에는 기다릴 수 없습니다!");
+        _completionConditionVariable.wait(lock, [this]() { return _pendingRequestCount == 0; });
+    }
+
+    const uint32 AsyncFileService::getPendingRequestCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock{ _mutex };
+        return _pendingRequestCount;
+    }
+
+    AsyncFileRequestId AsyncFileService::pushRequest(Request&& request) noexcept
+    {
+        bool isBatched = false;
+        AsyncFileRequestId requestId = kInvalidAsyncFileRequestId;
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            requestId = ++_lastRequestId;
+            request._requestId = requestId;
+            ++_pendingRequestCount;
+
+            isBatched = (_batchDepth > 0);
+            if (isBatched == true)
+            {
+                _batchRequestQueue.push(std::move(request));
+            }
+            else
+            {
+                _requestQueues[static_cast<uint32>(request._priority)].push(std::move(request));
+            }
+        }
+
+        if (isBatched == false)
+        {
+            _requestConditionVariable.notify_one();
+        }
+        return requestId;
+    }
+
+    void AsyncFileService::runWorker() noexcept
+    {
+        while (true)
+        {
+            // 이동된 mint::Vector 는 다시 쓸 수 없으므로 요청마다 새로 만든다.
+            Request request;
+            AsyncFileCompletion completion;
+
+            // Lock 을 잡을 때마다 비어 있지 않은 가장 높은 Priority 의 Queue 에서 하나만 가져온다.
+            // 그래야 나중에 들어온 High 요청이 이미 가져간 Low 요청들 뒤에서 기다리지 않는다.
+            {
+                std::unique_lock<std::mutex> lock{ _mutex };
+                std::queue<Request>* requestQueue = nullptr;
+                _requestConditionVariable.wait(lock, [this, &requestQueue]()
+                    {
+                        for (std::queue<Request>& currentRequestQueue : _requestQueues)
+                        {
+                            if (currentRequestQueue.empty() == false)
+                            {
+                                requestQueue = &currentRequestQueue;
+                                return true;
+                            }
+                        }
+                        return _shouldStop;
+                    });
+
+                if (requestQueue == nullptr)
+                {
+                    return;
+                }
+
+                request = std::move(requestQueue->front());
+                requestQueue->pop();
+            }
+
+            processRequest(request, completion);
+
+            // 끝난 요청은 바로 내보낸다.
+            {
+                std::lock_guard<std::mutex> lock{ _mutex };
+                _completionQueue.push(std::move(completion));
+                --_pendingRequestCount;
+            }
+            _completionConditionVariable.notify_all();
+        }
+    }
+
+    void AsyncFileService::processRequest(Request& request, AsyncFileCompletion& outCompletion) noexcept
+    {
+        outCompletion._requestId = request._requestId;
+        outCompletion._requestType = request._requestType;
+        outCompletion._isSucceeded = false;
+        outCompletion._fileName = std::move(request._fileName);
+        outCompletion._byteArray.clear();
+
+        if (request._requestType == AsyncFileRequestType::Read)
+        {
+            std::ifstream ifs{ outCompletion._fileName, std::ifstream::binary };
+            if (ifs.is_open() == false)
+            {
+                return;
+            }
+
+            ifs.seekg(0, std::ifstream::end);
+            const uint64 fileSize = static_cast<uint64>(ifs.tellg());
+            ifs.seekg(0, std::ifstream::beg);
+            if (fileSize > kUint32Max)
+            {
+                return;
+            }
+
+            outCompletion._byteArray.resize(static_cast<uint32>(fileSize));
+            if (fileSize > 0)
+            {
+                ifs.read(reinterpret_cast<char*>(&outCompletion._byteArray[0]), fileSize);
+            }
+            outCompletion._isSucceeded = (ifs.fail() == false);
+        }
+        else
+        {
+            BinaryFileStreamWriter binaryFileStreamWriter;
+            if (binaryFileStreamWriter.open(outCompletion._fileName.c_str()) == false)
+            {
+                return;
+            }
+
+            binaryFileStreamWriter.writeSpan(request._byteArray.data(), request._byteArray.size());
+            outCompletion._isSucceeded = binaryFileStreamWriter.close(request._syncToDisk);
+        }
+        request._byteArray.clear();
+    }
+}
@@ -1,44 +1,91 @@
 ﻿#include <MintPlatform/Include/BinaryFile.h>
 
+#include <MintCommon/Include/Logger.h>
+
 #include <MintContainer/Include/Vector.hpp>
 
+#include <cstring>
 #include <fstream>
 
+#if defined _WIN32
+    #include <Windows.h>
+    #undef max
+    #undef min
+#else
+    #include <cstdio>
+    #include <unistd.h>
+
+    // Windows 가 아니면 _fileHandle 은 FILE* 이다.
+    #define INVALID_HANDLE_VALUE nullptr
+#endif
+
 
 namespace mint
 {
 #pragma region Binary File Reader
     const bool BinaryFileReader::open(const char* const fileName)
     {
+        _mappedFile.close();
+        _byteArray.clear();
+        _bytes = nullptr;
+        _byteCount = 0;
+        _at = 0;
+        _isOpen = false;
+
         std::ifstream ifs{ fileName, std::ifstream::binary };
         if (ifs.is_open() == false)
         {
-            _byteArray.clear();
             return false;
         }
 
-        _byteArray.clear();
-
         ifs.seekg(0, ifs.end);
-        const uint64 legth = ifs.tellg();
+        const uint64 length = ifs.tellg();
         ifs.seekg(0, ifs.beg);
-        _byteArray.reserve(static_cast<uint32>(legth));
-        while (ifs.eof() == false)
+        if (kUint32Max < length)
+        {
+            MINT_LOG("김장원", "4GB 를 넘는 파일은 openMapped() 로 열어야 합니다: %s", fileName);
+            return false;
+        }
+
+        _byteArray.resize(static_cast<uint32>(length));
+        if (0 < length)
         {
-            byte readByte{ static_cast<byte>(ifs.get()) };
-            _byteArray.push_back(readByte);
+            ifs.read(reinterpret_cast<char*>(&_byteArray[0]), length);
         }
+
+        _bytes = _byteArray.data();
+        _byteCount = _byteArray.size();
+        _isOpen = true;
+        return true;
+    }
+
+    const bool BinaryFileReader::openMapped(const char* const fileName, const FileAccessHint accessHint)
+    {
+        _byteArray.clear();
+        _bytes = nullptr;
+        _byteCount = 0;
+        _at = 0;
+        _isOpen = false;
+
+        if (_mappedFile.open(fileName, accessHint) == false)
+        {
+            return false;
+        }
+
+        _bytes = _mappedFile.getData();
+        _byteCount = _mappedFile.getSize();
+        _isOpen = true;
         return true;
     }
 
     const bool BinaryFileReader::isOpen() const noexcept
     {
-        return !_byteArray.empty();
+        return _isOpen;
     }
 
-    const uint32 BinaryFileReader::getFileSize() const noexcept
+    const uint64 BinaryFileReader::getFileSize() const noexcept
     {
-        return static_cast<uint32>(_byteArray.size());
+        return _byteCount;
     }
 #pragma endregion
 
@@ -57,7 +104,266 @@ namespace mint
         }
 
         ofs.write((const char*)&_byteArray[0], _byteArray.size());
-        return false;
+        return true;
+    }
+#pragma endregion
+
+
+#pragma region Binary File Stream Writer
+    BinaryFileStreamWriter::BinaryFileStreamWriter()
+        : BinaryFileStreamWriter(kDefaultBufferSize, false)
+    {
+        __noop;
+    }
+
+    BinaryFileStreamWriter::BinaryFileStreamWriter(const uint32 bufferSize, const bool useBackgroundFlush)
+        : _fileHandle{ INVALID_HANDLE_VALUE }
+        , _bufferSize{ mint::max(bufferSize, static_cast<uint32>(1 << 12)) }
+        , _useBackgroundFlush{ useBackgroundFlush }
+        , _frontBufferIndex{ 0 }
+        , _frontBufferAt{ 0 }
+        , _writtenSize{ 0 }
+        , _hasError{ false }
+        , _pendingBufferIndex{ 0 }
+        , _pendingByteCount{ 0 }
+        , _isFlushPending{ false }
+        , _shouldStopFlushThread{ false }
+    {
+        _bufferArray[0].resize(_bufferSize);
+        if (_useBackgroundFlush == true)
+        {
+            _bufferArray[1].resize(_bufferSize);
+        }
+    }
+
+    BinaryFileStreamWriter::~BinaryFileStreamWriter()
+    {
+        close(false);
+    }
+
+    const bool BinaryFileStreamWriter::open(const char* const fileName) noexcept
+    {
+        close(false);
+
+#if defined _WIN32
+        _fileHandle = ::CreateFileA(fileName, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+#else
+        _fileHandle = ::fopen(fileName, "wb");
+#endif
+        if (_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        _frontBufferIndex = 0;
+        _frontBufferAt = 0;
+        _writtenSize = 0;
+        _hasError = false;
+
+        if (_useBackgroundFlush == true)
+        {
+            _isFlushPending = false;
+            _shouldStopFlushThread = false;
+            _flushThread = std::thread(&BinaryFileStreamWriter::runBackgroundFlush, this);
+        }
+        return true;
+    }
+
+    const bool BinaryFileStreamWriter::flush(const bool syncToDisk) noexcept
+    {
+        if (isOpen() == false)
+        {
+            return false;
+        }
+
+        submitFrontBuffer();
+        waitForBackgroundFlush();
+
+        if (syncToDisk == true && _hasError == false)
+        {
+#if defined _WIN32
+            if (::FlushFileBuffers(_fileHandle) == FALSE)
+            {
+                _hasError = true;
+            }
+#else
+            FILE* const file = static_cast<FILE*>(_fileHandle);
+            if (::fflush(file) != 0 || ::fsync(::fileno(file)) != 0)
+            {
+                _hasError = true;
+            }
+#endif
+        }
+        return (_hasError == false);
+    }
+
+    const bool BinaryFileStreamWriter::close(const bool syncToDisk) noexcept
+    {
+        if (isOpen() == false)
+        {
+            return false;
+        }
+
+        const bool result = flush(syncToDisk);
+        if (_flushThread.joinable() == true)
+        {
+            {
+                std::lock_guard<std::mutex> lock{ _flushMutex };
+                _shouldStopFlushThread = true;
+            }
+            _flushConditionVariable.notify_all();
+            _flushThread.join();
+        }
+
+#if defined _WIN32
+        ::CloseHandle(_fileHandle);
+#else
+        // fclose 가 남은 stdio Buffer 를 쓰다 실패할 수도 있다.
+        if (::fclose(static_cast<FILE*>(_fileHandle)) != 0)
+        {
+            _hasError = true;
+        }
+#endif
+        _fileHandle = INVALID_HANDLE_VALUE;
+        return (result == true && _hasError == false);
+    }
+
+    void BinaryFileStreamWriter::writeBytes(const void* const in, const uint64 byteCount) noexcept
+    {
+        if (isOpen() == false || in == nullptr || byteCount == 0)
+        {
+            return;
+        }
+
+        const byte* bytes = reinterpret_cast<const byte*>(in);
+        uint64 remainingByteCount = byteCount;
+
+        // Buffer 보다 큰 쓰기는 (Background Flush 가 아닐 때) 복사 없이 바로 파일에 쓴다.
+        if (_useBackgroundFlush == false && remainingByteCount >= _bufferSize)
+        {
+            submitFrontBuffer();
+            writeFileInternal(bytes, remainingByteCount);
+            _writtenSize += remainingByteCount;
+            return;
+        }
+
+        while (remainingByteCount > 0)
+        {
+            const uint32 copyByteCount = static_cast<uint32>(mint::min(remainingByteCount, static_cast<uint64>(_bufferSize - _frontBufferAt)));
+            ::memcpy(&_bufferArray[_frontBufferIndex][_frontBufferAt], bytes, copyByteCount);
+            _frontBufferAt += copyByteCount;
+            bytes += copyByteCount;
+            remainingByteCount -= copyByteCount;
+
+            if (_frontBufferAt == _bufferSize)
+            {
+                submitFrontBuffer();
+            }
+        }
+        _writtenSize += byteCount;
+    }
+
+    const bool BinaryFileStreamWriter::isOpen() const noexcept
+    {
+        return (_fileHandle != INVALID_HANDLE_VALUE);
+    }
+
+    const bool BinaryFileStreamWriter::hasError() const noexcept
+    {
+        return _hasError;
+    }
+
+    const uint64 BinaryFileStreamWriter::getWrittenSize() const noexcept
+    {
+        return _writtenSize;
+    }
+
+    void BinaryFileStreamWriter::submitFrontBuffer() noexcept
+    {
+        if (_frontBufferAt == 0)
+        {
+            return;
+        }
+
+        if (_useBackgroundFlush == false)
+        {
+            writeFileInternal(&_bufferArray[_frontBufferIndex][0], _frontBufferAt);
+            _frontBufferAt = 0;
+            return;
+        }
+
+        // 이전 Buffer 가 다 쓰일 때까지 기다린 뒤, 쓸 Buffer 를 Lock 안에서 기록하고 Front 와 Back 을 바꾼다.
+        waitForBackgroundFlush();
+        {
+            std::lock_guard<std::mutex> lock{ _flushMutex };
+            _pendingBufferIndex = _frontBufferIndex;
+            _pendingByteCount = _frontBufferAt;
+            _isFlushPending = true;
+            _frontBufferIndex ^= 1;
+            _frontBufferAt = 0;
+        }
+        _flushConditionVariable.notify_all();
+    }
+
+    void BinaryFileStreamWriter::waitForBackgroundFlush() noexcept
+    {
+        if (_useBackgroundFlush == false)
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock{ _flushMutex };
+        _flushConditionVariable.wait(lock, [this]() { return _isFlushPending == false; });
+    }
+
+    void BinaryFileStreamWriter::writeFileInternal(const byte* const bytes, const uint64 byteCount) noexcept
+    {
+        uint64 writtenByteCount = 0;
+        while (writtenByteCount < byteCount)
+        {
+#if defined _WIN32
+            const DWORD requestedByteCount = static_cast<DWORD>(mint::min(byteCount - writtenByteCount, static_cast<uint64>(kUint32Max)));
+            DWORD currentWrittenByteCount = 0;
+            if (::WriteFile(_fileHandle, bytes + writtenByteCount, requestedByteCount, &currentWrittenByteCount, nullptr) == FALSE || currentWrittenByteCount == 0)
+            {
+                _hasError = true;
+                return;
+            }
+#else
+            const size_t currentWrittenByteCount = ::fwrite(bytes + writtenByteCount, 1, static_cast<size_t>(byteCount - writtenByteCount), static_cast<FILE*>(_fileHandle));
+            if (currentWrittenByteCount == 0)
+            {
+                _hasError = true;
+                return;
+            }
+#endif
+            writtenByteCount += currentWrittenByteCount;
+        }
+    }
+
+    void BinaryFileStreamWriter::runBackgroundFlush() noexcept
+    {
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock{ _flushMutex };
+            _flushConditionVariable.wait(lock, [this]() { return _isFlushPending == true || _shouldStopFlushThread == true; });
+            if (_isFlushPending == false)
+            {
+                return;
+            }
+
+            // Producer 가 기록해 둔 Buffer 만 쓴다. _frontBufferIndex 는 Producer 만 읽고 쓴다.
+            const uint32 pendingBufferIndex = _pendingBufferIndex;
+            const uint32 pendingByteCount = _pendingByteCount;
+            lock.unlock();
+
+            writeFileInternal(&_bufferArray[pendingBufferIndex][0], pendingByteCount);
+
+            lock.lock();
+            _isFlushPending = false;
+            lock.unlock();
+            _flushConditionVariable.notify_all();
+        }
     }
 #pragma endregion
 }
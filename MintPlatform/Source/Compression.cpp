@@ -0,0 +1,212 @@
+﻿#include <MintPlatform/Include/Compression.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+
+namespace mint
+{
+    namespace Compression
+    {
+        static constexpr uint32 kLz4MinMatch        = 4;
+        static constexpr uint32 kLz4LastLiterals    = 5;    // 마지막 5 byte 는 항상 literal
+        static constexpr uint32 kLz4MatchFindLimit  = 12;   // 마지막 match 는 끝에서 12 byte 이전에 시작해야 한다.
+        static constexpr uint32 kLz4MaxOffset       = 0xFFFF;
+        static constexpr uint32 kLz4HashLog         = 16;
+
+
+        MINT_INLINE const uint32 readUint32(const byte* const at) noexcept
+        {
+            uint32 result;
+            ::memcpy(&result, at, sizeof(uint32));
+            return result;
+        }
+
+        MINT_INLINE const uint32 hashLz4Sequence(const uint32 sequence) noexcept
+        {
+            return (sequence * 2654435761u) >> (32 - kLz4HashLog);
+        }
+
+        MINT_INLINE const uint64 getLz4LengthByteCount(const uint64 length) noexcept
+        {
+            return (length < 15) ? 0 : (length - 15) / 255 + 1;
+        }
+
+        MINT_INLINE void writeLz4Length(byte*& at, uint64 length) noexcept
+        {
+            length -= 15;
+            while (length >= 255)
+            {
+                *at++ = 255;
+                length -= 255;
+            }
+            *at++ = static_cast<byte>(length);
+        }
+
+        MINT_INLINE const bool readLz4Length(const byte*& at, const byte* const end, uint64& inOutLength) noexcept
+        {
+            byte current = 255;
+            while (current == 255)
+            {
+                if (at >= end)
+                {
+                    return false;
+                }
+                current = *at++;
+                inOutLength += current;
+            }
+            return true;
+        }
+
+        // matchLength 가 0 이면 literal 만 쓴다. (마지막 sequence)
+        MINT_INLINE const bool writeLz4Sequence(byte*& at, const byte* const end, const byte* const literals, const uint64 literalLength, const uint32 offset, const uint64 matchLength) noexcept
+        {
+            const uint64 encodedMatchLength = (matchLength == 0) ? 0 : matchLength - kLz4MinMatch;
+            const uint64 requiredByteCount = 1 + getLz4LengthByteCount(literalLength) + literalLength + ((matchLength == 0) ? 0 : 2 + getLz4LengthByteCount(encodedMatchLength));
+            if (static_cast<uint64>(end - at) < requiredByteCount)
+            {
+                return false;
+            }
+
+            byte& token = *at++;
+            token = static_cast<byte>(mint::min(literalLength, static_cast<uint64>(15)) << 4);
+            if (literalLength >= 15)
+            {
+                writeLz4Length(at, literalLength);
+            }
+            ::memcpy(at, literals, literalLength);
+            at += literalLength;
+
+            if (matchLength == 0)
+            {
+                return true;
+            }
+
+            *at++ = static_cast<byte>(offset & 0xFF);
+            *at++ = static_cast<byte>(offset >> 8);
+            token |= static_cast<byte>(mint::min(encodedMatchLength, static_cast<uint64>(15)));
+            if (encodedMatchLength >= 15)
+            {
+                writeLz4Length(at, encodedMatchLength);
+            }
+            return true;
+        }
+
+        const uint64 getLz4BlockBound(const uint64 sourceSize) noexcept
+        {
+            return sourceSize + sourceSize / 255 + 16;
+        }
+
+        const uint64 compressLz4Block(const byte* const source, const uint64 sourceSize, byte* const destination, const uint64 destinationCapacity) noexcept
+        {
+            byte* at = destination;
+            const byte* const end = destination + destinationCapacity;
+            uint64 anchor = 0;
+            if (sourceSize > kLz4MatchFindLimit)
+            {
+                // 0 은 비어 있음을 뜻하므로 위치 + 1 을 저장한다.
+                mint::Vector<uint32> hashTable(1 << kLz4HashLog);
+                ::memset(&hashTable[0], 0, sizeof(uint32) * hashTable.size());
+
+                const uint64 matchLimit = sourceSize - kLz4LastLiterals;
+                const uint64 sourceLimit = sourceSize - kLz4MatchFindLimit;
+                uint64 sourceAt = 0;
+                while (sourceAt < sourceLimit)
+                {
+                    const uint32 sequence = readUint32(source + sourceAt);
+                    uint32& hashEntry = hashTable[hashLz4Sequence(sequence)];
+                    const uint64 candidate = hashEntry;
+                    hashEntry = static_cast<uint32>(sourceAt + 1);
+                    if (candidate == 0 || sourceAt - (candidate - 1) > kLz4MaxOffset || readUint32(source + candidate - 1) != sequence)
+                    {
+                        ++sourceAt;
+                        continue;
+                    }
+
+                    const uint64 matchAt = candidate - 1;
+                    uint64 matchLength = kLz4MinMatch;
+                    while (sourceAt + matchLength < matchLimit && source[sourceAt + matchLength] == source[matchAt + matchLength])
+                    {
+                        ++matchLength;
+                    }
+
+                    if (writeLz4Sequence(at, end, source + anchor, sourceAt - anchor, static_cast<uint32>(sourceAt - matchAt), matchLength) == false)
+                    {
+                        return 0;
+                    }
+                    sourceAt += matchLength;
+                    anchor = sourceAt;
+                }
+            }
+
+            if (writeLz4Sequence(at, end, source + anchor, sourceSize - anchor, 0, 0) == false)
+            {
+                return 0;
+            }
+            return static_cast<uint64>(at - destination);
+        }
+
+        const bool decompressLz4Block(const byte* const source, const uint64 sourceSize, byte* const destination, const uint64 destinationSize) noexcept
+        {
+            const byte* at = source;
+            const byte* const end = source + sourceSize;
+            uint64 destinationAt = 0;
+            while (true)
+            {
+                if (at >= end)
+                {
+                    return false;
+                }
+
+                const byte token = *at++;
+                uint64 literalLength = token >> 4;
+                if (literalLength == 15 && readLz4Length(at, end, literalLength) == false)
+                {
+                    return false;
+                }
+                if (static_cast<uint64>(end - at) < literalLength || destinationSize - destinationAt < literalLength)
+                {
+                    return false;
+                }
+                ::memcpy(destination + destinationAt, at, literalLength);
+                at += literalLength;
+                destinationAt += literalLength;
+
+                if (at == end)
+                {
+                    return (destinationAt == destinationSize);
+                }
+
+                if (end - at < 2)
+                {
+                    return false;
+                }
+                const uint64 offset = static_cast<uint64>(at[0]) | (static_cast<uint64>(at[1]) << 8);
+                at += 2;
+                if (offset == 0 || offset > destinationAt)
+                {
+                    return false;
+                }
+
+                uint64 matchLength = token & 15;
+                if (matchLength == 15 && readLz4Length(at, end, matchLength) == false)
+                {
+                    return false;
+                }
+                matchLength += kLz4MinMatch;
+                if (destinationSize - destinationAt < matchLength)
+                {
+                    return false;
+                }
+
+                // 겹치는 복사가 가능하므로 한 byte 씩 복사한다.
+                const byte* match = destination + destinationAt - offset;
+                byte* output = destination + destinationAt;
+                for (uint64 matchIndex = 0; matchIndex < matchLength; ++matchIndex)
+                {
+                    output[matchIndex] = match[matchIndex];
+                }
+                destinationAt += matchLength;
+            }
+        }
+    }
+}
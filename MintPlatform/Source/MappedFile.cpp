@@ -0,0 +1,213 @@
+﻿#include <MintPlatform/Include/MappedFile.h>
+
+#if defined _WIN32
+    #include <Windows.h>
+    #undef max
+    #undef min
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    // Windows 가 아니면 mmap 후 바로 fd 를 닫으므로 Handle 은 쓰지 않는다.
+    #define INVALID_HANDLE_VALUE nullptr
+#endif
+
+
+namespace mint
+{
+    MappedFile::MappedFile()
+        : _fileHandle{ INVALID_HANDLE_VALUE }
+        , _mappingHandle{ nullptr }
+        , _data{ nullptr }
+        , _size{ 0 }
+    {
+        __noop;
+    }
+
+    MappedFile::MappedFile(MappedFile&& rhs) noexcept
+        : _fileHandle{ rhs._fileHandle }
+        , _mappingHandle{ rhs._mappingHandle }
+        , _data{ rhs._data }
+        , _size{ rhs._size }
+    {
+        rhs._fileHandle = INVALID_HANDLE_VALUE;
+        rhs._mappingHandle = nullptr;
+        rhs._data = nullptr;
+        rhs._size = 0;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            close();
+
+            _fileHandle = rhs._fileHandle;
+            _mappingHandle = rhs._mappingHandle;
+            _data = rhs._data;
+            _size = rhs._size;
+
+            rhs._fileHandle = INVALID_HANDLE_VALUE;
+            rhs._mappingHandle = nullptr;
+            rhs._data = nullptr;
+            rhs._size = 0;
+        }
+        return *this;
+    }
+
+    const bool MappedFile::open(const char* const fileName, const FileAccessHint accessHint) noexcept
+    {
+        close();
+
+#if defined _WIN32
+        DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL;
+        if (accessHint == FileAccessHint::Sequential)
+        {
+            flagsAndAttributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if (accessHint == FileAccessHint::Random)
+        {
+            flagsAndAttributes |= FILE_FLAG_RANDOM_ACCESS;
+        }
+
+        _fileHandle = ::CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flagsAndAttributes, nullptr);
+        if (_fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (::GetFileSizeEx(_fileHandle, &fileSize) == FALSE || fileSize.QuadPart == 0)
+        {
+            // 크기가 0 인 파일은 Mapping 할 수 없다.
+            close();
+            return false;
+        }
+
+        _mappingHandle = ::CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mappingHandle == nullptr)
+        {
+            close();
+            return false;
+        }
+
+        _data = static_cast<const byte*>(::MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            close();
+            return false;
+        }
+
+        _size = static_cast<uint64>(fileSize.QuadPart);
+        return true;
+#else
+        const int fileDescriptor = ::open(fileName, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (::fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            // 크기가 0 인 파일은 Mapping 할 수 없다.
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        void* const mappedData = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        ::close(fileDescriptor);
+        if (mappedData == MAP_FAILED)
+        {
+            return false;
+        }
+
+        if (accessHint == FileAccessHint::Sequential)
+        {
+            ::madvise(mappedData, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+        }
+        else if (accessHint == FileAccessHint::Random)
+        {
+            ::madvise(mappedData, static_cast<size_t>(fileStat.st_size), MADV_RANDOM);
+        }
+
+        _data = static_cast<const byte*>(mappedData);
+        _size = static_cast<uint64>(fileStat.st_size);
+        return true;
+#endif
+    }
+
+    void MappedFile::close() noexcept
+    {
+#if defined _WIN32
+        if (_data != nullptr)
+        {
+            ::UnmapViewOfFile(_data);
+            _data = nullptr;
+        }
+
+        if (_mappingHandle != nullptr)
+        {
+            ::CloseHandle(_mappingHandle);
+            _mappingHandle = nullptr;
+        }
+
+        if (_fileHandle != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(_fileHandle);
+            _fileHandle = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (_data != nullptr)
+        {
+            ::munmap(const_cast<byte*>(_data), static_cast<size_t>(_size));
+            _data = nullptr;
+        }
+#endif
+
+        _size = 0;
+    }
+
+    void MappedFile::prefetch(const uint64 offset, const uint64 byteCount) const noexcept
+    {
+        if (_data == nullptr || _size <= offset)
+        {
+            return;
+        }
+
+#if defined _WIN32
+        WIN32_MEMORY_RANGE_ENTRY rangeEntry;
+        rangeEntry.VirtualAddress = const_cast<byte*>(_data + offset);
+        rangeEntry.NumberOfBytes = static_cast<SIZE_T>(mint::min(byteCount, _size - offset));
+        ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &rangeEntry, 0);
+#else
+        // madvise 는 Page 단위로 정렬된 주소를 받는다.
+        const uint64 pageSize = static_cast<uint64>(::sysconf(_SC_PAGESIZE));
+        const uint64 alignedOffset = offset - (offset % pageSize);
+        const uint64 alignedByteCount = mint::min(byteCount, _size - offset) + (offset - alignedOffset);
+        ::madvise(const_cast<byte*>(_data + alignedOffset), static_cast<size_t>(alignedByteCount), MADV_WILLNEED);
+#endif
+    }
+
+    const bool MappedFile::isOpen() const noexcept
+    {
+        return (_data != nullptr);
+    }
+
+    const byte* MappedFile::getData() const noexcept
+    {
+        return _data;
+    }
+
+    const uint64 MappedFile::getSize() const noexcept
+    {
+        return _size;
+    }
+}
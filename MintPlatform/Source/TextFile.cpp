@@ -8,68 +8,175 @@
 
 namespace mint
 {
+    TextLineIterator::TextLineIterator()
+        : _at{ nullptr }
+        , _end{ nullptr }
+    {
+        __noop;
+    }
+
+    TextLineIterator::TextLineIterator(const char* const begin, const char* const end)
+        : _at{ begin }
+        , _end{ end }
+    {
+        _line._lineIndex = 0;
+        readLine();
+    }
+
+    const TextLine& TextLineIterator::operator*() const noexcept
+    {
+        return _line;
+    }
+
+    const TextLine* TextLineIterator::operator->() const noexcept
+    {
+        return &_line;
+    }
+
+    TextLineIterator& TextLineIterator::operator++() noexcept
+    {
+        ++_line._lineIndex;
+        readLine();
+        return *this;
+    }
+
+    const bool TextLineIterator::operator!=(const TextLineIterator& rhs) const noexcept
+    {
+        return (_line._begin != rhs._line._begin);
+    }
+
+    void TextLineIterator::readLine() noexcept
+    {
+        if (_at == nullptr || _end <= _at)
+        {
+            // end iterator  .
+            _line._begin = nullptr;
+            _line._end = nullptr;
+            return;
+        }
+
+        const char* const lineEnd = mint::StringUtil::findChar(_at, _end, '\n');
+        _line._begin = _at;
+        _line._end = (_at < lineEnd && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+        _at = (lineEnd < _end) ? lineEnd + 1 : _end;
+    }
+
+
     const bool TextFileReader::open(const char* const fileName)
     {
+        _mappedFile.close();
+        _byteArray.clear();
+        _bytes = nullptr;
+        _byteCount = 0;
+        _encoding = TextFileEncoding::ASCII;
+
         std::ifstream ifs{ fileName, std::ifstream::binary };
         if (ifs.is_open() == false)
         {
-            _byteArray.clear();
             return false;
         }
 
-        _byteArray.clear();
+        ifs.seekg(0, ifs.end);
+        uint64 length = ifs.tellg();
+        ifs.seekg(0, ifs.beg);
 
-        bool isBomChecked = false;
-        while (ifs.eof() == false)
+        // BOM Ȯ
+        if (3 <= length)
         {
-            byte readByte{ static_cast<byte>(ifs.get()) };
-            _byteArray.push_back(readByte);
-
-            // BOM Ȯ
-            if (isBomChecked == false && _byteArray.size() == 3)
+            char bom[3]{};
+            ifs.read(bom, 3);
+            if (static_cast<byte>(bom[0]) == 0xEF && static_cast<byte>(bom[1]) == 0xBB && static_cast<byte>(bom[2]) == 0xBF)
             {
-                if (_byteArray.at(0) == 0xEF &&
-                    _byteArray.at(1) == 0xBB &&
-                    _byteArray.at(2) == 0xBF)
-                {
-                    // UTF-8 (BOM)
-                    _encoding = TextFileEncoding::UTF8_BOM;
-                    _byteArray.clear();
-
-                    isBomChecked = true;
-                }
+                // UTF-8 (BOM)
+                _encoding = TextFileEncoding::UTF8_BOM;
+                length -= 3;
+            }
+            else
+            {
+                ifs.seekg(0, ifs.beg);
             }
         }
 
-        if (_byteArray.empty() == false)
+        if (kUint32Max <= length)
         {
-            if (_byteArray.back() == 255)
-            {
-                _byteArray.back() = 0;
-            }
+            return false;
+        }
+
+        // null-terminated
+        _byteArray.resize(static_cast<uint32>(length + 1));
+        if (0 < length)
+        {
+            ifs.read(reinterpret_cast<char*>(&_byteArray[0]), length);
+        }
+        _byteArray.back() = 0;
+
+        _bytes = _byteArray.data();
+        _byteCount = _byteArray.size();
+        return true;
+    }
+
+    const bool TextFileReader::openMapped(const char* const fileName, const FileAccessHint accessHint)
+    {
+        _byteArray.clear();
+        _bytes = nullptr;
+        _byteCount = 0;
+        _encoding = TextFileEncoding::ASCII;
+
+        if (_mappedFile.open(fileName, accessHint) == false)
+        {
+            return false;
         }
 
+        _bytes = _mappedFile.getData();
+        _byteCount = _mappedFile.getSize();
+        if (3 <= _byteCount && _bytes[0] == 0xEF && _bytes[1] == 0xBB && _bytes[2] == 0xBF)
+        {
+            // UTF-8 (BOM)
+            _encoding = TextFileEncoding::UTF8_BOM;
+            _bytes += 3;
+            _byteCount -= 3;
+        }
         return true;
     }
 
     const bool TextFileReader::isOpen() const noexcept
     {
-        return !_byteArray.empty();
+        return (_bytes != nullptr);
     }
 
-    const uint32 TextFileReader::getFileSize() const noexcept
+    const uint64 TextFileReader::getFileSize() const noexcept
     {
-        return static_cast<uint32>(_byteArray.size());
+        return _byteCount;
     }
 
-    const char TextFileReader::get(const uint32 at) const noexcept
+    const char TextFileReader::get(const uint64 at) const noexcept
     {
-        return static_cast<char>(_byteArray.at(at));
+        MINT_ASSERT("", at < _byteCount, "  Դϴ.");
+        return static_cast<char>(_bytes[at]);
     }
 
     const char* TextFileReader::get() const noexcept
     {
-        return reinterpret_cast<const char*>(&_byteArray.front());
+        return reinterpret_cast<const char*>(_bytes);
+    }
+
+    const TextFileEncoding TextFileReader::getEncoding() const noexcept
+    {
+        return _encoding;
+    }
+
+    const uint64 TextFileReader::getTextLength() const noexcept
+    {
+        // open()   쿡  '\0'  پ ִ.
+        return (_byteArray.empty() == false) ? _byteCount - 1 : _byteCount;
+    }
+
+    TextLineRange TextFileReader::getLines() const noexcept
+    {
+        TextLineRange textLineRange;
+        textLineRange._begin = get();
+        textLineRange._end = get() + getTextLength();
+        return textLineRange;
     }
 
     const bool TextFileWriter::save(const char* const fileName)
@@ -107,7 +214,7 @@ namespace mint
         }
 
         ofs.write(reinterpret_cast<const char*>(&_byteArray.front()), _byteArray.size());
-        return false;
+        return (ofs.fail() == false);
     }
 
     void TextFileWriter::clear()
@@ -1,4 +1,8 @@
+#include <MintPlatform/Source/AssetPack.cpp>
+#include <MintPlatform/Source/AsyncFileService.cpp>
 #include <MintPlatform/Source/BinaryFile.cpp>
+#include <MintPlatform/Source/Compression.cpp>
 #include <MintPlatform/Source/IWindow.cpp>
+#include <MintPlatform/Source/MappedFile.cpp>
 #include <MintPlatform/Source/TextFile.cpp>
 #include <MintPlatform/Source/WindowsWindow.cpp>
@@ -7,6 +7,8 @@
 
 #include <MintRendering/Include/Object.h>
 
+#include <MintMath/Include/Frustum.h>
+
 
 namespace mint
 {
@@ -99,6 +101,7 @@ namespace mint
         public:
             mint::Float4x4            getViewMatrix() const noexcept;
             const mint::Float4x4&     getProjectionMatrix() const noexcept;
+            mint::Frustum             getFrustum() const noexcept;
         
         private:
             mint::Float4x4            getRotationMatrix() const noexcept;
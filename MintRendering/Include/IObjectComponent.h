@@ -10,6 +10,7 @@
 #include <MintContainer/Include/IId.h>
 
 #include <MintMath/Include/Float4x4.h>
+#include <MintMath/Include/Transform3x4.h>
 
 
 namespace mint
@@ -44,6 +45,7 @@ namespace mint
         {
         public:
             mint::Float4x4            toMatrix() const noexcept { return mint::Float4x4::srtMatrix(_scale, _rotation, _translation); }
+            mint::Transform3x4        toTransform3x4() const noexcept { return mint::Transform3x4::srt(_scale, _rotation, _translation); }
 
         public:
             mint::Float3              _scale = mint::Float3::kUnitScale;
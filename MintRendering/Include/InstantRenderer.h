@@ -8,6 +8,7 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintRenderingBase/Include/LowLevelRenderer.h>
+#include <MintRenderingBase/Include/ShaderPermutation.h>
 
 #include <Assets/CppHlsl/CppHlslConstantBuffers.h>
 
@@ -51,8 +52,8 @@ namespace mint
             mint::RenderingBase::CB_Transform               _cbTransformData;
             mint::Vector<mint::RenderingBase::SB_Material>  _sbMaterialDatas;
             mint::RenderingBase::DxObjectId                 _vsDefaultId;
-            mint::RenderingBase::DxObjectId                 _psDefaultId;
-            mint::RenderingBase::DxObjectId                 _psColorId;
+            uint32                                          _psDefaultPermutationIndex;
+            mint::RenderingBase::ShaderKeywordMask          _unlitKeywordMask;
         };
     }
 }
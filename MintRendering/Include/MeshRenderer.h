@@ -8,6 +8,7 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintRenderingBase/Include/LowLevelRenderer.h>
+#include <MintRenderingBase/Include/ShaderPermutation.h>
 
 #include <Assets/CppHlsl/CppHlslConstantBuffers.h>
 
@@ -48,10 +49,10 @@ namespace mint
 
         private:
             mint::RenderingBase::DxObjectId             _vsDefaultId;
-            mint::RenderingBase::DxObjectId             _gsNormalId;
-            mint::RenderingBase::DxObjectId             _gsTriangleEdgeId;
-            mint::RenderingBase::DxObjectId             _psDefaultId;
-            mint::RenderingBase::DxObjectId             _psTexCoordAsColorId;
+            uint32                                      _gsMeshDebugPermutationIndex;
+            uint32                                      _psDefaultPermutationIndex;
+            mint::RenderingBase::ShaderKeywordMask      _triangleEdgeKeywordMask;
+            mint::RenderingBase::ShaderKeywordMask      _texCoordAsColorKeywordMask;
         };
     }
 }
@@ -58,6 +58,7 @@ namespace mint
             mint::Rendering::Srt&             getObjectTransformSrt() noexcept;
             const mint::Rendering::Srt&       getObjectTransformSrt() const noexcept;
             mint::Float4x4                    getObjectTransformMatrix() const noexcept;
+            mint::Transform3x4                getObjectTransform3x4() const noexcept;
 
         protected:
             TransformComponent*             getObjectTransformComponent() const noexcept;
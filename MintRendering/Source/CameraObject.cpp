@@ -127,6 +127,11 @@ namespace mint
             return _projectionMatrix;
         }
 
+        mint::Frustum CameraObject::getFrustum() const noexcept
+        {
+            return mint::Frustum::fromViewProjectionMatrix(_projectionMatrix * getViewMatrix());
+        }
+
         mint::Float4x4 CameraObject::getRotationMatrix() const noexcept
         {
             const mint::Float3& forwardDirectionAfterYaw = mint::Float4x4::rotationMatrixY(_yaw) * _baseForwardDirection;
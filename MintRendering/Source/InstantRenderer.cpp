@@ -18,6 +18,8 @@ namespace mint
             : _graphicDevice{ graphicDevice }
             , _lowLevelRendererLine{ graphicDevice }
             , _lowLevelRendererMesh{ graphicDevice }
+            , _psDefaultPermutationIndex{ kUint32Max }
+            , _unlitKeywordMask{ 0 }
         {
             __noop;
         }
@@ -33,9 +35,20 @@ namespace mint
             const mint::CppHlsl::Interpreter& interpreter = _graphicDevice->getCppHlslSteamData();
             const mint::CppHlsl::TypeMetaData& vsInputTypeMetaData = interpreter.getTypeMetaData(typeid(mint::RenderingBase::VS_INPUT));
 
-            _vsDefaultId = shaderPool.pushVertexShader("Assets/Hlsl/", "VsDefault.hlsl", "main", &vsInputTypeMetaData, "Assets/HlslBinary/");
-            _psDefaultId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "PsDefault.hlsl", "main", mint::RenderingBase::DxShaderType::PixelShader, "Assets/HlslBinary/");
-            _psColorId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "PsColor.hlsl", "main", mint::RenderingBase::DxShaderType::PixelShader, "Assets/HlslBinary/");
+            using mint::RenderingBase::DxShaderType;
+            const mint::RenderingBase::DxShaderRequest psDefaultRequest{ "Assets/Hlsl/", "PsDefault.hlsl", nullptr, nullptr, nullptr, "main", DxShaderType::PixelShader, nullptr };
+            _psDefaultPermutationIndex = shaderPool.pushShaderPermutation(psDefaultRequest);
+            _unlitKeywordMask = shaderPool.getShaderKeywordMask(_psDefaultPermutationIndex, "UNLIT");
+
+            // The PsDefault variants used by render() are compiled in the same batch as VsDefault.
+            mint::RenderingBase::DxShaderRequest shaderRequests[3];
+            shaderRequests[0] = { "Assets/Hlsl/", "VsDefault.hlsl", "Assets/HlslBinary/", nullptr, nullptr, "main", DxShaderType::VertexShader, &vsInputTypeMetaData };
+            shaderRequests[1]._shaderPermutationIndex = _psDefaultPermutationIndex;
+            shaderRequests[2]._shaderPermutationIndex = _psDefaultPermutationIndex;
+            shaderRequests[2]._keywordMask = _unlitKeywordMask;
+            mint::RenderingBase::DxObjectId shaderIds[ARRAYSIZE(shaderRequests)];
+            shaderPool.pushShaders(shaderRequests, ARRAYSIZE(shaderRequests), shaderIds);
+            _vsDefaultId = shaderIds[0];
         }
 
         void InstantRenderer::drawLine(const mint::Float3& a, const mint::Float3& b, const mint::RenderingBase::Color& color) noexcept
@@ -108,11 +121,11 @@ namespace mint
                 sbMaterial.updateBuffer(&_sbMaterialDatas[0], _sbMaterialDatas.size());
             }
             
-            shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, _psColorId);
+            shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, shaderPool.getShaderVariant(_psDefaultPermutationIndex, _unlitKeywordMask));
             _lowLevelRendererLine.render(mint::RenderingBase::RenderingPrimitive::LineList);
             _lowLevelRendererLine.flush();
 
-            shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, _psDefaultId);
+            shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, shaderPool.getShaderVariant(_psDefaultPermutationIndex, 0));
             _lowLevelRendererMesh.render(mint::RenderingBase::RenderingPrimitive::TriangleList);
             _lowLevelRendererMesh.flush();
 
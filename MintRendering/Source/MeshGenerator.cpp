@@ -3,6 +3,8 @@
 
 #include <MintContainer/Include/Vector.hpp>
 
+#include <MintMath/Include/BatchTransform.h>
+#include <MintMath/Include/FastMath.h>
 #include <MintMath/Include/Float2x2.h>
 
 #include <Assets/CppHlsl/CppHlslStreamData.h>
@@ -264,9 +266,10 @@ namespace mint
                 const float angleStep = mint::Math::kTwoPi / static_cast<float>(coneParam._sideCount);
                 for (int16 sideIndex = 0; sideIndex < coneParam._sideCount; ++sideIndex)
                 {
-                    const float x = ::cos(angleStep * sideIndex) * coneParam._radius;
-                    const float z = ::sin(angleStep * sideIndex) * coneParam._radius;
-                    pushPosition({ x, 0.0f, z }, meshData);
+                    float sinAngle;
+                    float cosAngle;
+                    mint::Math::sinCos<mint::Math::Precision::Fast>(angleStep * sideIndex, sinAngle, cosAngle);
+                    pushPosition({ cosAngle * coneParam._radius, 0.0f, sinAngle * coneParam._radius }, meshData);
                 }
 
                 pushPosition({ 0.0f, 0.0f, 0.0f }, meshData);
@@ -313,8 +316,11 @@ namespace mint
                 const float angleStep = mint::Math::kTwoPi / static_cast<float>(cylinderParam._sideCount);
                 for (int16 sideIndex = 0; sideIndex < cylinderParam._sideCount; ++sideIndex)
                 {
-                    const float x = ::cos(angleStep * sideIndex) * cylinderParam._radius;
-                    const float z = ::sin(angleStep * sideIndex) * cylinderParam._radius;
+                    float sinAngle;
+                    float cosAngle;
+                    mint::Math::sinCos<mint::Math::Precision::Fast>(angleStep * sideIndex, sinAngle, cosAngle);
+                    const float x = cosAngle * cylinderParam._radius;
+                    const float z = sinAngle * cylinderParam._radius;
                     pushPosition({ x, cylinderParam._height, z }, meshData);
                     pushPosition({ x, 0.0f, z }, meshData);
                 }
@@ -446,10 +452,10 @@ namespace mint
         void MeshGenerator::transformMeshData(mint::RenderingBase::MeshData& meshData, const mint::Float4x4& transformationMatrix) noexcept
         {
             const uint32 positionCount = meshData.getPositionCount();
-            for (uint32 positionIndex = 0; positionIndex < positionCount; ++positionIndex)
+            if (positionCount > 0)
             {
-                mint::Float4& position = meshData._positionArray[positionIndex];
-                position = transformationMatrix.mul(position);
+                mint::Float4* const positions = &meshData._positionArray[0];
+                mint::BatchTransform::transformPoints(transformationMatrix, positions, positions, positionCount, true);
             }
             meshData.updateVertexFromPositions();
         }
@@ -18,6 +18,10 @@ namespace mint
         MeshRenderer::MeshRenderer(mint::RenderingBase::GraphicDevice* const graphicDevice)
             : _graphicDevice{ graphicDevice }
             , _lowLevelRenderer{ graphicDevice }
+            , _gsMeshDebugPermutationIndex{ kUint32Max }
+            , _psDefaultPermutationIndex{ kUint32Max }
+            , _triangleEdgeKeywordMask{ 0 }
+            , _texCoordAsColorKeywordMask{ 0 }
         {
             __noop;
         }
@@ -33,12 +37,27 @@ namespace mint
             const mint::CppHlsl::Interpreter& interpreter = _graphicDevice->getCppHlslSteamData();
             const mint::CppHlsl::TypeMetaData& vsInputTypeMetaData = interpreter.getTypeMetaData(typeid(mint::RenderingBase::VS_INPUT));
 
-            _vsDefaultId = shaderPool.pushVertexShader("Assets/Hlsl/", "VsDefault.hlsl", "main", &vsInputTypeMetaData, "Assets/HlslBinary/");
-            _psDefaultId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "PsDefault.hlsl", "main", mint::RenderingBase::DxShaderType::PixelShader, "Assets/HlslBinary/");
-            
-            _gsNormalId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "GsNormal.hlsl", "main", mint::RenderingBase::DxShaderType::GeometryShader, "Assets/HlslBinary/");
-            _gsTriangleEdgeId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "GsTriangleEdge.hlsl", "main", mint::RenderingBase::DxShaderType::GeometryShader, "Assets/HlslBinary/");
-            _psTexCoordAsColorId = shaderPool.pushNonVertexShader("Assets/Hlsl/", "PsTexCoordAsColor.hlsl", "main", mint::RenderingBase::DxShaderType::PixelShader, "Assets/HlslBinary/");
+            using mint::RenderingBase::DxShaderType;
+            const mint::RenderingBase::DxShaderRequest gsMeshDebugRequest{ "Assets/Hlsl/", "GsMeshDebug.hlsl", nullptr, nullptr, nullptr, "main", DxShaderType::GeometryShader, nullptr };
+            _gsMeshDebugPermutationIndex = shaderPool.pushShaderPermutation(gsMeshDebugRequest);
+            _triangleEdgeKeywordMask = shaderPool.getShaderKeywordMask(_gsMeshDebugPermutationIndex, "TRIANGLE_EDGE");
+
+            const mint::RenderingBase::DxShaderRequest psDefaultRequest{ "Assets/Hlsl/", "PsDefault.hlsl", nullptr, nullptr, nullptr, "main", DxShaderType::PixelShader, nullptr };
+            _psDefaultPermutationIndex = shaderPool.pushShaderPermutation(psDefaultRequest);
+            _texCoordAsColorKeywordMask = shaderPool.getShaderKeywordMask(_psDefaultPermutationIndex, "TEXCOORD_AS_COLOR");
+
+            // The variants used by render() are compiled in the same batch as VsDefault.
+            mint::RenderingBase::DxShaderRequest shaderRequests[5];
+            shaderRequests[0] = { "Assets/Hlsl/", "VsDefault.hlsl", "Assets/HlslBinary/", nullptr, nullptr, "main", DxShaderType::VertexShader, &vsInputTypeMetaData };
+            shaderRequests[1]._shaderPermutationIndex = _psDefaultPermutationIndex;
+            shaderRequests[2]._shaderPermutationIndex = _psDefaultPermutationIndex;
+            shaderRequests[2]._keywordMask = _texCoordAsColorKeywordMask;
+            shaderRequests[3]._shaderPermutationIndex = _gsMeshDebugPermutationIndex;
+            shaderRequests[4]._shaderPermutationIndex = _gsMeshDebugPermutationIndex;
+            shaderRequests[4]._keywordMask = _triangleEdgeKeywordMask;
+            mint::RenderingBase::DxObjectId shaderIds[ARRAYSIZE(shaderRequests)];
+            shaderPool.pushShaders(shaderRequests, ARRAYSIZE(shaderRequests), shaderIds);
+            _vsDefaultId = shaderIds[0];
         }
 
         void MeshRenderer::render(const mint::Rendering::ObjectPool& objectPool) noexcept
@@ -65,7 +84,7 @@ namespace mint
             for (uint32 meshCompnentIndex = 0; meshCompnentIndex < meshComponentCount; ++meshCompnentIndex)
             {
                 const MeshComponent* const meshComponent = meshComponents[meshCompnentIndex];
-                _cbTransformData._cbWorldMatrix = meshComponent->getOwnerObject()->getObjectTransformMatrix() * meshComponent->_srt.toMatrix();
+                _cbTransformData._cbWorldMatrix = (meshComponent->getOwnerObject()->getObjectTransform3x4() * meshComponent->_srt.toTransform3x4()).toMatrix();
                 cbTransform.updateBuffer(&_cbTransformData, 1);
 
                 _lowLevelRenderer.flush();
@@ -75,21 +94,21 @@ namespace mint
                 sbMaterialData._diffuseColor = mint::RenderingBase::Color::kBlue;
                 sbMaterial.updateBuffer(&sbMaterialData, 1);
                 
-                shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, _psDefaultId);
+                shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, shaderPool.getShaderVariant(_psDefaultPermutationIndex, 0));
                 shaderPool.unbindShader(mint::RenderingBase::DxShaderType::GeometryShader);
                 _lowLevelRenderer.render(mint::RenderingBase::RenderingPrimitive::TriangleList);
 
                 if (meshComponent->shouldDrawNormals() == true)
                 {
-                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::GeometryShader, _gsNormalId);
-                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, _psTexCoordAsColorId);
+                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::GeometryShader, shaderPool.getShaderVariant(_gsMeshDebugPermutationIndex, 0));
+                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, shaderPool.getShaderVariant(_psDefaultPermutationIndex, _texCoordAsColorKeywordMask));
                     _lowLevelRenderer.render(mint::RenderingBase::RenderingPrimitive::LineList);
                 }
 
                 if (meshComponent->shouldDrawEdges() == true)
                 {
-                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::GeometryShader, _gsTriangleEdgeId);
-                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, _psTexCoordAsColorId);
+                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::GeometryShader, shaderPool.getShaderVariant(_gsMeshDebugPermutationIndex, _triangleEdgeKeywordMask));
+                    shaderPool.bindShaderIfNot(mint::RenderingBase::DxShaderType::PixelShader, shaderPool.getShaderVariant(_psDefaultPermutationIndex, _texCoordAsColorKeywordMask));
                     _lowLevelRenderer.render(mint::RenderingBase::RenderingPrimitive::TriangleList);
                 }
             }
@@ -113,6 +113,11 @@ namespace mint
             return getObjectTransformComponent()->_srt.toMatrix();
         }
 
+        mint::Transform3x4 Object::getObjectTransform3x4() const noexcept
+        {
+            return getObjectTransformComponent()->_srt.toTransform3x4();
+        }
+
         TransformComponent* Object::getObjectTransformComponent() const noexcept
         {
             return static_cast<TransformComponent*>(_componentArray[0]);
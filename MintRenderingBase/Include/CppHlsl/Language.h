@@ -1,17 +0,0 @@
-#pragma once
-
-
-#ifndef MINT_LANGUAGE_H
-#define MINT_LANGUAGE_H
-
-
-#include <MintRenderingBase/Include/CppHlsl/ILexer.h>
-#include <MintRenderingBase/Include/CppHlsl/IParser.h>
-
-#include <MintRenderingBase/Include/CppHlsl/Tokenizer.h>
-
-#include <MintRenderingBase/Include/CppHlsl/Lexer.h>
-#include <MintRenderingBase/Include/CppHlsl/Parser.h>
-
-
-#endif // !MINT_LANGUAGE_H
@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 
 
 #ifndef MINT_DX_SHADER_H
@@ -8,9 +8,13 @@
 #include <MintCommon/Include/CommonDefinitions.h>
 
 #include <MintRenderingBase/Include/IDxObject.h>
+#include <MintRenderingBase/Include/ShaderCompileQueue.h>
+#include <MintRenderingBase/Include/ShaderPermutation.h>
 
 #include <MintContainer/Include/Vector.h>
 
+#include <MintCppHlsl/Include/ShaderCache.h>
+
 
 namespace mint
 {
@@ -65,6 +69,7 @@ namespace mint
             std::string                 _hlslFileName;
             std::string                 _hlslBinaryFileName;
             std::string                 _entryPoint;
+            uint64                      _cacheKey;      // ShaderCache::computeKey()
 
         public:
             static const DxShader       kNullInstance;
@@ -79,9 +84,57 @@ namespace mint
             const char*         _shaderTextContent = nullptr;
         };
 
+        // pushShaders() 에 넘기는 요청. _inputShaderFileName 이 nullptr 이면 _textContent 를 compile 한다.
+        // _shaderPermutationIndex 를 정하면 나머지는 무시하고 그 permutation 의 _keywordMask variant 를 만든다.
+        struct DxShaderRequest
+        {
+            const char*                         _inputDirectory = nullptr;
+            const char*                         _inputShaderFileName = nullptr;
+            const char*                         _outputDirectory = nullptr;
+            const char*                         _shaderIdentifier = nullptr;
+            const char*                         _textContent = nullptr;
+            const char*                         _entryPoint = "main";
+            DxShaderType                        _shaderType = DxShaderType::VertexShader;
+            const mint::CppHlsl::TypeMetaData*  _inputElementTypeMetaData = nullptr;
+            uint32                              _shaderPermutationIndex = kUint32Max;   // pushShaderPermutation() 의 반환값
+            ShaderKeywordMask                   _keywordMask = 0;
+        };
+
+        // pushShaderPermutation() 으로 등록한 Shader. Variant 마다 DxShader 를 하나씩 만든다.
+        struct DxShaderPermutation
+        {
+            uint32                                          _permutationShaderIndex = kUint32Max;   // ShaderPermutationCache 의 index
+            DxShaderType                                    _shaderType = DxShaderType::VertexShader;
+            const mint::CppHlsl::TypeMetaData*              _inputElementTypeMetaData = nullptr;
+            std::string                                     _hlslFileName;  // Memory 에서 등록했으면 비어 있다.
+            std::string                                     _entryPoint;
+            mint::HashMap<ShaderKeywordMask, DxObjectId>    _variantObjectIdMap;
+        };
+
+
+        class DxShaderCompiler final : public IShaderCompiler
+        {
+        public:
+                                        DxShaderCompiler(DxShaderHeaderMemory* const shaderHeaderMemory);
+            virtual                     ~DxShaderCompiler() = default;
+
+        public:
+            virtual const bool          compile(const ShaderCompileRequest& request, ShaderCompileResult& outResult) noexcept override final;
+
+        public:
+            // D3DCompile 에 넘기는 flag. 다른 binary 가 나오므로 ShaderCache 의 Key 에도 넣는다.
+            static const uint32         getCompileFlags() noexcept;
+
+        private:
+            DxShaderHeaderMemory*       _shaderHeaderMemory;
+        };
+
+
         class DxShaderPool final : public IDxObject
         {
             static constexpr const char* const  kCompiledShaderFileExtension = ".hlslbin";
+            static constexpr const char* const  kShaderCacheDirectory = "Assets/HlslCache/";
+            static constexpr uint64             kShaderCacheCapacity = 64 * 1024 * 1024;
 
         public:
                                         DxShaderPool(GraphicDevice* const graphicDevice, DxShaderHeaderMemory* const shaderHeaderMemory, const DxShaderVersion shaderVersion);
@@ -95,6 +148,21 @@ namespace mint
         public:
             const DxObjectId&           pushVertexShader(const char* const inputDirectory, const char* const inputShaderFileName, const char* const entryPoint, const mint::CppHlsl::TypeMetaData* const inputElementTypeMetaData, const char* const outputDirectory = nullptr);
             const DxObjectId&           pushNonVertexShader(const char* const inputDirectory, const char* const inputShaderFileName, const char* const entryPoint, const DxShaderType shaderType, const char* const outputDirectory = nullptr);
+            // Cache 에 없는 Shader 들을 Worker thread 들에서 한꺼번에 compile 하고, 요청 순서대로 outObjectIds 를 채운다.
+            // 실패한 요청의 ObjectId 는 kInvalidObjectId 가 된다. Variant 요청은 getShaderVariant() 도 같은 ObjectId 를 찾게 된다.
+            const bool                  pushShaders(const DxShaderRequest* const shaderRequests, const uint32 shaderRequestCount, DxObjectId* const outObjectIds);
+
+        public:
+            // //#keywords 로 Keyword 를 선언한 Shader 를 등록만 한다. 실패하면 kUint32Max 를 반환한다.
+            // 이미 등록한 파일과 entry point 를 다시 등록하면 그 permutation 의 index 를 반환한다.
+            const uint32                pushShaderPermutation(const DxShaderRequest& shaderRequest);
+            const ShaderKeywordMask     getShaderKeywordMask(const uint32 shaderPermutationIndex, const char* const keyword) const noexcept;
+            // Keyword mask 로 variant 를 찾고, 처음 쓰는 variant 면 compile 해서 만든다. 실패하면 kInvalidObjectId 를 반환한다.
+            const DxObjectId            getShaderVariant(const uint32 shaderPermutationIndex, const ShaderKeywordMask keywordMask);
+
+        public:
+            // nullptr 이면 D3D 를 쓰는 기본 compiler 로 돌아간다.
+            void                        setShaderCompiler(IShaderCompiler* const shaderCompiler) noexcept;
 
         private:
             const DxObjectId&           pushVertexShaderInternal(DxShader& shader, const mint::CppHlsl::TypeMetaData* const inputElementTypeMetaData);
@@ -106,15 +174,30 @@ namespace mint
             const bool                  createNonVertexShaderInternal(DxShader& shader, const DxShaderType shaderType);
 
         private:
+            const DxObjectId            createShaderVariant(const DxShaderPermutation& shaderPermutation, const ShaderKeywordMask keywordMask);
+            const bool                  compileShaderVariant(const DxShaderPermutation& shaderPermutation, const ShaderKeywordMask keywordMask, DxShader& inoutShader);
+            void                        recompileShaderPermutations();
+
+        private:
+            const bool                  makeShaderFilePaths(const char* const inputDirectory, const char* const inputShaderFileName, const char* const outputDirectory, std::string& outInputShaderFilePath, std::string& outOutputShaderFilePath) const;
             const bool                  compileShaderFromFile(const char* const inputDirectory, const char* const inputShaderFileName, const char* const entryPoint, const char* const outputDirectory, const DxShaderType shaderType, const bool forceCompilation, DxShader& inoutShader);
             const bool                  compileShaderFromFile(const char* const inputShaderFilePath, const char* const entryPoint, const char* const outputShaderFilePath, const DxShaderType shaderType, const bool forceCompilation, DxShader& inoutShader);
             const bool                  compileShaderInternalXXX(const DxShaderType shaderType, const DxShaderCompileParam& compileParam, const char* const entryPoint, ID3D10Blob** outBlob);
 
+        private:
+            // Source 와 Source 가 #include 하는 ShaderHeaderMemory 의 내용, entry point, target profile, compile flag 로 Key 를 만든다.
+            const uint64                computeShaderCacheKey(const char* const source, const char* const entryPoint, const DxShaderType shaderType) const noexcept;
+            const uint64                computeShaderCacheKey(const char* const source, const mint::Vector<std::string_view>& defines, const char* const entryPoint, const DxShaderType shaderType) const noexcept;
+            void                        collectIncludeContents(const std::string_view source, mint::Vector<std::string_view>& inoutIncludeContents) const noexcept;
+            const bool                  isStaleShader(const DxShader& shader) const noexcept;
+
         public:
+            // Source 나 #include 가 바뀐 Shader 들만 다시 compile 한다.
             void                        recompileAllShaders();
 
         private:
             void                        reportCompileError();
+            void                        reportCompileError(std::string errorMessages);
 
         public:
             void                        bindShaderIfNot(const DxShaderType shaderType, const DxObjectId& objectId);
@@ -122,6 +205,7 @@ namespace mint
             
         private:
             const DxShader&             getShader(const DxShaderType shaderType, const DxObjectId& objectId);
+            mint::Vector<DxShader>&     getShaderArray(const DxShaderType shaderType) noexcept;
 
         private:
             ComPtr<ID3DBlob>            _errorMessageBlob;
@@ -131,6 +215,15 @@ namespace mint
 
         private:
             DxShaderVersion             _shaderVersion;
+            CppHlsl::ShaderCache        _shaderCache;
+
+        private:
+            DxShaderCompiler            _dxShaderCompiler;
+            IShaderCompiler*            _shaderCompiler;
+            ShaderPermutationCache      _shaderPermutationCache;
+
+        private:
+            mint::Vector<DxShaderPermutation>   _shaderPermutationArray;
 
         private:
             mint::Vector<DxShader>        _vertexShaderArray;
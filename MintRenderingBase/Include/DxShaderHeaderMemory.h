@@ -20,6 +20,8 @@ namespace mint
         
         public:
             void                                pushHeader(const char* const name, const char* const content);
+            // 없으면 빈 string_view 를 반환한다.
+            const std::string_view              getHeaderContent(const std::string_view name) const noexcept;
 
         public:
             HRESULT                             Open(D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes) override final;
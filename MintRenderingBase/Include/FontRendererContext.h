@@ -145,7 +145,7 @@ namespace mint
         private:
             const bool                          bakeGlyph(const wchar_t wch, const int16 width, const int16 spaceLeft, const int16 spaceTop, mint::Vector<uint8>& pixelArray, int16& pixelPositionX, int16& pixelPositionY);
             void                                completeGlyphInfoArray(const int16 textureWidth, const int16 textureHeight);
-            void                                writeMetaData(const int16 textureWidth, const int16 textureHeight, mint::BinaryFileWriter& binaryFileWriter) const noexcept;
+            void                                writeMetaData(const int16 textureWidth, const int16 textureHeight, mint::BinaryFileStreamWriter& binaryFileWriter) const noexcept;
 
         public:
             virtual void                        initializeShaders() noexcept override final;
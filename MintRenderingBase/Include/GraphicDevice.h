@@ -20,7 +20,8 @@
 
 #include <MintRenderingBase/Include/Gui/GuiContext.h>
 
-#include <MintRenderingBase/Include/CppHlsl/Interpreter.h>
+#include <MintCppHlsl/Include/Interpreter.h>
+#include <MintCppHlsl/Include/BufferPacking.h>
 
 #include <MintMath/Include/Float4x4.h>
 
@@ -146,6 +147,8 @@ namespace mint
             const bool                                          initializeDepthStencilBufferAndView(const mint::Int2& windowSize);
             const bool                                          initializeDepthStencilStates();
             void                                                initializeShaderHeaderMemory();
+            // C++ 구조체와 HLSL 이 같은 layout 을 쓰는지 Debug 에서 확인한다.
+            static void                                         validateCppHlslBufferLayout(const mint::CppHlsl::TypeMetaData& typeMetaData, const mint::CppHlsl::BufferPackingRule packingRule, const uint32 cppTypeSize) noexcept;
             void                                                initializeShaders();
             void                                                initializeSamplerStates();
             void                                                initializeBlendStates();
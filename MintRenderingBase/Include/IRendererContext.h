@@ -37,11 +37,11 @@ namespace mint
             virtual                                 ~IRendererContext() = default;
 
         public:
-            virtual void                            initializeShaders() noexcept abstract;
-            virtual const bool                      hasData() const noexcept abstract;
-            virtual void                            flush() noexcept abstract;
-            virtual void                            render() noexcept abstract;
-            virtual void                            renderAndFlush() noexcept abstract;
+            virtual void                            initializeShaders() noexcept = 0;
+            virtual const bool                      hasData() const noexcept = 0;
+            virtual void                            flush() noexcept = 0;
+            virtual void                            render() noexcept = 0;
+            virtual void                            renderAndFlush() noexcept = 0;
         
         protected:
             void                                    flushTransformBuffer() noexcept;
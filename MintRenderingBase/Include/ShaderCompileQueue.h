@@ -0,0 +1,83 @@
+﻿#pragma once
+
+
+#ifndef MINT_SHADER_COMPILE_QUEUE_H
+#define MINT_SHADER_COMPILE_QUEUE_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+
+
+namespace mint
+{
+    namespace RenderingBase
+    {
+        struct ShaderCompileRequest
+        {
+            std::string_view            _identifier;    // 파일 경로나 이름. Error 메시지에 쓰인다.
+            std::string_view            _source;
+            std::string_view            _entryPoint;
+            std::string_view            _targetProfile; // 예: "ps_5_0"
+        };
+
+        struct ShaderCompileResult
+        {
+            bool                        _isSucceeded = false;
+            mint::Vector<byte>          _binary;
+            std::string                 _errorMessage;
+        };
+
+
+        // Shader compiler backend. D3D 를 쓰는 DxShaderCompiler 와 Test 용 가짜 compiler 를 바꿔 끼울 수 있다.
+        class IShaderCompiler abstract
+        {
+        public:
+                                        IShaderCompiler() = default;
+            virtual                     ~IShaderCompiler() = default;
+
+        public:
+            // 여러 Worker thread 에서 동시에 불리므로 thread-safe 해야 한다!
+            virtual const bool          compile(const ShaderCompileRequest& request, ShaderCompileResult& outResult) noexcept = 0;
+        };
+
+
+        // 쌓인 요청들을 Worker thread 들이 하나씩 가져가 compile 한다. 결과는 요청한 순서대로 남는다.
+        class ShaderCompileQueue final
+        {
+        public:
+                                        ShaderCompileQueue(IShaderCompiler& shaderCompiler);
+                                        ShaderCompileQueue(const ShaderCompileQueue& rhs) = delete;
+                                        ~ShaderCompileQueue() = default;
+
+        public:
+            // 요청의 index 를 반환한다. 요청이 가리키는 문자열들은 execute() 가 끝날 때까지 살아 있어야 한다.
+            const uint32                push(const ShaderCompileRequest& request) noexcept;
+            void                        clear() noexcept;
+            // 모든 요청이 끝나야 반환한다. 호출한 thread 도 Worker 로 일한다.
+            void                        execute(const uint32 maxWorkerCount = 0) noexcept;
+
+        public:
+            const uint32                getRequestCount() const noexcept;
+            const ShaderCompileResult&  getResult(const uint32 requestIndex) const noexcept;
+            const bool                  isAllSucceeded() const noexcept;
+
+        private:
+            void                        runWorker() noexcept;
+
+        private:
+            IShaderCompiler&                    _shaderCompiler;
+            mint::Vector<ShaderCompileRequest>  _requestArray;
+            mint::Vector<ShaderCompileResult>   _resultArray;
+            std::atomic<uint32>                 _nextRequestIndex;
+        };
+    }
+}
+
+
+#endif // !MINT_SHADER_COMPILE_QUEUE_H
@@ -0,0 +1,113 @@
+﻿#pragma once
+
+
+#ifndef MINT_SHADER_PERMUTATION_H
+#define MINT_SHADER_PERMUTATION_H
+
+
+#include <MintCommon/Include/CommonDefinitions.h>
+
+#include <MintContainer/Include/Vector.h>
+#include <MintContainer/Include/HashMap.h>
+
+#include <MintRenderingBase/Include/ShaderCompileQueue.h>
+
+
+namespace mint
+{
+    namespace RenderingBase
+    {
+        // Keyword 의 index 번째 bit 가 켜져 있으면 그 Keyword 를 #define 한 variant 다.
+        using ShaderKeywordMask = uint64;
+
+
+        // Shader 가 선언한 Keyword 들. Source 에서는 아래처럼 선언한다.
+        // //#keywords NO_LIGHTING TEXCOORD_AS_COLOR
+        class ShaderKeywordSet final
+        {
+        public:
+            static constexpr uint32     kMaxKeywordCount = 64;
+            static constexpr const char* const kDeclarationPrefix = "//#keywords";
+
+        public:
+                                        ShaderKeywordSet() = default;
+                                        ~ShaderKeywordSet() = default;
+
+        public:
+            // 이미 있는 Keyword 면 그 index 를, 더 넣을 수 없으면 kUint32Max 를 반환한다.
+            const uint32                addKeyword(const std::string_view keyword) noexcept;
+            // Source 의 모든 선언 줄을 읽고, 새로 추가된 Keyword 수를 반환한다.
+            const uint32                parseDeclaration(const std::string_view source) noexcept;
+            void                        clear() noexcept;
+
+        public:
+            const uint32                getKeywordCount() const noexcept;
+            const std::string&          getKeyword(const uint32 keywordIndex) const noexcept;
+            // 선언되지 않은 Keyword 면 0 을 반환한다.
+            const ShaderKeywordMask     getKeywordMask(const std::string_view keyword) const noexcept;
+            const ShaderKeywordMask     getDeclaredMask() const noexcept;
+
+        public:
+            // "#define KEYWORD 1" 줄들 뒤에 "#line 1" 을 붙여서, Error 메시지의 줄 번호가 원래 source 와 같게 한다.
+            void                        makeDefinitionPrefix(const ShaderKeywordMask keywordMask, std::string& outPrefix) const noexcept;
+            void                        makeDefines(const ShaderKeywordMask keywordMask, mint::Vector<std::string_view>& outDefines) const noexcept;
+
+        private:
+            mint::Vector<std::string>   _keywordArray;
+        };
+
+
+        // Keyword 를 선언한 Shader 들의 variant 를 ShaderKeywordMask 로 찾는다. D3D 에 의존하지 않는다.
+        // 처음 쓰는 variant 는 그 자리에서 compile 하고, 실패한 결과도 기억해서 다시 compile 하지 않는다.
+        class ShaderPermutationCache final
+        {
+            struct PermutationShader
+            {
+                std::string                                 _identifier;
+                std::string                                 _source;
+                std::string                                 _entryPoint;
+                std::string                                 _targetProfile;
+                ShaderKeywordSet                            _keywordSet;
+                mint::HashMap<ShaderKeywordMask, uint32>    _variantIndexMap;   // _variantArray 의 index
+                mint::Vector<ShaderCompileResult>           _variantArray;
+            };
+
+        public:
+                                        ShaderPermutationCache(IShaderCompiler& shaderCompiler);
+                                        ShaderPermutationCache(const ShaderPermutationCache& rhs) = delete;
+                                        ~ShaderPermutationCache() = default;
+
+        public:
+            // Source 는 복사해 둔다. 반환하는 index 로 Shader 를 가리킨다.
+            const uint32                registerShader(const std::string_view identifier, const std::string_view source, const std::string_view entryPoint, const std::string_view targetProfile) noexcept;
+            // Source 가 바뀌었으면 Keyword 를 다시 읽고 모든 variant 를 버린 뒤 true 를 반환한다.
+            const bool                  updateSource(const uint32 shaderIndex, const std::string_view source) noexcept;
+            void                        setShaderCompiler(IShaderCompiler& shaderCompiler) noexcept;
+
+        public:
+            const uint32                getShaderCount() const noexcept;
+            const ShaderKeywordSet&     getKeywordSet(const uint32 shaderIndex) const noexcept;
+            const std::string&          getSource(const uint32 shaderIndex) const noexcept;
+            void                        makeVariantSource(const uint32 shaderIndex, const ShaderKeywordMask keywordMask, std::string& outVariantSource) const noexcept;
+
+        public:
+            // 반환한 참조는 같은 Shader 에 variant 가 추가되기 전까지만 유효하다.
+            const ShaderCompileResult&  getVariant(const uint32 shaderIndex, const ShaderKeywordMask keywordMask) noexcept;
+            const bool                  hasVariant(const uint32 shaderIndex, const ShaderKeywordMask keywordMask) const noexcept;
+            const uint32                getVariantCount(const uint32 shaderIndex) const noexcept;
+            // 아직 없는 variant 들을 ShaderCompileQueue 로 한꺼번에 compile 해 둔다.
+            void                        compileVariants(const uint32 shaderIndex, const ShaderKeywordMask* const keywordMasks, const uint32 keywordMaskCount, const uint32 maxWorkerCount = 0) noexcept;
+
+        private:
+            const ShaderKeywordMask     validateKeywordMask(const PermutationShader& permutationShader, const ShaderKeywordMask keywordMask) const noexcept;
+            void                        makeCompileRequest(const PermutationShader& permutationShader, const std::string& variantSource, ShaderCompileRequest& outRequest) const noexcept;
+
+        private:
+            IShaderCompiler*                    _shaderCompiler;
+            mint::Vector<PermutationShader>     _shaderArray;
+        };
+    }
+}
+
+
+#endif // !MINT_SHADER_PERMUTATION_H
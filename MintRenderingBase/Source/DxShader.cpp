@@ -8,6 +8,7 @@
 #include <MintContainer/Include/ScopeString.hpp>
 #include <MintContainer/Include/StringUtil.hpp>
 #include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
 
 #include <MintPlatform/Include/TextFile.h>
 #include <MintPlatform/Include/FileUtil.hpp>
@@ -15,7 +16,9 @@
 #include <MintRenderingBase/Include/GraphicDevice.h>
 #include <MintRenderingBase/Include/DxShaderHeaderMemory.h>
 
-#include <MintRenderingBase/Include/CppHlsl/Parser.h>
+#include <MintCppHlsl/Include/Parser.h>
+
+#include <cstring>
 
 
 #pragma comment(lib, "d3dcompiler.lib")
@@ -53,12 +56,51 @@ namespace mint
                 out.append("5_0");
             }
         }
+
+        static const DXGI_FORMAT convertCppHlslTypeToDxgiFormat(const CppHlsl::TypeMetaData& typeMetaData)
+        {
+            const std::string_view typeName = typeMetaData.getTypeName();
+            if (typeName == "float" || typeName == "float1")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32_FLOAT;
+            }
+            else if (typeName == "float2")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32_FLOAT;
+            }
+            else if (typeName == "float3")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32B32_FLOAT;
+            }
+            else if (typeName == "float4")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32B32A32_FLOAT;
+            }
+            else if (typeName == "uint" || typeName == "uint1")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32_UINT;
+            }
+            else if (typeName == "uint2")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32_UINT;
+            }
+            else if (typeName == "uint3")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32B32_UINT;
+            }
+            else if (typeName == "uint4")
+            {
+                return DXGI_FORMAT::DXGI_FORMAT_R32G32B32A32_UINT;
+            }
+
+            return DXGI_FORMAT::DXGI_FORMAT_R32_FLOAT;
+        }
 #pragma endregion
 
 
         const DxShader DxShader::kNullInstance(nullptr, DxShaderType::VertexShader);
         DxShader::DxShader(GraphicDevice* const graphicDevice, const DxShaderType shaderType)
-            : IDxObject(graphicDevice, DxObjectType::Shader), _shaderType{ shaderType }
+            : IDxObject(graphicDevice, DxObjectType::Shader), _shaderType{ shaderType }, _cacheKey{ 0 }
         {
             __noop;
         }
@@ -98,12 +140,55 @@ namespace mint
         }
 
 
+        DxShaderCompiler::DxShaderCompiler(DxShaderHeaderMemory* const shaderHeaderMemory)
+            : _shaderHeaderMemory{ shaderHeaderMemory }
+        {
+            __noop;
+        }
+
+        const bool DxShaderCompiler::compile(const ShaderCompileRequest& request, ShaderCompileResult& outResult) noexcept
+        {
+            // D3DCompile  null   ڿ ޴´.
+            const std::string identifier{ request._identifier };
+            const std::string entryPoint{ request._entryPoint };
+            const std::string targetProfile{ request._targetProfile };
+
+            ComPtr<ID3D10Blob> shaderBlob;
+            ComPtr<ID3D10Blob> errorMessageBlob;
+            if (FAILED(D3DCompile(request._source.data(), request._source.length(), identifier.c_str(), nullptr, _shaderHeaderMemory, entryPoint.c_str(), targetProfile.c_str(), getCompileFlags(), 0, shaderBlob.GetAddressOf(), errorMessageBlob.GetAddressOf())))
+            {
+                if (errorMessageBlob != nullptr)
+                {
+                    outResult._errorMessage.assign(reinterpret_cast<const char*>(errorMessageBlob->GetBufferPointer()), errorMessageBlob->GetBufferSize());
+                }
+                return false;
+            }
+
+            const uint32 binarySize = static_cast<uint32>(shaderBlob->GetBufferSize());
+            outResult._binary.resize(binarySize);
+            if (0 < binarySize)
+            {
+                ::memcpy(&outResult._binary[0], shaderBlob->GetBufferPointer(), binarySize);
+            }
+            return true;
+        }
+
+        const uint32 DxShaderCompiler::getCompileFlags() noexcept
+        {
+            return D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+        }
+
+
         DxShaderPool::DxShaderPool(GraphicDevice* const graphicDevice, DxShaderHeaderMemory* const shaderHeaderMemory, const DxShaderVersion shaderVersion)
             : IDxObject(graphicDevice, DxObjectType::Pool)
             , _shaderHeaderMemory{ shaderHeaderMemory }
             , _shaderVersion{ shaderVersion }
+            , _shaderCache{ kShaderCacheDirectory, kShaderCacheCapacity }
+            , _dxShaderCompiler{ shaderHeaderMemory }
+            , _shaderCompiler{ &_dxShaderCompiler }
+            , _shaderPermutationCache{ _dxShaderCompiler }
         {
-            __noop;
+            _shaderCache.loadManifest();
         }
 
         const DxObjectId& DxShaderPool::pushVertexShaderFromMemory(const char* const shaderIdentifier, const char* const textContent, const char* const entryPoint, const mint::CppHlsl::TypeMetaData* const inputElementTypeMetaData)
@@ -158,6 +243,292 @@ namespace mint
             return pushNonVertexShaderInternal(shader, shaderType);
         }
 
+        const bool DxShaderPool::pushShaders(const DxShaderRequest* const shaderRequests, const uint32 shaderRequestCount, DxObjectId* const outObjectIds)
+        {
+            // ڿ compileQueue  ŰǷ ũ⸦ ̸  ΰ ٽ Ҵ ʴ´.
+            mint::Vector<std::string> sources(shaderRequestCount);
+            mint::Vector<std::string> inputShaderFilePaths(shaderRequestCount);
+            mint::Vector<std::string> outputShaderFilePaths(shaderRequestCount);
+            mint::Vector<std::string> targetProfiles(shaderRequestCount);
+            mint::Vector<uint64> cacheKeys(shaderRequestCount);
+            mint::Vector<ComPtr<ID3D10Blob>> shaderBlobs(shaderRequestCount);
+            mint::Vector<uint32> compileRequestIndices(shaderRequestCount);
+            mint::Vector<uint32> sameVariantRequestIndices(shaderRequestCount);
+
+            bool isAllSucceeded = true;
+            ShaderCompileQueue compileQueue{ *_shaderCompiler };
+            for (uint32 shaderRequestIndex = 0; shaderRequestIndex < shaderRequestCount; ++shaderRequestIndex)
+            {
+                const DxShaderRequest& shaderRequest = shaderRequests[shaderRequestIndex];
+                compileRequestIndices[shaderRequestIndex] = kUint32Max;
+                sameVariantRequestIndices[shaderRequestIndex] = kUint32Max;
+                cacheKeys[shaderRequestIndex] = 0;
+                outObjectIds[shaderRequestIndex] = DxObjectId::kInvalidObjectId;
+
+                const bool isVariantRequest = (shaderRequest._shaderPermutationIndex != kUint32Max);
+                if (isVariantRequest == true && _shaderPermutationArray.size() <= shaderRequest._shaderPermutationIndex)
+                {
+                    isAllSucceeded = false;
+                    continue;
+                }
+
+                const DxShaderType shaderType = (isVariantRequest == true) ? _shaderPermutationArray[shaderRequest._shaderPermutationIndex]._shaderType : shaderRequest._shaderType;
+                mint::ScopeStringA<20> version;
+                makeShaderVersion(version, shaderType, _shaderVersion);
+                targetProfiles[shaderRequestIndex] = version.c_str();
+
+                if (isVariantRequest == true)
+                {
+                    DxShaderPermutation& shaderPermutation = _shaderPermutationArray[shaderRequest._shaderPermutationIndex];
+                    const KeyValuePair<ShaderKeywordMask, DxObjectId> keyValuePair = shaderPermutation._variantObjectIdMap.find(shaderRequest._keywordMask);
+                    if (keyValuePair.isValid() == true)
+                    {
+                        outObjectIds[shaderRequestIndex] = *keyValuePair._value;
+                        isAllSucceeded = (isAllSucceeded == true && outObjectIds[shaderRequestIndex].isValid() == true);
+                        continue;
+                    }
+
+                    //  batch ȿ  variant   û   compile Ѵ.
+                    for (uint32 previousRequestIndex = 0; previousRequestIndex < shaderRequestIndex; ++previousRequestIndex)
+                    {
+                        if (shaderRequests[previousRequestIndex]._shaderPermutationIndex == shaderRequest._shaderPermutationIndex
+                            && shaderRequests[previousRequestIndex]._keywordMask == shaderRequest._keywordMask)
+                        {
+                            sameVariantRequestIndices[shaderRequestIndex] = previousRequestIndex;
+                            break;
+                        }
+                    }
+                    if (sameVariantRequestIndices[shaderRequestIndex] != kUint32Max)
+                    {
+                        continue;
+                    }
+
+                    const uint32 permutationShaderIndex = shaderPermutation._permutationShaderIndex;
+                    const ShaderKeywordSet& keywordSet = _shaderPermutationCache.getKeywordSet(permutationShaderIndex);
+                    const ShaderKeywordMask declaredKeywordMask = shaderRequest._keywordMask & keywordSet.getDeclaredMask();
+                    mint::Vector<std::string_view> defines;
+                    keywordSet.makeDefines(declaredKeywordMask, defines);
+                    cacheKeys[shaderRequestIndex] = computeShaderCacheKey(_shaderPermutationCache.getSource(permutationShaderIndex).c_str(), defines, shaderPermutation._entryPoint.c_str(), shaderType);
+                    inputShaderFilePaths[shaderRequestIndex] = shaderPermutation._hlslFileName;
+
+                    std::string cachedBinaryFilePath;
+                    if (_shaderCache.find(cacheKeys[shaderRequestIndex], cachedBinaryFilePath) == true)
+                    {
+                        std::wstring cachedBinaryFilePathWide;
+                        mint::StringUtil::convertStringToWideString(cachedBinaryFilePath, cachedBinaryFilePathWide);
+                        if (SUCCEEDED(D3DReadFileToBlob(cachedBinaryFilePathWide.c_str(), shaderBlobs[shaderRequestIndex].ReleaseAndGetAddressOf())))
+                        {
+                            continue;
+                        }
+                    }
+                    _shaderPermutationCache.makeVariantSource(permutationShaderIndex, declaredKeywordMask, sources[shaderRequestIndex]);
+                }
+                else if (shaderRequest._inputShaderFileName != nullptr)
+                {
+                    mint::TextFileReader textFileReader;
+                    if (makeShaderFilePaths(shaderRequest._inputDirectory, shaderRequest._inputShaderFileName, shaderRequest._outputDirectory, inputShaderFilePaths[shaderRequestIndex], outputShaderFilePaths[shaderRequestIndex]) == false
+                        || textFileReader.open(inputShaderFilePaths[shaderRequestIndex].c_str()) == false)
+                    {
+                        isAllSucceeded = false;
+                        continue;
+                    }
+                    sources[shaderRequestIndex] = textFileReader.get();
+                    cacheKeys[shaderRequestIndex] = computeShaderCacheKey(sources[shaderRequestIndex].c_str(), shaderRequest._entryPoint, shaderRequest._shaderType);
+
+                    std::string cachedBinaryFilePath;
+                    if (_shaderCache.find(cacheKeys[shaderRequestIndex], cachedBinaryFilePath) == true)
+                    {
+                        std::wstring cachedBinaryFilePathWide;
+                        mint::StringUtil::convertStringToWideString(cachedBinaryFilePath, cachedBinaryFilePathWide);
+                        if (SUCCEEDED(D3DReadFileToBlob(cachedBinaryFilePathWide.c_str(), shaderBlobs[shaderRequestIndex].ReleaseAndGetAddressOf())))
+                        {
+                            continue;
+                        }
+                    }
+                }
+                else
+                {
+                    sources[shaderRequestIndex] = shaderRequest._textContent;
+                    inputShaderFilePaths[shaderRequestIndex] = shaderRequest._shaderIdentifier;
+                }
+
+                ShaderCompileRequest compileRequest;
+                compileRequest._identifier = inputShaderFilePaths[shaderRequestIndex];
+                compileRequest._source = sources[shaderRequestIndex];
+                compileRequest._entryPoint = (isVariantRequest == true) ? std::string_view(_shaderPermutationArray[shaderRequest._shaderPermutationIndex]._entryPoint) : std::string_view(shaderRequest._entryPoint);
+                compileRequest._targetProfile = targetProfiles[shaderRequestIndex];
+                compileRequestIndices[shaderRequestIndex] = compileQueue.push(compileRequest);
+            }
+
+            compileQueue.execute();
+
+            for (uint32 shaderRequestIndex = 0; shaderRequestIndex < shaderRequestCount; ++shaderRequestIndex)
+            {
+                const DxShaderRequest& shaderRequest = shaderRequests[shaderRequestIndex];
+                const uint32 sameVariantRequestIndex = sameVariantRequestIndices[shaderRequestIndex];
+                if (sameVariantRequestIndex != kUint32Max)
+                {
+                    outObjectIds[shaderRequestIndex] = outObjectIds[sameVariantRequestIndex];
+                    continue;
+                }
+
+                DxShaderPermutation* const shaderPermutation = (shaderRequest._shaderPermutationIndex < _shaderPermutationArray.size()) ? &_shaderPermutationArray[shaderRequest._shaderPermutationIndex] : nullptr;
+                const uint32 compileRequestIndex = compileRequestIndices[shaderRequestIndex];
+                if (compileRequestIndex != kUint32Max)
+                {
+                    const ShaderCompileResult& compileResult = compileQueue.getResult(compileRequestIndex);
+                    if (compileResult._isSucceeded == false)
+                    {
+                        reportCompileError(compileResult._errorMessage);
+                        if (shaderPermutation != nullptr)
+                        {
+                            // getShaderVariant() ó  variant  ؼ ٽ compile  ʴ´.
+                            shaderPermutation->_variantObjectIdMap.insert(shaderRequest._keywordMask, DxObjectId::kInvalidObjectId);
+                        }
+                        isAllSucceeded = false;
+                        continue;
+                    }
+
+                    const uint32 binarySize = compileResult._binary.size();
+                    if (FAILED(D3DCreateBlob(binarySize, shaderBlobs[shaderRequestIndex].ReleaseAndGetAddressOf())))
+                    {
+                        isAllSucceeded = false;
+                        continue;
+                    }
+                    ::memcpy(shaderBlobs[shaderRequestIndex]->GetBufferPointer(), compileResult._binary.data(), binarySize);
+
+                    if (shaderPermutation == nullptr && shaderRequest._inputShaderFileName != nullptr)
+                    {
+                        std::wstring outputShaderFilePathWide;
+                        mint::StringUtil::convertStringToWideString(outputShaderFilePaths[shaderRequestIndex], outputShaderFilePathWide);
+                        D3DWriteBlobToFile(shaderBlobs[shaderRequestIndex].Get(), outputShaderFilePathWide.c_str(), TRUE);
+                    }
+                    if (cacheKeys[shaderRequestIndex] != 0)
+                    {
+                        _shaderCache.insert(cacheKeys[shaderRequestIndex], compileResult._binary.data(), binarySize);
+                    }
+                }
+                else if (shaderBlobs[shaderRequestIndex] == nullptr)
+                {
+                    continue;
+                }
+
+                const DxShaderType shaderType = (shaderPermutation != nullptr) ? shaderPermutation->_shaderType : shaderRequest._shaderType;
+                DxShader shader(_graphicDevice, shaderType);
+                shader._shaderBlob = shaderBlobs[shaderRequestIndex];
+                shader._entryPoint = (shaderPermutation != nullptr) ? shaderPermutation->_entryPoint : shaderRequest._entryPoint;
+                shader._hlslFileName = inputShaderFilePaths[shaderRequestIndex];
+                shader._hlslBinaryFileName = outputShaderFilePaths[shaderRequestIndex];
+                shader._cacheKey = cacheKeys[shaderRequestIndex];
+                if (shaderType == DxShaderType::VertexShader)
+                {
+                    outObjectIds[shaderRequestIndex] = pushVertexShaderInternal(shader, (shaderPermutation != nullptr) ? shaderPermutation->_inputElementTypeMetaData : shaderRequest._inputElementTypeMetaData);
+                }
+                else
+                {
+                    outObjectIds[shaderRequestIndex] = pushNonVertexShaderInternal(shader, shaderType);
+                }
+                if (shaderPermutation != nullptr)
+                {
+                    shaderPermutation->_variantObjectIdMap.insert(shaderRequest._keywordMask, outObjectIds[shaderRequestIndex]);
+                }
+                if (outObjectIds[shaderRequestIndex].isValid() == false)
+                {
+                    isAllSucceeded = false;
+                }
+            }
+            return isAllSucceeded;
+        }
+
+        void DxShaderPool::setShaderCompiler(IShaderCompiler* const shaderCompiler) noexcept
+        {
+            _shaderCompiler = (shaderCompiler == nullptr) ? &_dxShaderCompiler : shaderCompiler;
+            _shaderPermutationCache.setShaderCompiler(*_shaderCompiler);
+        }
+
+        const uint32 DxShaderPool::pushShaderPermutation(const DxShaderRequest& shaderRequest)
+        {
+            DxShaderPermutation shaderPermutation;
+            shaderPermutation._shaderType = shaderRequest._shaderType;
+            shaderPermutation._inputElementTypeMetaData = shaderRequest._inputElementTypeMetaData;
+            shaderPermutation._entryPoint = shaderRequest._entryPoint;
+
+            std::string source;
+            std::string identifier;
+            if (shaderRequest._inputShaderFileName != nullptr)
+            {
+                // Variant  binary  ShaderCache  ϹǷ outputShaderFilePath   ʴ´.
+                std::string outputShaderFilePath;
+                mint::TextFileReader textFileReader;
+                if (makeShaderFilePaths(shaderRequest._inputDirectory, shaderRequest._inputShaderFileName, shaderRequest._outputDirectory, shaderPermutation._hlslFileName, outputShaderFilePath) == false
+                    || textFileReader.open(shaderPermutation._hlslFileName.c_str()) == false)
+                {
+                    return kUint32Max;
+                }
+
+                //    Renderer  ص variant    compile ǵ ̹ ִ permutation   .
+                const uint32 shaderPermutationCount = _shaderPermutationArray.size();
+                for (uint32 shaderPermutationIndex = 0; shaderPermutationIndex < shaderPermutationCount; ++shaderPermutationIndex)
+                {
+                    const DxShaderPermutation& existingShaderPermutation = _shaderPermutationArray[shaderPermutationIndex];
+                    if (existingShaderPermutation._hlslFileName == shaderPermutation._hlslFileName
+                        && existingShaderPermutation._entryPoint == shaderPermutation._entryPoint
+                        && existingShaderPermutation._shaderType == shaderPermutation._shaderType
+                        && existingShaderPermutation._inputElementTypeMetaData == shaderPermutation._inputElementTypeMetaData)
+                    {
+                        return shaderPermutationIndex;
+                    }
+                }
+
+                source = textFileReader.get();
+                identifier = shaderPermutation._hlslFileName;
+            }
+            else
+            {
+                source = shaderRequest._textContent;
+                identifier = shaderRequest._shaderIdentifier;
+            }
+
+            mint::ScopeStringA<20> version;
+            makeShaderVersion(version, shaderRequest._shaderType, _shaderVersion);
+            shaderPermutation._permutationShaderIndex = _shaderPermutationCache.registerShader(identifier, source, shaderRequest._entryPoint, version.c_str());
+
+            _shaderPermutationArray.push_back(std::move(shaderPermutation));
+            return _shaderPermutationArray.size() - 1;
+        }
+
+        const ShaderKeywordMask DxShaderPool::getShaderKeywordMask(const uint32 shaderPermutationIndex, const char* const keyword) const noexcept
+        {
+            if (_shaderPermutationArray.size() <= shaderPermutationIndex)
+            {
+                return 0;
+            }
+
+            const ShaderKeywordMask keywordMask = _shaderPermutationCache.getKeywordSet(_shaderPermutationArray[shaderPermutationIndex]._permutationShaderIndex).getKeywordMask(keyword);
+            MINT_ASSERT("", keywordMask != 0, "Keyword [%s]   ʾҽϴ!", keyword);
+            return keywordMask;
+        }
+
+        const DxObjectId DxShaderPool::getShaderVariant(const uint32 shaderPermutationIndex, const ShaderKeywordMask keywordMask)
+        {
+            if (_shaderPermutationArray.size() <= shaderPermutationIndex)
+            {
+                return DxObjectId::kInvalidObjectId;
+            }
+
+            DxShaderPermutation& shaderPermutation = _shaderPermutationArray[shaderPermutationIndex];
+            const KeyValuePair<ShaderKeywordMask, DxObjectId> keyValuePair = shaderPermutation._variantObjectIdMap.find(keywordMask);
+            if (keyValuePair.isValid() == true)
+            {
+                return *keyValuePair._value;
+            }
+
+            //  variant  ؼ  frame ٽ compile  ʴ´.
+            const DxObjectId objectId = createShaderVariant(shaderPermutation, keywordMask);
+            shaderPermutation._variantObjectIdMap.insert(keywordMask, objectId);
+            return objectId;
+        }
+
         const DxObjectId& DxShaderPool::pushVertexShaderInternal(DxShader& shader, const mint::CppHlsl::TypeMetaData* const inputElementTypeMetaData)
         {
             if (createVertexShaderInternal(shader, inputElementTypeMetaData) == true)
@@ -226,7 +597,7 @@ namespace mint
                 if (FAILED(_graphicDevice->getDxDevice()->CreateInputLayout(&shader._inputElementSet._inputElementDescriptorArray[0], static_cast<UINT>(shader._inputElementSet._inputElementDescriptorArray.size()),
                     shader._shaderBlob->GetBufferPointer(), shader._shaderBlob->GetBufferSize(), shader._inputLayout.ReleaseAndGetAddressOf())))
                 {
-                    MINT_LOG_ERROR("", "VertexShader [[%s]]  InputLayout  ߽ϴ. Input ڷ  [[%s]]  ° ´ Ȯ ּ.", shader._hlslFileName.c_str(), inputElementTypeMetaData->getTypeName().c_str());
+                    MINT_LOG_ERROR("", "VertexShader [[%s]]  InputLayout  ߽ϴ. Input ڷ  [[%.*s]]  ° ´ Ȯ ּ.", shader._hlslFileName.c_str(), static_cast<int32>(inputElementTypeMetaData->getTypeName().length()), inputElementTypeMetaData->getTypeName().data());
                     return false;
                 }
             }
@@ -241,7 +612,7 @@ namespace mint
             D3D11_INPUT_ELEMENT_DESC inputElementDescriptor;
             inputElementDescriptor.SemanticName = inputElementSet._semanticNameArray.back().c_str();
             inputElementDescriptor.SemanticIndex = 0;
-            inputElementDescriptor.Format = CppHlsl::Parser::convertCppHlslTypeToDxgiFormat(memberTypeMetaData);
+            inputElementDescriptor.Format = convertCppHlslTypeToDxgiFormat(memberTypeMetaData);
             inputElementDescriptor.InputSlot = memberTypeMetaData.getInputSlot();
             inputElementDescriptor.AlignedByteOffset = memberTypeMetaData.getByteOffset();
             inputElementDescriptor.InputSlotClass = D3D11_INPUT_CLASSIFICATION::D3D11_INPUT_PER_VERTEX_DATA;
@@ -278,33 +649,147 @@ namespace mint
             return true;
         }
 
-        const bool DxShaderPool::compileShaderFromFile(const char* const inputDirectory, const char* const inputShaderFileName, const char* const entryPoint, const char* const outputDirectory, const DxShaderType shaderType, const bool forceCompilation, DxShader& inoutShader)
+        const DxObjectId DxShaderPool::createShaderVariant(const DxShaderPermutation& shaderPermutation, const ShaderKeywordMask keywordMask)
+        {
+            DxShader shader(_graphicDevice, shaderPermutation._shaderType);
+            if (compileShaderVariant(shaderPermutation, keywordMask, shader) == false)
+            {
+                return DxObjectId::kInvalidObjectId;
+            }
+
+            if (shaderPermutation._shaderType == DxShaderType::VertexShader)
+            {
+                return pushVertexShaderInternal(shader, shaderPermutation._inputElementTypeMetaData);
+            }
+            return pushNonVertexShaderInternal(shader, shaderPermutation._shaderType);
+        }
+
+        const bool DxShaderPool::compileShaderVariant(const DxShaderPermutation& shaderPermutation, const ShaderKeywordMask keywordMask, DxShader& inoutShader)
         {
-            std::string inputShaderFilePath{ inputDirectory };
-            inputShaderFilePath += inputShaderFileName;
-            if (mint::FileUtil::exists(inputShaderFilePath.c_str()) == false)
+            const uint32 permutationShaderIndex = shaderPermutation._permutationShaderIndex;
+            const ShaderKeywordSet& keywordSet = _shaderPermutationCache.getKeywordSet(permutationShaderIndex);
+            mint::Vector<std::string_view> defines;
+            keywordSet.makeDefines(keywordMask & keywordSet.getDeclaredMask(), defines);
+            const uint64 cacheKey = computeShaderCacheKey(_shaderPermutationCache.getSource(permutationShaderIndex).c_str(), defines, shaderPermutation._entryPoint.c_str(), shaderPermutation._shaderType);
+
+            bool isLoadedFromCache = false;
+            std::string cachedBinaryFilePath;
+            if (_shaderCache.find(cacheKey, cachedBinaryFilePath) == true)
             {
-                MINT_LOG_ERROR("", "Input shader file not found : %s", inputShaderFilePath.c_str());
+                std::wstring cachedBinaryFilePathWide;
+                mint::StringUtil::convertStringToWideString(cachedBinaryFilePath, cachedBinaryFilePathWide);
+                isLoadedFromCache = SUCCEEDED(D3DReadFileToBlob(cachedBinaryFilePathWide.c_str(), inoutShader._shaderBlob.ReleaseAndGetAddressOf()));
+            }
+
+            if (isLoadedFromCache == false)
+            {
+                const ShaderCompileResult& compileResult = _shaderPermutationCache.getVariant(permutationShaderIndex, keywordMask);
+                if (compileResult._isSucceeded == false)
+                {
+                    reportCompileError(compileResult._errorMessage);
+                    return false;
+                }
+
+                const uint32 binarySize = compileResult._binary.size();
+                if (FAILED(D3DCreateBlob(binarySize, inoutShader._shaderBlob.ReleaseAndGetAddressOf())))
+                {
+                    return false;
+                }
+                ::memcpy(inoutShader._shaderBlob->GetBufferPointer(), compileResult._binary.data(), binarySize);
+                _shaderCache.insert(cacheKey, compileResult._binary.data(), binarySize);
+            }
+
+            // _hlslBinaryFileName   Ƿ recompileAllShaders()    ó .
+            inoutShader._cacheKey = cacheKey;
+            inoutShader._entryPoint = shaderPermutation._entryPoint;
+            inoutShader._hlslFileName = shaderPermutation._hlslFileName;
+            return true;
+        }
+
+        void DxShaderPool::recompileShaderPermutations()
+        {
+            const uint32 shaderPermutationCount = _shaderPermutationArray.size();
+            for (uint32 shaderPermutationIndex = 0; shaderPermutationIndex < shaderPermutationCount; ++shaderPermutationIndex)
+            {
+                const DxShaderPermutation& shaderPermutation = _shaderPermutationArray[shaderPermutationIndex];
+                if (shaderPermutation._hlslFileName.empty() == true || shaderPermutation._variantObjectIdMap.empty() == true)
+                {
+                    continue;
+                }
+
+                mint::TextFileReader textFileReader;
+                if (textFileReader.open(shaderPermutation._hlslFileName.c_str()) == false
+                    || _shaderPermutationCache.updateSource(shaderPermutation._permutationShaderIndex, textFileReader.get()) == false)
+                {
+                    continue;
+                }
+
+                // ̹  variant 鸸  ObjectId  ٽ .  ó   compile ȴ.
+                mint::Vector<DxShader>& shaderArray = getShaderArray(shaderPermutation._shaderType);
+                for (mint::BucketViewer bucketViewer = shaderPermutation._variantObjectIdMap.getBucketViewer(); bucketViewer.isValid(); bucketViewer.next())
+                {
+                    const KeyValuePairConst<ShaderKeywordMask, DxObjectId> keyValuePair = bucketViewer.view();
+                    const int32 shaderIndex = mint::binarySearch(shaderArray, *keyValuePair._value);
+                    if (shaderIndex < 0)
+                    {
+                        continue;
+                    }
+
+                    DxShader& shader = shaderArray[shaderIndex];
+                    if (compileShaderVariant(shaderPermutation, *keyValuePair._key, shader) == false)
+                    {
+                        continue;
+                    }
+
+                    if (shaderPermutation._shaderType == DxShaderType::VertexShader)
+                    {
+                        createVertexShaderInternal(shader, nullptr);
+                    }
+                    else
+                    {
+                        createNonVertexShaderInternal(shader, shaderPermutation._shaderType);
+                    }
+                }
+            }
+        }
+
+        const bool DxShaderPool::makeShaderFilePaths(const char* const inputDirectory, const char* const inputShaderFileName, const char* const outputDirectory, std::string& outInputShaderFilePath, std::string& outOutputShaderFilePath) const
+        {
+            outInputShaderFilePath = inputDirectory;
+            outInputShaderFilePath += inputShaderFileName;
+            if (mint::FileUtil::exists(outInputShaderFilePath.c_str()) == false)
+            {
+                MINT_LOG_ERROR("", "Input shader file not found : %s", outInputShaderFilePath.c_str());
                 return false;
             }
 
-            std::string outputShaderFilePath{ inputShaderFileName };
-            mint::StringUtil::excludeExtension(outputShaderFilePath);
+            outOutputShaderFilePath = inputShaderFileName;
+            mint::StringUtil::excludeExtension(outOutputShaderFilePath);
             if (outputDirectory != nullptr)
             {
-                if (mint::FileUtil::exists(outputDirectory) == false)
+                if (mint::FileUtil::exists(outputDirectory) == false && mint::FileUtil::createDirectory(outputDirectory) == false)
                 {
-                    MINT_ASSERT("", mint::FileUtil::createDirectory(outputDirectory) == true, "  ߽ϴ!");
+                    MINT_LOG("", "[%s]  ߽ϴ!", outputDirectory);
                 }
 
-                outputShaderFilePath = outputDirectory + outputShaderFilePath;
+                outOutputShaderFilePath = outputDirectory + outOutputShaderFilePath;
             }
             else
             {
-                outputShaderFilePath = inputDirectory + outputShaderFilePath;
+                outOutputShaderFilePath = inputDirectory + outOutputShaderFilePath;
             }
-            outputShaderFilePath.append(kCompiledShaderFileExtension);
+            outOutputShaderFilePath.append(kCompiledShaderFileExtension);
+            return true;
+        }
 
+        const bool DxShaderPool::compileShaderFromFile(const char* const inputDirectory, const char* const inputShaderFileName, const char* const entryPoint, const char* const outputDirectory, const DxShaderType shaderType, const bool forceCompilation, DxShader& inoutShader)
+        {
+            std::string inputShaderFilePath;
+            std::string outputShaderFilePath;
+            if (makeShaderFilePaths(inputDirectory, inputShaderFileName, outputDirectory, inputShaderFilePath, outputShaderFilePath) == false)
+            {
+                return false;
+            }
             return compileShaderFromFile(inputShaderFilePath.c_str(), entryPoint, outputShaderFilePath.c_str(), shaderType, forceCompilation, inoutShader);
         }
 
@@ -315,26 +800,38 @@ namespace mint
                 return false;
             }
 
-            if (mint::FileUtil::exists(outputShaderFilePath) == false || forceCompilation == true)
+            mint::TextFileReader textFileReader;
+            if (textFileReader.open(inputShaderFilePath) == false)
+            {
+                MINT_LOG_ERROR("", "Input file not found : %s", inputShaderFilePath);
+                return false;
+            }
+            const uint64 cacheKey = computeShaderCacheKey(textFileReader.get(), entryPoint, shaderType);
+
+            bool isLoadedFromCache = false;
+            std::string cachedBinaryFilePath;
+            if (forceCompilation == false && _shaderCache.find(cacheKey, cachedBinaryFilePath) == true)
+            {
+                std::wstring cachedBinaryFilePathWide;
+                mint::StringUtil::convertStringToWideString(cachedBinaryFilePath, cachedBinaryFilePathWide);
+                isLoadedFromCache = SUCCEEDED(D3DReadFileToBlob(cachedBinaryFilePathWide.c_str(), inoutShader._shaderBlob.ReleaseAndGetAddressOf()));
+            }
+
+            if (isLoadedFromCache == false)
             {
                 DxShaderCompileParam compileParam;
-                compileParam._inputFileName = inputShaderFilePath;
                 compileParam._outputFileName = outputShaderFilePath;
+                compileParam._shaderIdentifier = inputShaderFilePath;
+                compileParam._shaderTextContent = textFileReader.get();
                 if (compileShaderInternalXXX(shaderType, compileParam, entryPoint, inoutShader._shaderBlob.ReleaseAndGetAddressOf()) == false)
                 {
                     return false;
                 }
-            }
-            else
-            {
-                std::wstring compiledShaderFileNameWide;
-                mint::StringUtil::convertStringToWideString(outputShaderFilePath, compiledShaderFileNameWide);
-                if (FAILED(D3DReadFileToBlob(compiledShaderFileNameWide.c_str(), inoutShader._shaderBlob.ReleaseAndGetAddressOf())))
-                {
-                    return false;
-                }
+
+                _shaderCache.insert(cacheKey, reinterpret_cast<const byte*>(inoutShader._shaderBlob->GetBufferPointer()), static_cast<uint32>(inoutShader._shaderBlob->GetBufferSize()));
             }
 
+            inoutShader._cacheKey = cacheKey;
             inoutShader._entryPoint = entryPoint;
             inoutShader._hlslFileName = inputShaderFilePath;
             inoutShader._hlslBinaryFileName = outputShaderFilePath;
@@ -360,7 +857,7 @@ namespace mint
                 }
 
                 content = textFileReader.get();
-                contentLength = textFileReader.getFileSize();
+                contentLength = static_cast<uint32>(textFileReader.getFileSize());
                 identifier = compileParam._inputFileName;
             }
             else
@@ -370,8 +867,7 @@ namespace mint
                 identifier = compileParam._shaderIdentifier;
             }
 
-            const UINT debugFlag = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-            if (FAILED(D3DCompile(content, contentLength, identifier, nullptr, _shaderHeaderMemory, entryPoint, version.c_str(), debugFlag, 0, outBlob, _errorMessageBlob.ReleaseAndGetAddressOf())))
+            if (FAILED(D3DCompile(content, contentLength, identifier, nullptr, _shaderHeaderMemory, entryPoint, version.c_str(), DxShaderCompiler::getCompileFlags(), 0, outBlob, _errorMessageBlob.ReleaseAndGetAddressOf())))
             {
                 reportCompileError();
                 return false;
@@ -390,6 +886,73 @@ namespace mint
             return true;
         }
 
+        const uint64 DxShaderPool::computeShaderCacheKey(const char* const source, const char* const entryPoint, const DxShaderType shaderType) const noexcept
+        {
+            return computeShaderCacheKey(source, mint::Vector<std::string_view>(), entryPoint, shaderType);
+        }
+
+        const uint64 DxShaderPool::computeShaderCacheKey(const char* const source, const mint::Vector<std::string_view>& defines, const char* const entryPoint, const DxShaderType shaderType) const noexcept
+        {
+            mint::ScopeStringA<20> version;
+            makeShaderVersion(version, shaderType, _shaderVersion);
+
+            CppHlsl::ShaderCacheKeyInput keyInput;
+            keyInput._source = source;
+            keyInput._defines = defines;
+            keyInput._entryPoint = entryPoint;
+            keyInput._targetProfile = version.c_str();
+            keyInput._compileFlags = DxShaderCompiler::getCompileFlags();
+            collectIncludeContents(keyInput._source, keyInput._includeContents);
+            return CppHlsl::ShaderCache::computeKey(keyInput);
+        }
+
+        void DxShaderPool::collectIncludeContents(const std::string_view source, mint::Vector<std::string_view>& inoutIncludeContents) const noexcept
+        {
+            mint::Vector<std::string_view> includeNames;
+            CppHlsl::ShaderCache::extractIncludeNames(source, includeNames);
+
+            const uint32 includeNameCount = includeNames.size();
+            for (uint32 includeNameIndex = 0; includeNameIndex < includeNameCount; ++includeNameIndex)
+            {
+                const std::string_view includeContent = _shaderHeaderMemory->getHeaderContent(includeNames[includeNameIndex]);
+                
+                //   #include Ǿ   ִ´. ( #include ϴ 쿡 )
+                bool isAlreadyCollected = false;
+                const uint32 includeContentCount = inoutIncludeContents.size();
+                for (uint32 includeContentIndex = 0; includeContentIndex < includeContentCount; ++includeContentIndex)
+                {
+                    if (inoutIncludeContents[includeContentIndex].data() == includeContent.data())
+                    {
+                        isAlreadyCollected = true;
+                        break;
+                    }
+                }
+                if (isAlreadyCollected == true || includeContent.empty() == true)
+                {
+                    continue;
+                }
+
+                inoutIncludeContents.push_back(includeContent);
+                collectIncludeContents(includeContent, inoutIncludeContents);
+            }
+        }
+
+        const bool DxShaderPool::isStaleShader(const DxShader& shader) const noexcept
+        {
+            // Memory  compile  Shader  ٽ compile   .
+            if (shader._hlslBinaryFileName.empty() == true)
+            {
+                return false;
+            }
+
+            mint::TextFileReader textFileReader;
+            if (textFileReader.open(shader._hlslFileName.c_str()) == false)
+            {
+                return false;
+            }
+            return computeShaderCacheKey(textFileReader.get(), shader._entryPoint.c_str(), shader._shaderType) != shader._cacheKey;
+        }
+
         void DxShaderPool::recompileAllShaders()
         {
             const uint32 shaderTypeCount = static_cast<uint32>(mint::RenderingBase::DxShaderType::COUNT);
@@ -407,26 +970,34 @@ namespace mint
             for (uint32 vertexShaderIndex = 0; vertexShaderIndex < vertexShaderCount; ++vertexShaderIndex)
             {
                 DxShader& shader = _vertexShaderArray[vertexShaderIndex];
-                compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, true, shader);
-                createVertexShaderInternal(shader, nullptr);
+                if (isStaleShader(shader) == true && compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, false, shader) == true)
+                {
+                    createVertexShaderInternal(shader, nullptr);
+                }
             }
 
             const uint32 geometryShaderCount = _geometryShaderArray.size();
             for (uint32 geometryShaderIndex = 0; geometryShaderIndex < geometryShaderCount; ++geometryShaderIndex)
             {
                 DxShader& shader = _geometryShaderArray[geometryShaderIndex];
-                compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, true, shader);
-                createNonVertexShaderInternal(shader, mint::RenderingBase::DxShaderType::GeometryShader);
+                if (isStaleShader(shader) == true && compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, false, shader) == true)
+                {
+                    createNonVertexShaderInternal(shader, mint::RenderingBase::DxShaderType::GeometryShader);
+                }
             }
 
             const uint32 pixelShaderCount = _pixelShaderArray.size();
             for (uint32 pixelShaderIndex = 0; pixelShaderIndex < pixelShaderCount; ++pixelShaderIndex)
             {
                 DxShader& shader = _pixelShaderArray[pixelShaderIndex];
-                compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, true, shader);
-                createNonVertexShaderInternal(shader, mint::RenderingBase::DxShaderType::PixelShader);
+                if (isStaleShader(shader) == true && compileShaderFromFile(shader._hlslFileName.c_str(), shader._entryPoint.c_str(), shader._hlslBinaryFileName.c_str(), shader._shaderType, false, shader) == true)
+                {
+                    createNonVertexShaderInternal(shader, mint::RenderingBase::DxShaderType::PixelShader);
+                }
             }
 
+            recompileShaderPermutations();
+
             for (uint32 shaderTypeIndex = 0; shaderTypeIndex < shaderTypeCount; ++shaderTypeIndex)
             {
                 const mint::RenderingBase::DxShaderType shaderType = static_cast<mint::RenderingBase::DxShaderType>(shaderTypeIndex);
@@ -440,8 +1011,11 @@ namespace mint
 
         void DxShaderPool::reportCompileError()
         {
-            std::string errorMessages(reinterpret_cast<char*>(_errorMessageBlob->GetBufferPointer()));
-            
+            reportCompileError(std::string(reinterpret_cast<char*>(_errorMessageBlob->GetBufferPointer())));
+        }
+
+        void DxShaderPool::reportCompileError(std::string errorMessages)
+        {
             const size_t firstNewLinePos = errorMessages.find('\n');
             const size_t secondNewLinePos = errorMessages.find('\n', firstNewLinePos + 1);
             errorMessages = errorMessages.substr(0, secondNewLinePos);
@@ -507,5 +1081,19 @@ namespace mint
             }
             return DxShader::kNullInstance;
         }
+
+        mint::Vector<DxShader>& DxShaderPool::getShaderArray(const DxShaderType shaderType) noexcept
+        {
+            if (shaderType == DxShaderType::VertexShader)
+            {
+                return _vertexShaderArray;
+            }
+            else if (shaderType == DxShaderType::GeometryShader)
+            {
+                return _geometryShaderArray;
+            }
+            MINT_ASSERT("", shaderType == DxShaderType::PixelShader, "Invalid parameter - ShaderType !!");
+            return _pixelShaderArray;
+        }
     }
 }
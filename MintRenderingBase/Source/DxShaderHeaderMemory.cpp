@@ -15,6 +15,19 @@ namespace mint
             _fileContentArray.push_back(content);
         }
 
+        const std::string_view DxShaderHeaderMemory::getHeaderContent(const std::string_view name) const noexcept
+        {
+            const uint32 fileCount = static_cast<uint32>(_fileNameArray.size());
+            for (uint32 fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+            {
+                if (_fileNameArray[fileIndex] == name)
+                {
+                    return _fileContentArray[fileIndex];
+                }
+            }
+            return std::string_view();
+        }
+
         HRESULT DxShaderHeaderMemory::Open(D3D_INCLUDE_TYPE IncludeType, LPCSTR pFileName, LPCVOID pParentData, LPCVOID* ppData, UINT* pBytes)
         {
             const uint32 fileCount = static_cast<uint32>(_fileNameArray.size());
@@ -170,7 +170,7 @@ namespace mint
             }
 
             mint::BinaryFileReader binaryFileReader;
-            if (binaryFileReader.open(fontFileNameWithExtension.c_str()) == false)
+            if (binaryFileReader.openMapped(fontFileNameWithExtension.c_str(), mint::FileAccessHint::Sequential) == false)
             {
                 MINT_LOG_ERROR("", "ش FontFile    ߽ϴ: %s", fontFileNameWithExtension.c_str());
                 return false;
@@ -211,17 +211,18 @@ namespace mint
             mint::Vector<byte> rawData;
 #if defined MINT_FONT_RENDERER_COMPRESS_AS_PNG
             const int32 pngLength = *binaryFileReader.read<int32>();
-            mint::Vector<byte> pngData(pngLength);
-            for (int32 pngAt = 0; pngAt < pngLength; ++pngAt)
+            const byte* const pngData = binaryFileReader.read<byte>(pngLength);
+            if (pngData == nullptr)
             {
-                pngData[pngAt] = *binaryFileReader.read<byte>();
+                MINT_LOG_ERROR("", "FontFile  ũⰡ ߸Ǿϴ: %s", fontFileNameWithExtension.c_str());
+                return false;
             }
 
             int32 width{};
             int32 height{};
             int32 comp{};
             int32 req_comp{ 1 };
-            stbi_uc* const tempDataPtr = stbi_load_from_memory(&pngData[0], pngLength, &width, &height, &comp, req_comp);
+            stbi_uc* const tempDataPtr = stbi_load_from_memory(pngData, pngLength, &width, &height, &comp, req_comp);
             const int32 dimension = static_cast<int32>(static_cast<int64>(width) * height);
             rawData.resize(dimension);
             for (int32 at = 0; at < dimension; ++at)
@@ -229,17 +230,20 @@ namespace mint
                 rawData[at] = tempDataPtr[at];
             }
             stbi_image_free(tempDataPtr);
+            const byte* const pixelData = &rawData[0];
 #else
+            // Mapping   ȼ ͸   ״ ø.
             const uint32 pixelCount = *binaryFileReader.read<uint32>();
-            rawData.resize(pixelCount);
-            for (uint32 pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex)
+            const byte* const pixelData = binaryFileReader.read<byte>(pixelCount);
+            if (pixelData == nullptr)
             {
-                rawData[pixelIndex] = *binaryFileReader.read<byte>();
+                MINT_LOG_ERROR("", "FontFile  ũⰡ ߸Ǿϴ: %s", fontFileNameWithExtension.c_str());
+                return false;
             }
 #endif
             
             mint::RenderingBase::DxResourcePool& resourcePool = _graphicDevice->getResourcePool();
-            _fontData._fontTextureId = resourcePool.pushTexture2D(mint::RenderingBase::DxTextureFormat::R8_UNORM, &rawData[0], textureWidth, textureHeight);
+            _fontData._fontTextureId = resourcePool.pushTexture2D(mint::RenderingBase::DxTextureFormat::R8_UNORM, pixelData, textureWidth, textureHeight);
             return true;
         }
 
@@ -319,7 +323,16 @@ namespace mint
             stbi_write_png(pngFileName.c_str(), textureWidth, textureHeight, 1, &pixelArray[0], textureWidth * 1);
 #endif
 
-            mint::BinaryFileWriter binaryFileWriter;
+            std::string outputFileNameS = outputFileName;
+            mint::StringUtil::excludeExtension(outputFileNameS);
+            outputFileNameS.append(kFontFileExtension);
+
+            mint::BinaryFileStreamWriter binaryFileWriter;
+            if (binaryFileWriter.open(outputFileNameS.c_str()) == false)
+            {
+                MINT_LOG_ERROR("", "FontFile    ϴ: %s", outputFileNameS.c_str());
+                return false;
+            }
             writeMetaData(textureWidth, textureHeight, binaryFileWriter);
 
 #if defined MINT_FONT_RENDERER_COMPRESS_AS_PNG
@@ -332,27 +345,15 @@ namespace mint
             }
 
             binaryFileWriter.write(length);
-            for (int32 at = 0; at < length; ++at)
-            {
-                binaryFileWriter.write(png[at]);
-            }
+            binaryFileWriter.writeSpan(png, static_cast<uint64>(length));
             STBIW_FREE(png);
 #else
             const uint32 pixelCount = static_cast<uint32>(pixelArray.size());
-            binaryFileWriter.write(pixelArray.size());
-            for (uint32 pixelIndex = 0; pixelIndex < pixelCount; ++pixelIndex)
-            {
-                binaryFileWriter.write(pixelArray[pixelIndex]);
-            }
+            binaryFileWriter.write(pixelCount);
+            binaryFileWriter.writeSpan(&pixelArray[0], static_cast<uint64>(pixelCount));
 #endif
 
-            std::string outputFileNameS = outputFileName;
-            mint::StringUtil::excludeExtension(outputFileNameS);
-            outputFileNameS.append(kFontFileExtension);
-
-            binaryFileWriter.save(outputFileNameS.c_str());
-
-            return true;
+            return binaryFileWriter.close();
         }
 
         const FontRendererContext::FontData& FontRendererContext::getFontData() const noexcept
@@ -463,7 +464,7 @@ namespace mint
             }
         }
 
-        void FontRendererContext::writeMetaData(const int16 textureWidth, const int16 textureHeight, mint::BinaryFileWriter& binaryFileWriter) const noexcept
+        void FontRendererContext::writeMetaData(const int16 textureWidth, const int16 textureHeight, mint::BinaryFileStreamWriter& binaryFileWriter) const noexcept
         {
             binaryFileWriter.write("FNT");
             binaryFileWriter.write(textureWidth);
@@ -492,6 +493,7 @@ namespace mint
             _clipRect = _graphicDevice->getFullScreenClipRect();
 
             mint::RenderingBase::DxShaderPool& shaderPool = _graphicDevice->getShaderPool();
+            DxShaderRequest shaderRequests[3];
 
             // Compile vertex shader and create input layer
             {
@@ -526,7 +528,11 @@ namespace mint
                     )"
                 };
                 const CppHlsl::TypeMetaData& typeMetaData = _graphicDevice->getCppHlslSteamData().getTypeMetaData(typeid(mint::RenderingBase::VS_INPUT_SHAPE));
-                _vertexShaderId = shaderPool.pushVertexShaderFromMemory("FontRendererVS", kShaderString, "main", &typeMetaData);
+                shaderRequests[0]._shaderIdentifier = "FontRendererVS";
+                shaderRequests[0]._textContent = kShaderString;
+                shaderRequests[0]._entryPoint = "main";
+                shaderRequests[0]._shaderType = DxShaderType::VertexShader;
+                shaderRequests[0]._inputElementTypeMetaData = &typeMetaData;
             }
 
             {
@@ -546,7 +552,10 @@ namespace mint
                     }
                     )"
                 };
-                _geometryShaderId = shaderPool.pushNonVertexShaderFromMemory("FontRendererGS", kShaderString, "main", DxShaderType::GeometryShader);
+                shaderRequests[1]._shaderIdentifier = "FontRendererGS";
+                shaderRequests[1]._textContent = kShaderString;
+                shaderRequests[1]._entryPoint = "main";
+                shaderRequests[1]._shaderType = DxShaderType::GeometryShader;
             }
 
             // Compile pixel shader
@@ -579,8 +588,17 @@ namespace mint
                     }
                     )"
                 };
-                _pixelShaderId = shaderPool.pushNonVertexShaderFromMemory("FontRendererPS", kShaderString, "main", DxShaderType::PixelShader);
+                shaderRequests[2]._shaderIdentifier = "FontRendererPS";
+                shaderRequests[2]._textContent = kShaderString;
+                shaderRequests[2]._entryPoint = "main";
+                shaderRequests[2]._shaderType = DxShaderType::PixelShader;
             }
+
+            DxObjectId shaderIds[3];
+            shaderPool.pushShaders(shaderRequests, 3, shaderIds);
+            _vertexShaderId = shaderIds[0];
+            _geometryShaderId = shaderIds[1];
+            _pixelShaderId = shaderIds[2];
         }
 
         const bool FontRendererContext::hasData() const noexcept
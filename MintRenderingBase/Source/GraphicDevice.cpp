@@ -28,6 +28,17 @@ namespace mint
         #define MINT_CHECK_TWO_STATES(a, aa, b, bb) if ((a == aa) && (b == bb)) { return; } a = aa; b = bb;
 
 
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(CB_View, _cb2DProjectionMatrix);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(CB_View, _cb3DProjectionMatrix);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(CB_View, _cbViewMatrix);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(CB_View, _cbViewProjectionMatrix);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_SIZE(CB_View);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_MEMBER(CB_Transform, _cbWorldMatrix);
+        MINT_CPP_HLSL_STATIC_ASSERT_CONSTANT_BUFFER_SIZE(CB_Transform);
+        MINT_CPP_HLSL_STATIC_ASSERT_STRUCTURED_BUFFER_STRIDE(SB_Transform);
+        MINT_CPP_HLSL_STATIC_ASSERT_STRUCTURED_BUFFER_STRIDE(SB_Material);
+
+
         SafeResourceMapper::SafeResourceMapper(GraphicDevice* const graphicDevice, ID3D11Resource* const resource, const uint32 subresource)
             : _graphicDevice{ graphicDevice }
             , _resource{ resource }
@@ -474,23 +485,25 @@ namespace mint
 
         void GraphicDevice::initializeShaderHeaderMemory()
         {
+            // CppHlsl 파일이 바뀌지 않았으면 Cache 에서 TypeMetaData 와 Hlsl 을 바로 읽는다.
+            static constexpr const char* const kCppHlslCacheDirectory = "Assets/CppHlslCache/";
+
             const Int2 windowSize = _window->getSize();
 
             // Stream data
             {
-                _cppHlslStreamData.parseCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h");
-                _cppHlslStreamData.generateHlslString(mint::CppHlsl::CppHlslFileType::StreamData);
+                _cppHlslStreamData.interpretCppHlslFile("Assets/CppHlsl/CppHlslStreamData.h", mint::CppHlsl::CppHlslFileType::StreamData, kCppHlslCacheDirectory);
                 _shaderHeaderMemory.pushHeader("ShaderStructDefinitions", _cppHlslStreamData.getHlslString());
             }
 
             // Constant buffers
             {
-                _cppHlslConstantBuffers.parseCppHlslFile("Assets/CppHlsl/CppHlslConstantBuffers.h");
-                _cppHlslConstantBuffers.generateHlslString(mint::CppHlsl::CppHlslFileType::ConstantBuffers);
+                _cppHlslConstantBuffers.interpretCppHlslFile("Assets/CppHlsl/CppHlslConstantBuffers.h", mint::CppHlsl::CppHlslFileType::ConstantBuffers, kCppHlslCacheDirectory);
                 _shaderHeaderMemory.pushHeader("ShaderConstantBuffers", _cppHlslConstantBuffers.getHlslString());
 
                 {
                     const mint::CppHlsl::TypeMetaData& typeMetaData = _cppHlslConstantBuffers.getTypeMetaData(typeid(_cbViewData));
+                    validateCppHlslBufferLayout(typeMetaData, mint::CppHlsl::BufferPackingRule::ConstantBuffer, sizeof(_cbViewData));
                     _cbViewId = _resourcePool.pushConstantBuffer(&_cbViewData, sizeof(_cbViewData), typeMetaData.getRegisterIndex());
                     
                     mint::RenderingBase::DxResource& cbView = _resourcePool.getResource(_cbViewId);
@@ -502,6 +515,7 @@ namespace mint
                 {
                     mint::RenderingBase::CB_Transform cbTransformData;
                     const mint::CppHlsl::TypeMetaData& typeMetaData = _cppHlslConstantBuffers.getTypeMetaData(typeid(cbTransformData));
+                    validateCppHlslBufferLayout(typeMetaData, mint::CppHlsl::BufferPackingRule::ConstantBuffer, sizeof(cbTransformData));
                     _cbTransformId = _resourcePool.pushConstantBuffer(&cbTransformData, sizeof(cbTransformData), typeMetaData.getRegisterIndex());
                 }
 
@@ -510,24 +524,38 @@ namespace mint
 
             // Structured buffers
             {
-                _cppHlslStructuredBuffers.parseCppHlslFile("Assets/CppHlsl/CppHlslStructuredBuffers.h");
-                _cppHlslStructuredBuffers.generateHlslString(mint::CppHlsl::CppHlslFileType::StructuredBuffers);
+                _cppHlslStructuredBuffers.interpretCppHlslFile("Assets/CppHlsl/CppHlslStructuredBuffers.h", mint::CppHlsl::CppHlslFileType::StructuredBuffers, kCppHlslCacheDirectory);
                 _shaderHeaderMemory.pushHeader("ShaderStructuredBufferDefinitions", _cppHlslStructuredBuffers.getHlslString());
 
                 {
                     mint::RenderingBase::SB_Transform sbTransformData;
                     const mint::CppHlsl::TypeMetaData& typeMetaData = _cppHlslStructuredBuffers.getTypeMetaData(typeid(sbTransformData));
+                    validateCppHlslBufferLayout(typeMetaData, mint::CppHlsl::BufferPackingRule::StructuredBuffer, sizeof(sbTransformData));
                     _sbTransformId = _resourcePool.pushStructuredBuffer(&sbTransformData, sizeof(sbTransformData), 1, typeMetaData.getRegisterIndex());
                 }
 
                 {
                     mint::RenderingBase::SB_Material sbMaterialData;
                     const mint::CppHlsl::TypeMetaData& typeMetaData = _cppHlslStructuredBuffers.getTypeMetaData(typeid(sbMaterialData));
+                    validateCppHlslBufferLayout(typeMetaData, mint::CppHlsl::BufferPackingRule::StructuredBuffer, sizeof(sbMaterialData));
                     _sbMaterialId = _resourcePool.pushStructuredBuffer(&sbMaterialData, sizeof(sbMaterialData), 1, typeMetaData.getRegisterIndex());
                 }
             }
         }
 
+        void GraphicDevice::validateCppHlslBufferLayout(const mint::CppHlsl::TypeMetaData& typeMetaData, const mint::CppHlsl::BufferPackingRule packingRule, const uint32 cppTypeSize) noexcept
+        {
+#if defined MINT_DEBUG
+            uint32 mismatchMemberIndex = 0;
+            const bool isValid = mint::CppHlsl::BufferPacking::validateLayout(typeMetaData, packingRule, mismatchMemberIndex);
+            MINT_ASSERT("김장원", isValid == true, "Type[%.*s] 의 %u 번째 멤버가 HLSL layout 과 다릅니다!", static_cast<int32>(typeMetaData.getTypeName().length()), typeMetaData.getTypeName().data(), mismatchMemberIndex);
+            
+            mint::CppHlsl::BufferLayout layout;
+            mint::CppHlsl::BufferPacking::computeLayout(typeMetaData, packingRule, layout);
+            MINT_ASSERT("김장원", layout._size == cppTypeSize, "Type[%.*s] 의 C++ 크기(%u) 가 HLSL 크기(%u) 와 다릅니다!", static_cast<int32>(typeMetaData.getTypeName().length()), typeMetaData.getTypeName().data(), cppTypeSize, layout._size);
+#endif
+        }
+
         void GraphicDevice::initializeShaders()
         {
             _shapeRendererContext.initializeShaders();
@@ -0,0 +1,102 @@
+﻿#include <MintRenderingBase/Include/ShaderCompileQueue.h>
+
+#include <MintContainer/Include/Vector.hpp>
+
+#include <thread>
+#include <vector>
+
+
+namespace mint
+{
+    namespace RenderingBase
+    {
+        ShaderCompileQueue::ShaderCompileQueue(IShaderCompiler& shaderCompiler)
+            : _shaderCompiler{ shaderCompiler }
+            , _nextRequestIndex{ 0 }
+        {
+            __noop;
+        }
+
+        const uint32 ShaderCompileQueue::push(const ShaderCompileRequest& request) noexcept
+        {
+            _requestArray.push_back(request);
+            return _requestArray.size() - 1;
+        }
+
+        void ShaderCompileQueue::clear() noexcept
+        {
+            _requestArray.clear();
+            _resultArray.clear();
+        }
+
+        void ShaderCompileQueue::execute(const uint32 maxWorkerCount) noexcept
+        {
+            const uint32 requestCount = _requestArray.size();
+            _resultArray.clear();
+            _resultArray.resize(requestCount);
+            if (requestCount == 0)
+            {
+                return;
+            }
+
+            _nextRequestIndex.store(0);
+
+            const uint32 hardwareThreadCount = max(std::thread::hardware_concurrency(), 1u);
+            const uint32 workerCount = min(min(hardwareThreadCount, requestCount), (maxWorkerCount == 0) ? kUint32Max : maxWorkerCount);
+            std::vector<std::thread> workerThreads;
+            workerThreads.reserve(workerCount - 1);
+            for (uint32 workerIndex = 1; workerIndex < workerCount; ++workerIndex)
+            {
+                workerThreads.emplace_back(&ShaderCompileQueue::runWorker, this);
+            }
+
+            runWorker();
+
+            for (std::thread& workerThread : workerThreads)
+            {
+                workerThread.join();
+            }
+        }
+
+        const uint32 ShaderCompileQueue::getRequestCount() const noexcept
+        {
+            return _requestArray.size();
+        }
+
+        const ShaderCompileResult& ShaderCompileQueue::getResult(const uint32 requestIndex) const noexcept
+        {
+            MINT_ASSERT("김장원", requestIndex < _resultArray.size(), "execute() 를 먼저 호출해야 합니다!");
+            return _resultArray[requestIndex];
+        }
+
+        const bool ShaderCompileQueue::isAllSucceeded() const noexcept
+        {
+            const uint32 resultCount = _resultArray.size();
+            for (uint32 resultIndex = 0; resultIndex < resultCount; ++resultIndex)
+            {
+                if (_resultArray[resultIndex]._isSucceeded == false)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void ShaderCompileQueue::runWorker() noexcept
+        {
+            // 요청마다 compile 시간이 크게 다르므로 구간을 미리 나누지 않고 하나씩 가져간다.
+            const uint32 requestCount = _requestArray.size();
+            while (true)
+            {
+                const uint32 requestIndex = _nextRequestIndex.fetch_add(1);
+                if (requestCount <= requestIndex)
+                {
+                    break;
+                }
+
+                ShaderCompileResult& result = _resultArray[requestIndex];
+                result._isSucceeded = _shaderCompiler.compile(_requestArray[requestIndex], result);
+            }
+        }
+    }
+}
@@ -0,0 +1,305 @@
+﻿#include <MintRenderingBase/Include/ShaderPermutation.h>
+
+#include <MintContainer/Include/Vector.hpp>
+#include <MintContainer/Include/HashMap.hpp>
+
+
+namespace mint
+{
+    namespace RenderingBase
+    {
+#pragma region Static function definitions
+        static const bool isKeywordCharacter(const char ch) noexcept
+        {
+            return ('a' <= ch && ch <= 'z') || ('A' <= ch && ch <= 'Z') || ('0' <= ch && ch <= '9') || (ch == '_');
+        }
+#pragma endregion
+
+
+        const uint32 ShaderKeywordSet::addKeyword(const std::string_view keyword) noexcept
+        {
+            const uint32 keywordCount = _keywordArray.size();
+            for (uint32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex)
+            {
+                if (_keywordArray[keywordIndex] == keyword)
+                {
+                    return keywordIndex;
+                }
+            }
+
+            if (kMaxKeywordCount <= keywordCount)
+            {
+                MINT_LOG("김장원", "Keyword [%.*s] 를 추가할 수 없습니다. Keyword 는 최대 %u 개입니다!", static_cast<int32>(keyword.length()), keyword.data(), kMaxKeywordCount);
+                return kUint32Max;
+            }
+
+            _keywordArray.push_back(std::string(keyword));
+            return keywordCount;
+        }
+
+        const uint32 ShaderKeywordSet::parseDeclaration(const std::string_view source) noexcept
+        {
+            const std::string_view declarationPrefix{ kDeclarationPrefix };
+            const uint32 oldKeywordCount = _keywordArray.size();
+            uint64 at = source.find(declarationPrefix);
+            while (at != std::string_view::npos)
+            {
+                at += declarationPrefix.length();
+                while (at < source.length() && source[at] != '\n')
+                {
+                    if (isKeywordCharacter(source[at]) == false)
+                    {
+                        ++at;
+                        continue;
+                    }
+
+                    const uint64 keywordBegin = at;
+                    while (at < source.length() && isKeywordCharacter(source[at]) == true)
+                    {
+                        ++at;
+                    }
+                    addKeyword(source.substr(keywordBegin, at - keywordBegin));
+                }
+                at = source.find(declarationPrefix, at);
+            }
+            return _keywordArray.size() - oldKeywordCount;
+        }
+
+        void ShaderKeywordSet::clear() noexcept
+        {
+            _keywordArray.clear();
+        }
+
+        const uint32 ShaderKeywordSet::getKeywordCount() const noexcept
+        {
+            return _keywordArray.size();
+        }
+
+        const std::string& ShaderKeywordSet::getKeyword(const uint32 keywordIndex) const noexcept
+        {
+            return _keywordArray[keywordIndex];
+        }
+
+        const ShaderKeywordMask ShaderKeywordSet::getKeywordMask(const std::string_view keyword) const noexcept
+        {
+            const uint32 keywordCount = _keywordArray.size();
+            for (uint32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex)
+            {
+                if (_keywordArray[keywordIndex] == keyword)
+                {
+                    return static_cast<ShaderKeywordMask>(1) << keywordIndex;
+                }
+            }
+            return 0;
+        }
+
+        const ShaderKeywordMask ShaderKeywordSet::getDeclaredMask() const noexcept
+        {
+            // Keyword 가 64 개일 때 1 << 64 가 되지 않도록 한 bit 씩 켠다.
+            ShaderKeywordMask declaredMask = 0;
+            const uint32 keywordCount = _keywordArray.size();
+            for (uint32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex)
+            {
+                declaredMask |= static_cast<ShaderKeywordMask>(1) << keywordIndex;
+            }
+            return declaredMask;
+        }
+
+        void ShaderKeywordSet::makeDefinitionPrefix(const ShaderKeywordMask keywordMask, std::string& outPrefix) const noexcept
+        {
+            outPrefix.clear();
+            if (keywordMask == 0)
+            {
+                return;
+            }
+
+            const uint32 keywordCount = _keywordArray.size();
+            for (uint32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex)
+            {
+                if ((keywordMask & (static_cast<ShaderKeywordMask>(1) << keywordIndex)) != 0)
+                {
+                    outPrefix.append("#define ");
+                    outPrefix.append(_keywordArray[keywordIndex]);
+                    outPrefix.append(" 1\n");
+                }
+            }
+            outPrefix.append("#line 1\n");
+        }
+
+        void ShaderKeywordSet::makeDefines(const ShaderKeywordMask keywordMask, mint::Vector<std::string_view>& outDefines) const noexcept
+        {
+            outDefines.clear();
+
+            const uint32 keywordCount = _keywordArray.size();
+            for (uint32 keywordIndex = 0; keywordIndex < keywordCount; ++keywordIndex)
+            {
+                if ((keywordMask & (static_cast<ShaderKeywordMask>(1) << keywordIndex)) != 0)
+                {
+                    outDefines.push_back(_keywordArray[keywordIndex]);
+                }
+            }
+        }
+
+
+        ShaderPermutationCache::ShaderPermutationCache(IShaderCompiler& shaderCompiler)
+            : _shaderCompiler{ &shaderCompiler }
+        {
+            __noop;
+        }
+
+        const uint32 ShaderPermutationCache::registerShader(const std::string_view identifier, const std::string_view source, const std::string_view entryPoint, const std::string_view targetProfile) noexcept
+        {
+            PermutationShader permutationShader;
+            permutationShader._identifier = identifier;
+            permutationShader._source = source;
+            permutationShader._entryPoint = entryPoint;
+            permutationShader._targetProfile = targetProfile;
+            permutationShader._keywordSet.parseDeclaration(permutationShader._source);
+            _shaderArray.push_back(std::move(permutationShader));
+            return _shaderArray.size() - 1;
+        }
+
+        const bool ShaderPermutationCache::updateSource(const uint32 shaderIndex, const std::string_view source) noexcept
+        {
+            PermutationShader& permutationShader = _shaderArray[shaderIndex];
+            if (permutationShader._source == source)
+            {
+                return false;
+            }
+
+            permutationShader._source = source;
+            permutationShader._keywordSet.clear();
+            permutationShader._keywordSet.parseDeclaration(permutationShader._source);
+            permutationShader._variantIndexMap.clear();
+            permutationShader._variantArray.clear();
+            return true;
+        }
+
+        void ShaderPermutationCache::setShaderCompiler(IShaderCompiler& shaderCompiler) noexcept
+        {
+            _shaderCompiler = &shaderCompiler;
+        }
+
+        const uint32 ShaderPermutationCache::getShaderCount() const noexcept
+        {
+            return _shaderArray.size();
+        }
+
+        const ShaderKeywordSet& ShaderPermutationCache::getKeywordSet(const uint32 shaderIndex) const noexcept
+        {
+            return _shaderArray[shaderIndex]._keywordSet;
+        }
+
+        const std::string& ShaderPermutationCache::getSource(const uint32 shaderIndex) const noexcept
+        {
+            return _shaderArray[shaderIndex]._source;
+        }
+
+        void ShaderPermutationCache::makeVariantSource(const uint32 shaderIndex, const ShaderKeywordMask keywordMask, std::string& outVariantSource) const noexcept
+        {
+            const PermutationShader& permutationShader = _shaderArray[shaderIndex];
+            permutationShader._keywordSet.makeDefinitionPrefix(validateKeywordMask(permutationShader, keywordMask), outVariantSource);
+            outVariantSource.append(permutationShader._source);
+        }
+
+        const ShaderCompileResult& ShaderPermutationCache::getVariant(const uint32 shaderIndex, const ShaderKeywordMask keywordMask) noexcept
+        {
+            PermutationShader& permutationShader = _shaderArray[shaderIndex];
+            const ShaderKeywordMask validKeywordMask = validateKeywordMask(permutationShader, keywordMask);
+            const KeyValuePair<ShaderKeywordMask, uint32> keyValuePair = permutationShader._variantIndexMap.find(validKeywordMask);
+            if (keyValuePair.isValid() == true)
+            {
+                return permutationShader._variantArray[*keyValuePair._value];
+            }
+
+            std::string variantSource;
+            makeVariantSource(shaderIndex, validKeywordMask, variantSource);
+            ShaderCompileRequest compileRequest;
+            makeCompileRequest(permutationShader, variantSource, compileRequest);
+
+            ShaderCompileResult compileResult;
+            compileResult._isSucceeded = _shaderCompiler->compile(compileRequest, compileResult);
+            permutationShader._variantArray.push_back(std::move(compileResult));
+
+            const uint32 variantIndex = permutationShader._variantArray.size() - 1;
+            permutationShader._variantIndexMap.insert(validKeywordMask, variantIndex);
+            return permutationShader._variantArray[variantIndex];
+        }
+
+        const bool ShaderPermutationCache::hasVariant(const uint32 shaderIndex, const ShaderKeywordMask keywordMask) const noexcept
+        {
+            const PermutationShader& permutationShader = _shaderArray[shaderIndex];
+            return permutationShader._variantIndexMap.contains(validateKeywordMask(permutationShader, keywordMask));
+        }
+
+        const uint32 ShaderPermutationCache::getVariantCount(const uint32 shaderIndex) const noexcept
+        {
+            return _shaderArray[shaderIndex]._variantArray.size();
+        }
+
+        void ShaderPermutationCache::compileVariants(const uint32 shaderIndex, const ShaderKeywordMask* const keywordMasks, const uint32 keywordMaskCount, const uint32 maxWorkerCount) noexcept
+        {
+            PermutationShader& permutationShader = _shaderArray[shaderIndex];
+
+            // compileQueue 가 source 들을 가리키므로 크기를 미리 정해 두고 다시 할당하지 않는다.
+            mint::Vector<std::string> variantSources(keywordMaskCount);
+            mint::Vector<ShaderKeywordMask> pendingKeywordMasks;
+            ShaderCompileQueue compileQueue{ *_shaderCompiler };
+            for (uint32 keywordMaskIndex = 0; keywordMaskIndex < keywordMaskCount; ++keywordMaskIndex)
+            {
+                const ShaderKeywordMask validKeywordMask = validateKeywordMask(permutationShader, keywordMasks[keywordMaskIndex]);
+                if (permutationShader._variantIndexMap.contains(validKeywordMask) == true)
+                {
+                    continue;
+                }
+
+                bool isAlreadyPending = false;
+                const uint32 pendingKeywordMaskCount = pendingKeywordMasks.size();
+                for (uint32 pendingKeywordMaskIndex = 0; pendingKeywordMaskIndex < pendingKeywordMaskCount; ++pendingKeywordMaskIndex)
+                {
+                    if (pendingKeywordMasks[pendingKeywordMaskIndex] == validKeywordMask)
+                    {
+                        isAlreadyPending = true;
+                        break;
+                    }
+                }
+                if (isAlreadyPending == true)
+                {
+                    continue;
+                }
+
+                std::string& variantSource = variantSources[pendingKeywordMasks.size()];
+                makeVariantSource(shaderIndex, validKeywordMask, variantSource);
+                ShaderCompileRequest compileRequest;
+                makeCompileRequest(permutationShader, variantSource, compileRequest);
+                compileQueue.push(compileRequest);
+                pendingKeywordMasks.push_back(validKeywordMask);
+            }
+
+            compileQueue.execute(maxWorkerCount);
+
+            const uint32 pendingKeywordMaskCount = pendingKeywordMasks.size();
+            for (uint32 pendingKeywordMaskIndex = 0; pendingKeywordMaskIndex < pendingKeywordMaskCount; ++pendingKeywordMaskIndex)
+            {
+                permutationShader._variantArray.push_back(compileQueue.getResult(pendingKeywordMaskIndex));
+                permutationShader._variantIndexMap.insert(pendingKeywordMasks[pendingKeywordMaskIndex], permutationShader._variantArray.size() - 1);
+            }
+        }
+
+        const ShaderKeywordMask ShaderPermutationCache::validateKeywordMask(const PermutationShader& permutationShader, const ShaderKeywordMask keywordMask) const noexcept
+        {
+            // 선언되지 않은 Keyword 는 결과에 영향이 없으므로 같은 variant 로 취급한다.
+            const ShaderKeywordMask declaredMask = permutationShader._keywordSet.getDeclaredMask();
+            MINT_ASSERT("김장원", (keywordMask & ~declaredMask) == 0, "[%s] 가 선언하지 않은 Keyword 가 mask 에 있습니다!", permutationShader._identifier.c_str());
+            return keywordMask & declaredMask;
+        }
+
+        void ShaderPermutationCache::makeCompileRequest(const PermutationShader& permutationShader, const std::string& variantSource, ShaderCompileRequest& outRequest) const noexcept
+        {
+            outRequest._identifier = permutationShader._identifier;
+            outRequest._source = variantSource;
+            outRequest._entryPoint = permutationShader._entryPoint;
+            outRequest._targetProfile = permutationShader._targetProfile;
+        }
+    }
+}
@@ -4,6 +4,7 @@
 #include <MintRenderingBase/Include/GraphicDevice.h>
 #include <MintRenderingBase/Include/LowLevelRenderer.hpp>
 
+#include <MintMath/Include/FastMath.h>
 #include <MintMath/Include/Float2x2.h>
 #include <MintMath/Include/Float3x3.h>
 
@@ -30,6 +31,7 @@ namespace mint
             _clipRect = _graphicDevice->getFullScreenClipRect();
 
             mint::RenderingBase::DxShaderPool& shaderPool = _graphicDevice->getShaderPool();
+            DxShaderRequest shaderRequests[3];
 
             {
                 static constexpr const char kShaderString[]
@@ -62,7 +64,11 @@ namespace mint
                     )"
                 };
                 const CppHlsl::TypeMetaData& typeMetaData = _graphicDevice->getCppHlslSteamData().getTypeMetaData(typeid(mint::RenderingBase::VS_INPUT_SHAPE));
-                _vertexShaderId = shaderPool.pushVertexShaderFromMemory("ShapeRendererVS", kShaderString, "main_shape", &typeMetaData);
+                shaderRequests[0]._shaderIdentifier = "ShapeRendererVS";
+                shaderRequests[0]._textContent = kShaderString;
+                shaderRequests[0]._entryPoint = "main_shape";
+                shaderRequests[0]._shaderType = DxShaderType::VertexShader;
+                shaderRequests[0]._inputElementTypeMetaData = &typeMetaData;
             }
 
             {
@@ -82,7 +88,10 @@ namespace mint
                     }
                     )"
                 };
-                _geometryShaderId = shaderPool.pushNonVertexShaderFromMemory("ShapeRendererGS", kShaderString, "main_shape", DxShaderType::GeometryShader);
+                shaderRequests[1]._shaderIdentifier = "ShapeRendererGS";
+                shaderRequests[1]._textContent = kShaderString;
+                shaderRequests[1]._entryPoint = "main_shape";
+                shaderRequests[1]._shaderType = DxShaderType::GeometryShader;
             }
 
             {
@@ -136,8 +145,17 @@ namespace mint
                     }
                     )"
                 };
-                _pixelShaderId = shaderPool.pushNonVertexShaderFromMemory("ShapeRendererPS", kShaderString, "main_shape", DxShaderType::PixelShader);
+                shaderRequests[2]._shaderIdentifier = "ShapeRendererPS";
+                shaderRequests[2]._textContent = kShaderString;
+                shaderRequests[2]._entryPoint = "main_shape";
+                shaderRequests[2]._shaderType = DxShaderType::PixelShader;
             }
+
+            DxObjectId shaderIds[3];
+            shaderPool.pushShaders(shaderRequests, 3, shaderIds);
+            _vertexShaderId = shaderIds[0];
+            _geometryShaderId = shaderIds[1];
+            _pixelShaderId = shaderIds[2];
         }
 
         const bool ShapeRendererContext::hasData() const noexcept
@@ -487,8 +505,9 @@ namespace mint
         {
             static constexpr uint32 kDeltaVertexCount = 6;
             const float halfArcAngle = mint::Math::clamp(arcAngle, 0.0f, mint::Math::kPi) * 0.5f;
-            const float sinHalfArcAngle = sin(halfArcAngle);
-            const float cosHalfArcAngle = cos(halfArcAngle);
+            float sinHalfArcAngle;
+            float cosHalfArcAngle;
+            mint::Math::sinCos<mint::Math::Precision::Fast>(halfArcAngle, sinHalfArcAngle, cosHalfArcAngle);
             const uint32 vertexOffset = _lowLevelRenderer->getVertexCount();
             const uint32 indexOffset = _lowLevelRenderer->getIndexCount();
 
@@ -572,8 +591,9 @@ namespace mint
         {
             static constexpr uint32 kDeltaVertexCount = 13;
             const float halfArcAngle = mint::Math::clamp(arcAngle, 0.0f, mint::Math::kPi) * 0.5f;
-            const float sinHalfArcAngle = sin(halfArcAngle);
-            const float cosHalfArcAngle = cos(halfArcAngle);
+            float sinHalfArcAngle;
+            float cosHalfArcAngle;
+            mint::Math::sinCos<mint::Math::Precision::Fast>(halfArcAngle, sinHalfArcAngle, cosHalfArcAngle);
             const float tanHalfArcAngle = tan(halfArcAngle);
             const uint32 vertexOffset = _lowLevelRenderer->getVertexCount();
             const uint32 indexOffset = _lowLevelRenderer->getIndexCount();
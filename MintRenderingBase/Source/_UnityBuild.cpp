@@ -7,12 +7,8 @@
 #include <MintRenderingBase/Source/IRendererContext.cpp>
 #include <MintRenderingBase/Source/MeshData.cpp>
 #include <MintRenderingBase/Source/RenderingBaseCommon.cpp>
+#include <MintRenderingBase/Source/ShaderCompileQueue.cpp>
+#include <MintRenderingBase/Source/ShaderPermutation.cpp>
 #include <MintRenderingBase/Source/ShapeFontRendererContext.cpp>
 #include <MintRenderingBase/Source/ShapeRendererContext.cpp>
-#include <MintRenderingBase/Source/CppHlsl/ILexer.cpp>
-#include <MintRenderingBase/Source/CppHlsl/Interpreter.cpp>
-#include <MintRenderingBase/Source/CppHlsl/IParser.cpp>
-#include <MintRenderingBase/Source/CppHlsl/Lexer.cpp>
-#include <MintRenderingBase/Source/CppHlsl/Parser.cpp>
-#include <MintRenderingBase/Source/CppHlsl/Tokenizer.cpp>
 #include <MintRenderingBase/Source/Gui/GuiContext.cpp>